@@ -48,10 +48,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     std::unique_ptr<vk::raii::Device> device = vk::raii::su::makeUniqueDevice(
       *physicalDevice, graphicsAndPresentQueueFamilyIndex.first, vk::su::getDeviceExtensions() );
 
-    std::unique_ptr<vk::raii::CommandPool> commandPool =
-      vk::raii::su::makeUniqueCommandPool( *device, graphicsAndPresentQueueFamilyIndex.first );
-    std::unique_ptr<vk::raii::CommandBuffer> commandBuffer =
-      vk::raii::su::makeUniqueCommandBuffer( *device, *commandPool );
+    vk::raii::su::FramesInFlight framesInFlight( *physicalDevice, *device, graphicsAndPresentQueueFamilyIndex.first );
 
     std::unique_ptr<vk::raii::Queue> graphicsQueue =
       vk::raii::su::make_unique<vk::raii::Queue>( *device, graphicsAndPresentQueueFamilyIndex.first, 0 );
@@ -73,7 +70,7 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     vk::raii::su::TextureData textureData( *physicalDevice, *device );
 
-    commandBuffer->begin( vk::CommandBufferBeginInfo() );
+    std::unique_ptr<vk::raii::CommandBuffer> const & commandBuffer = framesInFlight.beginFrame().commandBuffer;
     textureData.setImage( *commandBuffer, vk::su::CheckerboardImageGenerator() );
 
     vk::raii::su::BufferData uniformBufferData(
@@ -137,16 +134,13 @@ int main( int /*argc*/, char ** /*argv*/ )
     /* VULKAN_KEY_START */
 
     // Get the index of the next available swapchain image:
-    std::unique_ptr<vk::raii::Semaphore> imageAcquiredSemaphore =
-      vk::raii::su::make_unique<vk::raii::Semaphore>( *device, vk::SemaphoreCreateInfo() );
     vk::Result result;
     uint32_t   imageIndex;
-    std::tie( result, imageIndex ) =
-      swapChainData.swapChain->acquireNextImage( vk::su::FenceTimeout, **imageAcquiredSemaphore );
+    std::tie( result, imageIndex ) = framesInFlight.acquireNextImage( *swapChainData.swapChain );
     assert( result == vk::Result::eSuccess );
     assert( imageIndex < swapChainData.images.size() );
 
-    // commandBuffer->begin() has already been called above!
+    // framesInFlight.beginFrame() has already begun the commandBuffer above!
 
     std::array<vk::ClearValue, 2> clearValues;
     clearValues[0].color        = vk::ClearColorValue( std::array<float, 4>( { { 0.2f, 0.2f, 0.2f, 0.2f } } ) );
@@ -170,19 +164,11 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     commandBuffer->draw( 12 * 3, 1, 0, 0 );
     commandBuffer->endRenderPass();
-    commandBuffer->end();
 
-    std::unique_ptr<vk::raii::Fence> drawFence = vk::raii::su::make_unique<vk::raii::Fence>( *device, vk::FenceCreateInfo() );
+    // Submit the command buffer, waiting on the acquired image; the presentation waits on the rendering, not the CPU
+    framesInFlight.submit( *graphicsQueue, vk::PipelineStageFlagBits::eColorAttachmentOutput );
 
-    vk::PipelineStageFlags waitDestinationStageMask( vk::PipelineStageFlagBits::eColorAttachmentOutput );
-    vk::SubmitInfo         submitInfo( **imageAcquiredSemaphore, waitDestinationStageMask, **commandBuffer );
-    graphicsQueue->submit( submitInfo, **drawFence );
-
-    while ( vk::Result::eTimeout == device->waitForFences( { **drawFence }, VK_TRUE, vk::su::FenceTimeout ) )
-      ;
-
-    vk::PresentInfoKHR presentInfoKHR( nullptr, **swapChainData.swapChain, imageIndex );
-    result = presentQueue->presentKHR( presentInfoKHR );
+    result = framesInFlight.present( *presentQueue, *swapChainData.swapChain, imageIndex );
     switch ( result )
     {
       case vk::Result::eSuccess: break;
@@ -194,6 +180,8 @@ int main( int /*argc*/, char ** /*argv*/ )
     std::this_thread::sleep_for( std::chrono::milliseconds( 1000 ) );
 
     /* VULKAN_KEY_END */
+
+    device->waitIdle();
   }
   catch ( vk::SystemError & err )
   {
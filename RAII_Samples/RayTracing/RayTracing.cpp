@@ -196,15 +196,6 @@ AccelerationStructureData createAccelerationStructureData(
   return accelerationStructureData;
 }
 
-struct PerFrameData
-{
-  std::unique_ptr<vk::raii::CommandPool>   commandPool;
-  std::unique_ptr<vk::raii::CommandBuffer> commandBuffer;
-  std::unique_ptr<vk::raii::Fence>         fence;
-  std::unique_ptr<vk::raii::Semaphore>     presentCompleteSemaphore;
-  std::unique_ptr<vk::raii::Semaphore>     renderCompleteSemaphore;
-};
-
 struct UniformBufferObject
 {
   glm::mat4 model;
@@ -746,19 +737,12 @@ int main( int /*argc*/, char ** /*argv*/ )
                                       &supportedFeatures.get<vk::PhysicalDeviceDescriptorIndexingFeaturesEXT>() );
 
     // setup stuff per frame
-    std::array<PerFrameData, IMGUI_VK_QUEUED_FRAMES> perFrameData;
-    for ( int i = 0; i < IMGUI_VK_QUEUED_FRAMES; i++ )
-    {
-      perFrameData[i].commandPool =
-        vk::raii::su::makeUniqueCommandPool( *device, graphicsAndPresentQueueFamilyIndex.first );
-      perFrameData[i].commandBuffer = vk::raii::su::makeUniqueCommandBuffer( *device, *perFrameData[i].commandPool );
-      perFrameData[i].fence =
-        vk::raii::su::make_unique<vk::raii::Fence>( *device, vk::FenceCreateInfo( vk::FenceCreateFlagBits::eSignaled ) );
-      perFrameData[i].presentCompleteSemaphore =
-        vk::raii::su::make_unique<vk::raii::Semaphore>( *device, vk::SemaphoreCreateInfo() );
-      perFrameData[i].renderCompleteSemaphore =
-        vk::raii::su::make_unique<vk::raii::Semaphore>( *device, vk::SemaphoreCreateInfo() );
-    }
+    vk::raii::su::FramesInFlight framesInFlight(
+      *physicalDevice, *device, graphicsAndPresentQueueFamilyIndex.first, IMGUI_VK_QUEUED_FRAMES );
+
+    // a separate command pool for the one-time submits during setup
+    std::unique_ptr<vk::raii::CommandPool> commandPool =
+      vk::raii::su::makeUniqueCommandPool( *device, graphicsAndPresentQueueFamilyIndex.first );
 
     std::unique_ptr<vk::raii::Queue> graphicsQueue =
       vk::raii::su::make_unique<vk::raii::Queue>( *device, graphicsAndPresentQueueFamilyIndex.first, 0 );
@@ -812,7 +796,7 @@ int main( int /*argc*/, char ** /*argv*/ )
                              true );
     }
     vk::raii::su::oneTimeSubmit(
-      *device, *perFrameData[0].commandPool, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
+      *device, *commandPool, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
         for ( auto & t : textures )
         {
           t.setImage(
@@ -871,7 +855,7 @@ int main( int /*argc*/, char ** /*argv*/ )
                                                bufferUsageFlags,
                                                vk::MemoryPropertyFlagBits::eDeviceLocal );
     vertexBufferData.upload(
-      *physicalDevice, *device, *perFrameData[0].commandPool, *graphicsQueue, vertices, VertexStride );
+      *physicalDevice, *device, *commandPool, *graphicsQueue, vertices, VertexStride );
 
     bufferUsageFlags = vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eIndexBuffer |
                        vk::BufferUsageFlagBits::eStorageBuffer;
@@ -881,7 +865,7 @@ int main( int /*argc*/, char ** /*argv*/ )
                                               bufferUsageFlags,
                                               vk::MemoryPropertyFlagBits::eDeviceLocal );
     indexBufferData.upload(
-      *physicalDevice, *device, *perFrameData[0].commandPool, *graphicsQueue, indices, sizeof( uint32_t ) );
+      *physicalDevice, *device, *commandPool, *graphicsQueue, indices, sizeof( uint32_t ) );
 
     // clang-format off
     glm::mat4x4 transform( glm::mat4x4( 1.0f, 0.0f, 0.0f, 0.0f,
@@ -944,7 +928,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     // create acceleration structures: one top-level, and just one bottom-level
     AccelerationStructureData topLevelAS, bottomLevelAS;
     vk::raii::su::oneTimeSubmit(
-      *device, *perFrameData[0].commandPool, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
+      *device, *commandPool, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
         vk::GeometryDataNV geometryDataNV( vk::GeometryTrianglesNV( **vertexBufferData.buffer,
                                                                     0,
                                                                     vk::su::checked_cast<uint32_t>( vertices.size() ),
@@ -972,7 +956,7 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     // create raytracing descriptor set
     vk::raii::su::oneTimeSubmit(
-      *device, *perFrameData[0].commandPool, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
+      *device, *commandPool, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
         vk::BufferMemoryBarrier bufferMemoryBarrier( {},
                                                      vk::AccessFlagBits::eShaderRead,
                                                      VK_QUEUE_FAMILY_IGNORED,
@@ -1185,7 +1169,6 @@ int main( int /*argc*/, char ** /*argv*/ )
     clearValues[1].depthStencil = vk::ClearDepthStencilValue( 1.0f, 0 );
 
     // Main loop
-    uint32_t            frameIndex = 0;
     UniformBufferObject uniformBufferObject;
     uniformBufferObject.model   = glm::mat4( 1 );
     uniformBufferObject.modelIT = glm::inverseTranspose( uniformBufferObject.model );
@@ -1197,7 +1180,8 @@ int main( int /*argc*/, char ** /*argv*/ )
       double startTime = glfwGetTime();
       glfwPollEvents();
 
-      vk::raii::CommandBuffer const & commandBuffer = *perFrameData[frameIndex].commandBuffer;
+      // frame begin: wait for the frame that used this slot last time, then begin its command buffer
+      vk::raii::CommandBuffer const & commandBuffer = *framesInFlight.beginFrame().commandBuffer;
 
       int w, h;
       glfwGetWindowSize( window, &w, &h );
@@ -1218,14 +1202,12 @@ int main( int /*argc*/, char ** /*argv*/ )
         depthBufferData = vk::raii::su::DepthBufferData(
           *physicalDevice, *device, vk::su::pickDepthFormat( **physicalDevice ), windowExtent );
 
-        vk::raii::su::oneTimeSubmit(
-          commandBuffer, *graphicsQueue, [&]( vk::raii::CommandBuffer const & commandBuffer ) {
-            vk::raii::su::setImageLayout( commandBuffer,
-                                          **depthBufferData.image,
-                                          depthFormat,
-                                          vk::ImageLayout::eUndefined,
-                                          vk::ImageLayout::eDepthStencilAttachmentOptimal );
-          } );
+        // the transition of the new depth buffer is recorded into this frame's command buffer
+        vk::raii::su::setImageLayout( commandBuffer,
+                                      **depthBufferData.image,
+                                      depthFormat,
+                                      vk::ImageLayout::eUndefined,
+                                      vk::ImageLayout::eDepthStencilAttachmentOptimal );
 
         framebuffers = vk::raii::su::makeUniqueFramebuffers(
           *device, *renderPass, swapChainData.imageViews, depthBufferData.imageView, windowExtent );
@@ -1241,20 +1223,11 @@ int main( int /*argc*/, char ** /*argv*/ )
       uniformBufferObject.projInverse = glm::inverse( uniformBufferObject.proj );
       uniformBufferData.upload( uniformBufferObject );
 
-      // frame begin
       vk::Result result;
       uint32_t   backBufferIndex;
-      std::tie( result, backBufferIndex ) = swapChainData.swapChain->acquireNextImage(
-        vk::su::FenceTimeout, **perFrameData[frameIndex].presentCompleteSemaphore );
+      std::tie( result, backBufferIndex ) = framesInFlight.acquireNextImage( *swapChainData.swapChain );
       assert( result == vk::Result::eSuccess );
 
-      while ( vk::Result::eTimeout ==
-              device->waitForFences( { **perFrameData[frameIndex].fence }, VK_TRUE, vk::su::FenceTimeout ) )
-        ;
-      device->resetFences( { **perFrameData[frameIndex].fence } );
-
-      commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
-
       if ( appInfo.useRasterRender )
       {
         vk::RenderPassBeginInfo renderPassBeginInfo( **renderPass,
@@ -1327,16 +1300,8 @@ int main( int /*argc*/, char ** /*argv*/ )
       }
 
       // frame end
-      commandBuffer.end();
-      const vk::PipelineStageFlags waitDestinationStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-      vk::SubmitInfo               submitInfo( **perFrameData[frameIndex].presentCompleteSemaphore,
-                                 waitDestinationStageMask,
-                                 *commandBuffer,
-                                 **perFrameData[frameIndex].renderCompleteSemaphore );
-      graphicsQueue->submit( submitInfo, **perFrameData[frameIndex].fence );
-      vk::PresentInfoKHR presentInfoKHR(
-        **perFrameData[frameIndex].renderCompleteSemaphore, **swapChainData.swapChain, backBufferIndex );
-      result = presentQueue->presentKHR( presentInfoKHR );
+      framesInFlight.submit( *graphicsQueue, vk::PipelineStageFlagBits::eColorAttachmentOutput );
+      result = framesInFlight.present( *presentQueue, *swapChainData.swapChain, backBufferIndex );
       switch ( result )
       {
         case vk::Result::eSuccess: break;
@@ -1345,7 +1310,6 @@ int main( int /*argc*/, char ** /*argv*/ )
           break;
         default: assert( false );  // an unexpected result is returned !
       }
-      frameIndex = ( frameIndex + 1 ) % IMGUI_VK_QUEUED_FRAMES;
 
       double endTime = glfwGetTime();
       accumulatedTime += endTime - startTime;
@@ -28,7 +28,19 @@
 #include "../../samples/utils/utils.hpp"
 #include "vulkan/vulkan_raii.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <iomanip>
+#include <limits>
+#include <new>
 #include <numeric>
+#include <sstream>
+#include <tuple>
+#include <type_traits>
 
 namespace vk
 {
@@ -175,7 +187,7 @@ namespace vk
         if ( newImageLayout == vk::ImageLayout::eDepthStencilAttachmentOptimal )
         {
           aspectMask = vk::ImageAspectFlagBits::eDepth;
-          if ( format == vk::Format::eD32SfloatS8Uint || format == vk::Format::eD24UnormS8Uint )
+          if ( vk::getFormatTraits( format ).hasStencilComponent )
           {
             aspectMask |= vk::ImageAspectFlagBits::eStencil;
           }
@@ -339,117 +351,1786 @@ namespace vk
         {}
       };
 
+      // Creates buffers and images in bulk, and binds them to a few shared allocations with one bindBufferMemory2 and
+      // one bindImageMemory2 call per bindMemory, instead of one allocation and one bindMemory per resource as with
+      // BufferData and ImageData. Resources created with identical create infos have identical memory requirements, so
+      // they are queried only once per distinct create info without a pNext chain. The resources added since the last
+      // bindMemory are placed per memory type into blocks of up to blockSize bytes; a resource larger than that gets a
+      // block on its own. Needs a Vulkan 1.1 device, and the batch has to be destroyed before the device.
+      class ResourceBatch
+      {
+      public:
+        struct MemoryRange
+        {
+          vk::raii::DeviceMemory const * deviceMemory;
+          vk::DeviceSize                 offset;
+          vk::DeviceSize                 size;
+        };
+
+        ResourceBatch( vk::raii::PhysicalDevice const & physicalDevice,
+                       vk::raii::Device const &         device,
+                       vk::MemoryPropertyFlags          propertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal,
+                       vk::DeviceSize                   blockSize     = 256 * 1024 * 1024 )
+          : m_device( device )
+          , m_memoryProperties( physicalDevice.getMemoryProperties() )
+          , m_bufferImageGranularity( physicalDevice.getProperties().limits.bufferImageGranularity )
+          , m_propertyFlags( propertyFlags )
+          , m_blockSize( blockSize )
+          , m_boundBufferCount( 0 )
+          , m_boundImageCount( 0 )
+          , m_queryCount( 0 )
+        {}
+
+        // creates the buffers and returns the index of the first one; their memory is bound by the next bindMemory
+        size_t addBuffers( vk::ArrayProxy<const vk::BufferCreateInfo> const & createInfos )
+        {
+          size_t firstIndex = m_buffers.size();
+          for ( auto const & createInfo : createInfos )
+          {
+            m_buffers.emplace_back( m_device, createInfo );
+            m_bufferBindings.push_back( Binding( getMemoryRequirements( m_buffers.back(), createInfo ), false ) );
+          }
+          return firstIndex;
+        }
+
+        // creates the images and returns the index of the first one; their memory is bound by the next bindMemory
+        size_t addImages( vk::ArrayProxy<const vk::ImageCreateInfo> const & createInfos )
+        {
+          size_t firstIndex = m_images.size();
+          for ( auto const & createInfo : createInfos )
+          {
+            m_images.emplace_back( m_device, createInfo );
+            m_imageBindings.push_back( Binding( getMemoryRequirements( m_images.back(), createInfo ),
+                                                createInfo.tiling == vk::ImageTiling::eLinear ) );
+          }
+          return firstIndex;
+        }
+
+        // allocates the memory for the resources added since the last call, and binds them all in one go
+        void bindMemory()
+        {
+          std::vector<Block> blocks;
+          std::map<uint32_t, size_t> currentBlocks;  // memory type index -> index into blocks
+          for ( size_t i = m_boundBufferCount; i < m_bufferBindings.size(); i++ )
+          {
+            place( m_bufferBindings[i], true, blocks, currentBlocks );
+          }
+          for ( size_t i = m_boundImageCount; i < m_imageBindings.size(); i++ )
+          {
+            place( m_imageBindings[i], m_imageBindings[i].isLinear, blocks, currentBlocks );
+          }
+
+          size_t firstMemoryIndex = m_deviceMemories.size();
+          for ( auto const & block : blocks )
+          {
+            m_deviceMemories.emplace_back( m_device, vk::MemoryAllocateInfo( block.size, block.memoryTypeIndex ) );
+          }
+
+          std::vector<vk::BindBufferMemoryInfo> bindBufferMemoryInfos;
+          bindBufferMemoryInfos.reserve( m_bufferBindings.size() - m_boundBufferCount );
+          for ( ; m_boundBufferCount < m_bufferBindings.size(); m_boundBufferCount++ )
+          {
+            Binding & binding = m_bufferBindings[m_boundBufferCount];
+            binding.memoryIndex += firstMemoryIndex;
+            bindBufferMemoryInfos.push_back( vk::BindBufferMemoryInfo(
+              *m_buffers[m_boundBufferCount], *m_deviceMemories[binding.memoryIndex], binding.offset ) );
+          }
+          std::vector<vk::BindImageMemoryInfo> bindImageMemoryInfos;
+          bindImageMemoryInfos.reserve( m_imageBindings.size() - m_boundImageCount );
+          for ( ; m_boundImageCount < m_imageBindings.size(); m_boundImageCount++ )
+          {
+            Binding & binding = m_imageBindings[m_boundImageCount];
+            binding.memoryIndex += firstMemoryIndex;
+            bindImageMemoryInfos.push_back( vk::BindImageMemoryInfo(
+              *m_images[m_boundImageCount], *m_deviceMemories[binding.memoryIndex], binding.offset ) );
+          }
+
+          if ( !bindBufferMemoryInfos.empty() )
+          {
+            m_device.bindBufferMemory2( bindBufferMemoryInfos );
+          }
+          if ( !bindImageMemoryInfos.empty() )
+          {
+            m_device.bindImageMemory2( bindImageMemoryInfos );
+          }
+        }
+
+        vk::raii::Buffer const & getBuffer( size_t index ) const
+        {
+          return m_buffers[index];
+        }
+
+        vk::raii::Image const & getImage( size_t index ) const
+        {
+          return m_images[index];
+        }
+
+        // the memory a buffer is bound to, to map it or to upload to it
+        MemoryRange getBufferMemory( size_t index ) const
+        {
+          assert( index < m_boundBufferCount );
+          return getMemoryRange( m_bufferBindings[index] );
+        }
+
+        MemoryRange getImageMemory( size_t index ) const
+        {
+          assert( index < m_boundImageCount );
+          return getMemoryRange( m_imageBindings[index] );
+        }
+
+        size_t getBufferCount() const
+        {
+          return m_buffers.size();
+        }
+
+        size_t getImageCount() const
+        {
+          return m_images.size();
+        }
+
+        size_t getAllocationCount() const
+        {
+          return m_deviceMemories.size();
+        }
+
+        // the number of getMemoryRequirements calls that went to the driver
+        size_t getMemoryRequirementsQueryCount() const
+        {
+          return m_queryCount;
+        }
+
+      private:
+        struct Binding
+        {
+          Binding( vk::MemoryRequirements const & memoryRequirements_, bool isLinear_ )
+            : memoryRequirements( memoryRequirements_ ), isLinear( isLinear_ ), memoryIndex( 0 ), offset( 0 )
+          {}
+
+          vk::MemoryRequirements memoryRequirements;
+          bool                   isLinear;
+          size_t                 memoryIndex;
+          vk::DeviceSize         offset;
+        };
+
+        struct Block
+        {
+          uint32_t       memoryTypeIndex;
+          vk::DeviceSize size;
+          bool           lastIsLinear;
+        };
+
+        typedef std::tuple<VkBufferCreateFlags, vk::DeviceSize, VkBufferUsageFlags> BufferKey;
+        typedef std::tuple<VkImageCreateFlags,
+                           VkImageType,
+                           VkFormat,
+                           uint32_t,
+                           uint32_t,
+                           uint32_t,
+                           uint32_t,
+                           uint32_t,
+                           VkSampleCountFlags,
+                           VkImageTiling,
+                           VkImageUsageFlags>
+          ImageKey;
+
+        vk::MemoryRequirements getMemoryRequirements( vk::raii::Buffer const &     buffer,
+                                                      vk::BufferCreateInfo const & createInfo )
+        {
+          if ( createInfo.pNext || ( createInfo.sharingMode != vk::SharingMode::eExclusive ) )
+          {
+            m_queryCount++;
+            return buffer.getMemoryRequirements();
+          }
+          BufferKey key( static_cast<VkBufferCreateFlags>( createInfo.flags ),
+                         createInfo.size,
+                         static_cast<VkBufferUsageFlags>( createInfo.usage ) );
+          auto it = m_bufferRequirements.find( key );
+          if ( it == m_bufferRequirements.end() )
+          {
+            m_queryCount++;
+            it = m_bufferRequirements.insert( std::make_pair( key, buffer.getMemoryRequirements() ) ).first;
+          }
+          return it->second;
+        }
+
+        vk::MemoryRequirements getMemoryRequirements( vk::raii::Image const &     image,
+                                                      vk::ImageCreateInfo const & createInfo )
+        {
+          if ( createInfo.pNext || ( createInfo.sharingMode != vk::SharingMode::eExclusive ) )
+          {
+            m_queryCount++;
+            return image.getMemoryRequirements();
+          }
+          ImageKey key( static_cast<VkImageCreateFlags>( createInfo.flags ),
+                        static_cast<VkImageType>( createInfo.imageType ),
+                        static_cast<VkFormat>( createInfo.format ),
+                        createInfo.extent.width,
+                        createInfo.extent.height,
+                        createInfo.extent.depth,
+                        createInfo.mipLevels,
+                        createInfo.arrayLayers,
+                        static_cast<VkSampleCountFlags>( createInfo.samples ),
+                        static_cast<VkImageTiling>( createInfo.tiling ),
+                        static_cast<VkImageUsageFlags>( createInfo.usage ) );
+          auto it = m_imageRequirements.find( key );
+          if ( it == m_imageRequirements.end() )
+          {
+            m_queryCount++;
+            it = m_imageRequirements.insert( std::make_pair( key, image.getMemoryRequirements() ) ).first;
+          }
+          return it->second;
+        }
+
+        // assigns the resource a block and an offset in it, respecting its alignment and, next to a resource of the
+        // other kind of linear and non-linear, the bufferImageGranularity
+        void place( Binding &                    binding,
+                    bool                         isLinear,
+                    std::vector<Block> &         blocks,
+                    std::map<uint32_t, size_t> & currentBlocks )
+        {
+          vk::MemoryRequirements const & memoryRequirements = binding.memoryRequirements;
+          uint32_t                       memoryTypeIndex =
+            vk::su::findMemoryType( m_memoryProperties, memoryRequirements.memoryTypeBits, m_propertyFlags );
+
+          auto           blockIt    = currentBlocks.find( memoryTypeIndex );
+          size_t         blockIndex = blocks.size();
+          vk::DeviceSize offset     = 0;
+          if ( blockIt != currentBlocks.end() )
+          {
+            Block const &  block     = blocks[blockIt->second];
+            vk::DeviceSize alignment = memoryRequirements.alignment;
+            if ( block.lastIsLinear != isLinear )
+            {
+              alignment = ( std::max )( alignment, m_bufferImageGranularity );
+            }
+            offset = ( block.size + alignment - 1 ) / alignment * alignment;
+            if ( offset + memoryRequirements.size <= m_blockSize )
+            {
+              blockIndex = blockIt->second;
+            }
+            else
+            {
+              offset = 0;
+            }
+          }
+          if ( blockIndex == blocks.size() )
+          {
+            Block block = { memoryTypeIndex, 0, isLinear };
+            blocks.push_back( block );
+            currentBlocks[memoryTypeIndex] = blockIndex;
+          }
+
+          blocks[blockIndex].size         = offset + memoryRequirements.size;
+          blocks[blockIndex].lastIsLinear = isLinear;
+          binding.memoryIndex             = blockIndex;
+          binding.offset                  = offset;
+        }
+
+        MemoryRange getMemoryRange( Binding const & binding ) const
+        {
+          MemoryRange memoryRange = { &m_deviceMemories[binding.memoryIndex],
+                                      binding.offset,
+                                      binding.memoryRequirements.size };
+          return memoryRange;
+        }
+
+      private:
+        vk::raii::Device const &                    m_device;
+        vk::PhysicalDeviceMemoryProperties          m_memoryProperties;
+        vk::DeviceSize                              m_bufferImageGranularity;
+        vk::MemoryPropertyFlags                     m_propertyFlags;
+        vk::DeviceSize                              m_blockSize;
+        std::deque<vk::raii::DeviceMemory>          m_deviceMemories;  // declared first, to be freed last
+        std::deque<vk::raii::Buffer>                m_buffers;
+        std::deque<vk::raii::Image>                 m_images;
+        std::vector<Binding>                        m_bufferBindings;
+        std::vector<Binding>                        m_imageBindings;
+        size_t                                      m_boundBufferCount;
+        size_t                                      m_boundImageCount;
+        std::map<BufferKey, vk::MemoryRequirements> m_bufferRequirements;
+        std::map<ImageKey, vk::MemoryRequirements>  m_imageRequirements;
+        size_t                                      m_queryCount;
+      };
+
       struct SurfaceData
       {
-        SurfaceData( vk::raii::Instance const & instance, std::string const & windowName, vk::Extent2D const & extent_ )
-          : extent( extent_ ), window( vk::su::createWindow( windowName, extent ) )
+        SurfaceData( vk::raii::Instance const & instance, std::string const & windowName, vk::Extent2D const & extent_ )
+          : extent( extent_ ), window( vk::su::createWindow( windowName, extent ) )
+        {
+          VkSurfaceKHR _surface;
+          VkResult     err =
+            glfwCreateWindowSurface( static_cast<VkInstance>( *instance ), window.handle, nullptr, &_surface );
+          if ( err != VK_SUCCESS )
+            throw std::runtime_error( "Failed to create window!" );
+          surface = vk::raii::su::make_unique<vk::raii::SurfaceKHR>( instance, _surface );
+        }
+
+        vk::Extent2D                          extent;
+        vk::su::WindowData                    window;
+        std::unique_ptr<vk::raii::SurfaceKHR> surface;
+      };
+
+      // Creates a swapchain for surface, with a view per image. Its extent is the current extent of the surface, or, if
+      // that's undefined, the requested extent clamped to the supported ones. That extent is returned; if it's zero, as
+      // the window is minimized, nothing is created.
+      inline vk::Extent2D createSwapchain( vk::raii::PhysicalDevice const &          physicalDevice,
+                                           vk::raii::Device const &                  device,
+                                           vk::SurfaceKHR const &                    surface,
+                                           vk::SurfaceFormatKHR const &              surfaceFormat,
+                                           vk::PresentModeKHR                        presentMode,
+                                           vk::Extent2D const &                      extent,
+                                           vk::ImageUsageFlags                       usage,
+                                           vk::SwapchainKHR const &                  oldSwapchain,
+                                           uint32_t                                  graphicsQueueFamilyIndex,
+                                           uint32_t                                  presentQueueFamilyIndex,
+                                           std::unique_ptr<vk::raii::SwapchainKHR> & swapchain,
+                                           std::vector<VkImage> &                    images,
+                                           std::vector<vk::raii::ImageView> &        imageViews )
+      {
+        vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR( surface );
+        vk::Extent2D               swapchainExtent;
+        if ( surfaceCapabilities.currentExtent.width == std::numeric_limits<uint32_t>::max() )
+        {
+          // If the surface size is undefined, the size is set to the size of the images requested.
+          swapchainExtent.width = vk::su::clamp(
+            extent.width, surfaceCapabilities.minImageExtent.width, surfaceCapabilities.maxImageExtent.width );
+          swapchainExtent.height = vk::su::clamp(
+            extent.height, surfaceCapabilities.minImageExtent.height, surfaceCapabilities.maxImageExtent.height );
+        }
+        else
+        {
+          // If the surface size is defined, the swap chain size must match
+          swapchainExtent = surfaceCapabilities.currentExtent;
+        }
+        if ( ( swapchainExtent.width == 0 ) || ( swapchainExtent.height == 0 ) )
+        {
+          return swapchainExtent;
+        }
+
+        vk::SurfaceTransformFlagBitsKHR preTransform =
+          ( surfaceCapabilities.supportedTransforms & vk::SurfaceTransformFlagBitsKHR::eIdentity )
+            ? vk::SurfaceTransformFlagBitsKHR::eIdentity
+            : surfaceCapabilities.currentTransform;
+        vk::CompositeAlphaFlagBitsKHR compositeAlpha =
+          ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePreMultiplied )
+            ? vk::CompositeAlphaFlagBitsKHR::ePreMultiplied
+          : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePostMultiplied )
+            ? vk::CompositeAlphaFlagBitsKHR::ePostMultiplied
+          : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::eInherit )
+            ? vk::CompositeAlphaFlagBitsKHR::eInherit
+            : vk::CompositeAlphaFlagBitsKHR::eOpaque;
+        vk::SwapchainCreateInfoKHR swapChainCreateInfo( {},
+                                                        surface,
+                                                        surfaceCapabilities.minImageCount,
+                                                        surfaceFormat.format,
+                                                        surfaceFormat.colorSpace,
+                                                        swapchainExtent,
+                                                        1,
+                                                        usage,
+                                                        vk::SharingMode::eExclusive,
+                                                        {},
+                                                        preTransform,
+                                                        compositeAlpha,
+                                                        presentMode,
+                                                        true,
+                                                        oldSwapchain );
+        uint32_t queueFamilyIndices[2] = { graphicsQueueFamilyIndex, presentQueueFamilyIndex };
+        if ( graphicsQueueFamilyIndex != presentQueueFamilyIndex )
+        {
+          // If the graphics and present queues are from different queue families, we either have to explicitly
+          // transfer ownership of images between the queues, or we have to create the swapchain with imageSharingMode
+          // as vk::SharingMode::eConcurrent
+          swapChainCreateInfo.imageSharingMode      = vk::SharingMode::eConcurrent;
+          swapChainCreateInfo.queueFamilyIndexCount = 2;
+          swapChainCreateInfo.pQueueFamilyIndices   = queueFamilyIndices;
+        }
+        swapchain = vk::raii::su::make_unique<vk::raii::SwapchainKHR>( device, swapChainCreateInfo );
+
+        images = swapchain->getImages();
+
+        imageViews.clear();
+        imageViews.reserve( images.size() );
+        vk::ComponentMapping componentMapping(
+          vk::ComponentSwizzle::eR, vk::ComponentSwizzle::eG, vk::ComponentSwizzle::eB, vk::ComponentSwizzle::eA );
+        vk::ImageSubresourceRange subResourceRange( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
+        for ( auto image : images )
+        {
+          vk::ImageViewCreateInfo imageViewCreateInfo( {},
+                                                       static_cast<vk::Image>( image ),
+                                                       vk::ImageViewType::e2D,
+                                                       surfaceFormat.format,
+                                                       componentMapping,
+                                                       subResourceRange );
+          imageViews.emplace_back( device, imageViewCreateInfo );
+        }
+        return swapchainExtent;
+      }
+
+      struct SwapChainData
+      {
+        SwapChainData( vk::raii::PhysicalDevice const &                physicalDevice,
+                       vk::raii::Device const &                        device,
+                       vk::raii::SurfaceKHR const &                    surface,
+                       vk::Extent2D const &                            extent,
+                       vk::ImageUsageFlags                             usage,
+                       std::unique_ptr<vk::raii::SwapchainKHR> const & oldSwapchain,
+                       uint32_t                                        graphicsQueueFamilyIndex,
+                       uint32_t                                        presentQueueFamilyIndex )
+        {
+          vk::SurfaceFormatKHR surfaceFormat =
+            vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( *surface ) );
+          colorFormat = surfaceFormat.format;
+
+          vk::Extent2D swapchainExtent =
+            createSwapchain( physicalDevice,
+                             device,
+                             *surface,
+                             surfaceFormat,
+                             vk::su::pickPresentMode( physicalDevice.getSurfacePresentModesKHR( *surface ) ),
+                             extent,
+                             usage,
+                             oldSwapchain ? **oldSwapchain : nullptr,
+                             graphicsQueueFamilyIndex,
+                             presentQueueFamilyIndex,
+                             swapChain,
+                             images,
+                             imageViews );
+          if ( ( swapchainExtent.width == 0 ) || ( swapchainExtent.height == 0 ) )
+          {
+            throw std::runtime_error( "Failed to create a swapchain for a surface with zero extent!" );
+          }
+        }
+
+        vk::Format                              colorFormat;
+        std::unique_ptr<vk::raii::SwapchainKHR> swapChain;
+        std::vector<VkImage>                    images;
+        std::vector<vk::raii::ImageView>        imageViews;
+      };
+
+      struct FrameData
+      {
+        FrameData( vk::raii::PhysicalDevice const & physicalDevice,
+                   vk::raii::Device const &         device,
+                   uint32_t                         queueFamilyIndex,
+                   vk::DeviceSize                   transientBufferSize_ )
+          : transientBufferSize( transientBufferSize_ ), transientOffset( 0 ), transientData( nullptr )
+        {
+          // the command pool is reset as a whole per frame, so there's no need for eResetCommandBuffer
+          commandPool = vk::raii::su::make_unique<vk::raii::CommandPool>(
+            device, vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eTransient, queueFamilyIndex ) );
+          commandBuffer = vk::raii::su::make_unique<vk::raii::CommandBuffer>( std::move(
+            vk::raii::CommandBuffers( device, { **commandPool, vk::CommandBufferLevel::ePrimary, 1 } ).front() ) );
+          // the fence starts signaled, such that the very first beginFrame doesn't block
+          fence = vk::raii::su::make_unique<vk::raii::Fence>(
+            device, vk::FenceCreateInfo( vk::FenceCreateFlagBits::eSignaled ) );
+          imageAcquiredSemaphore  = vk::raii::su::make_unique<vk::raii::Semaphore>( device, vk::SemaphoreCreateInfo() );
+          renderCompleteSemaphore = vk::raii::su::make_unique<vk::raii::Semaphore>( device, vk::SemaphoreCreateInfo() );
+          if ( 0 < transientBufferSize )
+          {
+            transientBufferData = vk::raii::su::make_unique<BufferData>(
+              physicalDevice,
+              device,
+              transientBufferSize,
+              vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eStorageBuffer |
+                vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer |
+                vk::BufferUsageFlagBits::eTransferSrc );
+            transientData = transientBufferData->deviceMemory->mapMemory( 0, transientBufferSize );
+          }
+        }
+
+        // linear sub-allocation out of the persistently mapped transient buffer; everything handed out is invalidated
+        // with the next reset of this frame
+        vk::su::TransientAllocation allocateTransient( vk::DeviceSize size, vk::DeviceSize alignment = 16 )
+        {
+          assert( transientBufferData );
+          assert( ( 0 < alignment ) && !( alignment & ( alignment - 1 ) ) );
+          vk::DeviceSize offset = ( transientOffset + alignment - 1 ) & ~( alignment - 1 );
+          if ( transientBufferSize < offset + size )
+          {
+            throw std::runtime_error( "FrameData: out of transient memory" );
+          }
+          transientOffset = offset + size;
+          return { **transientBufferData->buffer, offset, static_cast<uint8_t *>( transientData ) + offset };
+        }
+
+        std::unique_ptr<vk::raii::CommandPool>   commandPool;
+        std::unique_ptr<vk::raii::CommandBuffer> commandBuffer;
+        std::unique_ptr<vk::raii::Fence>         fence;
+        std::unique_ptr<vk::raii::Semaphore>     imageAcquiredSemaphore;
+        std::unique_ptr<vk::raii::Semaphore>     renderCompleteSemaphore;
+        std::unique_ptr<BufferData>              transientBufferData;
+        vk::DeviceSize                           transientBufferSize;
+        vk::DeviceSize                           transientOffset;
+        void *                                   transientData;
+      };
+
+      // A ring of frameCount FrameData, allowing the CPU to record frame n + 1 while the GPU is still working on frame
+      // n. Per frame, the sequence is beginFrame -> [acquireNextImage] -> record -> submit -> [present].
+      class FramesInFlight
+      {
+      public:
+        FramesInFlight( vk::raii::PhysicalDevice const & physicalDevice,
+                        vk::raii::Device const &         device,
+                        uint32_t                         queueFamilyIndex,
+                        uint32_t                         frameCount          = 2,
+                        vk::DeviceSize                   transientBufferSize = 0 )
+          : m_device( device ), m_frameIndex( 0 ), m_submittedFrameIndex( 0 ), m_imageAcquired( false )
+        {
+          assert( 0 < frameCount );
+          m_frames.reserve( frameCount );
+          for ( uint32_t i = 0; i < frameCount; i++ )
+          {
+            m_frames.push_back(
+              vk::raii::su::make_unique<FrameData>( physicalDevice, device, queueFamilyIndex, transientBufferSize ) );
+          }
+        }
+
+        // waits for the GPU to finish the previous use of the current frame, then resets its fence, command pool and
+        // transient allocations and begins its command buffer
+        FrameData & beginFrame()
+        {
+          FrameData & frame = *m_frames[m_frameIndex];
+          while ( vk::Result::eTimeout == m_device.waitForFences( { **frame.fence }, VK_TRUE, vk::su::FenceTimeout ) )
+            ;
+          m_device.resetFences( { **frame.fence } );
+          frame.commandPool->reset();
+          frame.transientOffset = 0;
+          m_imageAcquired       = false;
+
+          frame.commandBuffer->begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+          return frame;
+        }
+
+        std::pair<vk::Result, uint32_t> acquireNextImage( vk::raii::SwapchainKHR const & swapChain )
+        {
+          // the imageAcquiredSemaphore is guaranteed to be unsignaled here, as beginFrame waited for the submission
+          // that consumed it the last time
+          std::pair<vk::Result, uint32_t> rv =
+            swapChain.acquireNextImage( vk::su::FenceTimeout, **m_frames[m_frameIndex]->imageAcquiredSemaphore );
+          m_imageAcquired = ( rv.first == vk::Result::eSuccess ) || ( rv.first == vk::Result::eSuboptimalKHR );
+          return rv;
+        }
+
+        // ends the command buffer and submits it, waiting on an acquired image (if any) and signaling the frame fence
+        void submit( vk::raii::Queue const & queue,
+                     vk::PipelineStageFlags  waitDstStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput )
+        {
+          FrameData & frame = *m_frames[m_frameIndex];
+          frame.commandBuffer->end();
+
+          vk::Semaphore     imageAcquiredSemaphore  = **frame.imageAcquiredSemaphore;
+          vk::Semaphore     renderCompleteSemaphore = **frame.renderCompleteSemaphore;
+          vk::CommandBuffer commandBuffer           = **frame.commandBuffer;
+          vk::SubmitInfo    submitInfo( m_imageAcquired ? 1 : 0,
+                                     &imageAcquiredSemaphore,
+                                     &waitDstStageMask,
+                                     1,
+                                     &commandBuffer,
+                                     m_imageAcquired ? 1 : 0,
+                                     &renderCompleteSemaphore );
+          queue.submit( submitInfo, **frame.fence );
+
+          m_submittedFrameIndex = m_frameIndex;
+          m_frameIndex          = ( m_frameIndex + 1 ) % frameCount();
+        }
+
+        vk::Result present( vk::raii::Queue const & queue, vk::raii::SwapchainKHR const & swapChain, uint32_t imageIndex )
+        {
+          assert( m_imageAcquired );
+          m_imageAcquired = false;
+          return queue.presentKHR(
+            vk::PresentInfoKHR( **m_frames[m_submittedFrameIndex]->renderCompleteSemaphore, *swapChain, imageIndex ) );
+        }
+
+        // waits for all frames in flight, without idling the queue
+        void waitIdle() const
+        {
+          std::vector<vk::Fence> fences;
+          fences.reserve( m_frames.size() );
+          for ( auto const & frame : m_frames )
+          {
+            fences.push_back( **frame->fence );
+          }
+          while ( vk::Result::eTimeout == m_device.waitForFences( fences, VK_TRUE, vk::su::FenceTimeout ) )
+            ;
+        }
+
+        FrameData & currentFrame()
+        {
+          return *m_frames[m_frameIndex];
+        }
+
+        uint32_t frameCount() const
+        {
+          return static_cast<uint32_t>( m_frames.size() );
+        }
+
+        uint32_t frameIndex() const
+        {
+          return m_frameIndex;
+        }
+
+      private:
+        vk::raii::Device const &                m_device;
+        std::vector<std::unique_ptr<FrameData>> m_frames;
+        uint32_t                                m_frameIndex;
+        uint32_t                                m_submittedFrameIndex;
+        bool                                    m_imageAcquired;
+      };
+
+      // Measures nested scopes of the recorded commands on the GPU with timestamp queries, and reports them on the
+      // std::chrono::steady_clock timeline. There's one query pool per frame in flight. beginFrame reads back the
+      // results of the previous use of the current pool with one vkGetQueryPoolResults, and resets it. Those results
+      // are available without stalling as soon as the frame fence has been waited on, as in
+      // FramesInFlight::beginFrame; a frame with results still not available is dropped instead of waited on.
+      // With VK_EXT_calibrated_timestamps enabled and the host time domain eClockMonotonic supported, the GPU ticks are
+      // calibrated against CLOCK_MONOTONIC, which is the clock of std::chrono::steady_clock with libstdc++ and libc++.
+      // Otherwise, the first timestamp read is simply mapped to the time it was read, so the GPU scopes are ordered
+      // correctly among each other, but just roughly aligned with the CPU.
+      class GpuProfiler
+      {
+      public:
+        struct Scope
+        {
+          std::string name;
+          uint32_t    depth;  // the number of enclosing scopes
+          uint64_t    frame;
+          int64_t     beginNs;
+          int64_t     endNs;
+        };
+
+        GpuProfiler( vk::raii::PhysicalDevice const & physicalDevice,
+                     vk::raii::Device const &         device,
+                     uint32_t                         queueFamilyIndex,
+                     uint32_t                         frameCount              = 2,
+                     uint32_t                         maxScopesPerFrame       = 256,
+                     bool                             useCalibratedTimestamps = false,
+                     bool                             useSynchronization2     = false )
+          : m_device( device )
+          , m_maxQueryCount( 2 * maxScopesPerFrame )
+          , m_useSynchronization2( useSynchronization2 )
+          , m_calibrated( false )
+          , m_timestampPeriod( physicalDevice.getProperties().limits.timestampPeriod )
+          , m_frameIndex( 0 )
+          , m_frameNumber( 0 )
+          , m_droppedFrameCount( 0 )
+          , m_droppedScopeCount( 0 )
+          , m_referenceTicks( 0 )
+          , m_referenceNs( 0 )
+          , m_hasReference( false )
+        {
+          assert( ( 0 < frameCount ) && ( 0 < maxScopesPerFrame ) );
+          std::vector<vk::QueueFamilyProperties> queueFamilyProperties = physicalDevice.getQueueFamilyProperties();
+          assert( queueFamilyIndex < queueFamilyProperties.size() );
+          uint32_t timestampValidBits = queueFamilyProperties[queueFamilyIndex].timestampValidBits;
+          if ( timestampValidBits == 0 )
+          {
+            throw std::runtime_error( "GpuProfiler: the queue family does not support timestamps" );
+          }
+          m_timestampMask =
+            ( timestampValidBits < 64 ) ? ( ( uint64_t( 1 ) << timestampValidBits ) - 1 ) : ~uint64_t( 0 );
+
+          if ( useCalibratedTimestamps )
+          {
+            std::vector<vk::TimeDomainEXT> timeDomains = physicalDevice.getCalibrateableTimeDomainsEXT();
+            auto supports = [&timeDomains]( vk::TimeDomainEXT timeDomain ) {
+              return std::find( timeDomains.begin(), timeDomains.end(), timeDomain ) != timeDomains.end();
+            };
+            m_calibrated = supports( vk::TimeDomainEXT::eDevice ) && supports( vk::TimeDomainEXT::eClockMonotonic );
+          }
+
+          m_frames.resize( frameCount );
+          m_queryPools.reserve( frameCount );
+          for ( uint32_t i = 0; i < frameCount; i++ )
+          {
+            m_queryPools.emplace_back( device,
+                                       vk::QueryPoolCreateInfo( {}, vk::QueryType::eTimestamp, m_maxQueryCount ) );
+          }
+        }
+
+        // collects the results of the previous use of the current query pool and resets it
+        void beginFrame( vk::raii::CommandBuffer const & commandBuffer )
+        {
+          FrameQueries & frame = m_frames[m_frameIndex];
+          if ( frame.pending && !readResults( m_frameIndex ) )
+          {
+            m_droppedFrameCount++;
+          }
+          commandBuffer.resetQueryPool( *m_queryPools[m_frameIndex], 0, m_maxQueryCount );
+          frame.scopes.clear();
+          frame.queryCount = 0;
+          frame.frame      = m_frameNumber;
+          frame.pending    = false;
+        }
+
+        // scopes have to be closed in the same frame; scopes beyond maxScopesPerFrame are dropped
+        void beginScope( vk::raii::CommandBuffer const & commandBuffer, std::string const & name )
+        {
+          FrameQueries & frame = m_frames[m_frameIndex];
+          if ( m_maxQueryCount < frame.queryCount + 2 )
+          {
+            m_openScopes.push_back( ~size_t( 0 ) );
+            m_droppedScopeCount++;
+            return;
+          }
+
+          m_openScopes.push_back( frame.scopes.size() );
+          frame.scopes.push_back(
+            { name, static_cast<uint32_t>( m_openScopes.size() - 1 ), frame.queryCount, frame.queryCount + 1 } );
+          frame.queryCount += 2;
+          writeTimestamp( commandBuffer, true, frame.scopes.back().beginQuery );
+        }
+
+        void endScope( vk::raii::CommandBuffer const & commandBuffer )
+        {
+          assert( !m_openScopes.empty() );
+          size_t scopeIndex = m_openScopes.back();
+          m_openScopes.pop_back();
+          if ( scopeIndex != ~size_t( 0 ) )
+          {
+            writeTimestamp( commandBuffer, false, m_frames[m_frameIndex].scopes[scopeIndex].endQuery );
+          }
+        }
+
+        void endFrame()
+        {
+          assert( m_openScopes.empty() );
+          m_frames[m_frameIndex].pending = !m_frames[m_frameIndex].scopes.empty();
+          m_frameIndex                   = ( m_frameIndex + 1 ) % static_cast<uint32_t>( m_frames.size() );
+          m_frameNumber++;
+        }
+
+        // collects the results of all the frames that are available by now, without waiting for the others
+        void collect()
+        {
+          for ( size_t i = 0; i < m_frames.size(); i++ )
+          {
+            // oldest frame first, such that the scopes are sorted by frame
+            size_t frameIndex = ( m_frameIndex + i ) % m_frames.size();
+            if ( m_frames[frameIndex].pending )
+            {
+              readResults( frameIndex );
+            }
+          }
+        }
+
+        std::vector<Scope> const & getScopes() const
+        {
+          return m_scopes;
+        }
+
+        void clearScopes()
+        {
+          m_scopes.clear();
+        }
+
+        uint64_t getDroppedFrameCount() const
+        {
+          return m_droppedFrameCount;
+        }
+
+        uint64_t getDroppedScopeCount() const
+        {
+          return m_droppedScopeCount;
+        }
+
+        bool isCalibrated() const
+        {
+          return m_calibrated;
+        }
+
+        // the collected scopes as complete events in the Chrome trace event format, to be loaded into chrome://tracing
+        // or Perfetto
+        std::string toChromeTrace() const
+        {
+          std::ostringstream oss;
+          // the timestamps are in microseconds; the nesting is derived from the time ranges
+          oss << std::fixed << std::setprecision( 3 ) << "{\"traceEvents\":[\n"
+              << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"GPU\"}}";
+          for ( auto const & scope : m_scopes )
+          {
+            oss << ",\n{\"name\":\"" << escapeJson( scope.name )
+                << "\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":" << scope.beginNs / 1000.0
+                << ",\"dur\":" << ( scope.endNs - scope.beginNs ) / 1000.0 << ",\"args\":{\"frame\":" << scope.frame
+                << ",\"depth\":" << scope.depth << "}}";
+          }
+          oss << "\n],\"displayTimeUnit\":\"ns\"}\n";
+          return oss.str();
+        }
+
+      private:
+        struct PendingScope
+        {
+          std::string name;
+          uint32_t    depth;
+          uint32_t    beginQuery;
+          uint32_t    endQuery;
+        };
+
+        struct FrameQueries
+        {
+          std::vector<PendingScope> scopes;
+          uint32_t                  queryCount = 0;
+          uint64_t                  frame      = 0;
+          bool                      pending    = false;  // submitted, but not yet read back
+        };
+
+        static std::string escapeJson( std::string const & text )
+        {
+          std::string escaped;
+          for ( char c : text )
+          {
+            if ( ( c == '"' ) || ( c == '\\' ) )
+            {
+              escaped += '\\';
+              escaped += c;
+            }
+            else if ( static_cast<unsigned char>( c ) < 0x20 )
+            {
+              char buffer[8];
+              snprintf( buffer, sizeof( buffer ), "\\u%04x", static_cast<unsigned>( static_cast<unsigned char>( c ) ) );
+              escaped += buffer;
+            }
+            else
+            {
+              escaped += c;
+            }
+          }
+          return escaped;
+        }
+
+        void writeTimestamp( vk::raii::CommandBuffer const & commandBuffer, bool begin, uint32_t query ) const
+        {
+          if ( m_useSynchronization2 )
+          {
+            commandBuffer.writeTimestamp2KHR( begin ? vk::PipelineStageFlagBits2KHR::eTopOfPipe
+                                                    : vk::PipelineStageFlagBits2KHR::eBottomOfPipe,
+                                              *m_queryPools[m_frameIndex],
+                                              query );
+          }
+          else
+          {
+            commandBuffer.writeTimestamp(
+              begin ? vk::PipelineStageFlagBits::eTopOfPipe : vk::PipelineStageFlagBits::eBottomOfPipe,
+              *m_queryPools[m_frameIndex],
+              query );
+          }
+        }
+
+        // the difference of two timestamps of timestampValidBits, which might have wrapped around
+        int64_t tickDelta( uint64_t ticks, uint64_t referenceTicks ) const
+        {
+          uint64_t delta = ( ticks - referenceTicks ) & m_timestampMask;
+          return ( delta <= ( m_timestampMask >> 1 ) )
+                 ? static_cast<int64_t>( delta )
+                 : -static_cast<int64_t>( ( referenceTicks - ticks ) & m_timestampMask );
+        }
+
+        int64_t toNanoseconds( uint64_t ticks ) const
+        {
+          return m_referenceNs + static_cast<int64_t>( std::llround( tickDelta( ticks, m_referenceTicks ) *
+                                                                     static_cast<double>( m_timestampPeriod ) ) );
+        }
+
+        bool readResults( size_t frameIndex )
+        {
+          FrameQueries & frame = m_frames[frameIndex];
+          assert( frame.pending );
+
+          // all queries of a frame at once, without vk::QueryResultFlagBits::eWait
+          std::pair<vk::Result, std::vector<uint64_t>> results =
+            m_queryPools[frameIndex].getResults<uint64_t>( 0,
+                                                           frame.queryCount,
+                                                           frame.queryCount * sizeof( uint64_t ),
+                                                           sizeof( uint64_t ),
+                                                           vk::QueryResultFlagBits::e64 );
+          if ( results.first == vk::Result::eNotReady )
+          {
+            return false;
+          }
+
+          if ( m_calibrated )
+          {
+            // recalibrated per frame, to follow the drift between the clocks
+            std::pair<std::vector<uint64_t>, uint64_t> calibration = m_device.getCalibratedTimestampsEXT(
+              { vk::CalibratedTimestampInfoEXT( vk::TimeDomainEXT::eDevice ),
+                vk::CalibratedTimestampInfoEXT( vk::TimeDomainEXT::eClockMonotonic ) } );
+            m_referenceTicks = calibration.first[0] & m_timestampMask;
+            m_referenceNs    = static_cast<int64_t>( calibration.first[1] );
+          }
+          else if ( !m_hasReference )
+          {
+            m_referenceTicks = results.second[frame.scopes.front().beginQuery] & m_timestampMask;
+            m_referenceNs    = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch() )
+                              .count();
+            m_hasReference = true;
+          }
+
+          for ( auto const & scope : frame.scopes )
+          {
+            m_scopes.push_back( { scope.name,
+                                  scope.depth,
+                                  frame.frame,
+                                  toNanoseconds( results.second[scope.beginQuery] & m_timestampMask ),
+                                  toNanoseconds( results.second[scope.endQuery] & m_timestampMask ) } );
+          }
+          frame.pending = false;
+          return true;
+        }
+
+        vk::raii::Device const &         m_device;
+        std::vector<vk::raii::QueryPool> m_queryPools;
+        std::vector<FrameQueries>        m_frames;
+        std::vector<size_t>              m_openScopes;  // indices into the scopes of the current frame
+        std::vector<Scope>               m_scopes;
+        uint32_t                         m_maxQueryCount;
+        bool                             m_useSynchronization2;
+        bool                             m_calibrated;
+        float                            m_timestampPeriod;
+        uint64_t                         m_timestampMask;
+        uint32_t                         m_frameIndex;
+        uint64_t                         m_frameNumber;
+        uint64_t                         m_droppedFrameCount;
+        uint64_t                         m_droppedScopeCount;
+        uint64_t                         m_referenceTicks;
+        int64_t                          m_referenceNs;
+        bool                             m_hasReference;
+      };
+
+      template <typename T>
+      struct IsPoolAllocated
+        : std::integral_constant<bool,
+                                 std::is_same<T, vk::raii::CommandBuffer>::value ||
+                                   std::is_same<T, vk::raii::CommandBuffers>::value ||
+                                   std::is_same<T, vk::raii::DescriptorSet>::value ||
+                                   std::is_same<T, vk::raii::DescriptorSets>::value>
+      {};
+
+      template <typename T>
+      struct IsPoolAllocated<std::unique_ptr<T>> : IsPoolAllocated<T>
+      {};
+
+      // Keeps raii handles alive until the GPU is done with them, instead of destroying them right away. retire moves
+      // a handle into the queue, tagged with a point on a GPU timeline: the number of a frame that is complete once
+      // its fence has been waited on, or the value a timeline semaphore is signaled with by the last submission using
+      // the handle. collect destroys all the handles up to the completed point in one batch, either on the calling
+      // thread or on a background thread. Handles allocated from a pool (command buffers and descriptor sets) are
+      // always destroyed on the calling thread, as freeing them needs external synchronization of the pool.
+      // The values passed to retire must not decrease, and the queue has to be destroyed before the device.
+      class DeferredDestructionQueue
+      {
+      public:
+        explicit DeferredDestructionQueue( bool useBackgroundThread = false )
+          : m_quit( false ), m_pendingCount( 0 ), m_destroyedCount( 0 ), m_batchCount( 0 )
+        {
+          if ( useBackgroundThread )
+          {
+            m_worker = std::thread( &DeferredDestructionQueue::workerLoop, this );
+          }
+        }
+
+        // destroys all the remaining handles, so the GPU has to be idle by now
+        ~DeferredDestructionQueue()
+        {
+          if ( m_worker.joinable() )
+          {
+            {
+              std::lock_guard<std::mutex> lock( m_mutex );
+              m_quit = true;
+            }
+            m_workCondition.notify_one();
+            m_worker.join();
+          }
+        }
+
+        template <typename T>
+        void retire( T && handle, uint64_t value )
+        {
+          static_assert( !std::is_lvalue_reference<T>::value, "retire takes ownership of the handle" );
+          std::unique_ptr<RetiredHandle> retired( new RetiredHandleT<T>( std::move( handle ) ) );
+
+          std::lock_guard<std::mutex> lock( m_mutex );
+          assert( m_retired.empty() || ( m_retired.back().value <= value ) );
+          m_retired.push_back( { value, IsPoolAllocated<T>::value, std::move( retired ) } );
+        }
+
+        // destroys the handles retired with a value up to completedValue
+        void collect( uint64_t completedValue )
+        {
+          std::vector<std::unique_ptr<RetiredHandle>> batch, localBatch;
+          {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            while ( !m_retired.empty() && ( m_retired.front().value <= completedValue ) )
+            {
+              ( ( m_retired.front().poolAllocated || !m_worker.joinable() ) ? localBatch : batch )
+                .push_back( std::move( m_retired.front().handle ) );
+              m_retired.pop_front();
+            }
+            if ( batch.empty() && localBatch.empty() )
+            {
+              return;
+            }
+            m_batchCount++;
+            if ( !batch.empty() )
+            {
+              m_pendingCount += batch.size();
+              m_batches.push_back( std::move( batch ) );
+            }
+          }
+          m_workCondition.notify_one();
+
+          size_t count = localBatch.size();
+          localBatch.clear();
+          std::lock_guard<std::mutex> lock( m_mutex );
+          m_destroyedCount += count;
+        }
+
+        // destroys the handles retired with a value up to the current value of timelineSemaphore
+        void collect( vk::raii::Semaphore const & timelineSemaphore )
+        {
+          collect( timelineSemaphore.getCounterValue() );
+        }
+
+        // waits for the background thread to destroy the batches handed over so far
+        void waitIdle()
+        {
+          std::unique_lock<std::mutex> lock( m_mutex );
+          m_idleCondition.wait( lock, [this]() { return m_pendingCount == 0; } );
+        }
+
+        // the number of handles retired, but not yet destroyed
+        size_t size() const
+        {
+          std::lock_guard<std::mutex> lock( m_mutex );
+          return m_retired.size() + m_pendingCount;
+        }
+
+        uint64_t getDestroyedCount() const
+        {
+          std::lock_guard<std::mutex> lock( m_mutex );
+          return m_destroyedCount;
+        }
+
+        // the number of collect calls that destroyed anything
+        uint64_t getBatchCount() const
+        {
+          std::lock_guard<std::mutex> lock( m_mutex );
+          return m_batchCount;
+        }
+
+      private:
+        // the destructor of the raii handle calls the right vkDestroy* or vkFree* function
+        struct RetiredHandle
+        {
+          virtual ~RetiredHandle() = default;
+        };
+
+        template <typename T>
+        struct RetiredHandleT : public RetiredHandle
+        {
+          explicit RetiredHandleT( T && handle_ ) : handle( std::move( handle_ ) ) {}
+
+          T handle;
+        };
+
+        struct Entry
+        {
+          uint64_t                       value;
+          bool                           poolAllocated;
+          std::unique_ptr<RetiredHandle> handle;
+        };
+
+        void workerLoop()
+        {
+          std::unique_lock<std::mutex> lock( m_mutex );
+          while ( true )
+          {
+            m_workCondition.wait( lock, [this]() { return m_quit || !m_batches.empty(); } );
+            if ( m_batches.empty() )
+            {
+              break;  // quit, with all the batches destroyed
+            }
+            std::vector<std::unique_ptr<RetiredHandle>> batch = std::move( m_batches.front() );
+            m_batches.pop_front();
+
+            lock.unlock();
+            size_t count = batch.size();
+            batch.clear();
+            lock.lock();
+
+            m_pendingCount -= count;
+            m_destroyedCount += count;
+            if ( m_pendingCount == 0 )
+            {
+              m_idleCondition.notify_all();
+            }
+          }
+        }
+
+        mutable std::mutex                                      m_mutex;
+        std::condition_variable                                 m_workCondition;
+        std::condition_variable                                 m_idleCondition;
+        std::deque<Entry>                                       m_retired;
+        std::deque<std::vector<std::unique_ptr<RetiredHandle>>> m_batches;  // handed over to the background thread
+        std::thread                                             m_worker;
+        bool                                                    m_quit;
+        size_t                                                  m_pendingCount;
+        uint64_t                                                m_destroyedCount;
+        uint64_t                                                m_batchCount;
+      };
+
+      // Owns the swapchain of a surface and recreates it when it got out of date or suboptimal, or on resize, handing
+      // the current swapchain over as oldSwapchain, such that the presentation engine can reuse its resources. An image
+      // acquired as suboptimal is still presented from the current swapchain, which is replaced right after. The
+      // replaced swapchain, with its image views and framebuffers, is not destroyed right away, but retired with the
+      // number of the last frame presented from it, and destroyed by collect once that frame is complete. The surface
+      // formats and present modes are queried once, the surface capabilities with their current extent once per
+      // recreation.
+      class SwapchainManager
+      {
+      public:
+        SwapchainManager( vk::raii::PhysicalDevice const & physicalDevice,
+                          vk::raii::Device const &         device,
+                          vk::SurfaceKHR const &           surface,
+                          vk::Extent2D const &             extent,
+                          vk::ImageUsageFlags              usage,
+                          uint32_t                         graphicsQueueFamilyIndex,
+                          uint32_t                         presentQueueFamilyIndex )
+          : m_physicalDevice( physicalDevice )
+          , m_device( device )
+          , m_surface( surface )
+          , m_extent( extent )
+          , m_usage( usage )
+          , m_graphicsQueueFamilyIndex( graphicsQueueFamilyIndex )
+          , m_presentQueueFamilyIndex( presentQueueFamilyIndex )
+          , m_surfaceFormat( vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( surface ) ) )
+          , m_presentMode( vk::su::pickPresentMode( physicalDevice.getSurfacePresentModesKHR( surface ) ) )
+          , m_recreatePending( true )
+          , m_frame( 0 )
+          , m_recreateCount( 0 )
+        {
+          recreate();
+        }
+
+        // creates a framebuffer per swapchain image for renderPass, now and on each recreation, with the swapchain
+        // image view as the first attachment, followed by the views getAttachments returns for the new extent, like
+        // the view of a depth buffer that is resized along with the swapchain
+        void setRenderPass(
+          vk::raii::RenderPass const &                                             renderPass,
+          std::function<std::vector<vk::ImageView>( vk::Extent2D const & )> const & getAttachments = nullptr )
+        {
+          m_renderPass     = *renderPass;
+          m_getAttachments = getAttachments;
+          if ( !m_chain.framebuffers.empty() )
+          {
+            m_retiredChains.retire( std::move( m_chain.framebuffers ), m_frame );
+            m_chain.framebuffers.clear();
+          }
+          if ( m_chain.swapchain )
+          {
+            createFramebuffers( m_chain );
+          }
+        }
+
+        // the swapchain is recreated with the new extent on the next acquireNextImage
+        void resize( vk::Extent2D const & extent )
+        {
+          m_extent          = extent;
+          m_recreatePending = true;
+        }
+
+        // acquires the next image, recreating the swapchain first if needed, or if it turns out to be out of date;
+        // eErrorOutOfDateKHR is returned only if the swapchain can't be recreated, as the window is minimized
+        std::pair<vk::Result, uint32_t> acquireNextImage( vk::Semaphore const & semaphore,
+                                                          uint64_t              timeout = vk::su::FenceTimeout )
+        {
+          for ( int attempt = 0; attempt < 2; attempt++ )
+          {
+            if ( m_recreatePending && !recreate() )
+            {
+              break;
+            }
+            try
+            {
+              std::pair<vk::Result, uint32_t> rv = m_chain.swapchain->acquireNextImage( timeout, semaphore );
+              if ( rv.first == vk::Result::eSuboptimalKHR )
+              {
+                m_recreatePending = true;
+              }
+              return rv;
+            }
+            catch ( vk::OutOfDateKHRError const & )
+            {
+              // no image was acquired, so the semaphore is still unsignaled for the next attempt
+              m_recreatePending = true;
+            }
+          }
+          return std::make_pair( vk::Result::eErrorOutOfDateKHR, 0u );
+        }
+
+        // presents an image of the current swapchain, and counts the frame; on eSuboptimalKHR or eErrorOutOfDateKHR,
+        // the swapchain is recreated right away, for the next frame to use the new one
+        vk::Result present( vk::raii::Queue const & queue, vk::Semaphore const & waitSemaphore, uint32_t imageIndex )
+        {
+          vk::Result result;
+          try
+          {
+            result = queue.presentKHR( vk::PresentInfoKHR( waitSemaphore, **m_chain.swapchain, imageIndex ) );
+          }
+          catch ( vk::OutOfDateKHRError const & )
+          {
+            result = vk::Result::eErrorOutOfDateKHR;
+          }
+          m_frame++;
+          if ( ( result != vk::Result::eSuccess ) || m_recreatePending )
+          {
+            m_recreatePending = true;
+            recreate();
+          }
+          return result;
+        }
+
+        // destroys the swapchains retired up to completedFrame, with their image views and framebuffers. The frames are
+        // numbered by present, starting with 1; after waiting on the fences of the frames in flight for frame n, frame
+        // n - framesInFlight is complete, that is frame getFrameCount() + 1 - framesInFlight.
+        void collect( uint64_t completedFrame )
+        {
+          m_retiredChains.collect( completedFrame );
+        }
+
+        vk::raii::SwapchainKHR const & getSwapchain() const
+        {
+          return *m_chain.swapchain;
+        }
+
+        std::vector<VkImage> const & getImages() const
+        {
+          return m_chain.images;
+        }
+
+        std::vector<vk::raii::ImageView> const & getImageViews() const
+        {
+          return m_chain.imageViews;
+        }
+
+        vk::raii::Framebuffer const & getFramebuffer( uint32_t imageIndex ) const
+        {
+          return m_chain.framebuffers[imageIndex];
+        }
+
+        vk::Format getColorFormat() const
+        {
+          return m_surfaceFormat.format;
+        }
+
+        vk::Extent2D const & getExtent() const
+        {
+          return m_chain.extent;
+        }
+
+        // the number of frames presented so far
+        uint64_t getFrameCount() const
+        {
+          return m_frame;
+        }
+
+        uint64_t getRecreateCount() const
+        {
+          return m_recreateCount;
+        }
+
+        // the number of swapchains (and framebuffer sets) retired, but not yet destroyed
+        size_t getRetiredCount() const
+        {
+          return m_retiredChains.size();
+        }
+
+      private:
+        // the members are destroyed in reverse order: the framebuffers first, the swapchain last
+        struct Chain
+        {
+          std::unique_ptr<vk::raii::SwapchainKHR> swapchain;
+          std::vector<VkImage>                    images;
+          std::vector<vk::raii::ImageView>        imageViews;
+          std::vector<vk::raii::Framebuffer>      framebuffers;
+          vk::Extent2D                            extent;
+        };
+
+        // returns false if the surface has a zero extent, as the window is minimized
+        bool recreate()
+        {
+          Chain chain;
+          chain.extent = createSwapchain( m_physicalDevice,
+                                          m_device,
+                                          m_surface,
+                                          m_surfaceFormat,
+                                          m_presentMode,
+                                          m_extent,
+                                          m_usage,
+                                          m_chain.swapchain ? **m_chain.swapchain : nullptr,
+                                          m_graphicsQueueFamilyIndex,
+                                          m_presentQueueFamilyIndex,
+                                          chain.swapchain,
+                                          chain.images,
+                                          chain.imageViews );
+          if ( !chain.swapchain )
+          {
+            return false;
+          }
+          createFramebuffers( chain );
+
+          // the previous swapchain was retired by the creation of the new one, but its last frames might still be in
+          // flight
+          if ( m_chain.swapchain )
+          {
+            m_retiredChains.retire( std::move( m_chain ), m_frame );
+          }
+          m_chain           = std::move( chain );
+          m_recreatePending = false;
+          m_recreateCount++;
+          return true;
+        }
+
+        void createFramebuffers( Chain & chain ) const
+        {
+          if ( m_renderPass )
+          {
+            std::vector<vk::ImageView> attachments( 1 );
+            if ( m_getAttachments )
+            {
+              std::vector<vk::ImageView> additionalAttachments = m_getAttachments( chain.extent );
+              attachments.insert( attachments.end(), additionalAttachments.begin(), additionalAttachments.end() );
+            }
+            chain.framebuffers.reserve( chain.imageViews.size() );
+            for ( auto const & imageView : chain.imageViews )
+            {
+              attachments[0] = *imageView;
+              chain.framebuffers.emplace_back(
+                m_device,
+                vk::FramebufferCreateInfo(
+                  {}, m_renderPass, attachments, chain.extent.width, chain.extent.height, 1 ) );
+            }
+          }
+        }
+
+      private:
+        vk::raii::PhysicalDevice const &                                  m_physicalDevice;
+        vk::raii::Device const &                                          m_device;
+        vk::SurfaceKHR                                                    m_surface;
+        vk::Extent2D                                                      m_extent;  // the extent requested
+        vk::ImageUsageFlags                                               m_usage;
+        uint32_t                                                          m_graphicsQueueFamilyIndex;
+        uint32_t                                                          m_presentQueueFamilyIndex;
+        vk::SurfaceFormatKHR                                              m_surfaceFormat;
+        vk::PresentModeKHR                                                m_presentMode;
+        vk::RenderPass                                                    m_renderPass;
+        std::function<std::vector<vk::ImageView>( vk::Extent2D const & )> m_getAttachments;
+        DeferredDestructionQueue                                          m_retiredChains;
+        Chain                                                             m_chain;
+        bool                                                              m_recreatePending;
+        uint64_t                                                          m_frame;
+        uint64_t                                                          m_recreateCount;
+      };
+
+      // The completion of a batch enqueued to a SubmissionBatcher. It is known to be done once the flush that picked
+      // the batch up has been submitted, and the fence or timeline semaphore value of that flush has been signaled.
+      class SubmissionFuture
+      {
+      public:
+        SubmissionFuture() = default;
+
+        bool valid() const
         {
-          VkSurfaceKHR _surface;
-          VkResult     err =
-            glfwCreateWindowSurface( static_cast<VkInstance>( *instance ), window.handle, nullptr, &_surface );
-          if ( err != VK_SUCCESS )
-            throw std::runtime_error( "Failed to create window!" );
-          surface = vk::raii::su::make_unique<vk::raii::SurfaceKHR>( instance, _surface );
+          return !!m_state;
         }
 
-        vk::Extent2D                          extent;
-        vk::su::WindowData                    window;
-        std::unique_ptr<vk::raii::SurfaceKHR> surface;
+        // true once the batch has been handed to the queue; isReady and wait don't flush on their own
+        bool isSubmitted() const
+        {
+          assert( m_state );
+          std::lock_guard<std::mutex> lock( m_state->mutex );
+          return m_state->submitted;
+        }
+
+        bool isReady() const
+        {
+          return wait( 0 ) == vk::Result::eSuccess;
+        }
+
+        // returns eSuccess once the batch is done, eTimeout if it isn't within timeout nanoseconds, or the error code
+        // the submission failed with
+        vk::Result wait( uint64_t timeout = std::numeric_limits<uint64_t>::max() ) const
+        {
+          assert( m_state );
+          std::unique_lock<std::mutex> lock( m_state->mutex );
+          if ( !m_state->submitted )
+          {
+            if ( timeout == std::numeric_limits<uint64_t>::max() )
+            {
+              m_state->condition.wait( lock, [this]() { return m_state->submitted; } );
+            }
+            else if ( !m_state->condition.wait_for(
+                        lock, std::chrono::nanoseconds( timeout ), [this]() { return m_state->submitted; } ) )
+            {
+              return vk::Result::eTimeout;
+            }
+          }
+          lock.unlock();
+
+          if ( m_state->result != vk::Result::eSuccess )
+          {
+            return m_state->result;
+          }
+          if ( m_state->fence )
+          {
+            return m_state->device->waitForFences( { **m_state->fence }, true, timeout );
+          }
+          vk::SemaphoreWaitInfo semaphoreWaitInfo( {}, *m_state->timelineSemaphore, m_state->timelineValue );
+          return m_state->device->waitSemaphores( semaphoreWaitInfo, timeout );
+        }
+
+        // the value of the timeline semaphore of the batcher signaled by the flush, 0 with fences or before the flush
+        uint64_t getTimelineValue() const
+        {
+          assert( m_state );
+          std::lock_guard<std::mutex> lock( m_state->mutex );
+          return m_state->submitted ? m_state->timelineValue : 0;
+        }
+
+      private:
+        friend class SubmissionBatcher;
+
+        struct State
+        {
+          std::mutex                       mutex;
+          std::condition_variable          condition;
+          bool                             submitted = false;
+          vk::Result                       result    = vk::Result::eSuccess;
+          vk::raii::Device const *         device    = nullptr;
+          std::shared_ptr<vk::raii::Fence> fence;  // shared by all the batches of a flush
+          vk::Semaphore                    timelineSemaphore;
+          uint64_t                         timelineValue = 0;
+        };
+
+        explicit SubmissionFuture( std::shared_ptr<State> const & state ) : m_state( state ) {}
+
+        std::shared_ptr<State> m_state;
       };
 
-      struct SwapChainData
+      // A front end to a vk::raii::Queue for many producer threads. enqueue copies a SubmitInfo or SubmitInfo2KHR,
+      // with its semaphores and command buffers, onto a lock-free list and returns a SubmissionFuture. flush, called by
+      // a single thread at a time, takes all the batches enqueued so far and hands them to the queue with one submit
+      // (or submit2KHR) call, in the order they were enqueued; so each producer's batches keep their order. The last
+      // call of a flush signals either a fence, or the next value of a timeline semaphore owned by the batcher; as
+      // signal operations cover all the work submitted earlier, that completes the futures of all the batches.
+      // With a flush window, a submitter thread flushes on its own every flushWindow.
+      // Out of the pNext chain of a SubmitInfo, only a TimelineSemaphoreSubmitInfo is copied; any other extension
+      // structure is not supported. The queue must not be used by anything but the batcher while it's alive, and with
+      // a timeline semaphore, the futures must not be waited on after the batcher is destroyed.
+      class SubmissionBatcher
       {
-        SwapChainData( vk::raii::PhysicalDevice const &                physicalDevice,
-                       vk::raii::Device const &                        device,
-                       vk::raii::SurfaceKHR const &                    surface,
-                       vk::Extent2D const &                            extent,
-                       vk::ImageUsageFlags                             usage,
-                       std::unique_ptr<vk::raii::SwapchainKHR> const & oldSwapchain,
-                       uint32_t                                        graphicsQueueFamilyIndex,
-                       uint32_t                                        presentQueueFamilyIndex )
+      public:
+        SubmissionBatcher( vk::raii::Device const &  device,
+                           vk::raii::Queue const &   queue,
+                           bool                      useTimelineSemaphore = false,
+                           std::chrono::microseconds flushWindow          = std::chrono::microseconds( 0 ) )
+          : m_device( device )
+          , m_queue( queue )
+          , m_head( nullptr )
+          , m_timelineValue( 0 )
+          , m_flushCount( 0 )
+          , m_submitCount( 0 )
+          , m_quit( false )
         {
-          vk::SurfaceFormatKHR surfaceFormat =
-            vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( *surface ) );
-          colorFormat = surfaceFormat.format;
+          if ( useTimelineSemaphore )
+          {
+            vk::StructureChain<vk::SemaphoreCreateInfo, vk::SemaphoreTypeCreateInfo> semaphoreCreateInfo(
+              {}, vk::SemaphoreTypeCreateInfo( vk::SemaphoreType::eTimeline, 0 ) );
+            m_timelineSemaphore = vk::raii::su::make_unique<vk::raii::Semaphore>(
+              device, semaphoreCreateInfo.get<vk::SemaphoreCreateInfo>() );
+          }
+          if ( flushWindow.count() )
+          {
+            m_submitter = std::thread( &SubmissionBatcher::submitterLoop, this, flushWindow );
+          }
+        }
+
+        // flushes the batches that are still enqueued
+        ~SubmissionBatcher()
+        {
+          if ( m_submitter.joinable() )
+          {
+            {
+              std::lock_guard<std::mutex> lock( m_quitMutex );
+              m_quit = true;
+            }
+            m_quitCondition.notify_one();
+            m_submitter.join();
+          }
+          try
+          {
+            flush();
+          }
+          catch ( vk::SystemError const & )
+          {
+            // the futures of the batches carry the error
+          }
+        }
+
+        SubmissionFuture enqueue( vk::SubmitInfo const & submitInfo )
+        {
+          std::unique_ptr<Batch> batch( new Batch( false ) );
+          batch->waitSemaphores.assign( submitInfo.pWaitSemaphores,
+                                        submitInfo.pWaitSemaphores + submitInfo.waitSemaphoreCount );
+          batch->waitDstStageMasks.assign( submitInfo.pWaitDstStageMask,
+                                           submitInfo.pWaitDstStageMask + submitInfo.waitSemaphoreCount );
+          batch->commandBuffers.assign( submitInfo.pCommandBuffers,
+                                        submitInfo.pCommandBuffers + submitInfo.commandBufferCount );
+          batch->signalSemaphores.assign( submitInfo.pSignalSemaphores,
+                                          submitInfo.pSignalSemaphores + submitInfo.signalSemaphoreCount );
+          if ( submitInfo.pNext )
+          {
+            vk::TimelineSemaphoreSubmitInfo const * timelineSemaphoreSubmitInfo =
+              static_cast<vk::TimelineSemaphoreSubmitInfo const *>( submitInfo.pNext );
+            assert( ( timelineSemaphoreSubmitInfo->sType == vk::StructureType::eTimelineSemaphoreSubmitInfo ) &&
+                    !timelineSemaphoreSubmitInfo->pNext );
+            if ( timelineSemaphoreSubmitInfo->pWaitSemaphoreValues )
+            {
+              batch->waitValues.assign( timelineSemaphoreSubmitInfo->pWaitSemaphoreValues,
+                                        timelineSemaphoreSubmitInfo->pWaitSemaphoreValues +
+                                          timelineSemaphoreSubmitInfo->waitSemaphoreValueCount );
+            }
+            if ( timelineSemaphoreSubmitInfo->pSignalSemaphoreValues )
+            {
+              batch->signalValues.assign( timelineSemaphoreSubmitInfo->pSignalSemaphoreValues,
+                                          timelineSemaphoreSubmitInfo->pSignalSemaphoreValues +
+                                            timelineSemaphoreSubmitInfo->signalSemaphoreValueCount );
+            }
+          }
+          return push( std::move( batch ) );
+        }
+
+        SubmissionFuture enqueue( vk::SubmitInfo2KHR const & submitInfo )
+        {
+          assert( !submitInfo.pNext );
+          std::unique_ptr<Batch> batch( new Batch( true ) );
+          batch->flags = submitInfo.flags;
+          batch->waitSemaphoreInfos.assign( submitInfo.pWaitSemaphoreInfos,
+                                            submitInfo.pWaitSemaphoreInfos + submitInfo.waitSemaphoreInfoCount );
+          batch->commandBufferInfos.assign( submitInfo.pCommandBufferInfos,
+                                            submitInfo.pCommandBufferInfos + submitInfo.commandBufferInfoCount );
+          batch->signalSemaphoreInfos.assign( submitInfo.pSignalSemaphoreInfos,
+                                              submitInfo.pSignalSemaphoreInfos + submitInfo.signalSemaphoreInfoCount );
+          return push( std::move( batch ) );
+        }
+
+        // submits all the batches enqueued so far; returns the number of batches submitted
+        size_t flush()
+        {
+          std::lock_guard<std::mutex> flushLock( m_flushMutex );
 
-          vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR( *surface );
-          VkExtent2D                 swapchainExtent;
-          if ( surfaceCapabilities.currentExtent.width == std::numeric_limits<uint32_t>::max() )
+          // take the whole list at once, and reverse it into the order of enqueuing
+          std::vector<std::unique_ptr<Batch>> batches;
+          for ( Batch * batch = m_head.exchange( nullptr, std::memory_order_acquire ); batch; )
           {
-            // If the surface size is undefined, the size is set to the size of the images requested.
-            swapchainExtent.width = vk::su::clamp(
-              extent.width, surfaceCapabilities.minImageExtent.width, surfaceCapabilities.maxImageExtent.width );
-            swapchainExtent.height = vk::su::clamp(
-              extent.height, surfaceCapabilities.minImageExtent.height, surfaceCapabilities.maxImageExtent.height );
+            Batch * next = batch->next;
+            batches.push_back( std::unique_ptr<Batch>( batch ) );
+            batch = next;
+          }
+          if ( batches.empty() )
+          {
+            return 0;
+          }
+          std::reverse( batches.begin(), batches.end() );
+
+          // the last batch signals the completion of the whole flush
+          std::shared_ptr<vk::raii::Fence> fence;
+          uint64_t                         timelineValue = 0;
+          if ( m_timelineSemaphore )
+          {
+            timelineValue = ++m_timelineValue;
+            Batch & last  = *batches.back();
+            if ( last.synchronization2 )
+            {
+              last.signalSemaphoreInfos.push_back( vk::SemaphoreSubmitInfoKHR(
+                **m_timelineSemaphore, timelineValue, vk::PipelineStageFlagBits2KHR::eAllCommands ) );
+            }
+            else
+            {
+              last.signalValues.resize( last.signalSemaphores.size(), 0 );
+              last.signalSemaphores.push_back( **m_timelineSemaphore );
+              last.signalValues.push_back( timelineValue );
+            }
           }
           else
           {
-            // If the surface size is defined, the swap chain size must match
-            swapchainExtent = surfaceCapabilities.currentExtent;
-          }
-          vk::SurfaceTransformFlagBitsKHR preTransform =
-            ( surfaceCapabilities.supportedTransforms & vk::SurfaceTransformFlagBitsKHR::eIdentity )
-              ? vk::SurfaceTransformFlagBitsKHR::eIdentity
-              : surfaceCapabilities.currentTransform;
-          vk::CompositeAlphaFlagBitsKHR compositeAlpha =
-            ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePreMultiplied )
-              ? vk::CompositeAlphaFlagBitsKHR::ePreMultiplied
-            : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePostMultiplied )
-              ? vk::CompositeAlphaFlagBitsKHR::ePostMultiplied
-            : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::eInherit )
-              ? vk::CompositeAlphaFlagBitsKHR::eInherit
-              : vk::CompositeAlphaFlagBitsKHR::eOpaque;
-          vk::PresentModeKHR presentMode =
-            vk::su::pickPresentMode( physicalDevice.getSurfacePresentModesKHR( *surface ) );
-          vk::SwapchainCreateInfoKHR swapChainCreateInfo( {},
-                                                          *surface,
-                                                          surfaceCapabilities.minImageCount,
-                                                          colorFormat,
-                                                          surfaceFormat.colorSpace,
-                                                          swapchainExtent,
-                                                          1,
-                                                          usage,
-                                                          vk::SharingMode::eExclusive,
-                                                          {},
-                                                          preTransform,
-                                                          compositeAlpha,
-                                                          presentMode,
-                                                          true,
-                                                          oldSwapchain ? **oldSwapchain : nullptr );
-          if ( graphicsQueueFamilyIndex != presentQueueFamilyIndex )
-          {
-            uint32_t queueFamilyIndices[2] = { graphicsQueueFamilyIndex, presentQueueFamilyIndex };
-            // If the graphics and present queues are from different queue families, we either have to explicitly
-            // transfer ownership of images between the queues, or we have to create the swapchain with imageSharingMode
-            // as vk::SharingMode::eConcurrent
-            swapChainCreateInfo.imageSharingMode      = vk::SharingMode::eConcurrent;
-            swapChainCreateInfo.queueFamilyIndexCount = 2;
-            swapChainCreateInfo.pQueueFamilyIndices   = queueFamilyIndices;
-          }
-          swapChain = vk::raii::su::make_unique<vk::raii::SwapchainKHR>( device, swapChainCreateInfo );
-
-          images = swapChain->getImages();
-
-          imageViews.reserve( images.size() );
-          vk::ComponentMapping componentMapping(
-            vk::ComponentSwizzle::eR, vk::ComponentSwizzle::eG, vk::ComponentSwizzle::eB, vk::ComponentSwizzle::eA );
-          vk::ImageSubresourceRange subResourceRange( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
-          for ( auto image : images )
+            fence = std::make_shared<vk::raii::Fence>( m_device, vk::FenceCreateInfo() );
+          }
+
+          vk::Result result = vk::Result::eSuccess;
+          try
           {
-            vk::ImageViewCreateInfo imageViewCreateInfo( {},
-                                                         static_cast<vk::Image>( image ),
-                                                         vk::ImageViewType::e2D,
-                                                         colorFormat,
-                                                         componentMapping,
-                                                         subResourceRange );
-            imageViews.emplace_back( device, imageViewCreateInfo );
+            submit( batches, fence ? **fence : vk::Fence() );
           }
+          catch ( vk::SystemError const & err )
+          {
+            result = static_cast<vk::Result>( err.code().value() );
+          }
+
+          m_flushCount++;
+          for ( auto const & batch : batches )
+          {
+            {
+              std::lock_guard<std::mutex> lock( batch->state->mutex );
+              batch->state->submitted         = true;
+              batch->state->result            = result;
+              batch->state->device            = &m_device;
+              batch->state->fence             = fence;
+              batch->state->timelineSemaphore = m_timelineSemaphore ? **m_timelineSemaphore : vk::Semaphore();
+              batch->state->timelineValue     = timelineValue;
+            }
+            batch->state->condition.notify_all();
+          }
+          if ( result != vk::Result::eSuccess )
+          {
+            vk::throwResultException( result, "vk::raii::su::SubmissionBatcher::flush" );
+          }
+          return batches.size();
         }
 
-        vk::Format                              colorFormat;
-        std::unique_ptr<vk::raii::SwapchainKHR> swapChain;
-        std::vector<VkImage>                    images;
-        std::vector<vk::raii::ImageView>        imageViews;
+        // the number of flushes that submitted anything
+        uint64_t getFlushCount() const
+        {
+          std::lock_guard<std::mutex> lock( m_flushMutex );
+          return m_flushCount;
+        }
+
+        // the number of submit and submit2KHR calls
+        uint64_t getSubmitCount() const
+        {
+          std::lock_guard<std::mutex> lock( m_flushMutex );
+          return m_submitCount;
+        }
+
+      private:
+        // a copy of a SubmitInfo or a SubmitInfo2KHR, linked into the list of enqueued batches
+        struct Batch
+        {
+          explicit Batch( bool synchronization2_ )
+            : next( nullptr )
+            , synchronization2( synchronization2_ )
+            , state( std::make_shared<SubmissionFuture::State>() )
+          {}
+
+          Batch *                                  next;
+          bool                                     synchronization2;
+          std::shared_ptr<SubmissionFuture::State> state;
+
+          std::vector<vk::Semaphore>          waitSemaphores;
+          std::vector<vk::PipelineStageFlags> waitDstStageMasks;
+          std::vector<uint64_t>               waitValues;
+          std::vector<vk::CommandBuffer>      commandBuffers;
+          std::vector<vk::Semaphore>          signalSemaphores;
+          std::vector<uint64_t>               signalValues;
+
+          vk::SubmitFlagsKHR                          flags;
+          std::vector<vk::SemaphoreSubmitInfoKHR>     waitSemaphoreInfos;
+          std::vector<vk::CommandBufferSubmitInfoKHR> commandBufferInfos;
+          std::vector<vk::SemaphoreSubmitInfoKHR>     signalSemaphoreInfos;
+        };
+
+        SubmissionFuture push( std::unique_ptr<Batch> && batch )
+        {
+          SubmissionFuture future( batch->state );
+          Batch *          newHead = batch.release();
+          newHead->next            = m_head.load( std::memory_order_relaxed );
+          while ( !m_head.compare_exchange_weak( newHead->next, newHead, std::memory_order_release ) )
+          {
+            // newHead->next has been updated to the current head, try again
+          }
+          return future;
+        }
+
+        // one submit call per run of batches of the same kind, the fence goes with the last one
+        void submit( std::vector<std::unique_ptr<Batch>> const & batches, vk::Fence fence )
+        {
+          std::vector<vk::SubmitInfo>                  submitInfos;
+          std::vector<vk::TimelineSemaphoreSubmitInfo> timelineSemaphoreSubmitInfos;
+          std::vector<vk::SubmitInfo2KHR>              submitInfos2;
+          submitInfos.reserve( batches.size() );
+          timelineSemaphoreSubmitInfos.reserve( batches.size() );  // no reallocation, as the SubmitInfos point into it
+          submitInfos2.reserve( batches.size() );
+
+          for ( size_t i = 0; i < batches.size(); i++ )
+          {
+            Batch const & batch = *batches[i];
+            if ( batch.synchronization2 )
+            {
+              submitInfos2.push_back( vk::SubmitInfo2KHR(
+                batch.flags, batch.waitSemaphoreInfos, batch.commandBufferInfos, batch.signalSemaphoreInfos ) );
+            }
+            else
+            {
+              submitInfos.push_back( vk::SubmitInfo(
+                batch.waitSemaphores, batch.waitDstStageMasks, batch.commandBuffers, batch.signalSemaphores ) );
+              if ( !batch.waitValues.empty() || !batch.signalValues.empty() )
+              {
+                timelineSemaphoreSubmitInfos.push_back(
+                  vk::TimelineSemaphoreSubmitInfo( batch.waitValues, batch.signalValues ) );
+                submitInfos.back().pNext = &timelineSemaphoreSubmitInfos.back();
+              }
+            }
+
+            bool last = ( i + 1 == batches.size() );
+            if ( last || ( batches[i + 1]->synchronization2 != batch.synchronization2 ) )
+            {
+              if ( batch.synchronization2 )
+              {
+                m_queue.submit2KHR( submitInfos2, last ? fence : vk::Fence() );
+                submitInfos2.clear();
+              }
+              else
+              {
+                m_queue.submit( submitInfos, last ? fence : vk::Fence() );
+                submitInfos.clear();
+                timelineSemaphoreSubmitInfos.clear();
+              }
+              m_submitCount++;
+            }
+          }
+        }
+
+        void submitterLoop( std::chrono::microseconds flushWindow )
+        {
+          std::unique_lock<std::mutex> lock( m_quitMutex );
+          while ( !m_quitCondition.wait_for( lock, flushWindow, [this]() { return m_quit; } ) )
+          {
+            lock.unlock();
+            try
+            {
+              flush();
+            }
+            catch ( vk::SystemError const & )
+            {
+              // the futures of the batches carry the error
+            }
+            lock.lock();
+          }
+        }
+
+        vk::raii::Device const &             m_device;
+        vk::raii::Queue const &              m_queue;
+        std::unique_ptr<vk::raii::Semaphore> m_timelineSemaphore;
+        std::atomic<Batch *>                 m_head;  // the most recently enqueued batch
+        mutable std::mutex                   m_flushMutex;
+        uint64_t                             m_timelineValue;
+        uint64_t                             m_flushCount;
+        uint64_t                             m_submitCount;
+        std::thread                          m_submitter;
+        std::mutex                           m_quitMutex;
+        std::condition_variable              m_quitCondition;
+        bool                                 m_quit;
       };
 
       struct TextureData
@@ -475,7 +2156,10 @@ namespace vk
           {
             assert( ( formatProperties.optimalTilingFeatures & formatFeatureFlags ) == formatFeatureFlags );
             stagingBufferData = vk::raii::su::make_unique<BufferData>(
-              physicalDevice, device, extent.width * extent.height * 4, vk::BufferUsageFlagBits::eTransferSrc );
+              physicalDevice,
+              device,
+              vk::su::getPackedImageSize( format, extent ),
+              vk::BufferUsageFlagBits::eTransferSrc );
             imageTiling = vk::ImageTiling::eOptimal;
             usageFlags |= vk::ImageUsageFlagBits::eTransferDst;
             initialLayout = vk::ImageLayout::eUndefined;
@@ -518,11 +2202,24 @@ namespace vk
         template <typename ImageGenerator>
         void setImage( vk::raii::CommandBuffer const & commandBuffer, ImageGenerator const & imageGenerator )
         {
-          void * data =
-            needsStaging
-              ? stagingBufferData->deviceMemory->mapMemory( 0, stagingBufferData->buffer->getMemoryRequirements().size )
-              : imageData->deviceMemory->mapMemory( 0, imageData->image->getMemoryRequirements().size );
-          imageGenerator( data, extent );
+          void *         data;
+          vk::DeviceSize rowPitch;
+          if ( needsStaging )
+          {
+            // the staging buffer is tightly packed, matching the copyBufferToImage below
+            data =
+              stagingBufferData->deviceMemory->mapMemory( 0, stagingBufferData->buffer->getMemoryRequirements().size );
+            rowPitch = vk::su::getPackedRowPitch( format, extent.width );
+          }
+          else
+          {
+            // a linearly tiled image might have some padding at the end of each row
+            vk::SubresourceLayout subresourceLayout =
+              imageData->image->getSubresourceLayout( vk::ImageSubresource( vk::ImageAspectFlagBits::eColor, 0, 0 ) );
+            data     = imageData->deviceMemory->mapMemory( subresourceLayout.offset, subresourceLayout.size );
+            rowPitch = subresourceLayout.rowPitch;
+          }
+          imageGenerator( data, extent, rowPitch );
           needsStaging ? stagingBufferData->deviceMemory->unmapMemory() : imageData->deviceMemory->unmapMemory();
 
           if ( needsStaging )
@@ -944,6 +2641,8 @@ namespace vk
         throw std::runtime_error( "failed to find supported format!" );
       }
 
+      // for one-time submissions, like an upload or the single frame of a sample, that have to be complete before
+      // anything is destroyed; a render loop paces its frames with FramesInFlight instead
       void submitAndWait( vk::raii::Device const &        device,
                           vk::raii::Queue const &         queue,
                           vk::raii::CommandBuffer const & commandBuffer )
@@ -1048,6 +2747,275 @@ namespace vk
         device.updateDescriptorSets( writeDescriptorSets, nullptr );
       }
 
+      // the type of the descriptor info of a DescriptorType, as read by a descriptor update template; only the
+      // DescriptorTypes specialized below are supported
+      template <vk::DescriptorType descriptorType>
+      struct DescriptorInfoType
+      {
+        static_assert( descriptorType != descriptorType, "DescriptorInfoType: unsupported DescriptorType" );
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eSampler>
+      {
+        using Type = vk::DescriptorImageInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eCombinedImageSampler>
+      {
+        using Type = vk::DescriptorImageInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eSampledImage>
+      {
+        using Type = vk::DescriptorImageInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eStorageImage>
+      {
+        using Type = vk::DescriptorImageInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eInputAttachment>
+      {
+        using Type = vk::DescriptorImageInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eUniformTexelBuffer>
+      {
+        using Type = vk::BufferView;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eStorageTexelBuffer>
+      {
+        using Type = vk::BufferView;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eUniformBuffer>
+      {
+        using Type = vk::DescriptorBufferInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eStorageBuffer>
+      {
+        using Type = vk::DescriptorBufferInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eUniformBufferDynamic>
+      {
+        using Type = vk::DescriptorBufferInfo;
+      };
+
+      template <>
+      struct DescriptorInfoType<vk::DescriptorType::eStorageBufferDynamic>
+      {
+        using Type = vk::DescriptorBufferInfo;
+      };
+
+      // descriptorCount descriptors of descriptorType, written to binding starting at dstArrayElement
+      template <uint32_t           binding_,
+                vk::DescriptorType descriptorType_,
+                uint32_t           descriptorCount_ = 1,
+                uint32_t           dstArrayElement_ = 0>
+      struct DescriptorBinding
+      {
+        static_assert( 0 < descriptorCount_, "a DescriptorBinding needs at least one descriptor" );
+
+        using InfoType = typename DescriptorInfoType<descriptorType_>::Type;
+
+        static const uint32_t           binding         = binding_;
+        static const vk::DescriptorType descriptorType  = descriptorType_;
+        static const uint32_t           descriptorCount = descriptorCount_;
+        static const uint32_t           dstArrayElement = dstArrayElement_;
+      };
+
+      // the offset of the infos of the binding at index in a DescriptorSetData: right behind the previous binding,
+      // aligned for its info type
+      template <size_t index, typename... Bindings>
+      struct DescriptorBindingOffset
+      {
+        using Previous = typename std::tuple_element<index - 1, std::tuple<Bindings...>>::type;
+        using Current  = typename std::tuple_element<index, std::tuple<Bindings...>>::type;
+
+        static const size_t previousEnd = DescriptorBindingOffset<index - 1, Bindings...>::value +
+                                          Previous::descriptorCount * sizeof( typename Previous::InfoType );
+        static const size_t value = ( previousEnd + alignof( typename Current::InfoType ) - 1 ) /
+                                    alignof( typename Current::InfoType ) * alignof( typename Current::InfoType );
+      };
+
+      template <typename... Bindings>
+      struct DescriptorBindingOffset<0, Bindings...>
+      {
+        static const size_t value = 0;
+      };
+
+      // The data of a descriptor update template, laid out for a list of DescriptorBindings. The offsets of the
+      // bindings are compile time constants, and get<index>( arrayElement ) accesses the infos of the binding at index:
+      //   using MyData = vk::raii::su::DescriptorSetData<
+      //     vk::raii::su::DescriptorBinding<0, vk::DescriptorType::eUniformBuffer>,
+      //     vk::raii::su::DescriptorBinding<1, vk::DescriptorType::eCombinedImageSampler, 4>>;
+      // that replaces a hand-built array of DescriptorUpdateTemplateEntries with manual offsets and strides.
+      template <typename... Bindings>
+      class DescriptorSetData
+      {
+        static_assert( 0 < sizeof...( Bindings ), "a DescriptorSetData needs at least one DescriptorBinding" );
+
+      public:
+        template <size_t index>
+        using Binding = typename std::tuple_element<index, std::tuple<Bindings...>>::type;
+
+        template <size_t index>
+        using InfoType = typename Binding<index>::InfoType;
+
+        static const size_t bindingCount = sizeof...( Bindings );
+        static const size_t size = DescriptorBindingOffset<bindingCount - 1, Bindings...>::value +
+                                   Binding<bindingCount - 1>::descriptorCount * sizeof( InfoType<bindingCount - 1> );
+
+        DescriptorSetData()
+        {
+          initialize( std::integral_constant<size_t, 0>() );
+        }
+
+        template <size_t index>
+        InfoType<index> & get( uint32_t arrayElement = 0 )
+        {
+          assert( arrayElement < Binding<index>::descriptorCount );
+          char * bindingData =
+            reinterpret_cast<char *>( &m_storage ) + DescriptorBindingOffset<index, Bindings...>::value;
+          return reinterpret_cast<InfoType<index> *>( bindingData )[arrayElement];
+        }
+
+        template <size_t index>
+        InfoType<index> const & get( uint32_t arrayElement = 0 ) const
+        {
+          assert( arrayElement < Binding<index>::descriptorCount );
+          char const * bindingData =
+            reinterpret_cast<char const *>( &m_storage ) + DescriptorBindingOffset<index, Bindings...>::value;
+          return reinterpret_cast<InfoType<index> const *>( bindingData )[arrayElement];
+        }
+
+        // the pData to pass along with a descriptor update template created from getDescriptorUpdateTemplateEntries
+        void const * data() const
+        {
+          return &m_storage;
+        }
+
+        // the entries are computed once, and live as long as the program
+        static std::array<vk::DescriptorUpdateTemplateEntry, bindingCount> const & getDescriptorUpdateTemplateEntries()
+        {
+          static const std::array<vk::DescriptorUpdateTemplateEntry, bindingCount> entries = makeEntries();
+          return entries;
+        }
+
+      private:
+        void initialize( std::integral_constant<size_t, bindingCount> ) {}
+
+        template <size_t index>
+        void initialize( std::integral_constant<size_t, index> )
+        {
+          for ( uint32_t i = 0; i < Binding<index>::descriptorCount; i++ )
+          {
+            new ( &get<index>( i ) ) InfoType<index>();
+          }
+          initialize( std::integral_constant<size_t, index + 1>() );
+        }
+
+        static std::array<vk::DescriptorUpdateTemplateEntry, bindingCount> makeEntries()
+        {
+          std::array<vk::DescriptorUpdateTemplateEntry, bindingCount> entries;
+          makeEntries( entries, std::integral_constant<size_t, 0>() );
+          return entries;
+        }
+
+        static void makeEntries( std::array<vk::DescriptorUpdateTemplateEntry, bindingCount> &,
+                                 std::integral_constant<size_t, bindingCount> )
+        {}
+
+        template <size_t index>
+        static void makeEntries( std::array<vk::DescriptorUpdateTemplateEntry, bindingCount> & entries,
+                                 std::integral_constant<size_t, index> )
+        {
+          entries[index] = vk::DescriptorUpdateTemplateEntry( Binding<index>::binding,
+                                                              Binding<index>::dstArrayElement,
+                                                              Binding<index>::descriptorCount,
+                                                              Binding<index>::descriptorType,
+                                                              DescriptorBindingOffset<index, Bindings...>::value,
+                                                              sizeof( InfoType<index> ) );
+          makeEntries( entries, std::integral_constant<size_t, index + 1>() );
+        }
+
+        typename std::aligned_storage<size>::type m_storage;
+      };
+
+      // A descriptor update template created once from the entries of a DescriptorSetData, for the descriptor sets of
+      // a layout, or for push descriptors. update and push then write all the bindings of a DescriptorSetData with a
+      // single call, without building WriteDescriptorSets.
+      template <typename Data>
+      class TypedDescriptorUpdateTemplate
+      {
+      public:
+        // for the descriptor sets allocated with descriptorSetLayout
+        TypedDescriptorUpdateTemplate( vk::raii::Device const &              device,
+                                       vk::raii::DescriptorSetLayout const & descriptorSetLayout )
+          : m_descriptorUpdateTemplate( device,
+                                        vk::DescriptorUpdateTemplateCreateInfo(
+                                          {},
+                                          Data::getDescriptorUpdateTemplateEntries(),
+                                          vk::DescriptorUpdateTemplateType::eDescriptorSet,
+                                          *descriptorSetLayout ) )
+          , m_set( 0 )
+        {}
+
+        // for the push descriptors of set in pipelineLayout, with VK_KHR_push_descriptor
+        TypedDescriptorUpdateTemplate( vk::raii::Device const &         device,
+                                       vk::raii::PipelineLayout const & pipelineLayout,
+                                       vk::PipelineBindPoint            pipelineBindPoint,
+                                       uint32_t                         set )
+          : m_descriptorUpdateTemplate( device,
+                                        vk::DescriptorUpdateTemplateCreateInfo(
+                                          {},
+                                          Data::getDescriptorUpdateTemplateEntries(),
+                                          vk::DescriptorUpdateTemplateType::ePushDescriptorsKHR,
+                                          {},
+                                          pipelineBindPoint,
+                                          *pipelineLayout,
+                                          set ) )
+          , m_pipelineLayout( *pipelineLayout )
+          , m_set( set )
+        {}
+
+        void update( vk::raii::DescriptorSet const & descriptorSet, Data const & data ) const
+        {
+          descriptorSet.updateWithTemplate( *m_descriptorUpdateTemplate, data.data() );
+        }
+
+        void push( vk::raii::CommandBuffer const & commandBuffer, Data const & data ) const
+        {
+          assert( m_pipelineLayout );
+          commandBuffer.pushDescriptorSetWithTemplateKHR(
+            *m_descriptorUpdateTemplate, m_pipelineLayout, m_set, data.data() );
+        }
+
+        vk::raii::DescriptorUpdateTemplate const & getDescriptorUpdateTemplate() const
+        {
+          return m_descriptorUpdateTemplate;
+        }
+
+      private:
+        vk::raii::DescriptorUpdateTemplate m_descriptorUpdateTemplate;
+        vk::PipelineLayout                 m_pipelineLayout;
+        uint32_t                           m_set;
+      };
+
     }  // namespace su
   }    // namespace raii
 }  // namespace vk
@@ -16,11 +16,17 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <functional>
 #include <iterator>
 #include <regex>
+#if defined( __unix__ ) || defined( __APPLE__ )
+#  include <sys/resource.h>
+#endif
 
 void             appendArgumentCount( std::string &       str,
                                       size_t              vectorIndex,
@@ -40,6 +46,7 @@ void             checkElements( int
                                 std::vector<tinyxml2::XMLElement const *> const & elements,
                                 std::map<std::string, bool> const &               required,
                                 std::set<std::string> const &                     optional = {} );
+std::string      constructArgumentNames( std::string const & arguments );
 std::string      constructStandardArray( std::string const & type, std::vector<std::string> const & sizes );
 std::string      createEnumValueName( std::string const & name,
                                       std::string const & prefix,
@@ -55,16 +62,21 @@ std::set<size_t> determineSingularParams( size_t                           retur
                                           std::map<size_t, size_t> const & vectorParamIndices );
 std::set<size_t> determineSkippedParams( size_t returnParamIndex, std::map<size_t, size_t> const & vectorParamIndices );
 std::string      extractTag( int line, std::string const & name, std::set<std::string> const & tags );
+std::string      findClangFormatStyle( std::string const & fileName );
 std::string findTag( std::set<std::string> const & tags, std::string const & name, std::string const & postfix = "" );
 std::map<std::string, std::string> getAttributes( tinyxml2::XMLElement const * element );
 template <typename ElementContainer>
 std::vector<tinyxml2::XMLElement const *> getChildElements( ElementContainer const * element );
 std::string getEnumPostfix( std::string const & name, std::set<std::string> const & tags, std::string & prefix );
+uint64_t    hashContent( std::string const & content, uint64_t hash = 14695981039346656037ull );
+bool        isNumber( std::string const & name );
 std::string namespacedType( std::string const & type );
+std::string readFile( std::string const & fileName );
 std::string readTypePostfix( tinyxml2::XMLNode const * node );
 std::string readTypePrefix( tinyxml2::XMLNode const * node );
 void        replaceAll( std::string & str, std::string const & from, std::string const & to );
 std::string replaceWithMap( std::string const & input, std::map<std::string, std::string> replacements );
+void        reportPhase( std::string const & phase, std::chrono::steady_clock::time_point & start );
 std::string startLowerCase( std::string const & input );
 std::string startUpperCase( std::string const & input );
 std::string stripPostfix( std::string const & value, std::string const & postfix );
@@ -78,6 +90,7 @@ std::string              trim( std::string const & input );
 std::string              trimEnd( std::string const & input );
 std::string              trimStars( std::string const & input );
 void                     warn( bool condition, int line, std::string const & message );
+bool                     writeIfChanged( std::string const & fileName, std::string const & content );
 
 #if defined( NDEBUG )
 template <typename T>
@@ -243,6 +256,21 @@ void checkElements( int                                               line,
   }
 }
 
+std::string constructArgumentNames( std::string const & arguments )
+{
+  // reduces an argument list like "Device const & device, Optional<const AllocationCallbacks> allocator = nullptr"
+  // to the list of names, like "device, allocator"
+  std::string argumentNames;
+  for ( auto const & argument : tokenize( arguments, "," ) )
+  {
+    std::string declaration = trim( argument.substr( 0, argument.find( '=' ) ) );
+    size_t      nameStart   = declaration.find_last_of( " &*" );
+    assert( nameStart != std::string::npos );
+    argumentNames += ( argumentNames.empty() ? "" : ", " ) + declaration.substr( nameStart + 1 );
+  }
+  return argumentNames;
+}
+
 std::string constructCArraySizes( std::vector<std::string> const & sizes )
 {
   std::string arraySizes;
@@ -423,6 +451,23 @@ std::set<size_t> determineSkippedParams( size_t returnParamIndex, std::map<size_
   return skippedParams;
 }
 
+std::string findClangFormatStyle( std::string const & fileName )
+{
+  // clang-format --style=file uses the first .clang-format in the directory of the file or in one of its parents
+  std::string directory = fileName;
+  size_t      separatorPos;
+  while ( ( separatorPos = directory.find_last_of( "/\\" ) ) != std::string::npos )
+  {
+    directory.erase( separatorPos );
+    std::string style = readFile( directory + "/.clang-format" );
+    if ( !style.empty() )
+    {
+      return style;
+    }
+  }
+  return "";
+}
+
 std::string findTag( std::set<std::string> const & tags, std::string const & name, std::string const & postfix )
 {
   auto tagIt = std::find_if(
@@ -523,11 +568,33 @@ std::pair<std::vector<std::string>, std::string> readModifiers( tinyxml2::XMLNod
   return std::make_pair( arraySizes, bitCount );
 }
 
+uint64_t hashContent( std::string const & content, uint64_t hash )
+{
+  // 64 bit FNV-1a
+  for ( unsigned char c : content )
+  {
+    hash = ( hash ^ c ) * 1099511628211ull;
+  }
+  return hash;
+}
+
+bool isNumber( std::string const & name )
+{
+  return !name.empty() && ( name.find_first_not_of( "0123456789" ) == std::string::npos );
+}
+
 std::string namespacedType( std::string const & type )
 {
   return beginsWith( type, "Vk" ) ? ( "VULKAN_HPP_NAMESPACE::" + stripPrefix( type, "Vk" ) ) : type;
 }
 
+std::string readFile( std::string const & fileName )
+{
+  // a file that does not exist reads as empty
+  std::ifstream ifs( fileName );
+  return std::string( std::istreambuf_iterator<char>( ifs ), std::istreambuf_iterator<char>() );
+}
+
 std::string readTypePostfix( tinyxml2::XMLNode const * node )
 {
   std::string postfix;
@@ -610,6 +677,26 @@ std::string replaceWithMap( std::string const & input, std::map<std::string, std
   return result;
 }
 
+void reportPhase( std::string const & phase, std::chrono::steady_clock::time_point & start )
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::cout << "VulkanHppGenerator: " << phase << " took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>( now - start ).count() << " ms";
+#if defined( __unix__ ) || defined( __APPLE__ )
+  rusage usage;
+  if ( getrusage( RUSAGE_SELF, &usage ) == 0 )
+  {
+    // the peak resident set size so far, which is given in kilobytes on Linux and in bytes on macOS
+#  if defined( __APPLE__ )
+    usage.ru_maxrss /= 1024;
+#  endif
+    std::cout << ", peak memory " << usage.ru_maxrss / 1024 << " MB";
+  }
+#endif
+  std::cout << std::endl;
+  start = now;
+}
+
 std::string startLowerCase( std::string const & input )
 {
   return input.empty() ? "" : static_cast<char>( tolower( input[0] ) ) + input.substr( 1 );
@@ -786,6 +873,54 @@ void warn( bool condition, int line, std::string const & message )
   }
 }
 
+bool writeIfChanged( std::string const & fileName, std::string const & content )
+{
+  std::string formatted = content;
+#if defined( CLANG_FORMAT_EXECUTABLE )
+  // format a temporary copy next to fileName, with the same extension, such that clang-format uses the same style and
+  // language for it
+  size_t dotPos = fileName.find_last_of( '.' );
+  assert( dotPos != std::string::npos );
+  std::string tmpFileName = fileName.substr( 0, dotPos ) + ".tmp" + fileName.substr( dotPos );
+  {
+    std::ofstream ofs( tmpFileName );
+    if ( ofs.fail() )
+    {
+      throw std::runtime_error( "failed to open file " + tmpFileName );
+    }
+    ofs << content;
+  }
+
+  std::cout << "VulkanHppGenerator: Formatting " << fileName << " using clang-format..." << std::endl;
+  int ret = std::system( ( "\"" CLANG_FORMAT_EXECUTABLE "\" -i --style=file " + tmpFileName ).c_str() );
+  if ( ret == 0 )
+  {
+    formatted = readFile( tmpFileName );
+  }
+  std::remove( tmpFileName.c_str() );
+  if ( ret != 0 )
+  {
+    throw std::runtime_error( "failed to format file " + fileName + " with error <" + std::to_string( ret ) + ">" );
+  }
+#endif
+
+  // leave an unchanged file untouched, such that its timestamp doesn't trigger any rebuilds
+  if ( formatted == readFile( fileName ) )
+  {
+    std::cout << "VulkanHppGenerator: " << fileName << " is unchanged" << std::endl;
+    return false;
+  }
+
+  std::cout << "VulkanHppGenerator: Writing " << fileName << std::endl;
+  std::ofstream ofs( fileName );
+  if ( ofs.fail() )
+  {
+    throw std::runtime_error( "failed to open file " + fileName );
+  }
+  ofs << formatted;
+  return true;
+}
+
 VulkanHppGenerator::VulkanHppGenerator( tinyxml2::XMLDocument const & document )
 {
   m_handles.insert( std::make_pair(
@@ -1769,7 +1904,8 @@ void VulkanHppGenerator::appendCommandVector( std::string &
 ${enter}${commandStandard}${newlineOnDefinition}
 #ifndef VULKAN_HPP_DISABLE_ENHANCED_MODE
 ${commandEnhanced}${newlineOnDefinition}
-${commandEnhancedWithAllocators}
+${commandEnhancedWithAllocators}${newlineOnDefinition}
+${commandEnhancedInto}
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
 ${leave})";
 
@@ -1782,6 +1918,11 @@ ${leave})";
                 name, commandData, initialSkipCount, definition, vectorParamIndex, false )
             : constructCommandVoidEnumerate(
                 name, commandData, initialSkipCount, definition, vectorParamIndex, returnParamIndices, false ) },
+        { "commandEnhancedInto",
+          ( commandData.returnType == "VkResult" )
+            ? constructCommandResultEnumerateInto( name, commandData, initialSkipCount, definition, vectorParamIndex )
+            : constructCommandVoidEnumerateInto(
+                name, commandData, initialSkipCount, definition, vectorParamIndex, returnParamIndices ) },
         { "commandEnhancedWithAllocators",
           ( commandData.returnType == "VkResult" )
             ? constructCommandResultEnumerate( name, commandData, initialSkipCount, definition, vectorParamIndex, true )
@@ -1809,6 +1950,7 @@ ${enter}${commandStandard}${newlineOnDefinition}
 #ifndef VULKAN_HPP_DISABLE_ENHANCED_MODE
 ${commandEnhanced}${newlineOnDefinition}
 ${commandEnhancedWithAllocator}${newlineOnDefinition}
+${commandEnhancedInto}${newlineOnDefinition}
 ${commandEnhancedChained}${newlineOnDefinition}
 ${commandEnhancedChainedWithAllocator}
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
@@ -1858,6 +2000,12 @@ ${leave})";
                                                     *vectorParamIndices.begin(),
                                                     returnParamIndices,
                                                     true ) },
+        { "commandEnhancedInto",
+          ( commandData.returnType == "VkResult" )
+            ? constructCommandResultEnumerateInto(
+                name, commandData, initialSkipCount, definition, *vectorParamIndices.begin() )
+            : constructCommandVoidEnumerateInto(
+                name, commandData, initialSkipCount, definition, *vectorParamIndices.begin(), returnParamIndices ) },
         { "commandEnhancedWithAllocator",
           ( commandData.returnType == "VkResult" )
             ? constructCommandResultEnumerate(
@@ -1978,6 +2126,7 @@ ${commandEnhancedSingular}${newlineOnDefinition}
 #  ifndef VULKAN_HPP_NO_SMART_HANDLE
 ${commandEnhancedUnique}${newlineOnDefinition}
 ${commandEnhancedUniqueWithAllocators}${newlineOnDefinition}
+${commandEnhancedUniqueArray}${newlineOnDefinition}
 ${commandEnhancedUniqueSingular}
 #  endif /*VULKAN_HPP_NO_SMART_HANDLE*/
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
@@ -1998,6 +2147,9 @@ ${leave})";
         { "commandEnhancedUnique",
           constructCommandResultGetVectorOfHandlesUnique(
             name, commandData, initialSkipCount, definition, vectorParamIndices, returnParamIndex, false ) },
+        { "commandEnhancedUniqueArray",
+          constructCommandResultGetVectorOfHandlesUniqueArray(
+            name, commandData, initialSkipCount, definition, vectorParamIndices, returnParamIndex ) },
         { "commandEnhancedUniqueSingular",
           constructCommandResultGetVectorOfHandlesUniqueSingular(
             name, commandData, initialSkipCount, definition, vectorParamIndices, returnParamIndex ) },
@@ -2030,7 +2182,8 @@ ${commandEnhanced}${newlineOnDefinition}
 ${commandEnhancedWithAllocators}${newlineOnDefinition}
 #  ifndef VULKAN_HPP_NO_SMART_HANDLE
 ${commandEnhancedUnique}${newlineOnDefinition}
-${commandEnhancedUniqueWithAllocators}
+${commandEnhancedUniqueWithAllocators}${newlineOnDefinition}
+${commandEnhancedUniqueArray}
 #  endif /*VULKAN_HPP_NO_SMART_HANDLE*/
 #endif /*VULKAN_HPP_DISABLE_ENHANCED_MODE*/
 ${leave})";
@@ -2047,6 +2200,9 @@ ${leave})";
         { "commandEnhancedUnique",
           constructCommandResultGetVectorOfHandlesUnique(
             name, commandData, initialSkipCount, definition, vectorParamIndices, returnParamIndex, false ) },
+        { "commandEnhancedUniqueArray",
+          constructCommandResultGetVectorOfHandlesUniqueArray(
+            name, commandData, initialSkipCount, definition, vectorParamIndices, returnParamIndex ) },
         { "commandEnhancedUniqueWithAllocators",
           constructCommandResultGetVectorOfHandlesUnique(
             name, commandData, initialSkipCount, definition, vectorParamIndices, returnParamIndex, true ) },
@@ -3318,6 +3474,81 @@ ${CppTypeFromDebugReportObjectTypeEXT}
   m_listedTypes.insert( handleData.first );
 }
 
+void VulkanHppGenerator::appendFormatTraits( std::string & str ) const
+{
+  const std::string formatTraitsTemplate = R"(
+  //=====================
+  //=== FORMAT TRAITS ===
+  //=====================
+
+  struct FormatTraits
+  {
+    uint8_t      blockSize;          // size of a texel block, in bytes
+    uint8_t      texelsPerBlock;     // number of texels in a texel block
+    uint8_t      blockExtent[3];     // width, height, and depth of a texel block, in texels
+    uint8_t      packed;             // size of the word the components are packed into, in bits; 0 if not packed
+    uint8_t      componentCount;
+    uint8_t      componentBits[4];   // size of each component, in bits; 0 for a compressed component
+    char const * componentNames;     // one character per component, like "BGRA", "DS", or "GBR"
+    uint8_t      planeCount;         // 0 for a single-plane format
+    char const * compressionScheme;  // like "BC", "ETC2", or "ASTC LDR"; an empty string for an uncompressed format
+    char const * compatibilityClass; // the formats of a class are compatible for image views
+    bool         hasDepthComponent;
+    bool         hasStencilComponent;
+  };
+
+  // the traits of each format as given by the registry; a format without any known traits gets all zeros
+  VULKAN_HPP_CONSTEXPR_14 VULKAN_HPP_INLINE FormatTraits getFormatTraits( VULKAN_HPP_NAMESPACE::Format format ) VULKAN_HPP_NOEXCEPT
+  {
+    switch( format )
+    {
+${cases}      default: return { 0, 0, { 0, 0, 0 }, 0, 0, { 0, 0, 0, 0 }, "", 0, "", "", false, false };
+    }
+  }
+)";
+
+  auto formatIt = m_enums.find( "VkFormat" );
+  assert( formatIt != m_enums.end() );
+
+  std::string cases;
+  for ( auto const & format : m_formats )
+  {
+    auto valueIt = std::find_if( formatIt->second.values.begin(),
+                                 formatIt->second.values.end(),
+                                 [&format]( EnumValueData const & evd ) { return evd.vulkanValue == format.first; } );
+    assert( valueIt != formatIt->second.values.end() );
+
+    std::vector<std::string> blockExtent =
+      tokenize( format.second.blockExtent.empty() ? "1,1,1" : format.second.blockExtent, "," );
+    assert( blockExtent.size() == 3 );
+
+    std::string componentBits, componentNames;
+    bool        hasDepthComponent = false, hasStencilComponent = false;
+    for ( auto const & component : format.second.components )
+    {
+      componentBits += ( componentBits.empty() ? "" : ", " ) +
+                       ( ( component.bits == "compressed" ) ? std::string( "0" ) : component.bits );
+      componentNames += component.name;
+      hasDepthComponent |= ( component.name == "D" );
+      hasStencilComponent |= ( component.name == "S" );
+    }
+    for ( size_t i = format.second.components.size(); i < 4; i++ )
+    {
+      componentBits += ( componentBits.empty() ? "" : ", " ) + std::string( "0" );
+    }
+
+    cases += "      case VULKAN_HPP_NAMESPACE::Format::" + valueIt->vkValue + ": return { " + format.second.blockSize +
+             ", " + format.second.texelsPerBlock + ", { " + blockExtent[0] + ", " + blockExtent[1] + ", " +
+             blockExtent[2] + " }, " + ( format.second.packed.empty() ? "0" : format.second.packed ) + ", " +
+             std::to_string( format.second.components.size() ) + ", { " + componentBits + " }, \"" + componentNames +
+             "\", " + std::to_string( format.second.planes.size() ) + ", \"" + format.second.compressed + "\", \"" +
+             format.second.classAttribute + "\", " + ( hasDepthComponent ? "true" : "false" ) + ", " +
+             ( hasStencilComponent ? "true" : "false" ) + " };\n";
+  }
+
+  str += replaceWithMap( formatTraitsTemplate, { { "cases", cases } } );
+}
+
 void VulkanHppGenerator::appendHandles( std::string & str )
 {
   for ( auto const & handle : m_handles )
@@ -3598,6 +3829,241 @@ void VulkanHppGenerator::appendRAIIHandles( std::string & str, std::string & com
   }
 }
 
+void VulkanHppGenerator::appendRAIIInterningCaches( std::string & str ) const
+{
+  // the handle types with an immutable create info, that are frequently re-created with identical create infos
+  const std::vector<std::string> internedHandles = {
+    "VkDescriptorSetLayout", "VkPipelineLayout", "VkRenderPass", "VkSampler", "VkSamplerYcbcrConversion"
+  };
+
+  str += R"(
+    // appends the deep key of a value to key, and returns false if the value can't be keyed, like a structure with a
+    // pNext chain; plain values like enums, flags, handles, and numbers are keyed by their bits, the structures
+    // reachable from the create info of an interned handle type have a specialization
+    template <typename T>
+    struct InterningKey
+    {
+      static bool append( std::vector<uint64_t> & key, T const & value )
+      {
+        static_assert( sizeof( T ) <= sizeof( uint64_t ), "a structure needs a specialization of InterningKey" );
+        uint64_t word = 0;
+        memcpy( &word, &value, sizeof( T ) );
+        key.push_back( word );
+        return true;
+      }
+    };
+
+    template <typename T>
+    bool appendInterningKey( std::vector<uint64_t> & key, T const & value )
+    {
+      return InterningKey<T>::append( key, value );
+    }
+
+    // an array is keyed by whether it's there and by its elements, not by its address
+    template <typename T>
+    bool appendInterningKey( std::vector<uint64_t> & key, T const * values, uint32_t count )
+    {
+      key.push_back( values ? 1 : 0 );
+      bool keyed = true;
+      for ( uint32_t i = 0; keyed && values && ( i < count ); i++ )
+      {
+        keyed = InterningKey<T>::append( key, values[i] );
+      }
+      return keyed;
+    }
+
+    // A get-or-create cache for the handles with an immutable create info: equal create infos give the same, shared
+    // handle, even if their arrays are at different addresses. A hit is lock-free, a miss creates the handle under a
+    // mutex. A create info with a pNext chain is not keyed, and always gives a new handle of its own. The pointers in a
+    // create info are followed as given, so the ones Vulkan would ignore must be null. As the hits don't lock, trim and
+    // clear must not run while any other thread is in get. The cache must not outlive its device, while the handles it
+    // handed out might outlive the cache.
+    template <typename HandleType, typename CreateInfoType>
+    class InterningCache
+    {
+    public:
+      struct Statistics
+      {
+        size_t size;      // number of handles currently cached
+        size_t hits;      // number of gets that found their handle
+        size_t misses;    // number of gets that created a cached handle
+        size_t uncached;  // number of gets that created a handle of its own, as its create info could not be keyed
+      };
+
+    public:
+      // the bucket index is taken from the lower bits of the hash, so bucketCount is a power of two
+      explicit InterningCache( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                               size_t                                                          bucketCount = 64 )
+        : m_device( &device ), m_buckets( bucketCount ), m_size( 0 ), m_hits( 0 ), m_misses( 0 ), m_uncached( 0 )
+      {
+        VULKAN_HPP_ASSERT( ( 0 < bucketCount ) && ( ( bucketCount & ( bucketCount - 1 ) ) == 0 ) );
+        for ( auto & bucket : m_buckets )
+        {
+          bucket.store( nullptr, std::memory_order_relaxed );
+        }
+      }
+
+      InterningCache( InterningCache const & )             = delete;
+      InterningCache & operator=( InterningCache const & ) = delete;
+
+      ~InterningCache()
+      {
+        clear();
+      }
+
+      std::shared_ptr<HandleType const> get( CreateInfoType const & createInfo )
+      {
+        // the keys are built in a buffer per thread, such that a hit doesn't allocate
+        static thread_local std::vector<uint64_t> key;
+        key.clear();
+        if ( !appendInterningKey( key, createInfo ) )
+        {
+          m_uncached.fetch_add( 1, std::memory_order_relaxed );
+          return std::make_shared<HandleType>( *m_device, createInfo );
+        }
+
+        size_t                 hash = hashKey( key );
+        std::atomic<Entry *> & head = m_buckets[hash & ( m_buckets.size() - 1 )];
+        if ( Entry const * entry = find( head.load( std::memory_order_acquire ), hash, key ) )
+        {
+          m_hits.fetch_add( 1, std::memory_order_relaxed );
+          return entry->handle;
+        }
+
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( Entry const * entry = find( head.load( std::memory_order_relaxed ), hash, key ) )
+        {
+          // another thread created it meanwhile
+          m_hits.fetch_add( 1, std::memory_order_relaxed );
+          return entry->handle;
+        }
+
+        // the entry is completely set up before it's published to the readers
+        std::unique_ptr<Entry> entry( new Entry );
+        entry->key    = key;
+        entry->hash   = hash;
+        entry->handle = std::make_shared<HandleType>( *m_device, createInfo );
+        entry->next.store( head.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+        head.store( entry.get(), std::memory_order_release );
+        m_size++;
+        m_misses.fetch_add( 1, std::memory_order_relaxed );
+        return entry.release()->handle;
+      }
+
+      // destroys the cached handles nobody else holds any more, and returns their number; no other thread may be in get
+      // meanwhile, as a lock-free hit could take a handle just found unused, or still stand on its entry
+      size_t trim()
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        size_t                      trimmed = 0;
+        for ( auto & bucket : m_buckets )
+        {
+          std::atomic<Entry *> * link = &bucket;
+          while ( Entry * entry = link->load( std::memory_order_relaxed ) )
+          {
+            if ( entry->handle.use_count() == 1 )
+            {
+              link->store( entry->next.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+              delete entry;
+              trimmed++;
+            }
+            else
+            {
+              link = &entry->next;
+            }
+          }
+        }
+        m_size -= trimmed;
+        return trimmed;
+      }
+
+      // releases all the cached handles; no other thread may use the cache meanwhile
+      void clear()
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        for ( auto & bucket : m_buckets )
+        {
+          Entry * entry = bucket.exchange( nullptr, std::memory_order_relaxed );
+          while ( entry )
+          {
+            Entry * next = entry->next.load( std::memory_order_relaxed );
+            delete entry;
+            entry = next;
+          }
+        }
+        m_size = 0;
+      }
+
+      Statistics getStatistics() const
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        Statistics                  statistics;
+        statistics.size     = m_size;
+        statistics.hits     = m_hits.load( std::memory_order_relaxed );
+        statistics.misses   = m_misses.load( std::memory_order_relaxed );
+        statistics.uncached = m_uncached.load( std::memory_order_relaxed );
+        return statistics;
+      }
+
+    private:
+      struct Entry
+      {
+        std::vector<uint64_t>             key;
+        size_t                            hash;
+        std::shared_ptr<HandleType const> handle;
+        std::atomic<Entry *>              next;
+      };
+
+      static Entry const * find( Entry const * entry, size_t hash, std::vector<uint64_t> const & key )
+      {
+        while ( entry && ( ( entry->hash != hash ) || ( entry->key != key ) ) )
+        {
+          entry = entry->next.load( std::memory_order_acquire );
+        }
+        return entry;
+      }
+
+      static size_t hashKey( std::vector<uint64_t> const & key ) VULKAN_HPP_NOEXCEPT
+      {
+        // FNV-1a over the words of the key
+        uint64_t hash = 14695981039346656037ull;
+        for ( auto word : key )
+        {
+          hash = ( hash ^ word ) * 1099511628211ull;
+        }
+        return static_cast<size_t>( hash ^ ( hash >> 32 ) );
+      }
+
+    private:
+      VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const * m_device;
+      std::vector<std::atomic<Entry *>>                               m_buckets;
+      mutable std::mutex                                              m_mutex;  // guards all changes of the buckets
+      size_t                                                          m_size;
+      std::atomic<size_t>                                             m_hits;
+      std::atomic<size_t>                                             m_misses;
+      std::atomic<size_t>                                             m_uncached;
+    };
+)";
+
+  // the keys of the create infos, preceded by the keys of the structures they reference
+  std::set<std::string> listedStructures;
+  for ( auto const & handle : internedHandles )
+  {
+    assert( findHandle( handle ) != m_handles.end() );
+    appendRAIIInterningKey( str, handle + "CreateInfo", listedStructures );
+  }
+
+  const std::string cacheTemplate = R"(
+    using ${handleType}InterningCache = InterningCache<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType},
+                                                       VULKAN_HPP_NAMESPACE::${handleType}CreateInfo>;
+)";
+
+  for ( auto const & handle : internedHandles )
+  {
+    str += replaceWithMap( cacheTemplate, { { "handleType", stripPrefix( handle, "Vk" ) } } );
+  }
+}
+
 // Intended only for `enum class Result`!
 void VulkanHppGenerator::appendResultExceptions( std::string & str ) const
 {
@@ -3756,17 +4222,27 @@ ${leave})";
     {
       // it's a handle class with a friendly handles class
       const std::string handlesTemplate = R"(
-${enter}  class ${handleType}s : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}>
+${enter}  template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}>>
+  class Basic${handleType}s : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}, Allocator>
   {
   public:
     ${arrayConstructors}
 
-    ${handleType}s() = delete;
-    ${handleType}s( ${handleType}s const & ) = delete;
-    ${handleType}s( ${handleType}s && rhs ) = default;
-    ${handleType}s & operator=( ${handleType}s const & ) = delete;
-    ${handleType}s & operator=( ${handleType}s && rhs ) = default;
+    Basic${handleType}s() = delete;
+    Basic${handleType}s( Basic${handleType}s const & ) = delete;
+    Basic${handleType}s( Basic${handleType}s && rhs ) = default;
+    Basic${handleType}s & operator=( Basic${handleType}s const & ) = delete;
+    Basic${handleType}s & operator=( Basic${handleType}s && rhs ) = default;
   };
+
+  using ${handleType}s = Basic${handleType}s<>;
+
+#if defined( VULKAN_HPP_RAII_HAS_PMR )
+  namespace pmr
+  {
+    using ${handleType}s = Basic${handleType}s<std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}>>;
+  }
+#endif
 ${leave}
 )";
 
@@ -3832,6 +4308,86 @@ ${memberFunctionDeclarations}
   str += replaceWithMap( contextTemplate, { { "memberFunctionDeclarations", declarations } } );
 }
 
+void VulkanHppGenerator::appendRAIIInterningKey( std::string &           str,
+                                                 std::string const &     structureName,
+                                                 std::set<std::string> & listedStructures ) const
+{
+  auto structureIt = findStructure( structureName );
+  assert( structureIt != m_structures.end() );
+  if ( !listedStructures.insert( structureIt->first ).second )
+  {
+    return;
+  }
+  check( !structureIt->second.isUnion,
+         structureIt->second.xmlLine,
+         "interning key of union <" + structureIt->first + "> is not supported" );
+
+  std::vector<MemberData> const & members = structureIt->second.members;
+  for ( auto const & member : members )
+  {
+    if ( ( member.name != "pNext" ) && ( findStructure( member.type.type ) != m_structures.end() ) )
+    {
+      appendRAIIInterningKey( str, member.type.type, listedStructures );
+    }
+  }
+
+  std::string terms;
+  for ( auto const & member : members )
+  {
+    std::string term;
+    if ( member.name == "sType" )
+    {
+      continue;
+    }
+    else if ( member.name == "pNext" )
+    {
+      // a structure with a pNext chain is not keyed
+      term = "!value.pNext";
+    }
+    else if ( member.type.isValue() && member.arraySizes.empty() )
+    {
+      term = "appendInterningKey( key, value." + member.name + " )";
+    }
+    else if ( member.type.isValue() && ( member.arraySizes.size() == 1 ) )
+    {
+      term = "appendInterningKey( key, value." + member.name + ".data(), static_cast<uint32_t>( value." + member.name +
+             ".size() ) )";
+    }
+    else
+    {
+      check( member.type.isConstPointer() && ( member.type.postfix == "*" ) && ( member.type.type != "void" ),
+             member.xmlLine,
+             "interning key of member <" + member.name + "> of type <" + member.type.compose() + "> is not supported" );
+      std::string count = "1";
+      if ( !member.len.empty() )
+      {
+        check( std::find_if( members.begin(),
+                             members.end(),
+                             [&member]( MemberData const & md ) { return md.name == member.len[0]; } ) != members.end(),
+               member.xmlLine,
+               "interning key of member <" + member.name + "> with len <" + member.len[0] + "> is not supported" );
+        count = "value." + member.len[0];
+      }
+      term = "appendInterningKey( key, value." + member.name + ", " + count + " )";
+    }
+    terms += ( terms.empty() ? "" : " && " ) + term;
+  }
+
+  const std::string keyTemplate = R"(
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::${structureType}>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::${structureType} const & value )
+      {
+        return ${terms};
+      }
+    };
+)";
+
+  str += replaceWithMap( keyTemplate,
+                         { { "structureType", stripPrefix( structureIt->first, "Vk" ) }, { "terms", terms } } );
+}
+
 void VulkanHppGenerator::appendStruct( std::string & str, std::pair<std::string, StructureData> const & structure )
 {
   assert( m_listingTypes.find( structure.first ) == m_listingTypes.end() );
@@ -4757,39 +5313,137 @@ std::string
 }
 
 std::string
-  VulkanHppGenerator::constructCommandResultEnumerateTwoVectors( std::string const &              name,
-                                                                 CommandData const &              commandData,
-                                                                 size_t                           initialSkipCount,
-                                                                 bool                             definition,
-                                                                 std::map<size_t, size_t> const & vectorParamIndices,
-                                                                 std::vector<size_t> const &      returnParamIndices,
-                                                                 bool                             withAllocators ) const
+  VulkanHppGenerator::constructCommandResultEnumerateInto( std::string const &               name,
+                                                           CommandData const &               commandData,
+                                                           size_t                            initialSkipCount,
+                                                           bool                              definition,
+                                                           std::pair<size_t, size_t> const & vectorParamIndices ) const
 {
-  assert( !commandData.handle.empty() && ( commandData.returnType == "VkResult" ) );
+  assert( commandData.returnType == "VkResult" );
   assert( ( commandData.successCodes.size() == 2 ) && ( commandData.successCodes[0] == "VK_SUCCESS" ) &&
           ( commandData.successCodes[1] == "VK_INCOMPLETE" ) );
 
-  auto firstVectorParamIt  = vectorParamIndices.begin();
-  auto secondVectorParamIt = std::next( firstVectorParamIt );
-
-  assert( commandData.params[0].type.type == commandData.handle );
-  assert( firstVectorParamIt->second == secondVectorParamIt->second );
-
-  std::set<size_t> skippedParams =
-    determineSkippedParams( commandData.params, initialSkipCount, vectorParamIndices, returnParamIndices, false );
+  std::set<size_t> skippedParams = determineSkippedParams( commandData.params,
+                                                           initialSkipCount,
+                                                           { vectorParamIndices },
+                                                           { vectorParamIndices.second, vectorParamIndices.first },
+                                                           false );
 
+  // no default arguments before the vector to fill
   std::string argumentList =
-    constructArgumentListEnhanced( commandData.params, skippedParams, {}, definition, withAllocators, false, true );
-  std::string commandName = determineCommandName( name, commandData.params[initialSkipCount - 1].type.type, m_tags );
-  std::string nodiscard = determineNoDiscard( 1 < commandData.successCodes.size(), 1 < commandData.errorCodes.size() );
-  std::string templateTypeFirst  = stripPrefix( commandData.params[firstVectorParamIt->first].type.type, "Vk" );
-  std::string templateTypeSecond = stripPrefix( commandData.params[secondVectorParamIt->first].type.type, "Vk" );
+    constructArgumentListEnhanced( commandData.params, skippedParams, {}, true, false, false, false );
+  std::string commandName =
+    determineCommandName( name, initialSkipCount ? commandData.params[initialSkipCount - 1].type.type : "", m_tags );
+  std::string nodiscard         = determineNoDiscard( false, 1 < commandData.errorCodes.size() );
+  std::string vectorElementType = ( commandData.params[vectorParamIndices.first].type.type == "void" )
+                                    ? "uint8_t"
+                                    : stripPrefix( commandData.params[vectorParamIndices.first].type.type, "Vk" );
+  std::string allocatorType     = startUpperCase( vectorElementType ) + "Allocator";
+  std::string vectorName = startLowerCase( stripPrefix( commandData.params[vectorParamIndices.first].name, "p" ) );
+  argumentList += std::string( argumentList.empty() ? "" : ", " ) + "std::vector<" + vectorElementType + ", " +
+                  allocatorType + "> & " + vectorName + ", Dispatch const & d" +
+                  ( definition ? "" : " VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT" );
 
   if ( definition )
   {
     const std::string functionTemplate =
-      R"(  template <typename ${templateTypeFirst}Allocator, typename ${templateTypeSecond}Allocator, typename Dispatch${typenameCheck}>
-  ${nodiscard}VULKAN_HPP_INLINE typename ResultValueType<std::pair<std::vector<${templateTypeFirst}, ${templateTypeFirst}Allocator>, std::vector<${templateTypeSecond}, ${templateTypeSecond}Allocator>>>::type ${className}${classSeparator}${commandName}( ${argumentList} ) const
+      R"(  template <typename ${allocatorType}, typename Dispatch>
+  ${nodiscard}VULKAN_HPP_INLINE typename ResultValueType<void>::type ${className}${classSeparator}${commandName}( ${argumentList} )${const}
+  {
+    // try a single call with the capacity of ${vectorName} first, use the two-step protocol only if that's not enough
+    ${counterType} ${counterName} = static_cast<${counterType}>( ${vectorName}.capacity() );
+    Result result = Result::eIncomplete;
+    if ( ${counterName} )
+    {
+      ${vectorName}.resize( ${counterName} );
+      result = static_cast<Result>( d.${vkCommand}( ${secondCallArguments} ) );
+    }
+    while ( result == Result::eIncomplete )
+    {
+      result = static_cast<Result>( d.${vkCommand}( ${firstCallArguments} ) );
+      if ( ( result == Result::eSuccess ) && ${counterName} )
+      {
+        ${vectorName}.resize( ${counterName} );
+        result = static_cast<Result>( d.${vkCommand}( ${secondCallArguments} ) );
+        VULKAN_HPP_ASSERT( ${counterName} <= ${vectorName}.size() );
+      }
+    }
+    if ( ( result == Result::eSuccess ) && ( ${counterName} < ${vectorName}.size() ) )
+    {
+      ${vectorName}.resize( ${counterName} );
+    }
+    return createResultValue( result, VULKAN_HPP_NAMESPACE_STRING"::${className}${classSeparator}${commandName}" );
+  })";
+
+    return replaceWithMap(
+      functionTemplate,
+      { { "allocatorType", allocatorType },
+        { "argumentList", argumentList },
+        { "className",
+          initialSkipCount ? stripPrefix( commandData.params[initialSkipCount - 1].type.type, "Vk" ) : "" },
+        { "classSeparator", commandData.handle.empty() ? "" : "::" },
+        { "commandName", commandName },
+        { "const", commandData.handle.empty() ? "" : " const" },
+        { "counterName", startLowerCase( stripPrefix( commandData.params[vectorParamIndices.second].name, "p" ) ) },
+        { "counterType", commandData.params[vectorParamIndices.second].type.type },
+        { "firstCallArguments",
+          constructCallArgumentsEnhanced( commandData.params, initialSkipCount, true, {}, {}, false ) },
+        { "nodiscard", nodiscard },
+        { "secondCallArguments",
+          constructCallArgumentsEnhanced( commandData.params, initialSkipCount, false, {}, {}, false ) },
+        { "vectorName", vectorName },
+        { "vkCommand", name } } );
+  }
+  else
+  {
+    const std::string functionTemplate =
+      R"(    template <typename ${allocatorType} = std::allocator<${vectorElementType}>, typename Dispatch = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE>
+    ${nodiscard}typename ResultValueType<void>::type ${commandName}( ${argumentList} )${const};)";
+
+    return replaceWithMap( functionTemplate,
+                           { { "allocatorType", allocatorType },
+                             { "argumentList", argumentList },
+                             { "const", commandData.handle.empty() ? "" : " const" },
+                             { "commandName", commandName },
+                             { "nodiscard", nodiscard },
+                             { "vectorElementType", vectorElementType } } );
+  }
+}
+
+std::string
+  VulkanHppGenerator::constructCommandResultEnumerateTwoVectors( std::string const &              name,
+                                                                 CommandData const &              commandData,
+                                                                 size_t                           initialSkipCount,
+                                                                 bool                             definition,
+                                                                 std::map<size_t, size_t> const & vectorParamIndices,
+                                                                 std::vector<size_t> const &      returnParamIndices,
+                                                                 bool                             withAllocators ) const
+{
+  assert( !commandData.handle.empty() && ( commandData.returnType == "VkResult" ) );
+  assert( ( commandData.successCodes.size() == 2 ) && ( commandData.successCodes[0] == "VK_SUCCESS" ) &&
+          ( commandData.successCodes[1] == "VK_INCOMPLETE" ) );
+
+  auto firstVectorParamIt  = vectorParamIndices.begin();
+  auto secondVectorParamIt = std::next( firstVectorParamIt );
+
+  assert( commandData.params[0].type.type == commandData.handle );
+  assert( firstVectorParamIt->second == secondVectorParamIt->second );
+
+  std::set<size_t> skippedParams =
+    determineSkippedParams( commandData.params, initialSkipCount, vectorParamIndices, returnParamIndices, false );
+
+  std::string argumentList =
+    constructArgumentListEnhanced( commandData.params, skippedParams, {}, definition, withAllocators, false, true );
+  std::string commandName = determineCommandName( name, commandData.params[initialSkipCount - 1].type.type, m_tags );
+  std::string nodiscard = determineNoDiscard( 1 < commandData.successCodes.size(), 1 < commandData.errorCodes.size() );
+  std::string templateTypeFirst  = stripPrefix( commandData.params[firstVectorParamIt->first].type.type, "Vk" );
+  std::string templateTypeSecond = stripPrefix( commandData.params[secondVectorParamIt->first].type.type, "Vk" );
+
+  if ( definition )
+  {
+    const std::string functionTemplate =
+      R"(  template <typename ${templateTypeFirst}Allocator, typename ${templateTypeSecond}Allocator, typename Dispatch${typenameCheck}>
+  ${nodiscard}VULKAN_HPP_INLINE typename ResultValueType<std::pair<std::vector<${templateTypeFirst}, ${templateTypeFirst}Allocator>, std::vector<${templateTypeSecond}, ${templateTypeSecond}Allocator>>>::type ${className}${classSeparator}${commandName}( ${argumentList} ) const
   {
     std::pair<std::vector<${templateTypeFirst}, ${templateTypeFirst}Allocator>, std::vector<${templateTypeSecond}, ${templateTypeSecond}Allocator>> data${pairConstructor};
     std::vector<${templateTypeFirst}, ${templateTypeFirst}Allocator> & ${firstVectorName} = data.first;
@@ -5875,28 +6529,6 @@ std::string VulkanHppGenerator::constructCommandResultGetVectorOfHandlesUnique(
 
     std::string className =
       initialSkipCount ? stripPrefix( commandData.params[initialSkipCount - 1].type.type, "Vk" ) : "";
-
-    std::string              deleterDefinition;
-    std::vector<std::string> lenParts = tokenize( commandData.params[returnParamIndex].len, "->" );
-    switch ( lenParts.size() )
-    {
-      case 1: deleterDefinition = "ObjectDestroy<" + className + ", Dispatch> deleter( *this, allocator, d )"; break;
-      case 2:
-        {
-          auto vpiIt = vectorParamIndices.find( returnParamIndex );
-          assert( vpiIt != vectorParamIndices.end() );
-          std::string poolType, poolName;
-          std::tie( poolType, poolName ) = getPoolTypeAndName( commandData.params[vpiIt->second].type.type );
-          assert( !poolType.empty() );
-          poolType = stripPrefix( poolType, "Vk" );
-          poolName = startLowerCase( stripPrefix( lenParts[0], "p" ) ) + "." + poolName;
-
-          deleterDefinition =
-            "PoolFree<" + className + ", " + poolType + ", Dispatch> deleter( *this, " + poolName + ", d )";
-        }
-        break;
-    }
-
     std::string typenameCheck =
       withAllocator ? ( ", typename B, typename std::enable_if<std::is_same<typename B::value_type, UniqueHandle<" +
                         handleType + ", Dispatch>>::value, int>::type " )
@@ -5912,7 +6544,8 @@ std::string VulkanHppGenerator::constructCommandResultGetVectorOfHandlesUnique(
         { "className", className },
         { "classSeparator", commandData.handle.empty() ? "" : "::" },
         { "commandName", commandName },
-        { "deleterDefinition", deleterDefinition },
+        { "deleterDefinition",
+          constructUniqueDeleterDefinition( commandData, className, vectorParamIndices, returnParamIndex ) },
         { "handleType", handleType },
         { "nodiscard", nodiscard },
         { "returnType", returnType },
@@ -5947,6 +6580,83 @@ std::string VulkanHppGenerator::constructCommandResultGetVectorOfHandlesUnique(
   }
 }
 
+std::string VulkanHppGenerator::constructCommandResultGetVectorOfHandlesUniqueArray(
+  std::string const &              name,
+  CommandData const &              commandData,
+  size_t                           initialSkipCount,
+  bool                             definition,
+  std::map<size_t, size_t> const & vectorParamIndices,
+  size_t                           returnParamIndex ) const
+{
+  assert( commandData.returnType == "VkResult" );
+
+  std::set<size_t> skippedParams =
+    determineSkippedParams( commandData.params, initialSkipCount, vectorParamIndices, { returnParamIndex }, false );
+
+  std::string argumentList =
+    constructArgumentListEnhanced( commandData.params, skippedParams, {}, definition, false, false, true );
+  std::string commandName = determineCommandName( name, commandData.params[initialSkipCount - 1].type.type, m_tags );
+  std::string nodiscard  = determineNoDiscard( 1 < commandData.successCodes.size(), 1 < commandData.errorCodes.size() );
+  std::string handleType = stripPrefix( commandData.params[returnParamIndex].type.type, "Vk" );
+  std::string returnType = ( commandData.successCodes.size() == 1 )
+                             ? ( "typename ResultValueType<UniqueHandleArray<" + handleType + ", Dispatch>>::type" )
+                             : ( "ResultValue<UniqueHandleArray<" + handleType + ", Dispatch>>" );
+
+  if ( definition )
+  {
+    std::string const functionTemplate =
+      R"(  template <typename Dispatch>
+  ${nodiscard}VULKAN_HPP_INLINE ${returnType} ${className}${classSeparator}${commandName}UniqueArray( ${argumentList} ) const
+  {
+    std::vector<${handleType}> ${vectorName}( ${vectorSize} );
+    Result result = static_cast<Result>( d.${vkCommand}( ${callArguments} ) );
+    UniqueHandleArray<${handleType}, Dispatch> ${uniqueVectorName};
+    if ( ${successCheck} )
+    {
+      ${deleterDefinition};
+      ${uniqueVectorName} = UniqueHandleArray<${handleType}, Dispatch>( std::move( ${vectorName} ), deleter );
+    }
+    return createResultValue( result, std::move( ${uniqueVectorName} ), VULKAN_HPP_NAMESPACE_STRING "::${className}${classSeparator}${commandName}UniqueArray"${successCodeList} );
+  })";
+
+    std::string className =
+      initialSkipCount ? stripPrefix( commandData.params[initialSkipCount - 1].type.type, "Vk" ) : "";
+
+    return replaceWithMap(
+      functionTemplate,
+      { { "argumentList", argumentList },
+        { "callArguments",
+          constructCallArgumentsEnhanced(
+            commandData.params, initialSkipCount, false, {}, { returnParamIndex }, false ) },
+        { "className", className },
+        { "classSeparator", commandData.handle.empty() ? "" : "::" },
+        { "commandName", commandName },
+        { "deleterDefinition",
+          constructUniqueDeleterDefinition( commandData, className, vectorParamIndices, returnParamIndex ) },
+        { "handleType", handleType },
+        { "nodiscard", nodiscard },
+        { "returnType", returnType },
+        { "successCheck", constructSuccessCheck( commandData.successCodes ) },
+        { "successCodeList", constructSuccessCodeList( commandData.successCodes ) },
+        { "uniqueVectorName", "unique" + stripPrefix( commandData.params[returnParamIndex].name, "p" ) },
+        { "vectorName", startLowerCase( stripPrefix( commandData.params[returnParamIndex].name, "p" ) ) },
+        { "vectorSize", getVectorSize( commandData.params, vectorParamIndices, returnParamIndex ) },
+        { "vkCommand", name } } );
+  }
+  else
+  {
+    std::string const functionTemplate =
+      R"(    template <typename Dispatch = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE>
+    ${nodiscard}${returnType} ${commandName}UniqueArray( ${argumentList} ) const;)";
+
+    return replaceWithMap( functionTemplate,
+                           { { "argumentList", argumentList },
+                             { "commandName", commandName },
+                             { "nodiscard", nodiscard },
+                             { "returnType", returnType } } );
+  }
+}
+
 std::string VulkanHppGenerator::constructCommandResultGetVectorOfHandlesUniqueSingular(
   std::string const &              name,
   CommandData const &              commandData,
@@ -6492,6 +7202,89 @@ std::string
   }
 }
 
+std::string
+  VulkanHppGenerator::constructCommandVoidEnumerateInto( std::string const &               name,
+                                                         CommandData const &               commandData,
+                                                         size_t                            initialSkipCount,
+                                                         bool                              definition,
+                                                         std::pair<size_t, size_t> const & vectorParamIndex,
+                                                         std::vector<size_t> const &       returnParamIndices ) const
+{
+  assert( commandData.params[0].type.type == commandData.handle && ( commandData.returnType == "void" ) &&
+          commandData.successCodes.empty() && commandData.errorCodes.empty() );
+
+  std::set<size_t> skippedParams =
+    determineSkippedParams( commandData.params, initialSkipCount, { vectorParamIndex }, returnParamIndices, false );
+
+  // no default arguments before the vector to fill
+  std::string argumentList =
+    constructArgumentListEnhanced( commandData.params, skippedParams, {}, true, false, false, false );
+  std::string commandName = determineCommandName( name, commandData.params[initialSkipCount - 1].type.type, m_tags );
+  std::string vectorElementType = stripPrefix( commandData.params[vectorParamIndex.first].type.type, "Vk" );
+  std::string vectorName = startLowerCase( stripPrefix( commandData.params[vectorParamIndex.first].name, "p" ) );
+  argumentList += std::string( argumentList.empty() ? "" : ", " ) + "std::vector<" + vectorElementType + ", " +
+                  vectorElementType + "Allocator> & " + vectorName + ", Dispatch const & d" +
+                  ( definition ? "" : " VULKAN_HPP_DEFAULT_DISPATCHER_ASSIGNMENT" );
+
+  if ( definition )
+  {
+    const std::string functionTemplate =
+      R"(  template <typename ${vectorElementType}Allocator, typename Dispatch>
+  VULKAN_HPP_INLINE void ${className}${classSeparator}${commandName}( ${argumentList} ) const
+  {
+    // try a single call with the capacity of ${vectorName} first; as there's no eIncomplete, only a count below that
+    // capacity is known to be complete, otherwise query the count
+    ${counterType} ${counterName} = static_cast<${counterType}>( ${vectorName}.capacity() );
+    if ( ${counterName} )
+    {
+      ${vectorName}.resize( ${counterName} );
+      d.${vkCommand}( ${secondCallArguments} );
+      if ( ${counterName} < ${vectorName}.size() )
+      {
+        ${vectorName}.resize( ${counterName} );
+        return;
+      }
+    }
+    d.${vkCommand}( ${firstCallArguments} );
+    if ( ${counterName} != ${vectorName}.size() )
+    {
+      ${vectorName}.resize( ${counterName} );
+      d.${vkCommand}( ${secondCallArguments} );
+      VULKAN_HPP_ASSERT( ${counterName} <= ${vectorName}.size() );
+    }
+  })";
+
+    return replaceWithMap(
+      functionTemplate,
+      { { "argumentList", argumentList },
+        { "className",
+          initialSkipCount ? stripPrefix( commandData.params[initialSkipCount - 1].type.type, "Vk" ) : "" },
+        { "classSeparator", commandData.handle.empty() ? "" : "::" },
+        { "commandName", commandName },
+        { "counterName", startLowerCase( stripPrefix( commandData.params[vectorParamIndex.second].name, "p" ) ) },
+        { "counterType", commandData.params[vectorParamIndex.second].type.type },
+        { "firstCallArguments",
+          constructCallArgumentsEnhanced( commandData.params, initialSkipCount, true, {}, returnParamIndices, false ) },
+        { "secondCallArguments",
+          constructCallArgumentsEnhanced(
+            commandData.params, initialSkipCount, false, {}, returnParamIndices, false ) },
+        { "vectorElementType", vectorElementType },
+        { "vectorName", vectorName },
+        { "vkCommand", name } } );
+  }
+  else
+  {
+    const std::string functionTemplate =
+      R"(    template <typename ${vectorElementType}Allocator = std::allocator<${vectorElementType}>, typename Dispatch = VULKAN_HPP_DEFAULT_DISPATCHER_TYPE>
+    void ${commandName}( ${argumentList} ) const;)";
+
+    return replaceWithMap( functionTemplate,
+                           { { "argumentList", argumentList },
+                             { "commandName", commandName },
+                             { "vectorElementType", vectorElementType } } );
+  }
+}
+
 std::string VulkanHppGenerator::constructCommandVoidGetChain( std::string const & name,
                                                               CommandData const & commandData,
                                                               size_t              initialSkipCount,
@@ -6654,6 +7447,12 @@ std::string VulkanHppGenerator::constructConstexprString( std::pair<std::string,
                            : "";
 }
 
+std::string VulkanHppGenerator::constructCommandId( std::string const & command ) const
+{
+  assert( beginsWith( command, "vk" ) && ( m_commands.find( command ) != m_commands.end() ) );
+  return "e" + stripPrefix( command, "vk" );
+}
+
 std::string VulkanHppGenerator::constructFailureCheck( std::vector<std::string> const & successCodes ) const
 {
   assert( !successCodes.empty() );
@@ -6667,7 +7466,7 @@ std::string VulkanHppGenerator::constructFailureCheck( std::vector<std::string>
         "&& ( result != VULKAN_HPP_NAMESPACE::Result::" + createSuccessCode( successCodes[i], m_tags ) + " )";
     }
   }
-  return failureCheck;
+  return "VULKAN_HPP_UNLIKELY( " + failureCheck + " )";
 }
 
 std::string VulkanHppGenerator::constructFunctionBodyEnhanced( std::string const &              indentation,
@@ -7028,10 +7827,11 @@ std::string VulkanHppGenerator::constructRAIIHandleConstructorEnumerate(
 
   const std::string constructorTemplate =
     R"(
-${enter}    ${handleType}s( ${constructorArguments} )
+${enter}    Basic${handleType}s( ${constructorArguments}, Allocator const & handlesAllocator = Allocator() )
+      : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}, Allocator>( handlesAllocator )
     {
       ${dispatcherType} const * dispatcher = ${parentName}.getDispatcher();
-      std::vector<${vectorElementType}> ${vectorName};
+      ScratchVector<${vectorElementType}> ${vectorName};
       ${counterType} ${counterName};
       VULKAN_HPP_NAMESPACE::Result result;
       do
@@ -7044,7 +7844,7 @@ ${enter}    ${handleType}s( ${constructorArguments} )
           VULKAN_HPP_ASSERT( ${counterName} <= ${vectorName}.size() );
         }
       } while ( result == VULKAN_HPP_NAMESPACE::Result::eIncomplete );
-      if ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
         this->reserve( ${counterName} );
         for ( auto const & ${handleName} : ${vectorName} )
@@ -7054,14 +7854,15 @@ ${enter}    ${handleType}s( ${constructorArguments} )
       }
       else
       {
-        throwResultException( result, "${constructorCall}" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
       }
     }
 ${leave})";
 
   return replaceWithMap(
     constructorTemplate,
-    { { "constructorArguments",
+    { { "commandId", constructCommandId( constructorIt->first ) },
+      { "constructorArguments",
         constructRAIIHandleConstructorArguments( handle.first, constructorIt->second.params, false, false ) },
       { "constructorCall", constructorIt->first },
       { "counterName", startLowerCase( stripPrefix( lenParamIt->name, "p" ) ) },
@@ -7171,7 +7972,7 @@ std::string VulkanHppGenerator::constructRAIIHandleConstructorResult(
 {
   std::string callArguments = constructRAIIHandleConstructorCallArguments(
     handle.first, constructorIt->second.params, false, {}, {}, handle.second.destructorIt != m_commands.end() );
-  std::string constructorArguments, dispatcherArgument, dispatcherInit, getDispatcher;
+  std::string constructorArguments, dispatcherArgument, dispatcherInit, dispatcherInitOnSuccess, getDispatcher;
   if ( handle.first == "VkInstance" )
   {
     constructorArguments = "VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Context const & context";
@@ -7193,9 +7994,12 @@ std::string VulkanHppGenerator::constructRAIIHandleConstructorResult(
   }
   constructorArguments += constructRAIIHandleConstructorArguments(
     handle.first, constructorIt->second.params, false, handle.first == "VkInstance" );
+  std::string handleType = stripPrefix( handle.first, "Vk" );
+  std::string handleName = startLowerCase( handleType );
   if ( ( handle.first == "VkDevice" ) || ( handle.first == "VkInstance" ) )
   {
-    dispatcherInit = "\n    m_dispatcher.init( static_cast<" + handle.first + ">( m_" + startLowerCase( stripPrefix( handle.first, "Vk" ) ) + " ) );";
+    dispatcherInit = "\n    m_dispatcher.init( static_cast<" + handle.first + ">( m_" + handleName + " ) );";
+    dispatcherInitOnSuccess = "\n      else\n      {" + dispatcherInit + "\n      }";
   }
   std::string initializationList = constructRAIIHandleConstructorInitializationList(
     handle.first, constructorIt, handle.second.destructorIt, !handle.second.secondLevelCommands.empty() );
@@ -7208,23 +8012,44 @@ ${enter}    ${handleType}( ${constructorArguments} )
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( ${getDispatcher}->${constructorCall}( ${callArguments} ) );
       if ( ${failureCheck} )
       {
-        throwResultException( result, "${constructorCall}" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
       }${dispatcherInit}
     }
+
+    ${handleType}( VULKAN_HPP_NAMESPACE::Result & result, ${constructorArguments} )
+      : ${initializationList}m_dispatcher( ${dispatcherArgument} )
+    {
+      result = static_cast<VULKAN_HPP_NAMESPACE::Result>( ${getDispatcher}->${constructorCall}( ${callArguments} ) );
+      if ( ${failureCheck} )
+      {
+        m_${handleName} = nullptr;
+      }${dispatcherInitOnSuccess}
+    }
+
+    static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<${handleType}> create( ${constructorArguments} )
+    {
+      VULKAN_HPP_NAMESPACE::Result result;
+      ${handleType} ${handleName}( result, ${argumentNames} );
+      return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<${handleType}>( result, std::move( ${handleName} ) );
+    }
 ${leave})";
 
   return replaceWithMap( constructorTemplate,
-                         { { "callArguments", callArguments },
+                         { { "argumentNames", constructArgumentNames( constructorArguments ) },
+                           { "callArguments", callArguments },
+                           { "commandId", constructCommandId( constructorIt->first ) },
                            { "constructorArguments", constructorArguments },
                            { "constructorCall", constructorIt->first },
                            { "dispatcherArgument", dispatcherArgument },
                            { "dispatcherInit", dispatcherInit },
+                           { "dispatcherInitOnSuccess", dispatcherInitOnSuccess },
                            { "enter", enter },
                            { "failureCheck", constructFailureCheck( constructorIt->second.successCodes ) },
                            { "getDispatcher", getDispatcher },
-                           { "leave", leave },
-                           { "handleType", stripPrefix( handle.first, "Vk" ) },
-                           { "initializationList", initializationList } } );
+                           { "handleName", handleName },
+                           { "handleType", handleType },
+                           { "initializationList", initializationList },
+                           { "leave", leave } } );
 }
 
 std::string VulkanHppGenerator::constructRAIIHandleConstructorTakeOwnership(
@@ -7373,10 +8198,11 @@ std::string VulkanHppGenerator::constructRAIIHandleConstructorVector(
 
   const std::string constructorTemplate =
     R"(
-${enter}    ${handleType}s( ${constructorArguments} )
+${enter}    Basic${handleType}s( ${constructorArguments}, Allocator const & handlesAllocator = Allocator() )
+      : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}, Allocator>( handlesAllocator )
     {
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = ${parentName}.getDispatcher();
-      std::vector<${vectorElementType}> ${vectorName}( ${vectorSize} );
+      ScratchVector<${vectorElementType}> ${vectorName}( ${vectorSize} );
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->${constructorCall}( ${callArguments} ) );
       if ( ${successCheck} )
       {
@@ -7388,18 +8214,44 @@ ${enter}    ${handleType}s( ${constructorArguments} )
       }
       else
       {
-        throwResultException( result, "${constructorCall}" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
+      }
+    }
+
+    Basic${handleType}s( VULKAN_HPP_NAMESPACE::Result & result, ${constructorArguments}, Allocator const & handlesAllocator = Allocator() )
+      : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::${handleType}, Allocator>( handlesAllocator )
+    {
+      VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = ${parentName}.getDispatcher();
+      ScratchVector<${vectorElementType}> ${vectorName}( ${vectorSize} );
+      result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->${constructorCall}( ${callArguments} ) );
+      if ( ${successCheck} )
+      {
+        this->reserve( ${vectorSize} );
+        for ( auto const & ${handleName} : ${vectorName} )
+        {
+          this->emplace_back( ${handleConstructorArguments}, ${successCodePassToElement} dispatcher );
+        }
       }
     }
+
+    static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Basic${handleType}s> create( ${constructorArguments}, Allocator const & handlesAllocator = Allocator() )
+    {
+      VULKAN_HPP_NAMESPACE::Result result;
+      Basic${handleType}s ${vectorName}( result, ${argumentNames}, handlesAllocator );
+      return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Basic${handleType}s>( result, std::move( ${vectorName} ) );
+    }
 ${leave})";
 
-  return replaceWithMap(
+  std::string constructorArguments =
+    constructRAIIHandleConstructorArguments( handle.first, constructorIt->second.params, false, false );
+  return replaceWithMap(
     constructorTemplate,
-    { { "callArguments",
+    { { "argumentNames", constructArgumentNames( constructorArguments ) },
+      { "callArguments",
         constructRAIIHandleConstructorCallArguments(
           handle.first, constructorIt->second.params, false, {}, {}, false ) },
-      { "constructorArguments",
-        constructRAIIHandleConstructorArguments( handle.first, constructorIt->second.params, false, false ) },
+      { "commandId", constructCommandId( constructorIt->first ) },
+      { "constructorArguments", constructorArguments },
       { "constructorCall", constructorIt->first },
       { "enter", enter },
       { "handleConstructorArguments", handleConstructorArguments },
@@ -7440,14 +8292,15 @@ ${enter}    ${handleType}( ${constructorArguments} )
       m_constructorSuccessCode = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${constructorCall}( ${callArguments} ) );
       if ( ${failureCheck} )
       {
-        throwResultException( m_constructorSuccessCode, "${constructorCall}" );
+        throwResultException( m_constructorSuccessCode, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
       }
     }
 ${leave})";
 
   return replaceWithMap(
     singularConstructorTemplate,
-    { { "initializationList", initializationList },
+    { { "commandId", constructCommandId( constructorIt->first ) },
+      { "initializationList", initializationList },
       { "callArguments", callArguments },
       { "constructorArguments",
         constructRAIIHandleConstructorArguments( handle.first, constructorIt->second.params, true, false ) },
@@ -7737,9 +8590,9 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<${vectorElementType
     {
       ${vectorName}.resize( ${counterName} );
     }
-    if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+    if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return ${vectorName};
   }
@@ -7750,6 +8603,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "className",
         initialSkipCount ? stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) : "Context" },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "counterName", counterName },
       { "counterType", commandIt->second.params[vectorParamIndices.begin()->second].type.type },
@@ -7835,9 +8689,9 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::pair<std::vector<${firstTy
       ${firstVectorName}.resize( ${counterName} );
       ${secondVectorName}.resize( ${counterName} );
     }
-    if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+    if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return data;
   }
@@ -7847,6 +8701,7 @@ ${leave})";
     definitionTemplate,
     { { "argumentList", argumentListDefinition },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "counterName", counterName },
       { "counterType", commandIt->second.params[firstVectorParamIt->second].type.type },
@@ -7917,7 +8772,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::tuple<VULKAN_HPP_NAMESPACE
     result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return data;
   }
@@ -7929,6 +8784,7 @@ ${leave})";
       { "callArguments", callArguments },
       { "className",
         initialSkipCount ? stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) : "Context" },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -7987,7 +8843,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE VULKAN_HPP_NAMESPACE::Result ${
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return result;
   }
@@ -7998,6 +8854,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8054,7 +8911,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::pair<VULKAN_HPP_NAMESPACE:
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return std::make_pair( result, ${valueName} );
   }
@@ -8065,6 +8922,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8121,7 +8979,7 @@ ${enter}  template <typename T>
     Result result = static_cast<Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return std::make_pair( result, ${dataName} );
   }
@@ -8132,6 +8990,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "dataName", dataName },
       { "dataSize", commandIt->second.params[nonConstPointerParamIndices[0]].len },
@@ -8190,7 +9049,7 @@ ${enter}  template <typename T>
     Result result = static_cast<Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return std::make_pair( result, ${dataName} );
   }
@@ -8201,6 +9060,7 @@ ${leave})";
                     { { "argumentList", argumentListDefinition },
                       { "callArguments", callArguments },
                       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+                      { "commandId", constructCommandId( commandIt->first ) },
                       { "commandName", commandName },
                       { "dataName", dataName },
                       { "enter", enter },
@@ -8314,7 +9174,7 @@ ${enter}  VULKAN_HPP_INLINE void ${className}::${commandName}( ${argumentList} )
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
   }
 ${leave})";
@@ -8324,6 +9184,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8380,7 +9241,7 @@ ${enter}  template <typename X, typename Y, typename... Z>
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return structureChain;
   }
@@ -8391,6 +9252,7 @@ ${leave})";
                     { { "argumentList", argumentListDefinition },
                       { "callArguments", callArguments },
                       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+                      { "commandId", constructCommandId( commandIt->first ) },
                       { "commandName", commandName },
                       { "enter", enter },
                       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8447,7 +9309,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::vector<${vectorElementType
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return ${vectorName};
   }
@@ -8458,6 +9320,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8524,7 +9387,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE std::pair<std::vector<${vectorE
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return data;
   }
@@ -8535,6 +9398,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8595,7 +9459,7 @@ ${enter}  template <typename T>
     Result result = static_cast<Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return ${dataName};
   }
@@ -8606,6 +9470,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "dataName", dataName },
       { "dataSize", commandIt->second.params[nonConstPointerParamIndices[0]].len },
@@ -8665,7 +9530,7 @@ ${enter}  template <typename T>
     Result result = static_cast<Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return ${dataName};
   }
@@ -8676,6 +9541,7 @@ ${leave})";
                     { { "argumentList", argumentListDefinition },
                       { "callArguments", callArguments },
                       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+                      { "commandId", constructCommandId( commandIt->first ) },
                       { "commandName", commandName },
                       { "dataName", dataName },
                       { "enter", enter },
@@ -8731,7 +9597,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ${vectorElementType} ${classNam
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return ${vectorElementName};
   }
@@ -8742,6 +9608,7 @@ ${leave})";
     { { "argumentList", argumentListDefinition },
       { "callArguments", callArguments },
       { "className", stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -8861,7 +9728,7 @@ ${enter}  VULKAN_HPP_NODISCARD VULKAN_HPP_INLINE ${returnType} ${className}::${c
     VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->${vkCommand}( ${callArguments} ) );
     if ( ${failureCheck} )
     {
-      throwResultException( result, VULKAN_HPP_NAMESPACE_STRING"::${className}::${commandName}" );
+      throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::${commandId} );
     }
     return ${valueName};
   }
@@ -8873,6 +9740,7 @@ ${leave})";
       { "callArguments", callArguments },
       { "className",
         initialSkipCount ? stripPrefix( commandIt->second.params[initialSkipCount - 1].type.type, "Vk" ) : "Context" },
+      { "commandId", constructCommandId( commandIt->first ) },
       { "commandName", commandName },
       { "enter", enter },
       { "failureCheck", constructFailureCheck( commandIt->second.successCodes ) },
@@ -9807,7 +10675,7 @@ ${enter}  template <typename StructureChain>
     ${counterType} ${counterName};
     getDispatcher()->${vkCommand}( ${firstCallArguments} );
     std::vector<StructureChain> returnVector( ${counterName} );
-    std::vector<${vectorElementType}> ${vectorName}( ${counterName} );
+    ScratchVector<${vectorElementType}> ${vectorName}( ${counterName} );
     for ( ${counterType} i = 0; i < ${counterName}; i++ )
     {
       ${vectorName}[i].pNext = returnVector[i].template get<${vectorElementType}>().pNext;
@@ -10057,6 +10925,8 @@ std::string VulkanHppGenerator::constructRAIIHandleVectorSizeCheck(
   std::map<size_t, std::vector<size_t>> const & countToVectorMap,
   std::set<size_t> const &                      skippedParams ) const
 {
+  std::string const assertTemplate =
+    "    VULKAN_HPP_ASSERT( ${zeroSizeCheck}${firstVectorName}.size() == ${secondVectorName}.size() );";
   std::string const throwTemplate =
     R"#(    if ( ${zeroSizeCheck}${firstVectorName}.size() != ${secondVectorName}.size() )
   {
@@ -10065,7 +10935,7 @@ std::string VulkanHppGenerator::constructRAIIHandleVectorSizeCheck(
 
   std::string commandName = determineCommandName( name, commandData.params[initialSkipCount - 1].type.type, m_tags );
 
-  std::string sizeChecks;
+  std::string assertions, throws;
   for ( auto const & cvm : countToVectorMap )
   {
     assert( !commandData.params[cvm.second[0]].optional );
@@ -10077,7 +10947,12 @@ std::string VulkanHppGenerator::constructRAIIHandleVectorSizeCheck(
     {
       std::string secondVectorName = startLowerCase( stripPrefix( commandData.params[cvm.second[i]].name, "p" ) );
       bool withZeroSizeCheck = commandData.params[cvm.second[i]].optional && ( defaultStartIndex <= cvm.second[i] );
-      sizeChecks +=
+      assertions +=
+        replaceWithMap( assertTemplate,
+                        { { "firstVectorName", firstVectorName },
+                          { "secondVectorName", secondVectorName },
+                          { "zeroSizeCheck", withZeroSizeCheck ? ( secondVectorName + ".empty() || " ) : "" } } );
+      throws +=
         replaceWithMap( throwTemplate,
                         { { "firstVectorName", firstVectorName },
                           { "className", stripPrefix( commandData.params[initialSkipCount - 1].type.type, "Vk" ) },
@@ -10086,16 +10961,27 @@ std::string VulkanHppGenerator::constructRAIIHandleVectorSizeCheck(
                           { "zeroSizeCheck", withZeroSizeCheck ? ( "!" + secondVectorName + ".empty() && " ) : "" } } );
       if ( i + 1 < cvm.second.size() )
       {
-        sizeChecks += "\n";
+        assertions += "\n";
+        throws += "\n";
       }
     }
   }
-  if ( !sizeChecks.empty() )
+  if ( assertions.empty() )
   {
-    sizeChecks += "\n";
+    return "";
   }
 
-  return sizeChecks;
+  // LogicError is not available with VULKAN_HPP_NO_EXCEPTIONS
+  std::string const sizeCheckTemplate =
+    R"#(
+#ifdef VULKAN_HPP_NO_EXCEPTIONS
+${assertions}
+#else
+${throws}
+#endif  /*VULKAN_HPP_NO_EXCEPTIONS*/
+)#";
+
+  return replaceWithMap( sizeCheckTemplate, { { "assertions", assertions }, { "throws", throws } } );
 }
 
 std::string
@@ -10172,7 +11058,7 @@ std::string VulkanHppGenerator::constructSuccessCheck( std::vector<std::string>
         "|| ( result == VULKAN_HPP_NAMESPACE::Result::" + createSuccessCode( successCodes[i], m_tags ) + " )";
     }
   }
-  return successCheck;
+  return "VULKAN_HPP_LIKELY( " + successCheck + " )";
 }
 
 std::string VulkanHppGenerator::constructSuccessCodeList( std::vector<std::string> const & successCodes ) const
@@ -10190,6 +11076,34 @@ std::string VulkanHppGenerator::constructSuccessCodeList( std::vector<std::strin
   return successCodeList;
 }
 
+std::string VulkanHppGenerator::constructUniqueDeleterDefinition( CommandData const &              commandData,
+                                                                 std::string const &              className,
+                                                                 std::map<size_t, size_t> const & vectorParamIndices,
+                                                                 size_t returnParamIndex ) const
+{
+  std::string              deleterDefinition;
+  std::vector<std::string> lenParts = tokenize( commandData.params[returnParamIndex].len, "->" );
+  switch ( lenParts.size() )
+  {
+    case 1: deleterDefinition = "ObjectDestroy<" + className + ", Dispatch> deleter( *this, allocator, d )"; break;
+    case 2:
+      {
+        auto vpiIt = vectorParamIndices.find( returnParamIndex );
+        assert( vpiIt != vectorParamIndices.end() );
+        std::string poolType, poolName;
+        std::tie( poolType, poolName ) = getPoolTypeAndName( commandData.params[vpiIt->second].type.type );
+        assert( !poolType.empty() );
+        poolType = stripPrefix( poolType, "Vk" );
+        poolName = startLowerCase( stripPrefix( lenParts[0], "p" ) ) + "." + poolName;
+
+        deleterDefinition =
+          "PoolFree<" + className + ", " + poolType + ", Dispatch> deleter( *this, " + poolName + ", d )";
+      }
+      break;
+  }
+  return deleterDefinition;
+}
+
 std::string
   VulkanHppGenerator::constructVectorSizeCheck( std::string const &                           name,
                                                 CommandData const &                           commandData,
@@ -10794,34 +11708,11 @@ void VulkanHppGenerator::appendStructureChainValidation( std::string & str )
       // append out allowed structure chains
       for ( auto extendName : structure.second.structExtends )
       {
-        std::map<std::string, StructureData>::const_iterator itExtend = m_structures.find( extendName );
-        if ( itExtend == m_structures.end() )
-        {
-          // look if the extendName acutally is an alias of some other structure
-          itExtend = std::find_if( m_structures.begin(),
-                                   m_structures.end(),
-                                   [extendName]( auto const & sd )
-                                   { return sd.second.aliases.find( extendName ) != sd.second.aliases.end(); } );
-        }
-        if ( itExtend == m_structures.end() )
-        {
-          std::string errorString;
-          errorString = "<" + extendName + "> does not specify a struct in structextends field.";
-
-          // check if symbol name is an alias to a struct
-          auto itAlias =
-            std::find_if( m_structures.begin(),
-                          m_structures.end(),
-                          [&extendName]( std::pair<std::string, StructureData> const & it ) -> bool {
-                            return std::find( it.second.aliases.begin(), it.second.aliases.end(), extendName ) !=
-                                   it.second.aliases.end();
-                          } );
-          if ( itAlias != m_structures.end() )
-          {
-            errorString += " The symbol is an alias and maps to <" + itAlias->first + ">.";
-          }
-          check( false, structure.second.xmlLine, errorString );
-        }
+        // the extendName might actually be an alias of some other structure
+        std::map<std::string, StructureData>::const_iterator itExtend = findStructure( extendName );
+        check( itExtend != m_structures.end(),
+               structure.second.xmlLine,
+               "<" + extendName + "> does not specify a struct in structextends field." );
 
         std::string subEnter, subLeave;
         std::tie( subEnter, subLeave ) = generateProtection( itExtend->first, !itExtend->second.aliases.empty() );
@@ -10844,13 +11735,35 @@ void VulkanHppGenerator::appendStructureChainValidation( std::string & str )
   }
 }
 
+void VulkanHppGenerator::appendCommandIds( std::string & str ) const
+{
+  // the commands returning a Result get a compact id, to identify them on throwing without a string literal per call
+  std::string commandIds;
+  for ( auto const & command : m_commands )
+  {
+    if ( command.second.returnType == "VkResult" )
+    {
+      commandIds += "    " + constructCommandId( command.first ) + ",\n";
+    }
+  }
+
+  static const std::string commandIdsTemplate = R"(
+  enum class CommandId : uint16_t
+  {
+${commandIds}  };
+)";
+
+  str += replaceWithMap( commandIdsTemplate, { { "commandIds", commandIds } } );
+}
+
 void VulkanHppGenerator::appendThrowExceptions( std::string & str ) const
 {
   auto enumData = m_enums.find( "VkResult" );
 
+  // the throwing functions are kept out of line and cold, so that the hot paths calling them just carry a call
   str +=
     "\n"
-    "  [[noreturn]] static void throwResultException( Result result, char const * message )\n"
+    "  [[noreturn]] VULKAN_HPP_NOINLINE VULKAN_HPP_COLD inline void throwResultException( Result result, char const * message )\n"
     "  {\n"
     "    switch ( result )\n"
     "    {\n";
@@ -10872,6 +11785,26 @@ void VulkanHppGenerator::appendThrowExceptions( std::string & str ) const
     "      default: throw SystemError( make_error_code( result ) );\n"
     "    }\n"
     "  }\n";
+
+  std::string commandNames;
+  for ( auto const & command : m_commands )
+  {
+    if ( command.second.returnType == "VkResult" )
+    {
+      commandNames += "      \"" + command.first + "\",\n";
+    }
+  }
+
+  static const std::string commandIdTemplate = R"(
+  [[noreturn]] VULKAN_HPP_NOINLINE VULKAN_HPP_COLD inline void throwResultException( Result result, CommandId commandId )
+  {
+    static char const * const commandNames[] = {
+${commandNames}    };
+    throwResultException( result, commandNames[static_cast<size_t>( commandId )] );
+  }
+)";
+
+  str += replaceWithMap( commandIdTemplate, { { "commandNames", commandNames } } );
 }
 
 void VulkanHppGenerator::appendType( std::string & str, std::string const & typeName )
@@ -10884,20 +11817,10 @@ void VulkanHppGenerator::appendType( std::string & str, std::string const & type
     {
       case TypeCategory::Handle:
         {
-          auto handleIt = m_handles.find( typeName );
-          if ( handleIt == m_handles.end() )
-          {
-            handleIt = std::find_if( m_handles.begin(),
-                                     m_handles.end(),
-                                     [&typeName]( std::pair<std::string, HandleData> const & hd )
-                                     { return hd.second.alias == typeName; } );
-            assert( handleIt != m_handles.end() );
-            if ( m_listedTypes.find( handleIt->first ) == m_listedTypes.end() )
-            {
-              appendHandle( str, *handleIt );
-            }
-          }
-          else
+          // typeName might be an alias of a handle that is listed already
+          auto handleIt = findHandle( typeName );
+          assert( handleIt != m_handles.end() );
+          if ( m_listedTypes.find( handleIt->first ) == m_listedTypes.end() )
           {
             appendHandle( str, *handleIt );
           }
@@ -10906,20 +11829,10 @@ void VulkanHppGenerator::appendType( std::string & str, std::string const & type
       case TypeCategory::Struct:
       case TypeCategory::Union:
         {
-          auto structIt = m_structures.find( typeName );
-          if ( structIt == m_structures.end() )
-          {
-            structIt = std::find_if( m_structures.begin(),
-                                     m_structures.end(),
-                                     [&typeName]( std::pair<std::string, StructureData> const & sd )
-                                     { return sd.second.aliases.find( typeName ) != sd.second.aliases.end(); } );
-            assert( structIt != m_structures.end() );
-            if ( m_listedTypes.find( structIt->first ) == m_listedTypes.end() )
-            {
-              appendStruct( str, *structIt );
-            }
-          }
-          else
+          // typeName might be an alias of a structure that is listed already
+          auto structIt = findStructure( typeName );
+          assert( structIt != m_structures.end() );
+          if ( m_listedTypes.find( structIt->first ) == m_listedTypes.end() )
           {
             appendStruct( str, *structIt );
           }
@@ -11848,6 +12761,38 @@ std::string const & VulkanHppGenerator::getVulkanLicenseHeader() const
   return m_vulkanLicenseHeader;
 }
 
+std::map<std::string, VulkanHppGenerator::HandleData>::const_iterator
+  VulkanHppGenerator::findHandle( std::string const & type ) const
+{
+  auto handleIt = m_handles.find( type );
+  if ( handleIt == m_handles.end() )
+  {
+    auto aliasIt = m_handleAliases.find( type );
+    if ( aliasIt != m_handleAliases.end() )
+    {
+      handleIt = m_handles.find( aliasIt->second );
+      assert( handleIt != m_handles.end() );
+    }
+  }
+  return handleIt;
+}
+
+std::map<std::string, VulkanHppGenerator::StructureData>::const_iterator
+  VulkanHppGenerator::findStructure( std::string const & type ) const
+{
+  auto structureIt = m_structures.find( type );
+  if ( structureIt == m_structures.end() )
+  {
+    auto aliasIt = m_structureAliases.find( type );
+    if ( aliasIt != m_structureAliases.end() )
+    {
+      structureIt = m_structures.find( aliasIt->second );
+      assert( structureIt != m_structures.end() );
+    }
+  }
+  return structureIt;
+}
+
 std::string VulkanHppGenerator::generateLenInitializer(
   std::vector<MemberData>::const_iterator                                        mit,
   std::map<std::vector<MemberData>::const_iterator,
@@ -12105,14 +13050,9 @@ bool VulkanHppGenerator::isHandleType( std::string const & type ) const
 {
   if ( beginsWith( type, "Vk" ) )
   {
-    auto it = m_handles.find( type );
-    if ( it == m_handles.end() )
-    {
-      it = std::find_if( m_handles.begin(),
-                         m_handles.end(),
-                         [&type]( std::pair<std::string, HandleData> const & hd ) { return hd.second.alias == type; } );
-    }
-    return ( it != m_handles.end() );
+    // handles and their aliases are all listed as types
+    auto typeIt = m_types.find( type );
+    return ( typeIt != m_types.end() ) && ( typeIt->second.category == TypeCategory::Handle );
   }
   return false;
 }
@@ -12202,14 +13142,7 @@ bool VulkanHppGenerator::isStructureChainAnchor( std::string const & type ) cons
 {
   if ( beginsWith( type, "Vk" ) )
   {
-    auto it = m_structures.find( type );
-    if ( it == m_structures.end() )
-    {
-      it = std::find_if( m_structures.begin(),
-                         m_structures.end(),
-                         [&type]( std::pair<std::string, StructureData> const & sd )
-                         { return sd.second.aliases.find( type ) != sd.second.aliases.end(); } );
-    }
+    auto it = findStructure( type );
     if ( it != m_structures.end() )
     {
       return m_extendedStructs.find( it->first ) != m_extendedStructs.end();
@@ -13297,6 +14230,192 @@ void VulkanHppGenerator::readFeatureRequireType( tinyxml2::XMLElement const * el
   }
 }
 
+void VulkanHppGenerator::readFormat( tinyxml2::XMLElement const * element )
+{
+  int                                line       = element->GetLineNum();
+  std::map<std::string, std::string> attributes = getAttributes( element );
+  checkAttributes( line,
+                   attributes,
+                   { { "blockSize", {} },
+                     { "class", {} },
+                     { "name", {} },
+                     { "texelsPerBlock", {} } },
+                   { { "blockExtent", {} },
+                     { "chroma", { "420", "422", "444" } },
+                     { "compressed", {} },
+                     { "packed", { "8", "16", "32" } } } );
+  std::vector<tinyxml2::XMLElement const *> children = getChildElements( element );
+  checkElements( line, children, { { "component", false } }, { "plane", "spirvimageformat" } );
+
+  FormatData  format( line );
+  std::string name;
+  for ( auto const & attribute : attributes )
+  {
+    if ( attribute.first == "blockExtent" )
+    {
+      check( tokenize( attribute.second, "," ).size() == 3, line, "unexpected blockExtent <" + attribute.second + ">" );
+      format.blockExtent = attribute.second;
+    }
+    else if ( attribute.first == "blockSize" )
+    {
+      check( isNumber( attribute.second ), line, "unexpected blockSize <" + attribute.second + ">" );
+      format.blockSize = attribute.second;
+    }
+    else if ( attribute.first == "chroma" )
+    {
+      format.chroma = attribute.second;
+    }
+    else if ( attribute.first == "class" )
+    {
+      format.classAttribute = attribute.second;
+    }
+    else if ( attribute.first == "compressed" )
+    {
+      format.compressed = attribute.second;
+    }
+    else if ( attribute.first == "name" )
+    {
+      name = attribute.second;
+    }
+    else if ( attribute.first == "packed" )
+    {
+      format.packed = attribute.second;
+    }
+    else if ( attribute.first == "texelsPerBlock" )
+    {
+      check( isNumber( attribute.second ), line, "unexpected texelsPerBlock <" + attribute.second + ">" );
+      format.texelsPerBlock = attribute.second;
+    }
+  }
+
+  auto formatIt = m_enums.find( "VkFormat" );
+  assert( formatIt != m_enums.end() );
+  check( std::find_if( formatIt->second.values.begin(),
+                       formatIt->second.values.end(),
+                       [&name]( EnumValueData const & evd ) { return evd.vulkanValue == name; } ) !=
+           formatIt->second.values.end(),
+         line,
+         "encountered unknown format <" + name + ">" );
+
+  for ( auto child : children )
+  {
+    std::string value = child->Value();
+    if ( value == "component" )
+    {
+      readFormatComponent( child, format );
+    }
+    else if ( value == "plane" )
+    {
+      readFormatPlane( child, format );
+    }
+    else if ( value == "spirvimageformat" )
+    {
+      readFormatSPIRVImageFormat( child, format );
+    }
+  }
+  check( format.components.size() <= 4, line, "format <" + name + "> has more than four components" );
+
+  check( m_formats.insert( std::make_pair( name, format ) ).second, line, "format <" + name + "> already specified" );
+}
+
+void VulkanHppGenerator::readFormatComponent( tinyxml2::XMLElement const * element, FormatData & formatData )
+{
+  int                                line       = element->GetLineNum();
+  std::map<std::string, std::string> attributes = getAttributes( element );
+  checkAttributes( line,
+                   attributes,
+                   { { "bits", {} }, { "name", {} }, { "numericFormat", {} } },
+                   { { "planeIndex", { "0", "1", "2" } } } );
+  checkElements( line, getChildElements( element ), {} );
+
+  formatData.components.emplace_back( line );
+  ComponentData & component = formatData.components.back();
+  for ( auto const & attribute : attributes )
+  {
+    if ( attribute.first == "bits" )
+    {
+      check( ( attribute.second == "compressed" ) || isNumber( attribute.second ),
+             line,
+             "unknown bits <" + attribute.second + ">" );
+      component.bits = attribute.second;
+    }
+    else if ( attribute.first == "name" )
+    {
+      component.name = attribute.second;
+    }
+    else if ( attribute.first == "numericFormat" )
+    {
+      component.numericFormat = attribute.second;
+    }
+    else if ( attribute.first == "planeIndex" )
+    {
+      component.planeIndex = attribute.second;
+    }
+  }
+}
+
+void VulkanHppGenerator::readFormatPlane( tinyxml2::XMLElement const * element, FormatData & formatData )
+{
+  int                                line       = element->GetLineNum();
+  std::map<std::string, std::string> attributes = getAttributes( element );
+  checkAttributes( line,
+                   attributes,
+                   { { "compatible", {} },
+                     { "heightDivisor", {} },
+                     { "index", { "0", "1", "2" } },
+                     { "widthDivisor", {} } },
+                   {} );
+  checkElements( line, getChildElements( element ), {} );
+
+  formatData.planes.emplace_back( line );
+  PlaneData & plane = formatData.planes.back();
+  for ( auto const & attribute : attributes )
+  {
+    if ( attribute.first == "compatible" )
+    {
+      plane.compatible = attribute.second;
+    }
+    else if ( attribute.first == "heightDivisor" )
+    {
+      plane.heightDivisor = attribute.second;
+    }
+    else if ( attribute.first == "index" )
+    {
+      check( std::stoul( attribute.second ) == formatData.planes.size() - 1,
+             line,
+             "unexpected plane index <" + attribute.second + ">" );
+    }
+    else if ( attribute.first == "widthDivisor" )
+    {
+      plane.widthDivisor = attribute.second;
+    }
+  }
+}
+
+void VulkanHppGenerator::readFormats( tinyxml2::XMLElement const * element )
+{
+  int line = element->GetLineNum();
+  checkAttributes( line, getAttributes( element ), {}, {} );
+  std::vector<tinyxml2::XMLElement const *> children = getChildElements( element );
+  checkElements( line, children, { { "format", false } } );
+
+  for ( auto child : children )
+  {
+    readFormat( child );
+  }
+}
+
+void VulkanHppGenerator::readFormatSPIRVImageFormat( tinyxml2::XMLElement const * element, FormatData & formatData )
+{
+  int                                line       = element->GetLineNum();
+  std::map<std::string, std::string> attributes = getAttributes( element );
+  checkAttributes( line, attributes, { { "name", {} } }, {} );
+  checkElements( line, getChildElements( element ), {} );
+
+  check( formatData.spirvImageFormat.empty(), line, "spirvimageformat already specified" );
+  formatData.spirvImageFormat = attributes.find( "name" )->second;
+}
+
 void VulkanHppGenerator::readFuncpointer( tinyxml2::XMLElement const *               element,
                                           std::map<std::string, std::string> const & attributes )
 {
@@ -13357,6 +14476,9 @@ void VulkanHppGenerator::readHandle( tinyxml2::XMLElement const *
            line,
            "handle <" + handlesIt->first + "> already has an alias <" + handlesIt->second.alias + ">" );
     handlesIt->second.alias = attributes.find( "name" )->second;
+    check( m_handleAliases.insert( std::make_pair( handlesIt->second.alias, handlesIt->first ) ).second,
+           line,
+           "handle alias <" + handlesIt->second.alias + "> already used" );
     check( m_types.insert( std::make_pair( handlesIt->second.alias, TypeCategory::Handle ) ).second,
            line,
            "handle alias <" + handlesIt->second.alias + "> already specified as a type" );
@@ -13499,7 +14621,8 @@ void VulkanHppGenerator::readRegistry( tinyxml2::XMLElement const * element )
                    { "spirvcapabilities", true },
                    { "spirvextensions", true },
                    { "tags", true },
-                   { "types", true } } );
+                   { "types", true } },
+                 { "formats" } );
   for ( auto child : children )
   {
     const std::string value = child->Value();
@@ -13527,6 +14650,10 @@ void VulkanHppGenerator::readRegistry( tinyxml2::XMLElement const * element )
     {
       readFeature( child );
     }
+    else if ( value == "formats" )
+    {
+      readFormats( child );
+    }
     else if ( value == "platforms" )
     {
       readPlatforms( child );
@@ -15522,6 +16649,15 @@ int main( int argc, char ** argv )
         m_owner.free( m_pool, t, *m_dispatch );
       }
 
+#if !defined( VULKAN_HPP_NO_SMART_HANDLE )
+      // frees all the handles of a UniqueHandleArray with one call
+      template <typename T>
+      void destroy( ArrayProxy<const T> const & ts ) VULKAN_HPP_NOEXCEPT
+      {
+        m_owner.free( m_pool, ts, *m_dispatch );
+      }
+#endif
+
     private:
       OwnerType        m_owner    = OwnerType();
       PoolType         m_pool     = PoolType();
@@ -15906,6 +17042,160 @@ int main( int argc, char ** argv )
     lhs.swap( rhs );
   }
 #endif
+)";
+
+  static const std::string classUniqueHandleArray = R"(
+#if !defined( VULKAN_HPP_NO_SMART_HANDLE )
+  template <typename Deleter>
+  struct IsPoolFree : std::false_type
+  {};
+
+  template <typename OwnerType, typename PoolType, typename Dispatch>
+  struct IsPoolFree<PoolFree<OwnerType, PoolType, Dispatch>> : std::true_type
+  {};
+
+  // The handles of a vector-returning *UniqueArray command, sharing one deleter. The handles are stored contiguously,
+  // and handles allocated from a pool are freed with a single call.
+  template <typename Type, typename Dispatch>
+  class UniqueHandleArray : public UniqueHandleTraits<Type, Dispatch>::deleter
+  {
+  private:
+    using Deleter = typename UniqueHandleTraits<Type, Dispatch>::deleter;
+
+  public:
+    using element_type   = Type;
+    using const_iterator = typename std::vector<Type>::const_iterator;
+
+    UniqueHandleArray() = default;
+
+    explicit UniqueHandleArray( std::vector<Type> && values, Deleter const & deleter = Deleter() ) VULKAN_HPP_NOEXCEPT
+      : Deleter( deleter )
+      , m_values( std::move( values ) )
+    {}
+
+    UniqueHandleArray( UniqueHandleArray const & ) = delete;
+
+    UniqueHandleArray( UniqueHandleArray && other ) VULKAN_HPP_NOEXCEPT
+      : Deleter( std::move( static_cast<Deleter &>( other ) ) )
+      , m_values( other.release() )
+    {}
+
+    ~UniqueHandleArray() VULKAN_HPP_NOEXCEPT
+    {
+      reset();
+    }
+
+    UniqueHandleArray & operator=( UniqueHandleArray const & ) = delete;
+
+    UniqueHandleArray & operator=( UniqueHandleArray && other ) VULKAN_HPP_NOEXCEPT
+    {
+      reset();
+      m_values                        = other.release();
+      *static_cast<Deleter *>( this ) = std::move( static_cast<Deleter &>( other ) );
+      return *this;
+    }
+
+    Type const & operator[]( size_t index ) const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values[index];
+    }
+
+    const_iterator begin() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values.begin();
+    }
+
+    const_iterator end() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values.end();
+    }
+
+    Type const * data() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values.data();
+    }
+
+    bool empty() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values.empty();
+    }
+
+    size_t size() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values.size();
+    }
+
+    std::vector<Type> const & get() const VULKAN_HPP_NOEXCEPT
+    {
+      return m_values;
+    }
+
+    // destroys all the handles still in the array
+    void reset() VULKAN_HPP_NOEXCEPT
+    {
+      destroyAll( IsPoolFree<Deleter>() );
+      m_values.clear();
+    }
+
+    // takes the handle at index out of the array, leaving a null handle behind
+    Type release( size_t index ) VULKAN_HPP_NOEXCEPT
+    {
+      Type value      = m_values[index];
+      m_values[index] = nullptr;
+      return value;
+    }
+
+    std::vector<Type> release() VULKAN_HPP_NOEXCEPT
+    {
+      std::vector<Type> values;
+      values.swap( m_values );
+      return values;
+    }
+
+    // moves the handle at index out of the array, into a UniqueHandle with its own copy of the deleter
+    UniqueHandle<Type, Dispatch> extract( size_t index ) VULKAN_HPP_NOEXCEPT
+    {
+      return UniqueHandle<Type, Dispatch>( release( index ), static_cast<Deleter const &>( *this ) );
+    }
+
+    void swap( UniqueHandleArray<Type, Dispatch> & rhs ) VULKAN_HPP_NOEXCEPT
+    {
+      m_values.swap( rhs.m_values );
+      std::swap( static_cast<Deleter &>( *this ), static_cast<Deleter &>( rhs ) );
+    }
+
+  private:
+    void destroyAll( std::true_type /*pool allocated*/ ) VULKAN_HPP_NOEXCEPT
+    {
+      if ( std::any_of( m_values.begin(), m_values.end(), []( Type const & value ) { return !!value; } ) )
+      {
+        // null handles are ignored by the free commands
+        this->destroy( ArrayProxy<const Type>( static_cast<uint32_t>( m_values.size() ), m_values.data() ) );
+      }
+    }
+
+    void destroyAll( std::false_type /*pool allocated*/ ) VULKAN_HPP_NOEXCEPT
+    {
+      for ( auto const & value : m_values )
+      {
+        if ( value )
+        {
+          this->destroy( value );
+        }
+      }
+    }
+
+  private:
+    std::vector<Type> m_values;
+  };
+
+  template <typename Type, typename Dispatch>
+  VULKAN_HPP_INLINE void swap( UniqueHandleArray<Type, Dispatch> & lhs,
+                               UniqueHandleArray<Type, Dispatch> & rhs ) VULKAN_HPP_NOEXCEPT
+  {
+    lhs.swap( rhs );
+  }
+#endif
 )";
 
   static const std::string defines = R"(
@@ -15992,6 +17282,34 @@ int main( int argc, char ** argv )
 #  endif
 #endif
 
+#if !defined( VULKAN_HPP_NOINLINE )
+#  if defined( __GNUC__ ) || defined( __clang__ )
+#    define VULKAN_HPP_NOINLINE __attribute__( ( noinline ) )
+#  elif defined( _MSC_VER )
+#    define VULKAN_HPP_NOINLINE __declspec( noinline )
+#  else
+#    define VULKAN_HPP_NOINLINE
+#  endif
+#endif
+
+#if !defined( VULKAN_HPP_COLD )
+#  if defined( __GNUC__ ) || defined( __clang__ )
+#    define VULKAN_HPP_COLD __attribute__( ( cold ) )
+#  else
+#    define VULKAN_HPP_COLD
+#  endif
+#endif
+
+#if !defined( VULKAN_HPP_LIKELY )
+#  if defined( __GNUC__ ) || defined( __clang__ )
+#    define VULKAN_HPP_LIKELY( x )   __builtin_expect( !!( x ), 1 )
+#    define VULKAN_HPP_UNLIKELY( x ) __builtin_expect( !!( x ), 0 )
+#  else
+#    define VULKAN_HPP_LIKELY( x )   ( x )
+#    define VULKAN_HPP_UNLIKELY( x ) ( x )
+#  endif
+#endif
+
 #if 14 <= VULKAN_HPP_CPP_VERSION
 #  define VULKAN_HPP_DEPRECATED( msg ) [[deprecated( msg )]]
 #else
@@ -16336,7 +17654,7 @@ namespace std
     VULKAN_HPP_ASSERT_ON_RESULT( result == Result::eSuccess );
     return result;
 #else
-    if ( result != Result::eSuccess )
+    if ( VULKAN_HPP_UNLIKELY( result != Result::eSuccess ) )
     {
       throwResultException( result, message );
     }
@@ -16351,7 +17669,7 @@ namespace std
     VULKAN_HPP_ASSERT_ON_RESULT( result == Result::eSuccess );
     return ResultValue<T>( result, std::move( data ) );
 #else
-    if ( result != Result::eSuccess )
+    if ( VULKAN_HPP_UNLIKELY( result != Result::eSuccess ) )
     {
       throwResultException( result, message );
     }
@@ -16366,7 +17684,7 @@ namespace std
     ignore(successCodes);   // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
 #else
-    if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+    if ( VULKAN_HPP_UNLIKELY( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() ) )
     {
       throwResultException( result, message );
     }
@@ -16382,7 +17700,7 @@ namespace std
     ignore(successCodes);   // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
 #else
-    if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+    if ( VULKAN_HPP_UNLIKELY( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() ) )
     {
       throwResultException( result, message );
     }
@@ -16399,7 +17717,7 @@ namespace std
     VULKAN_HPP_ASSERT_ON_RESULT( result == Result::eSuccess );
     return ResultValue<UniqueHandle<T,D>>( result, UniqueHandle<T,D>(data, deleter ) );
 #else
-    if ( result != Result::eSuccess )
+    if ( VULKAN_HPP_UNLIKELY( result != Result::eSuccess ) )
     {
       throwResultException( result, message );
     }
@@ -16420,7 +17738,7 @@ namespace std
     ignore(successCodes);   // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
 #  else
-    if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+    if ( VULKAN_HPP_UNLIKELY( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() ) )
     {
       throwResultException( result, message );
     }
@@ -16437,7 +17755,7 @@ namespace std
     VULKAN_HPP_ASSERT_ON_RESULT( result == Result::eSuccess );
     return ResultValue<std::vector<UniqueHandle<T, D>>>( result, std::move( data ) );
 #  else
-    if ( result != Result::eSuccess )
+    if ( VULKAN_HPP_UNLIKELY( result != Result::eSuccess ) )
     {
       throwResultException( result, message );
     }
@@ -16457,13 +17775,50 @@ namespace std
     ignore(successCodes);   // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
     VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
 #  else
-    if ( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() )
+    if ( VULKAN_HPP_UNLIKELY( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() ) )
     {
       throwResultException( result, message );
     }
 #  endif
     return ResultValue<std::vector<UniqueHandle<T, D>>>( result, std::move( data ) );
   }
+
+  template <typename T, typename D>
+  VULKAN_HPP_INLINE typename ResultValueType<UniqueHandleArray<T, D>>::type
+    createResultValue( Result result, UniqueHandleArray<T, D> && data, char const * message )
+  {
+#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+    ignore( message );
+    VULKAN_HPP_ASSERT_ON_RESULT( result == Result::eSuccess );
+    return ResultValue<UniqueHandleArray<T, D>>( result, std::move( data ) );
+#  else
+    if ( VULKAN_HPP_UNLIKELY( result != Result::eSuccess ) )
+    {
+      throwResultException( result, message );
+    }
+    return std::move( data );
+#  endif
+  }
+
+  template <typename T, typename D>
+  VULKAN_HPP_INLINE ResultValue<UniqueHandleArray<T, D>>
+                    createResultValue( Result                        result,
+                                       UniqueHandleArray<T, D> &&    data,
+                                       char const *                  message,
+                                       std::initializer_list<Result> successCodes )
+  {
+#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+    ignore( message );
+    ignore(successCodes);   // just in case VULKAN_HPP_ASSERT_ON_RESULT is empty
+    VULKAN_HPP_ASSERT_ON_RESULT( std::find( successCodes.begin(), successCodes.end(), result ) != successCodes.end() );
+#  else
+    if ( VULKAN_HPP_UNLIKELY( std::find( successCodes.begin(), successCodes.end(), result ) == successCodes.end() ) )
+    {
+      throwResultException( result, message );
+    }
+#  endif
+    return ResultValue<UniqueHandleArray<T, D>>( result, std::move( data ) );
+  }
 #endif
 )";
 
@@ -16481,21 +17836,72 @@ namespace std
 
   try
   {
-    tinyxml2::XMLDocument doc;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
-    std::string filename = ( argc == 1 ) ? VK_SPEC : argv[1];
+    // usage: VulkanHppGenerator [--force] [vk.xml]
+    std::string filename = VK_SPEC;
+    bool        force    = false;
+    for ( int i = 1; i < argc; i++ )
+    {
+      if ( strcmp( argv[i], "--force" ) == 0 )
+      {
+        force = true;
+      }
+      else
+      {
+        filename = argv[i];
+      }
+    }
 
     std::cout << "VulkanHppGenerator: Loading " << filename << std::endl;
-    tinyxml2::XMLError error = doc.LoadFile( filename.c_str() );
+    std::string spec = readFile( filename );
+    if ( spec.empty() )
+    {
+      std::cout << "VulkanHppGenerator: failed to load file " << filename << std::endl;
+      return -1;
+    }
+
+    // The inputs are the spec, the sources of the generator, and the clang-format executable, version, and style. If
+    // they are the same as on the last run, and the outputs have not been touched since then, there's nothing to do.
+    // The stamp is kept in the build directory.
+    static const std::string stampFile = VULKAN_HPP_GENERATOR_STAMP_FILE;
+    uint64_t                 inputHash = hashContent( spec );
+    inputHash                          = hashContent( readFile( VULKAN_HPP_GENERATOR_CPP_FILE ), inputHash );
+    inputHash                          = hashContent( readFile( VULKAN_HPP_GENERATOR_HPP_FILE ), inputHash );
+#if defined( CLANG_FORMAT_EXECUTABLE )
+    inputHash = hashContent( CLANG_FORMAT_EXECUTABLE "\n" CLANG_FORMAT_VERSION "\n", inputHash );
+    inputHash = hashContent( findClangFormatStyle( VULKAN_HPP_FILE ), inputHash );
+    inputHash = hashContent( findClangFormatStyle( VULKAN_RAII_HPP_FILE ), inputHash );
+#endif
+    auto makeStamp = [inputHash]() {
+      return std::to_string( inputHash ) + " " + std::to_string( hashContent( readFile( VULKAN_HPP_FILE ) ) ) + " " +
+             std::to_string( hashContent( readFile( VULKAN_RAII_HPP_FILE ) ) ) + "\n";
+    };
+    if ( !force && ( readFile( stampFile ) == makeStamp() ) )
+    {
+      std::cout << "VulkanHppGenerator: " << VULKAN_HPP_FILE << " and " << VULKAN_RAII_HPP_FILE
+                << " are up to date; use --force to regenerate them anyway" << std::endl;
+      // rewrite the unchanged stamp anyway, as it's the output the build system checks against the inputs
+      std::ofstream stamp( stampFile );
+      stamp << makeStamp();
+      reportPhase( "Checking the inputs", start );
+      return 0;
+    }
+    reportPhase( "Loading and hashing the inputs", start );
+
+    tinyxml2::XMLDocument doc;
+    tinyxml2::XMLError    error = doc.Parse( spec.data(), spec.size() );
     if ( error != tinyxml2::XML_SUCCESS )
     {
       std::cout << "VulkanHppGenerator: failed to load file " << filename << " with error <" << to_string( error )
                 << ">" << std::endl;
       return -1;
     }
+    reportPhase( "Reading the XML", start );
 
     std::cout << "VulkanHppGenerator: Parsing " << filename << std::endl;
     VulkanHppGenerator generator( doc );
+    reportPhase( "Parsing the registry", start );
 
     std::cout << "VulkanHppGenerator: Generating " << VULKAN_HPP_FILE << std::endl;
     std::string         str;
@@ -16508,14 +17914,17 @@ namespace std
            classFlags + classOptional + classStructureChain + classUniqueHandle;
     generator.appendDispatchLoaderStatic( str );
     generator.appendDispatchLoaderDefault( str );
-    str += classObjectDestroy + classObjectFree + classObjectRelease + classPoolFree + "\n";
+    str += classObjectDestroy + classObjectFree + classObjectRelease + classPoolFree + classUniqueHandleArray + "\n";
     generator.appendBaseTypes( str );
     str += typeTraits;
     generator.appendEnums( str );
+    generator.appendFormatTraits( str );
     generator.appendIndexTypeTraits( str );
     generator.appendBitmasks( str );
     str += "} // namespace VULKAN_HPP_NAMESPACE\n" + is_error_code_enum + "\n" + "namespace VULKAN_HPP_NAMESPACE\n" +
-           "{\n" + "#ifndef VULKAN_HPP_NO_EXCEPTIONS" + exceptions;
+           "{\n";
+    generator.appendCommandIds( str );
+    str += "\n#ifndef VULKAN_HPP_NO_EXCEPTIONS" + exceptions;
     generator.appendResultExceptions( str );
     generator.appendThrowExceptions( str );
     str += "#endif\n" + structResultValue;
@@ -16534,22 +17943,15 @@ namespace std
       "} // namespace std\n"
       "#endif\n";
 
-    std::ofstream ofs( VULKAN_HPP_FILE );
-    assert( !ofs.fail() );
-    ofs << str;
-    ofs.close();
+    reportPhase( "Generating vulkan.hpp", start );
 
 #if defined( CLANG_FORMAT_EXECUTABLE )
     int ret = std::system( "\"" CLANG_FORMAT_EXECUTABLE "\" --version" );
     assert( ret == 0 );
-    std::cout << "VulkanHppGenerator: Formatting " << VULKAN_HPP_FILE << " using clang-format..." << std::endl;
-    ret = std::system( "\"" CLANG_FORMAT_EXECUTABLE "\" -i --style=file " VULKAN_HPP_FILE );
-    if ( ret != 0 )
-    {
-      std::cout << "VulkanHppGenerator: failed to format file " << VULKAN_HPP_FILE << " with error <" << ret << ">\n";
-      return -1;
-    }
+    (void)ret;
 #endif
+    writeIfChanged( VULKAN_HPP_FILE, str );
+    reportPhase( "Formatting and writing vulkan.hpp", start );
 
     std::cout << "VulkanHppGenerator: Generating " << VULKAN_RAII_HPP_FILE << std::endl;
     str.clear();
@@ -16557,8 +17959,17 @@ namespace std
 #ifndef VULKAN_RAII_HPP
 #  define VULKAN_RAII_HPP
 
+#include <atomic>
+#include <mutex>
 #include <vulkan/vulkan.hpp>
 
+#if ( 17 <= VULKAN_HPP_CPP_VERSION ) && defined( __has_include )
+#  if __has_include( <memory_resource> )
+#    include <memory_resource>
+#    define VULKAN_HPP_RAII_HAS_PMR
+#  endif
+#endif
+
 #if !defined( VULKAN_HPP_RAII_NAMESPACE )
 #  define VULKAN_HPP_RAII_NAMESPACE raii
 #endif
@@ -16567,7 +17978,7 @@ namespace VULKAN_HPP_NAMESPACE
 {
   namespace VULKAN_HPP_RAII_NAMESPACE
   {
-#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE ) && !defined(VULKAN_HPP_NO_EXCEPTIONS)
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
 
     template <class T, class U = T>
     VULKAN_HPP_CONSTEXPR_14 VULKAN_HPP_INLINE T exchange( T & obj, U && newValue )
@@ -16581,6 +17992,229 @@ namespace VULKAN_HPP_NAMESPACE
 #  endif
     }
 
+    // the result of a create function: on success, the created handle; on failure, the failing Result together with
+    // an empty handle, such that failures can be handled without exceptions
+    template <typename T>
+    class Expected
+    {
+    public:
+      Expected( VULKAN_HPP_NAMESPACE::Result result, T && value ) : m_result( result ), m_value( std::move( value ) ) {}
+
+      Expected( Expected const & ) = delete;
+      Expected( Expected && rhs )  = default;
+      Expected & operator=( Expected const & ) = delete;
+      Expected & operator=( Expected && rhs ) = default;
+
+      bool has_value() const VULKAN_HPP_NOEXCEPT
+      {
+        // all error codes are negative
+        return 0 <= static_cast<int32_t>( m_result );
+      }
+
+      explicit operator bool() const VULKAN_HPP_NOEXCEPT
+      {
+        return has_value();
+      }
+
+      VULKAN_HPP_NAMESPACE::Result result() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_result;
+      }
+
+      T & value() & VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( has_value() );
+        return m_value;
+      }
+
+      T const & value() const & VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( has_value() );
+        return m_value;
+      }
+
+      T && value() && VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( has_value() );
+        return std::move( m_value );
+      }
+
+      T & operator*() & VULKAN_HPP_NOEXCEPT
+      {
+        return value();
+      }
+
+      T const & operator*() const & VULKAN_HPP_NOEXCEPT
+      {
+        return value();
+      }
+
+      T * operator->() VULKAN_HPP_NOEXCEPT
+      {
+        return &value();
+      }
+
+      T const * operator->() const VULKAN_HPP_NOEXCEPT
+      {
+        return &value();
+      }
+
+    private:
+      VULKAN_HPP_NAMESPACE::Result m_result;
+      T                            m_value;
+    };
+
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+    // without exceptions, a failing constructor or member function just asserts on the result;
+    // use the create functions returning an Expected to handle such failures
+    VULKAN_HPP_INLINE void throwResultException( VULKAN_HPP_NAMESPACE::Result    result,
+                                                 VULKAN_HPP_NAMESPACE::CommandId commandId )
+    {
+      ignore( result );
+      ignore( commandId );
+      VULKAN_HPP_ASSERT_ON_RESULT( false );
+    }
+#  endif
+
+#  if !defined( VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE )
+#    define VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE 16384
+#  endif
+
+    // a per-thread bump allocator for the transient arrays inside the raii constructors and functions, like the
+    // plain handles returned by vkAllocateDescriptorSets before they are wrapped; an allocation not fitting into the
+    // remaining space goes to the upstream memory resource (C++17) or to the heap
+    class ScratchArena
+    {
+    public:
+      static ScratchArena & get() VULKAN_HPP_NOEXCEPT
+      {
+        static thread_local ScratchArena arena;
+        return arena;
+      }
+
+      void * allocate( size_t size, size_t alignment )
+      {
+        VULKAN_HPP_ASSERT( alignment <= alignof( std::max_align_t ) );
+        size_t offset = ( m_offset + alignment - 1 ) & ~( alignment - 1 );
+        if ( offset + size <= VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE )
+        {
+          m_offset = offset + size;
+          m_liveCount++;
+          return m_buffer + offset;
+        }
+        m_overflowCount++;
+        m_liveOverflowCount++;
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+        if ( m_upstream )
+        {
+          return m_upstream->allocate( size, alignment );
+        }
+#  endif
+        return ::operator new( size );
+      }
+
+      void deallocate( void * p, size_t size, size_t alignment ) VULKAN_HPP_NOEXCEPT
+      {
+        char * c = static_cast<char *>( p );
+        if ( !std::less<char *>()( c, m_buffer ) &&
+             std::less<char *>()( c, m_buffer + VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE ) )
+        {
+          VULKAN_HPP_ASSERT( 0 < m_liveCount );
+          if ( --m_liveCount == 0 )
+          {
+            m_offset = 0;
+          }
+          else if ( c + size == m_buffer + m_offset )
+          {
+            // the top-most allocation is released, its space can be reused right away
+            m_offset = static_cast<size_t>( c - m_buffer );
+          }
+        }
+        else
+        {
+          VULKAN_HPP_ASSERT( 0 < m_liveOverflowCount );
+          m_liveOverflowCount--;
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+          if ( m_upstream )
+          {
+            m_upstream->deallocate( p, size, alignment );
+            return;
+          }
+#  endif
+          ignore( alignment );
+          ::operator delete( p );
+        }
+      }
+
+      // the number of allocations that did not fit into the arena; stays zero while the arena is large enough
+      size_t getOverflowCount() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_overflowCount;
+      }
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+      // the memory resource for overflowing allocations of this thread; only to be changed while nothing is allocated,
+      // as an allocation from the previous upstream resource would otherwise be deallocated to the new one
+      void setUpstreamResource( std::pmr::memory_resource * upstream ) VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( ( m_liveCount == 0 ) && ( m_liveOverflowCount == 0 ) );
+        m_upstream = upstream;
+      }
+#  endif
+
+    private:
+      ScratchArena() = default;
+
+    private:
+      alignas( std::max_align_t ) char m_buffer[VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE];
+      size_t m_offset            = 0;
+      size_t m_liveCount         = 0;
+      size_t m_overflowCount     = 0;
+      size_t m_liveOverflowCount = 0;  // the overflowing allocations not deallocated yet
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+      std::pmr::memory_resource * m_upstream = nullptr;
+#  endif
+    };
+
+    // allocates from the ScratchArena of the current thread; a container using it must not leave that thread
+    template <typename T>
+    class ScratchAllocator
+    {
+    public:
+      using value_type = T;
+
+      ScratchAllocator() = default;
+
+      template <typename U>
+      ScratchAllocator( ScratchAllocator<U> const & ) VULKAN_HPP_NOEXCEPT
+      {}
+
+      T * allocate( size_t n )
+      {
+        return static_cast<T *>( ScratchArena::get().allocate( n * sizeof( T ), alignof( T ) ) );
+      }
+
+      void deallocate( T * p, size_t n ) VULKAN_HPP_NOEXCEPT
+      {
+        ScratchArena::get().deallocate( p, n * sizeof( T ), alignof( T ) );
+      }
+
+      template <typename U>
+      bool operator==( ScratchAllocator<U> const & ) const VULKAN_HPP_NOEXCEPT
+      {
+        return true;
+      }
+
+      template <typename U>
+      bool operator!=( ScratchAllocator<U> const & ) const VULKAN_HPP_NOEXCEPT
+      {
+        return false;
+      }
+    };
+
+    template <typename T>
+    using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
 )";
 
     generator.appendRAIIDispatchers( str );
@@ -16588,6 +18222,7 @@ namespace VULKAN_HPP_NAMESPACE
     std::string raiiHandlesCommandDefinitions;
     generator.appendRAIIHandles( str, raiiHandlesCommandDefinitions );
     str += raiiHandlesCommandDefinitions;
+    generator.appendRAIIInterningCaches( str );
     str += R"(
 #endif
   } // namespace VULKAN_HPP_RAII_NAMESPACE
@@ -16595,24 +18230,17 @@ namespace VULKAN_HPP_NAMESPACE
 #endif
 )";
 
-    ofs.open( VULKAN_RAII_HPP_FILE );
-    assert( !ofs.fail() );
-    ofs << str;
-    ofs.close();
+    reportPhase( "Generating vulkan_raii.hpp", start );
 
-#if defined( CLANG_FORMAT_EXECUTABLE )
-    std::cout << "VulkanHppGenerator: Formatting " << VULKAN_RAII_HPP_FILE << " using clang-format..." << std::endl;
-    ret = std::system( "\"" CLANG_FORMAT_EXECUTABLE "\" -i --style=file " VULKAN_RAII_HPP_FILE );
-    if ( ret != 0 )
-    {
-      std::cout << "VulkanHppGenerator: failed to format file " << VULKAN_RAII_HPP_FILE << " with error <" << ret
-                << ">\n";
-      return -1;
-    }
-#else
+    writeIfChanged( VULKAN_RAII_HPP_FILE, str );
+    reportPhase( "Formatting and writing vulkan_raii.hpp", start );
+#if !defined( CLANG_FORMAT_EXECUTABLE )
     std::cout
       << "VulkanHppGenerator: could not find clang-format. The generated files will not be formatted accordingly.\n";
 #endif
+
+    std::ofstream stamp( stampFile );
+    stamp << makeStamp();
   }
   catch ( std::exception const & e )
   {
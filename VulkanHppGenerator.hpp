@@ -18,6 +18,7 @@
 #include <map>
 #include <set>
 #include <tinyxml2.h>
+#include <unordered_map>
 #include <vector>
 
 class VulkanHppGenerator
@@ -27,16 +28,19 @@ public:
 
   void appendBaseTypes( std::string & str ) const;
   void appendBitmasks( std::string & str ) const;
+  void appendCommandIds( std::string & str ) const;
   void appendDispatchLoaderDynamic( std::string & str );  // use vkGet*ProcAddress to get function pointers
   void appendDispatchLoaderStatic( std::string & str );   // use exported symbols from loader
   void appendDispatchLoaderDefault(
     std::string & str );  // typedef to DispatchLoaderStatic or undefined type, based on VK_NO_PROTOTYPES
   void                appendEnums( std::string & str ) const;
+  void                appendFormatTraits( std::string & str ) const;
   void                appendHandles( std::string & str );
   void                appendHandlesCommandDefinitions( std::string & str ) const;
   void                appendHashStructures( std::string & str ) const;
   void                appendRAIIDispatchers( std::string & str ) const;
   void                appendRAIIHandles( std::string & str, std::string & commandDefinitions );
+  void                appendRAIIInterningCaches( std::string & str ) const;
   void                appendResultExceptions( std::string & str ) const;
   void                appendStructs( std::string & str );
   void                appendStructureChainValidation( std::string & str );
@@ -192,6 +196,44 @@ private:
     int                        xmlLine;
   };
 
+  struct ComponentData
+  {
+    ComponentData( int line ) : xmlLine( line ) {}
+
+    std::string bits;
+    std::string name;
+    std::string numericFormat;
+    std::string planeIndex;
+    int         xmlLine;
+  };
+
+  struct PlaneData
+  {
+    PlaneData( int line ) : xmlLine( line ) {}
+
+    std::string compatible;
+    std::string heightDivisor;
+    std::string widthDivisor;
+    int         xmlLine;
+  };
+
+  struct FormatData
+  {
+    FormatData( int line ) : xmlLine( line ) {}
+
+    std::string                blockExtent;
+    std::string                blockSize;
+    std::string                chroma;
+    std::string                classAttribute;
+    std::string                compressed;
+    std::vector<ComponentData> components;
+    std::string                packed;
+    std::vector<PlaneData>     planes;
+    std::string                spirvImageFormat;
+    std::string                texelsPerBlock;
+    int                        xmlLine;
+  };
+
   struct FuncPointerData
   {
     FuncPointerData( std::string const & r, int line ) : requirements( r ), xmlLine( line ) {}
@@ -536,6 +578,9 @@ private:
                                        std::string &                              commandDefinitions,
                                        std::pair<std::string, HandleData> const & handle,
                                        std::set<std::string> const &              specialFunctions ) const;
+  void        appendRAIIInterningKey( std::string &           str,
+                                      std::string const &     structureName,
+                                      std::set<std::string> & listedStructures ) const;
   void        appendStruct( std::string & str, std::pair<std::string, StructureData> const & structure );
   void        appendStructAssignmentOperators( std::string &                                 str,
                                                std::pair<std::string, StructureData> const & structure,
@@ -616,6 +661,11 @@ private:
                                                       std::pair<size_t, size_t> const & vectorParamIndex,
                                                       std::vector<size_t> const &       returnParamIndices,
                                                       bool                              withAllocator ) const;
+  std::string constructCommandResultEnumerateInto( std::string const &               name,
+                                                   CommandData const &               commandData,
+                                                   size_t                            initialSkipCount,
+                                                   bool                              definition,
+                                                   std::pair<size_t, size_t> const & vectorParamIndices ) const;
   std::string constructCommandResultEnumerateTwoVectors( std::string const &              name,
                                                          CommandData const &              commandData,
                                                          size_t                           initialSkipCount,
@@ -706,6 +756,12 @@ private:
                                                               std::map<size_t, size_t> const & vectorParamIndices,
                                                               size_t                           returnParamIndex,
                                                               bool                             withAllocator ) const;
+  std::string constructCommandResultGetVectorOfHandlesUniqueArray( std::string const &              name,
+                                                                   CommandData const &              commandData,
+                                                                   size_t                           initialSkipCount,
+                                                                   bool                             definition,
+                                                                   std::map<size_t, size_t> const & vectorParamIndices,
+                                                                   size_t returnParamIndex ) const;
   std::string
               constructCommandResultGetVectorOfHandlesUniqueSingular( std::string const &              name,
                                                                       CommandData const &              commandData,
@@ -752,6 +808,12 @@ private:
                                                     std::pair<size_t, size_t> const & vectorParamIndex,
                                                     std::vector<size_t> const &       returnParamIndices,
                                                     bool                              withAllocators ) const;
+  std::string constructCommandVoidEnumerateInto( std::string const &               name,
+                                                 CommandData const &               commandData,
+                                                 size_t                            initialSkipCount,
+                                                 bool                              definition,
+                                                 std::pair<size_t, size_t> const & vectorParamIndex,
+                                                 std::vector<size_t> const &       returnParamIndices ) const;
   std::string constructCommandVoidGetChain( std::string const & name,
                                             CommandData const & commandData,
                                             size_t              initialSkipCount,
@@ -765,6 +827,7 @@ private:
                                             size_t                           returnParamIndex ) const;
   std::string constructConstexprString( std::pair<std::string, StructureData> const & structData,
                                         bool                                          assignmentOperator ) const;
+  std::string constructCommandId( std::string const & command ) const;
   std::string constructFailureCheck( std::vector<std::string> const & successCodes ) const;
   std::string constructFunctionBodyEnhanced( std::string const &              indentation,
                                              std::string const &              name,
@@ -1025,6 +1088,10 @@ private:
   std::string constructReturnType( CommandData const & commandData, std::string const & baseType ) const;
   std::string constructSuccessCheck( std::vector<std::string> const & successCodes ) const;
   std::string constructSuccessCodeList( std::vector<std::string> const & successCodes ) const;
+  std::string constructUniqueDeleterDefinition( CommandData const &              commandData,
+                                               std::string const &              className,
+                                               std::map<size_t, size_t> const & vectorParamIndices,
+                                               size_t                           returnParamIndex ) const;
   std::string constructVectorSizeCheck( std::string const &                           name,
                                         CommandData const &                           commandData,
                                         size_t                                        initialSkipCount,
@@ -1056,6 +1123,8 @@ private:
   std::vector<size_t>      determineNonConstPointerParamIndices( std::vector<ParamData> const & params ) const;
   std::map<size_t, size_t> determineVectorParamIndicesNew( std::vector<ParamData> const & params ) const;
   void                     distributeSecondLevelCommands( std::set<std::string> const & specialFunctions );
+  std::map<std::string, HandleData>::const_iterator    findHandle( std::string const & type ) const;
+  std::map<std::string, StructureData>::const_iterator findStructure( std::string const & type ) const;
   std::string
                                       generateLenInitializer( std::vector<MemberData>::const_iterator                                        mit,
                                                               std::map<std::vector<MemberData>::const_iterator,
@@ -1130,6 +1199,11 @@ private:
   void readFeatureRequire( tinyxml2::XMLElement const * element, std::string const & feature );
   void readFeatureRequireCommand( tinyxml2::XMLElement const * element, std::string const & feature );
   void readFeatureRequireType( tinyxml2::XMLElement const * element, std::string const & feature );
+  void readFormat( tinyxml2::XMLElement const * element );
+  void readFormatComponent( tinyxml2::XMLElement const * element, FormatData & formatData );
+  void readFormatPlane( tinyxml2::XMLElement const * element, FormatData & formatData );
+  void readFormats( tinyxml2::XMLElement const * element );
+  void readFormatSPIRVImageFormat( tinyxml2::XMLElement const * element, FormatData & formatData );
   void readFuncpointer( tinyxml2::XMLElement const * element, std::map<std::string, std::string> const & attributes );
   void readHandle( tinyxml2::XMLElement const * element, std::map<std::string, std::string> const & attributes );
   std::pair<NameData, TypeInfo> readNameAndType( tinyxml2::XMLElement const * elements );
@@ -1182,28 +1256,31 @@ private:
   std::string toString( TypeCategory category );
 
 private:
-  std::map<std::string, BaseTypeData>    m_baseTypes;
-  std::map<std::string, BitmaskData>     m_bitmasks;
-  std::map<std::string, CommandData>     m_commands;
-  std::map<std::string, std::string>     m_constants;
-  std::set<std::string>                  m_defines;
-  std::map<std::string, EnumData>        m_enums;
-  std::set<std::string>                  m_extendedStructs;  // structs which are referenced by the structextends tag
-  std::map<std::string, ExtensionData>   m_extensions;
-  std::map<std::string, std::string>     m_features;
-  std::map<std::string, FuncPointerData> m_funcPointers;
-  std::map<std::string, HandleData>      m_handles;
-  std::set<std::string>                  m_includes;
-  std::set<std::string>                  m_listedTypes;
-  std::set<std::string>                  m_listingTypes;
-  std::map<std::string, PlatformData>    m_platforms;
-  std::map<std::string, std::string>     m_structureAliases;
-  std::map<std::string, StructureData>   m_structures;
-  std::set<std::string>                  m_tags;
-  std::map<std::string, TypeData>        m_types;
-  std::string                            m_typesafeCheck;
-  std::string                            m_version;
-  std::string                            m_vulkanLicenseHeader;
+  std::map<std::string, BaseTypeData>          m_baseTypes;
+  std::map<std::string, BitmaskData>           m_bitmasks;
+  std::map<std::string, CommandData>           m_commands;
+  std::unordered_map<std::string, std::string> m_constants;
+  std::set<std::string>                        m_defines;
+  std::map<std::string, EnumData>              m_enums;
+  // structs which are referenced by the structextends tag
+  std::set<std::string>                        m_extendedStructs;
+  std::map<std::string, ExtensionData>         m_extensions;
+  std::map<std::string, std::string>           m_features;
+  std::map<std::string, FormatData>            m_formats;
+  std::map<std::string, FuncPointerData>       m_funcPointers;
+  std::unordered_map<std::string, std::string> m_handleAliases;  // map from alias to handle name
+  std::map<std::string, HandleData>            m_handles;
+  std::set<std::string>                        m_includes;
+  std::set<std::string>                        m_listedTypes;
+  std::set<std::string>                        m_listingTypes;
+  std::map<std::string, PlatformData>          m_platforms;
+  std::unordered_map<std::string, std::string> m_structureAliases;
+  std::map<std::string, StructureData>         m_structures;
+  std::set<std::string>                        m_tags;
+  std::unordered_map<std::string, TypeData>    m_types;
+  std::string                                  m_typesafeCheck;
+  std::string                                  m_version;
+  std::string                                  m_vulkanLicenseHeader;
 };
 
 const size_t INVALID_INDEX = (size_t)~0;
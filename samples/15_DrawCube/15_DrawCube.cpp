@@ -47,10 +47,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     vk::Device device =
       vk::su::createDevice( physicalDevice, graphicsAndPresentQueueFamilyIndex.first, vk::su::getDeviceExtensions() );
 
-    vk::CommandPool   commandPool = vk::su::createCommandPool( device, graphicsAndPresentQueueFamilyIndex.first );
-    vk::CommandBuffer commandBuffer =
-      device.allocateCommandBuffers( vk::CommandBufferAllocateInfo( commandPool, vk::CommandBufferLevel::ePrimary, 1 ) )
-        .front();
+    vk::su::FramesInFlight framesInFlight( physicalDevice, device, graphicsAndPresentQueueFamilyIndex.first );
 
     vk::Queue graphicsQueue = device.getQueue( graphicsAndPresentQueueFamilyIndex.first, 0 );
     vk::Queue presentQueue  = device.getQueue( graphicsAndPresentQueueFamilyIndex.second, 0 );
@@ -122,15 +119,14 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     /* VULKAN_KEY_START */
 
+    // Wait until the current frame is no longer in use by the GPU, and begin its command buffer
+    vk::CommandBuffer const & commandBuffer = framesInFlight.beginFrame( device ).commandBuffer;
+
     // Get the index of the next available swapchain image:
-    vk::Semaphore             imageAcquiredSemaphore = device.createSemaphore( vk::SemaphoreCreateInfo() );
-    vk::ResultValue<uint32_t> currentBuffer =
-      device.acquireNextImageKHR( swapChainData.swapChain, vk::su::FenceTimeout, imageAcquiredSemaphore, nullptr );
+    vk::ResultValue<uint32_t> currentBuffer = framesInFlight.acquireNextImage( device, swapChainData.swapChain );
     assert( currentBuffer.result == vk::Result::eSuccess );
     assert( currentBuffer.value < framebuffers.size() );
 
-    commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlags() ) );
-
     std::array<vk::ClearValue, 2> clearValues;
     clearValues[0].color        = vk::ClearColorValue( std::array<float, 4>( { { 0.2f, 0.2f, 0.2f, 0.2f } } ) );
     clearValues[1].depthStencil = vk::ClearDepthStencilValue( 1.0f, 0 );
@@ -154,19 +150,11 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     commandBuffer.draw( 12 * 3, 1, 0, 0 );
     commandBuffer.endRenderPass();
-    commandBuffer.end();
-
-    vk::Fence drawFence = device.createFence( vk::FenceCreateInfo() );
 
-    vk::PipelineStageFlags waitDestinationStageMask( vk::PipelineStageFlagBits::eColorAttachmentOutput );
-    vk::SubmitInfo         submitInfo( imageAcquiredSemaphore, waitDestinationStageMask, commandBuffer );
-    graphicsQueue.submit( submitInfo, drawFence );
+    // Submit the command buffer, waiting on the acquired image; the presentation waits on the rendering, not the CPU
+    framesInFlight.submit( graphicsQueue, vk::PipelineStageFlagBits::eColorAttachmentOutput );
 
-    while ( vk::Result::eTimeout == device.waitForFences( drawFence, VK_TRUE, vk::su::FenceTimeout ) )
-      ;
-
-    vk::Result result =
-      presentQueue.presentKHR( vk::PresentInfoKHR( {}, swapChainData.swapChain, currentBuffer.value ) );
+    vk::Result result = framesInFlight.present( presentQueue, swapChainData.swapChain, currentBuffer.value );
     switch ( result )
     {
       case vk::Result::eSuccess: break;
@@ -179,9 +167,6 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     device.waitIdle();
 
-    device.destroyFence( drawFence );
-    device.destroySemaphore( imageAcquiredSemaphore );
-
     /* VULKAN_KEY_END */
 
     device.destroyPipeline( graphicsPipeline );
@@ -200,7 +185,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     uniformBufferData.clear( device );
     depthBufferData.clear( device );
     swapChainData.clear( device );
-    device.destroyCommandPool( commandPool );
+    framesInFlight.clear( device );
     device.destroy();
     instance.destroySurfaceKHR( surfaceData.surface );
     instance.destroyDebugUtilsMessengerEXT( debugUtilsMessenger );
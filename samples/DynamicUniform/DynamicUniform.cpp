@@ -126,16 +126,10 @@ int main( int /*argc*/, char ** /*argv*/ )
     model    = glm::translate( model, glm::vec3( -1.5f, 1.5f, -1.5f ) );
     mvpcs[1] = clip * projection * view * model;
 
-    vk::DeviceSize bufferSize = sizeof( glm::mat4x4 );
-    if ( limits.minUniformBufferOffsetAlignment )
-    {
-      bufferSize =
-        ( bufferSize + limits.minUniformBufferOffsetAlignment - 1 ) & ~( limits.minUniformBufferOffsetAlignment - 1 );
-    }
-
-    vk::su::BufferData uniformBufferData(
-      physicalDevice, device, 2 * bufferSize, vk::BufferUsageFlagBits::eUniformBuffer );
-    vk::su::copyToDevice( device, uniformBufferData.deviceMemory, mvpcs, 2, bufferSize );
+    // the matrices are placed into a persistently mapped buffer, at offsets aligned to minUniformBufferOffsetAlignment
+    vk::su::DynamicBufferAllocator dynamicBufferAllocator( physicalDevice, device, 64 * 1024, 1 );
+    std::array<vk::su::DynamicAllocation, 2> mvpcAllocations = { { dynamicBufferAllocator.pushUniform( mvpcs[0] ),
+                                                                   dynamicBufferAllocator.pushUniform( mvpcs[1] ) } };
 
     // create a DescriptorSetLayout with vk::DescriptorType::eUniformBufferDynamic
     vk::DescriptorSetLayout descriptorSetLayout = vk::su::createDescriptorSetLayout(
@@ -149,8 +143,13 @@ int main( int /*argc*/, char ** /*argv*/ )
     vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo( descriptorPool, descriptorSetLayout );
     vk::DescriptorSet             descriptorSet = device.allocateDescriptorSets( descriptorSetAllocateInfo ).front();
 
-    vk::su::updateDescriptorSets(
-      device, descriptorSet, { { vk::DescriptorType::eUniformBufferDynamic, uniformBufferData.buffer, {} } }, {} );
+    // the range of a dynamic uniform buffer is the size of the data used per draw
+    vk::DescriptorBufferInfo descriptorBufferInfo =
+      dynamicBufferAllocator.getDescriptorBufferInfo( 0, sizeof( glm::mat4x4 ) );
+    device.updateDescriptorSets(
+      vk::WriteDescriptorSet(
+        descriptorSet, 0, 0, vk::DescriptorType::eUniformBufferDynamic, nullptr, descriptorBufferInfo ),
+      nullptr );
 
     vk::PipelineCache pipelineCache    = device.createPipelineCache( vk::PipelineCacheCreateInfo() );
     vk::Pipeline      graphicsPipeline = vk::su::createGraphicsPipeline(
@@ -193,7 +192,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     commandBuffer.setScissor( 0, vk::Rect2D( vk::Offset2D( 0, 0 ), surfaceData.extent ) );
 
     /* The first draw should use the first matrix in the buffer */
-    uint32_t dynamicOffset = 0;
+    uint32_t dynamicOffset = mvpcAllocations[0].dynamicOffset;
     commandBuffer.bindDescriptorSets(
       vk::PipelineBindPoint::eGraphics, pipelineLayout, 0, descriptorSet, dynamicOffset );
 
@@ -201,7 +200,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     commandBuffer.draw( 12 * 3, 1, 0, 0 );
 
     // the second draw should use the second matrix in the buffer;
-    dynamicOffset = (uint32_t)bufferSize;
+    dynamicOffset = mvpcAllocations[1].dynamicOffset;
     commandBuffer.bindDescriptorSets(
       vk::PipelineBindPoint::eGraphics, pipelineLayout, 0, descriptorSet, dynamicOffset );
     commandBuffer.draw( 12 * 3, 1, 0, 0 );
@@ -242,7 +241,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     device.destroyDescriptorPool( descriptorPool );
     device.destroyPipelineLayout( pipelineLayout );
     device.destroyDescriptorSetLayout( descriptorSetLayout );
-    uniformBufferData.clear( device );
+    dynamicBufferAllocator.clear( device );
     vertexBufferData.clear( device );
     for ( auto framebuffer : framebuffers )
     {
@@ -36,6 +36,9 @@
 #include <numeric>
 #include <random>
 #include <sstream>
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( 1 <= _M_IX86_FP ) )
+#  include <xmmintrin.h>
+#endif
 
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #define GLM_FORCE_RADIANS
@@ -79,150 +82,381 @@ struct GeometryInstanceData
 };
 static_assert( sizeof( GeometryInstanceData ) == 64, "GeometryInstanceData structure compiles to incorrect size" );
 
-struct AccelerationStructureData
+// Writes the top three rows of the transforms, as expected by GeometryInstanceData::transform, into the instances.
+// With SSE available, each matrix is transposed in registers.
+void packTransforms( GeometryInstanceData * instances, glm::mat4x4 const * transforms, size_t count )
+{
+  for ( size_t i = 0; i < count; i++ )
+  {
+    float const * m = &transforms[i][0][0];  // column major
+    float *       t = instances[i].transform;
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( 1 <= _M_IX86_FP ) )
+    __m128 row0 = _mm_loadu_ps( m );
+    __m128 row1 = _mm_loadu_ps( m + 4 );
+    __m128 row2 = _mm_loadu_ps( m + 8 );
+    __m128 row3 = _mm_loadu_ps( m + 12 );
+    _MM_TRANSPOSE4_PS( row0, row1, row2, row3 );
+    _mm_storeu_ps( t, row0 );
+    _mm_storeu_ps( t + 4, row1 );
+    _mm_storeu_ps( t + 8, row2 );
+#else
+    for ( size_t row = 0; row < 3; row++ )
+    {
+      for ( size_t col = 0; col < 4; col++ )
+      {
+        t[4 * row + col] = m[4 * col + row];
+      }
+    }
+#endif
+  }
+}
+
+vk::DeviceSize alignUp( vk::DeviceSize value, vk::DeviceSize alignment )
+{
+  return ( value + alignment - 1 ) / alignment * alignment;
+}
+
+// Builds any number of bottom-level acceleration structures, placed in one single memory allocation, and one top-level
+// acceleration structure, all sharing one scratch buffer. The bottom-level builds are packed into the scratch buffer
+// one after the other, and only when it's full there's a barrier before re-using it from the start. Optionally, the
+// bottom-level structures are compacted, using the compacted sizes queried right after building them.
+class AccelerationStructureBuilder
 {
-  void clear( vk::Device device )
+public:
+  AccelerationStructureBuilder( vk::PhysicalDevice const & physicalDevice,
+                                vk::Device const &         device,
+                                vk::DeviceSize             scratchBudget = 32 * 1024 * 1024 )
+    : m_physicalDevice( physicalDevice )
+    , m_device( device )
+    , m_scratchBudget( scratchBudget )
+    , m_scratchSize( 0 )
+    , m_instanceCount( 0 )
+  {}
+
+  // returns the index of the bottom-level acceleration structure, as to be used with buildTopLevel
+  uint32_t addBottomLevel( std::vector<vk::GeometryNV> const & geometries )
+  {
+    m_bottomLevels.push_back( { geometries, nullptr, 0 } );
+    return vk::su::checked_cast<uint32_t>( m_bottomLevels.size() - 1 );
+  }
+
+  // creates all the bottom-level acceleration structures added so far and records their builds
+  void buildBottomLevel( vk::CommandBuffer const & commandBuffer, bool allowCompaction )
   {
-    device.destroyAccelerationStructureNV( accelerationStructure );
-    if ( scratchBufferData )
+    assert( !m_bottomLevels.empty() && !m_bottomLevelMemory );
+
+    m_bottomLevelFlags = vk::BuildAccelerationStructureFlagBitsNV::ePreferFastTrace;
+    if ( allowCompaction )
+    {
+      m_bottomLevelFlags |= vk::BuildAccelerationStructureFlagBitsNV::eAllowCompaction;
+    }
+
+    std::vector<vk::AccelerationStructureNV> accelerationStructures;
+    accelerationStructures.reserve( m_bottomLevels.size() );
+    vk::DeviceSize scratchAlignment = 1;
+    for ( auto & bottomLevel : m_bottomLevels )
+    {
+      bottomLevel.accelerationStructure = m_device.createAccelerationStructureNV(
+        vk::AccelerationStructureCreateInfoNV( 0, getBottomLevelInfo( bottomLevel ) ) );
+      accelerationStructures.push_back( bottomLevel.accelerationStructure );
+
+      vk::MemoryRequirements scratchRequirements = getMemoryRequirements(
+        vk::AccelerationStructureMemoryRequirementsTypeNV::eBuildScratch, bottomLevel.accelerationStructure );
+      bottomLevel.scratchSize = scratchRequirements.size;
+      scratchAlignment        = std::max( scratchAlignment, scratchRequirements.alignment );
+    }
+
+    // the builds are packed into the scratch buffer at offsets aligned as required by any of them
+    vk::DeviceSize maxScratchSize = 0, sumScratchSize = 0;
+    for ( auto & bottomLevel : m_bottomLevels )
     {
-      scratchBufferData->clear( device );
+      bottomLevel.scratchSize = alignUp( bottomLevel.scratchSize, scratchAlignment );
+      maxScratchSize          = std::max( maxScratchSize, bottomLevel.scratchSize );
+      sumScratchSize += bottomLevel.scratchSize;
     }
-    if ( resultBufferData )
+    m_bottomLevelMemory = allocateAndBind( accelerationStructures );
+
+    // one scratch buffer big enough for the largest build, and for as many builds as fit into the budget
+    ensureScratchSize( std::max( maxScratchSize, std::min( sumScratchSize, m_scratchBudget ) ) );
+
+    vk::DeviceSize scratchOffset = 0;
+    for ( auto const & bottomLevel : m_bottomLevels )
     {
-      resultBufferData->clear( device );
+      if ( m_scratchSize < scratchOffset + bottomLevel.scratchSize )
+      {
+        // the builds recorded so far need to be finished before their scratch memory can be re-used
+        buildBarrier( commandBuffer, vk::PipelineStageFlagBits::eAccelerationStructureBuildNV );
+        scratchOffset = 0;
+      }
+      commandBuffer.buildAccelerationStructureNV( getBottomLevelInfo( bottomLevel ),
+                                                  nullptr,
+                                                  0,
+                                                  false,
+                                                  bottomLevel.accelerationStructure,
+                                                  nullptr,
+                                                  m_scratchBufferData->buffer,
+                                                  scratchOffset );
+      scratchOffset += bottomLevel.scratchSize;
     }
-    if ( instanceBufferData )
+    buildBarrier( commandBuffer, vk::PipelineStageFlagBits::eAccelerationStructureBuildNV );
+
+    if ( allowCompaction )
     {
-      instanceBufferData->clear( device );
+      uint32_t queryCount = vk::su::checked_cast<uint32_t>( accelerationStructures.size() );
+      m_queryPool         = m_device.createQueryPool(
+        vk::QueryPoolCreateInfo( {}, vk::QueryType::eAccelerationStructureCompactedSizeNV, queryCount ) );
+      commandBuffer.resetQueryPool( m_queryPool, 0, queryCount );
+      commandBuffer.writeAccelerationStructuresPropertiesNV(
+        accelerationStructures, vk::QueryType::eAccelerationStructureCompactedSizeNV, m_queryPool, 0 );
     }
   }
 
-  vk::AccelerationStructureNV         accelerationStructure;
-  std::unique_ptr<vk::su::BufferData> scratchBufferData;
-  std::unique_ptr<vk::su::BufferData> resultBufferData;
-  std::unique_ptr<vk::su::BufferData> instanceBufferData;
-};
+  // creates compacted copies of the bottom-level acceleration structures and records the copies;
+  // the commands recorded by buildBottomLevel need to be completed
+  void compactBottomLevel( vk::CommandBuffer const & commandBuffer )
+  {
+    assert( m_queryPool && !m_uncompactedMemory );
+
+    uint32_t                    count = vk::su::checked_cast<uint32_t>( m_bottomLevels.size() );
+    std::vector<vk::DeviceSize> compactedSizes =
+      m_device
+        .getQueryPoolResults<vk::DeviceSize>( m_queryPool,
+                                              0,
+                                              count,
+                                              count * sizeof( vk::DeviceSize ),
+                                              sizeof( vk::DeviceSize ),
+                                              vk::QueryResultFlagBits::e64 | vk::QueryResultFlagBits::eWait )
+        .value;
+    m_device.destroyQueryPool( m_queryPool );
+    m_queryPool = nullptr;
+
+    std::vector<vk::AccelerationStructureNV> compacted;
+    compacted.reserve( count );
+    for ( uint32_t i = 0; i < count; i++ )
+    {
+      compacted.push_back( m_device.createAccelerationStructureNV(
+        vk::AccelerationStructureCreateInfoNV( compactedSizes[i], getBottomLevelInfo( m_bottomLevels[i] ) ) ) );
+    }
+    vk::DeviceMemory compactedMemory = allocateAndBind( compacted );
 
-AccelerationStructureData
-  createAccelerationStructureData( vk::PhysicalDevice const & physicalDevice,
-                                   vk::Device const &         device,
-                                   vk::CommandBuffer const &  commandBuffer,
-                                   std::vector<std::pair<vk::AccelerationStructureNV, glm::mat4x4>> const & instances,
-                                   std::vector<vk::GeometryNV> const &                                      geometries )
-{
-  assert( instances.empty() ^ geometries.empty() );
-
-  AccelerationStructureData accelerationStructureData;
-
-  vk::AccelerationStructureTypeNV accelerationStructureType =
-    instances.empty() ? vk::AccelerationStructureTypeNV::eBottomLevel : vk::AccelerationStructureTypeNV::eTopLevel;
-  vk::AccelerationStructureInfoNV accelerationStructureInfo(
-    accelerationStructureType, {}, vk::su::checked_cast<uint32_t>( instances.size() ), geometries );
-  accelerationStructureData.accelerationStructure =
-    device.createAccelerationStructureNV( vk::AccelerationStructureCreateInfoNV( 0, accelerationStructureInfo ) );
-
-  vk::AccelerationStructureMemoryRequirementsInfoNV objectRequirements(
-    vk::AccelerationStructureMemoryRequirementsTypeNV::eObject, accelerationStructureData.accelerationStructure );
-  vk::DeviceSize resultSizeInBytes =
-    device.getAccelerationStructureMemoryRequirementsNV( objectRequirements ).memoryRequirements.size;
-  assert( 0 < resultSizeInBytes );
-  accelerationStructureData.resultBufferData =
-    std::unique_ptr<vk::su::BufferData>( new vk::su::BufferData( physicalDevice,
-                                                                 device,
-                                                                 resultSizeInBytes,
-                                                                 vk::BufferUsageFlagBits::eRayTracingNV,
-                                                                 vk::MemoryPropertyFlagBits::eDeviceLocal ) );
-
-  vk::AccelerationStructureMemoryRequirementsInfoNV buildScratchRequirements(
-    vk::AccelerationStructureMemoryRequirementsTypeNV::eBuildScratch, accelerationStructureData.accelerationStructure );
-  vk::AccelerationStructureMemoryRequirementsInfoNV updateScratchRequirements(
-    vk::AccelerationStructureMemoryRequirementsTypeNV::eUpdateScratch,
-    accelerationStructureData.accelerationStructure );
-  vk::DeviceSize scratchSizeInBytes = std::max(
-    device.getAccelerationStructureMemoryRequirementsNV( buildScratchRequirements ).memoryRequirements.size,
-    device.getAccelerationStructureMemoryRequirementsNV( updateScratchRequirements ).memoryRequirements.size );
-  assert( 0 < scratchSizeInBytes );
-
-  accelerationStructureData.scratchBufferData =
-    std::unique_ptr<vk::su::BufferData>( new vk::su::BufferData( physicalDevice,
-                                                                 device,
-                                                                 scratchSizeInBytes,
-                                                                 vk::BufferUsageFlagBits::eRayTracingNV,
-                                                                 vk::MemoryPropertyFlagBits::eDeviceLocal ) );
-
-  if ( !instances.empty() )
+    for ( uint32_t i = 0; i < count; i++ )
+    {
+      commandBuffer.copyAccelerationStructureNV(
+        compacted[i], m_bottomLevels[i].accelerationStructure, vk::CopyAccelerationStructureModeNV::eCompact );
+      m_uncompacted.push_back( m_bottomLevels[i].accelerationStructure );
+      m_bottomLevels[i].accelerationStructure = compacted[i];
+    }
+    buildBarrier( commandBuffer, vk::PipelineStageFlagBits::eAccelerationStructureBuildNV );
+
+    m_uncompactedMemory = m_bottomLevelMemory;
+    m_bottomLevelMemory = compactedMemory;
+  }
+
+  // destroys the originals of the compacted structures; the commands recorded by compactBottomLevel need to be
+  // completed
+  void releaseUncompacted()
   {
-    accelerationStructureData.instanceBufferData =
-      std::unique_ptr<vk::su::BufferData>( new vk::su::BufferData( physicalDevice,
-                                                                   device,
-                                                                   instances.size() * sizeof( GeometryInstanceData ),
-                                                                   vk::BufferUsageFlagBits::eRayTracingNV ) );
+    for ( auto accelerationStructure : m_uncompacted )
+    {
+      m_device.destroyAccelerationStructureNV( accelerationStructure );
+    }
+    m_uncompacted.clear();
+    m_device.freeMemory( m_uncompactedMemory );
+    m_uncompactedMemory = nullptr;
+  }
 
-    std::vector<GeometryInstanceData> geometryInstanceData;
+  // creates and builds the top-level acceleration structure over instances of the bottom-level structures, given by
+  // their index and transform
+  void buildTopLevel( vk::CommandBuffer const &                              commandBuffer,
+                      std::vector<std::pair<uint32_t, glm::mat4x4>> const & instances )
+  {
+    assert( !m_topLevel && !instances.empty() );
+
+    m_instanceCount = vk::su::checked_cast<uint32_t>( instances.size() );
+    m_topLevel      = m_device.createAccelerationStructureNV(
+      vk::AccelerationStructureCreateInfoNV( 0, getTopLevelInfo() ) );
+    m_topLevelMemory = allocateAndBind( { m_topLevel } );
+    ensureScratchSize(
+      getMemoryRequirements( vk::AccelerationStructureMemoryRequirementsTypeNV::eBuildScratch, m_topLevel ).size );
+
+    m_instanceBufferData = std::unique_ptr<vk::su::BufferData>(
+      new vk::su::BufferData( m_physicalDevice,
+                              m_device,
+                              instances.size() * sizeof( GeometryInstanceData ),
+                              vk::BufferUsageFlagBits::eRayTracingNV ) );
+    GeometryInstanceData * instanceData = static_cast<GeometryInstanceData *>(
+      m_device.mapMemory( m_instanceBufferData->deviceMemory, 0, instances.size() * sizeof( GeometryInstanceData ) ) );
+
+    std::vector<glm::mat4x4> transforms;
+    transforms.reserve( instances.size() );
     for ( size_t i = 0; i < instances.size(); i++ )
     {
-      uint64_t accelerationStructureHandle = device.getAccelerationStructureHandleNV<uint64_t>( instances[i].first );
+      uint64_t accelerationStructureHandle = m_device.getAccelerationStructureHandleNV<uint64_t>(
+        m_bottomLevels[instances[i].first].accelerationStructure );
 
       // For each instance we set its instance index to its index i in the instance vector, and set
       // its hit group index to 2*i. The hit group index defines which entry of the shader binding
       // table will contain the hit group to be executed when hitting this instance. We set this
       // index to 2*i due to the use of 2 types of rays in the scene: the camera rays and the shadow
       // rays. For each instance, the SBT will then have 2 hit groups
-      geometryInstanceData.emplace_back(
-        GeometryInstanceData( glm::transpose( instances[i].second ),
+      new ( instanceData + i )
+        GeometryInstanceData( glm::mat4x4( 1.0f ),
                               static_cast<uint32_t>( i ),
                               0xFF,
                               static_cast<uint32_t>( 2 * i ),
                               static_cast<uint8_t>( vk::GeometryInstanceFlagBitsNV::eTriangleCullDisable ),
-                              accelerationStructureHandle ) );
+                              accelerationStructureHandle );
+      transforms.push_back( instances[i].second );
     }
-    accelerationStructureData.instanceBufferData->upload( device, geometryInstanceData );
+    packTransforms( instanceData, transforms.data(), transforms.size() );
+    m_device.unmapMemory( m_instanceBufferData->deviceMemory );
+
+    commandBuffer.buildAccelerationStructureNV(
+      getTopLevelInfo(), m_instanceBufferData->buffer, 0, false, m_topLevel, nullptr, m_scratchBufferData->buffer, 0 );
+    buildBarrier( commandBuffer, vk::PipelineStageFlagBits::eRayTracingShaderNV );
   }
 
-  device.bindAccelerationStructureMemoryNV( vk::BindAccelerationStructureMemoryInfoNV(
-    accelerationStructureData.accelerationStructure, accelerationStructureData.resultBufferData->deviceMemory ) );
-
-  commandBuffer.buildAccelerationStructureNV(
-    vk::AccelerationStructureInfoNV(
-      accelerationStructureType, {}, vk::su::checked_cast<uint32_t>( instances.size() ), geometries ),
-    accelerationStructureData.instanceBufferData ? accelerationStructureData.instanceBufferData->buffer : nullptr,
-    0,
-    false,
-    accelerationStructureData.accelerationStructure,
-    nullptr,
-    accelerationStructureData.scratchBufferData->buffer,
-    0 );
-
-  commandBuffer.pipelineBarrier( vk::PipelineStageFlagBits::eAccelerationStructureBuildNV,
-                                 vk::PipelineStageFlagBits::eAccelerationStructureBuildNV,
-                                 {},
-                                 vk::MemoryBarrier( vk::AccessFlagBits::eAccelerationStructureWriteNV |
-                                                      vk::AccessFlagBits::eAccelerationStructureReadNV,
-                                                    vk::AccessFlagBits::eAccelerationStructureWriteNV |
-                                                      vk::AccessFlagBits::eAccelerationStructureReadNV ),
-                                 {},
-                                 {} );
-
-  return accelerationStructureData;
-}
+  vk::AccelerationStructureNV const & getTopLevel() const
+  {
+    return m_topLevel;
+  }
 
-struct PerFrameData
-{
-  void clear( vk::Device device )
+  void clear()
   {
-    device.freeCommandBuffers( commandPool, commandBuffer );
-    device.destroyCommandPool( commandPool );
-    device.destroyFence( fence );
-    device.destroySemaphore( presentCompleteSemaphore );
-    device.destroySemaphore( renderCompleteSemaphore );
+    if ( m_uncompactedMemory )
+    {
+      releaseUncompacted();
+    }
+    if ( m_queryPool )
+    {
+      m_device.destroyQueryPool( m_queryPool );
+    }
+    if ( m_instanceBufferData )
+    {
+      m_instanceBufferData->clear( m_device );
+    }
+    m_device.destroyAccelerationStructureNV( m_topLevel );
+    m_device.freeMemory( m_topLevelMemory );
+    for ( auto const & bottomLevel : m_bottomLevels )
+    {
+      m_device.destroyAccelerationStructureNV( bottomLevel.accelerationStructure );
+    }
+    m_device.freeMemory( m_bottomLevelMemory );
+    if ( m_scratchBufferData )
+    {
+      m_scratchBufferData->clear( m_device );
+    }
+  }
+
+private:
+  struct BottomLevel
+  {
+    std::vector<vk::GeometryNV> geometries;
+    vk::AccelerationStructureNV accelerationStructure;
+    vk::DeviceSize              scratchSize;
+  };
+
+private:
+  vk::DeviceMemory allocateAndBind( std::vector<vk::AccelerationStructureNV> const & accelerationStructures )
+  {
+    // all the acceleration structures get placed into one memory allocation
+    vk::MemoryRequirements                                 memoryRequirements( 0, 1, ~0u );
+    std::vector<vk::BindAccelerationStructureMemoryInfoNV> bindInfos;
+    bindInfos.reserve( accelerationStructures.size() );
+    for ( auto accelerationStructure : accelerationStructures )
+    {
+      vk::MemoryRequirements objectRequirements =
+        getMemoryRequirements( vk::AccelerationStructureMemoryRequirementsTypeNV::eObject, accelerationStructure );
+      assert( 0 < objectRequirements.size );
+      vk::DeviceSize offset = alignUp( memoryRequirements.size, objectRequirements.alignment );
+      bindInfos.push_back( vk::BindAccelerationStructureMemoryInfoNV( accelerationStructure, nullptr, offset ) );
+      memoryRequirements.size           = offset + objectRequirements.size;
+      memoryRequirements.alignment      = std::max( memoryRequirements.alignment, objectRequirements.alignment );
+      memoryRequirements.memoryTypeBits &= objectRequirements.memoryTypeBits;
+    }
+
+    vk::DeviceMemory deviceMemory = vk::su::allocateDeviceMemory( m_device,
+                                                                  m_physicalDevice.getMemoryProperties(),
+                                                                  memoryRequirements,
+                                                                  vk::MemoryPropertyFlagBits::eDeviceLocal );
+    for ( auto & bindInfo : bindInfos )
+    {
+      bindInfo.memory = deviceMemory;
+    }
+    m_device.bindAccelerationStructureMemoryNV( bindInfos );
+    return deviceMemory;
   }
 
-  vk::CommandPool   commandPool;
-  vk::CommandBuffer commandBuffer;
-  vk::Fence         fence;
-  vk::Semaphore     presentCompleteSemaphore;
-  vk::Semaphore     renderCompleteSemaphore;
+  void buildBarrier( vk::CommandBuffer const & commandBuffer, vk::PipelineStageFlagBits dstStageMask ) const
+  {
+    commandBuffer.pipelineBarrier( vk::PipelineStageFlagBits::eAccelerationStructureBuildNV,
+                                   dstStageMask,
+                                   {},
+                                   vk::MemoryBarrier( vk::AccessFlagBits::eAccelerationStructureWriteNV |
+                                                        vk::AccessFlagBits::eAccelerationStructureReadNV,
+                                                      vk::AccessFlagBits::eAccelerationStructureWriteNV |
+                                                        vk::AccessFlagBits::eAccelerationStructureReadNV ),
+                                   {},
+                                   {} );
+  }
+
+  // the scratch buffer is only ever grown between builds, with none of them pending on the GPU
+  void ensureScratchSize( vk::DeviceSize scratchSize )
+  {
+    if ( m_scratchSize < scratchSize )
+    {
+      if ( m_scratchBufferData )
+      {
+        m_scratchBufferData->clear( m_device );
+      }
+      m_scratchBufferData = std::unique_ptr<vk::su::BufferData>(
+        new vk::su::BufferData( m_physicalDevice,
+                                m_device,
+                                scratchSize,
+                                vk::BufferUsageFlagBits::eRayTracingNV,
+                                vk::MemoryPropertyFlagBits::eDeviceLocal ) );
+      m_scratchSize = scratchSize;
+    }
+  }
+
+  vk::AccelerationStructureInfoNV getBottomLevelInfo( BottomLevel const & bottomLevel ) const
+  {
+    return vk::AccelerationStructureInfoNV(
+      vk::AccelerationStructureTypeNV::eBottomLevel, m_bottomLevelFlags, 0, bottomLevel.geometries );
+  }
+
+  vk::MemoryRequirements getMemoryRequirements( vk::AccelerationStructureMemoryRequirementsTypeNV type,
+                                                vk::AccelerationStructureNV const & accelerationStructure ) const
+  {
+    return m_device
+      .getAccelerationStructureMemoryRequirementsNV(
+        vk::AccelerationStructureMemoryRequirementsInfoNV( type, accelerationStructure ) )
+      .memoryRequirements;
+  }
+
+  vk::AccelerationStructureInfoNV getTopLevelInfo() const
+  {
+    return vk::AccelerationStructureInfoNV( vk::AccelerationStructureTypeNV::eTopLevel,
+                                            vk::BuildAccelerationStructureFlagBitsNV::ePreferFastTrace,
+                                            m_instanceCount );
+  }
+
+private:
+  vk::PhysicalDevice                       m_physicalDevice;
+  vk::Device                               m_device;
+  vk::DeviceSize                           m_scratchBudget;
+  std::unique_ptr<vk::su::BufferData>      m_scratchBufferData;
+  vk::DeviceSize                           m_scratchSize;
+  std::vector<BottomLevel>                 m_bottomLevels;
+  vk::BuildAccelerationStructureFlagsNV    m_bottomLevelFlags;
+  vk::DeviceMemory                         m_bottomLevelMemory;
+  vk::QueryPool                            m_queryPool;
+  std::vector<vk::AccelerationStructureNV> m_uncompacted;
+  vk::DeviceMemory                         m_uncompactedMemory;
+  vk::AccelerationStructureNV              m_topLevel;
+  vk::DeviceMemory                         m_topLevelMemory;
+  std::unique_ptr<vk::su::BufferData>      m_instanceBufferData;
+  uint32_t                                 m_instanceCount;
 };
 
 struct UniformBufferObject
@@ -765,19 +999,11 @@ int main( int /*argc*/, char ** /*argv*/ )
                             &supportedFeatures.get<vk::PhysicalDeviceDescriptorIndexingFeaturesEXT>() );
 
     // setup stuff per frame
-    std::array<PerFrameData, IMGUI_VK_QUEUED_FRAMES> perFrameData;
-    for ( int i = 0; i < IMGUI_VK_QUEUED_FRAMES; i++ )
-    {
-      perFrameData[i].commandPool   = device.createCommandPool( vk::CommandPoolCreateInfo(
-        vk::CommandPoolCreateFlagBits::eResetCommandBuffer, graphicsAndPresentQueueFamilyIndex.first ) );
-      perFrameData[i].commandBuffer = device
-                                        .allocateCommandBuffers( vk::CommandBufferAllocateInfo(
-                                          perFrameData[i].commandPool, vk::CommandBufferLevel::ePrimary, 1 ) )
-                                        .front();
-      perFrameData[i].fence = device.createFence( vk::FenceCreateInfo( vk::FenceCreateFlagBits::eSignaled ) );
-      perFrameData[i].presentCompleteSemaphore = device.createSemaphore( vk::SemaphoreCreateInfo() );
-      perFrameData[i].renderCompleteSemaphore  = device.createSemaphore( vk::SemaphoreCreateInfo() );
-    }
+    vk::su::FramesInFlight framesInFlight(
+      physicalDevice, device, graphicsAndPresentQueueFamilyIndex.first, IMGUI_VK_QUEUED_FRAMES );
+
+    // a separate command pool for the one-time submits during setup
+    vk::CommandPool commandPool = vk::su::createCommandPool( device, graphicsAndPresentQueueFamilyIndex.first );
 
     vk::Queue graphicsQueue = device.getQueue( graphicsAndPresentQueueFamilyIndex.first, 0 );
     vk::Queue presentQueue  = device.getQueue( graphicsAndPresentQueueFamilyIndex.second, 0 );
@@ -826,7 +1052,7 @@ int main( int /*argc*/, char ** /*argv*/ )
                              true );
     }
     vk::su::oneTimeSubmit(
-      device, perFrameData[0].commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
+      device, commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
         for ( auto & t : textures )
         {
           t.setImage(
@@ -885,7 +1111,7 @@ int main( int /*argc*/, char ** /*argv*/ )
                                            vk::BufferUsageFlagBits::eStorageBuffer,
                                          vk::MemoryPropertyFlagBits::eDeviceLocal );
     vertexBufferData.upload(
-      physicalDevice, device, perFrameData[0].commandPool, graphicsQueue, vertices, VertexStride );
+      physicalDevice, device, commandPool, graphicsQueue, vertices, VertexStride );
 
     vk::su::BufferData indexBufferData( physicalDevice,
                                         device,
@@ -894,7 +1120,7 @@ int main( int /*argc*/, char ** /*argv*/ )
                                           vk::BufferUsageFlagBits::eStorageBuffer,
                                         vk::MemoryPropertyFlagBits::eDeviceLocal );
     indexBufferData.upload(
-      physicalDevice, device, perFrameData[0].commandPool, graphicsQueue, indices, sizeof( uint32_t ) );
+      physicalDevice, device, commandPool, graphicsQueue, indices, sizeof( uint32_t ) );
 
     glm::mat4x4 transform(
       glm::mat4x4( 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f ) );
@@ -946,38 +1172,32 @@ int main( int /*argc*/, char ** /*argv*/ )
 
     // RayTracing specific stuff
 
-    // create acceleration structures: one top-level, and just one bottom-level
-    AccelerationStructureData topLevelAS, bottomLevelAS;
-    vk::su::oneTimeSubmit(
-      device, perFrameData[0].commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
-        vk::GeometryDataNV geometryDataNV( vk::GeometryTrianglesNV( vertexBufferData.buffer,
-                                                                    0,
-                                                                    vk::su::checked_cast<uint32_t>( vertices.size() ),
-                                                                    VertexStride,
-                                                                    vk::Format::eR32G32B32Sfloat,
-                                                                    indexBufferData.buffer,
-                                                                    0,
-                                                                    vk::su::checked_cast<uint32_t>( indices.size() ),
-                                                                    vk::IndexType::eUint32 ),
-                                           {} );
-        bottomLevelAS =
-          createAccelerationStructureData( physicalDevice,
-                                           device,
-                                           commandBuffer,
-                                           {},
-                                           { vk::GeometryNV( vk::GeometryTypeNV::eTriangles, geometryDataNV ) } );
-
-        topLevelAS =
-          createAccelerationStructureData( physicalDevice,
-                                           device,
-                                           commandBuffer,
-                                           { std::make_pair( bottomLevelAS.accelerationStructure, transform ) },
-                                           std::vector<vk::GeometryNV>() );
-      } );
+    // create acceleration structures: one top-level, and just one bottom-level, which gets compacted
+    AccelerationStructureBuilder accelerationStructureBuilder( physicalDevice, device );
+    vk::GeometryDataNV           geometryDataNV( vk::GeometryTrianglesNV( vertexBufferData.buffer,
+                                                                0,
+                                                                vk::su::checked_cast<uint32_t>( vertices.size() ),
+                                                                VertexStride,
+                                                                vk::Format::eR32G32B32Sfloat,
+                                                                indexBufferData.buffer,
+                                                                0,
+                                                                vk::su::checked_cast<uint32_t>( indices.size() ),
+                                                                vk::IndexType::eUint32 ),
+                                       {} );
+    uint32_t                     bottomLevelIndex = accelerationStructureBuilder.addBottomLevel(
+      { vk::GeometryNV( vk::GeometryTypeNV::eTriangles, geometryDataNV ) } );
+    vk::su::oneTimeSubmit( device, commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
+      accelerationStructureBuilder.buildBottomLevel( commandBuffer, true );
+    } );
+    vk::su::oneTimeSubmit( device, commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
+      accelerationStructureBuilder.compactBottomLevel( commandBuffer );
+      accelerationStructureBuilder.buildTopLevel( commandBuffer, { std::make_pair( bottomLevelIndex, transform ) } );
+    } );
+    accelerationStructureBuilder.releaseUncompacted();
 
     // create raytracing descriptor set
     vk::su::oneTimeSubmit(
-      device, perFrameData[0].commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
+      device, commandPool, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
         vk::BufferMemoryBarrier bufferMemoryBarrier( {},
                                                      vk::AccessFlagBits::eShaderRead,
                                                      VK_QUEUE_FAMILY_IGNORED,
@@ -1045,8 +1265,8 @@ int main( int /*argc*/, char ** /*argv*/ )
       device.allocateDescriptorSets( descriptorSetAllocateInfo );
 
     // Bind ray tracing specific descriptor sets into pNext of a vk::WriteDescriptorSet
-    vk::WriteDescriptorSetAccelerationStructureNV writeDescriptorSetAcceleration( 1,
-                                                                                  &topLevelAS.accelerationStructure );
+    vk::WriteDescriptorSetAccelerationStructureNV writeDescriptorSetAcceleration(
+      1, &accelerationStructureBuilder.getTopLevel() );
     std::vector<vk::WriteDescriptorSet>           accelerationDescriptionSets;
     for ( size_t i = 0; i < rayTracingDescriptorSets.size(); i++ )
     {
@@ -1186,7 +1406,6 @@ int main( int /*argc*/, char ** /*argv*/ )
     clearValues[1].depthStencil = vk::ClearDepthStencilValue( 1.0f, 0 );
 
     // Main loop
-    uint32_t            frameIndex = 0;
     UniformBufferObject uniformBufferObject;
     uniformBufferObject.model   = glm::mat4( 1 );
     uniformBufferObject.modelIT = glm::inverseTranspose( uniformBufferObject.model );
@@ -1198,7 +1417,8 @@ int main( int /*argc*/, char ** /*argv*/ )
       double startTime = glfwGetTime();
       glfwPollEvents();
 
-      vk::CommandBuffer const & commandBuffer = perFrameData[frameIndex].commandBuffer;
+      // frame begin: wait for the frame that used this slot last time, then begin its command buffer
+      vk::CommandBuffer const & commandBuffer = framesInFlight.beginFrame( device ).commandBuffer;
 
       int w, h;
       glfwGetWindowSize( window, &w, &h );
@@ -1219,13 +1439,12 @@ int main( int /*argc*/, char ** /*argv*/ )
         depthBufferData =
           vk::su::DepthBufferData( physicalDevice, device, vk::su::pickDepthFormat( physicalDevice ), windowExtent );
 
-        vk::su::oneTimeSubmit( commandBuffer, graphicsQueue, [&]( vk::CommandBuffer const & commandBuffer ) {
-          vk::su::setImageLayout( commandBuffer,
-                                  depthBufferData.image,
-                                  depthFormat,
-                                  vk::ImageLayout::eUndefined,
-                                  vk::ImageLayout::eDepthStencilAttachmentOptimal );
-        } );
+        // the transition of the new depth buffer is recorded into this frame's command buffer
+        vk::su::setImageLayout( commandBuffer,
+                                depthBufferData.image,
+                                depthFormat,
+                                vk::ImageLayout::eUndefined,
+                                vk::ImageLayout::eDepthStencilAttachmentOptimal );
 
         framebuffers = vk::su::createFramebuffers(
           device, renderPass, swapChainData.imageViews, depthBufferData.imageView, windowExtent );
@@ -1241,19 +1460,10 @@ int main( int /*argc*/, char ** /*argv*/ )
       uniformBufferObject.projInverse = glm::inverse( uniformBufferObject.proj );
       uniformBufferData.upload( device, uniformBufferObject );
 
-      // frame begin
-      vk::ResultValue<uint32_t> rv = device.acquireNextImageKHR(
-        swapChainData.swapChain, UINT64_MAX, perFrameData[frameIndex].presentCompleteSemaphore, nullptr );
+      vk::ResultValue<uint32_t> rv = framesInFlight.acquireNextImage( device, swapChainData.swapChain );
       assert( rv.result == vk::Result::eSuccess );
       uint32_t backBufferIndex = rv.value;
 
-      while ( vk::Result::eTimeout ==
-              device.waitForFences( perFrameData[frameIndex].fence, VK_TRUE, vk::su::FenceTimeout ) )
-        ;
-      device.resetFences( perFrameData[frameIndex].fence );
-
-      commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
-
       if ( appInfo.useRasterRender )
       {
         commandBuffer.beginRenderPass(
@@ -1324,18 +1534,8 @@ int main( int /*argc*/, char ** /*argv*/ )
       }
 
       // frame end
-      commandBuffer.end();
-      const vk::PipelineStageFlags waitDstStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput;
-      graphicsQueue.submit( vk::SubmitInfo( 1,
-                                            &( perFrameData[frameIndex].presentCompleteSemaphore ),
-                                            &waitDstStageMask,
-                                            1,
-                                            &commandBuffer,
-                                            1,
-                                            &( perFrameData[frameIndex].renderCompleteSemaphore ) ),
-                            perFrameData[frameIndex].fence );
-      vk::Result result = presentQueue.presentKHR( vk::PresentInfoKHR(
-        perFrameData[frameIndex].renderCompleteSemaphore, swapChainData.swapChain, backBufferIndex ) );
+      framesInFlight.submit( graphicsQueue, vk::PipelineStageFlagBits::eColorAttachmentOutput );
+      vk::Result result = framesInFlight.present( presentQueue, swapChainData.swapChain, backBufferIndex );
       switch ( result )
       {
         case vk::Result::eSuccess: break;
@@ -1344,7 +1544,6 @@ int main( int /*argc*/, char ** /*argv*/ )
           break;
         default: assert( false );  // an unexpected result is returned !
       }
-      frameIndex = ( frameIndex + 1 ) % IMGUI_VK_QUEUED_FRAMES;
 
       double endTime = glfwGetTime();
       accumulatedTime += endTime - startTime;
@@ -1377,8 +1576,7 @@ int main( int /*argc*/, char ** /*argv*/ )
     device.freeDescriptorSets( rayTracingDescriptorPool, rayTracingDescriptorSets );
     device.destroyDescriptorSetLayout( rayTracingDescriptorSetLayout );
     device.destroyDescriptorPool( rayTracingDescriptorPool );
-    topLevelAS.clear( device );
-    bottomLevelAS.clear( device );
+    accelerationStructureBuilder.clear();
     device.freeDescriptorSets( descriptorPool, descriptorSet );
     uniformBufferData.clear( device );
     device.destroyPipeline( graphicsPipeline );
@@ -1401,10 +1599,8 @@ int main( int /*argc*/, char ** /*argv*/ )
     device.destroyRenderPass( renderPass );
     swapChainData.clear( device );
     device.destroyDescriptorPool( descriptorPool );
-    for ( int i = 0; i < IMGUI_VK_QUEUED_FRAMES; i++ )
-    {
-      perFrameData[i].clear( device );
-    }
+    device.destroyCommandPool( commandPool );
+    framesInFlight.clear( device );
     device.destroy();
     instance.destroySurfaceKHR( surface );
     instance.destroyDebugUtilsMessengerEXT( debugUtilsMessenger );
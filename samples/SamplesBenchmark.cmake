@@ -0,0 +1,96 @@
+# Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Benchmarks over the sample executables, run in script mode by the samples_binary_size and samples_icache targets.
+#   MODE          : "size" to measure the .text size of each sample, using TOOL = size (binutils),
+#                   "icache" to count the instruction cache misses and the instructions of a run, using TOOL = perf
+#   SAMPLES_FILES : file with one "<sample>=<executable>" line per sample
+#   SAMPLES       : optional list of samples to measure, all samples if empty
+#   RESULT        : file the results are written to, one "<sample> <value>..." line per sample
+#   BASELINE      : optional results file of an earlier run (e.g. of another revision), to print the differences to
+
+if(NOT MODE OR NOT TOOL OR NOT SAMPLES_FILES OR NOT RESULT)
+  message(FATAL_ERROR "SamplesBenchmark: MODE, TOOL, SAMPLES_FILES, and RESULT are required!")
+endif()
+
+file(STRINGS "${SAMPLES_FILES}" samplesFiles)
+
+if(BASELINE AND EXISTS "${BASELINE}")
+  file(STRINGS "${BASELINE}" baselineLines)
+  foreach(line ${baselineLines})
+    string(REGEX MATCH "^([^ ]+) ([0-9]+)" match "${line}")
+    if(match)
+      set(baseline_${CMAKE_MATCH_1} ${CMAKE_MATCH_2})
+    endif()
+  endforeach()
+endif()
+
+set(result "")
+set(total 0)
+set(comparedTotal 0)
+set(baselineTotal 0)
+foreach(sampleFile ${samplesFiles})
+  string(REGEX REPLACE "^([^=]+)=(.*)$" "\\1" sample "${sampleFile}")
+  string(REGEX REPLACE "^([^=]+)=(.*)$" "\\2" executable "${sampleFile}")
+  list(FIND SAMPLES ${sample} index)
+  if(SAMPLES AND (index EQUAL -1))
+    continue()
+  endif()
+
+  if(MODE STREQUAL "size")
+    execute_process(COMMAND "${TOOL}" -A "${executable}" OUTPUT_VARIABLE output RESULT_VARIABLE failed)
+    string(REGEX MATCH "\n\\.text[ \t]+([0-9]+)" match "${output}")
+    if(failed OR NOT match)
+      message(FATAL_ERROR "SamplesBenchmark: can't determine the .text size of <${executable}>!")
+    endif()
+    set(value ${CMAKE_MATCH_1})
+    set(line "${sample} ${value}")
+  elseif(MODE STREQUAL "icache")
+    # the samples run up to their end, those with a window close it themselves
+    get_filename_component(directory "${executable}" DIRECTORY)
+    execute_process(COMMAND "${TOOL}" stat -x , -e L1-icache-load-misses,instructions -- "${executable}"
+                    WORKING_DIRECTORY "${directory}" OUTPUT_QUIET ERROR_VARIABLE output RESULT_VARIABLE failed)
+    string(REGEX MATCH "(^|\n)([0-9]+),[^,\n]*,L1-icache-load-misses" match "${output}")
+    set(value ${CMAKE_MATCH_2})
+    string(REGEX MATCH "(^|\n)([0-9]+),[^,\n]*,instructions" match "${output}")
+    set(instructions ${CMAKE_MATCH_2})
+    if(failed OR NOT value OR NOT instructions)
+      message(WARNING "SamplesBenchmark: no instruction cache misses counted for <${sample}>, skipped!")
+      continue()
+    endif()
+    set(line "${sample} ${value} ${instructions}")
+  else()
+    message(FATAL_ERROR "SamplesBenchmark: unknown MODE <${MODE}>!")
+  endif()
+
+  math(EXPR total "${total} + ${value}")
+  if(DEFINED baseline_${sample})
+    math(EXPR delta "${value} - ${baseline_${sample}}")
+    math(EXPR comparedTotal "${comparedTotal} + ${value}")
+    math(EXPR baselineTotal "${baselineTotal} + ${baseline_${sample}}")
+    set(line "${line} (${delta} against the baseline)")
+  endif()
+  message("${line}")
+  set(result "${result}${line}\n")
+endforeach()
+
+set(line "total ${total}")
+if(baselineTotal GREATER 0)
+  math(EXPR delta "${comparedTotal} - ${baselineTotal}")
+  set(line "${line} (${delta} against the baseline over the same samples)")
+endif()
+message("${line}")
+set(result "${result}${line}\n")
+
+file(WRITE "${RESULT}" "${result}")
@@ -27,9 +27,24 @@
 
 #include "vulkan/vulkan.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <numeric>
 
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( 2 <= _M_IX86_FP ) )
+#  define VK_SU_SSE2
+#  include <emmintrin.h>
+#endif
+#if defined( __SSSE3__ ) || defined( __AVX2__ )
+#  define VK_SU_SSSE3
+#  include <tmmintrin.h>
+#endif
+#if defined( __AVX2__ )
+#  define VK_SU_AVX2
+#  include <immintrin.h>
+#endif
+
 #if ( VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1 )
 VULKAN_HPP_DEFAULT_DISPATCH_LOADER_DYNAMIC_STORAGE
 #endif
@@ -589,6 +604,21 @@ namespace vk
       return extensions;
     }
 
+    vk::DeviceSize getPackedImageSize( vk::Format format, vk::Extent2D const & extent )
+    {
+      uint32_t blockHeight = vk::getFormatTraits( format ).blockExtent[1];
+      assert( 0 < blockHeight );
+      return getPackedRowPitch( format, extent.width ) * ( ( extent.height + blockHeight - 1 ) / blockHeight );
+    }
+
+    vk::DeviceSize getPackedRowPitch( vk::Format format, uint32_t width )
+    {
+      vk::FormatTraits formatTraits = vk::getFormatTraits( format );
+      assert( ( 0 < formatTraits.blockSize ) && ( 0 < formatTraits.blockExtent[0] ) );
+      return vk::DeviceSize( ( width + formatTraits.blockExtent[0] - 1 ) / formatTraits.blockExtent[0] ) *
+             formatTraits.blockSize;
+    }
+
     vk::Format pickDepthFormat( vk::PhysicalDevice const & physicalDevice )
     {
       std::vector<vk::Format> candidates = { vk::Format::eD32Sfloat,
@@ -606,6 +636,19 @@ namespace vk
       throw std::runtime_error( "failed to find supported format!" );
     }
 
+    vk::Format pickDepthFormat( PhysicalDeviceCapabilities const & capabilities )
+    {
+      vk::Format format = capabilities.findSupportedFormat(
+        { vk::Format::eD32Sfloat, vk::Format::eD32SfloatS8Uint, vk::Format::eD24UnormS8Uint },
+        vk::ImageTiling::eOptimal,
+        vk::FormatFeatureFlagBits::eDepthStencilAttachment );
+      if ( format == vk::Format::eUndefined )
+      {
+        throw std::runtime_error( "failed to find supported format!" );
+      }
+      return format;
+    }
+
     vk::PresentModeKHR pickPresentMode( std::vector<vk::PresentModeKHR> const & presentModes )
     {
       vk::PresentModeKHR pickedMode = vk::PresentModeKHR::eFifo;
@@ -729,7 +772,7 @@ namespace vk
       if ( newImageLayout == vk::ImageLayout::eDepthStencilAttachmentOptimal )
       {
         aspectMask = vk::ImageAspectFlagBits::eDepth;
-        if ( format == vk::Format::eD32SfloatS8Uint || format == vk::Format::eD24UnormS8Uint )
+        if ( vk::getFormatTraits( format ).hasStencilComponent )
         {
           aspectMask |= vk::ImageAspectFlagBits::eStencil;
         }
@@ -859,191 +902,2314 @@ namespace vk
                    vk::ImageAspectFlagBits::eDepth )
     {}
 
-    ImageData::ImageData( vk::PhysicalDevice const & physicalDevice,
+    FrameData::FrameData( vk::PhysicalDevice const & physicalDevice,
                           vk::Device const &         device,
-                          vk::Format                 format_,
-                          vk::Extent2D const &       extent,
-                          vk::ImageTiling            tiling,
-                          vk::ImageUsageFlags        usage,
-                          vk::ImageLayout            initialLayout,
-                          vk::MemoryPropertyFlags    memoryProperties,
-                          vk::ImageAspectFlags       aspectMask )
-      : format( format_ )
+                          uint32_t                   queueFamilyIndex,
+                          vk::DeviceSize             transientBufferSize_ )
+      : transientBufferSize( transientBufferSize_ ), transientOffset( 0 ), transientData( nullptr )
     {
-      vk::ImageCreateInfo imageCreateInfo( vk::ImageCreateFlags(),
-                                           vk::ImageType::e2D,
-                                           format,
-                                           vk::Extent3D( extent, 1 ),
-                                           1,
-                                           1,
-                                           vk::SampleCountFlagBits::e1,
-                                           tiling,
-                                           usage | vk::ImageUsageFlagBits::eSampled,
-                                           vk::SharingMode::eExclusive,
-                                           {},
-                                           initialLayout );
-      image = device.createImage( imageCreateInfo );
+      // the command pool is reset as a whole per frame, so there's no need for eResetCommandBuffer
+      commandPool = device.createCommandPool(
+        vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eTransient, queueFamilyIndex ) );
+      commandBuffer =
+        device.allocateCommandBuffers( vk::CommandBufferAllocateInfo( commandPool, vk::CommandBufferLevel::ePrimary, 1 ) )
+          .front();
+      // the fence starts signaled, such that the very first beginFrame doesn't block
+      fence                   = device.createFence( vk::FenceCreateInfo( vk::FenceCreateFlagBits::eSignaled ) );
+      imageAcquiredSemaphore  = device.createSemaphore( vk::SemaphoreCreateInfo() );
+      renderCompleteSemaphore = device.createSemaphore( vk::SemaphoreCreateInfo() );
+      if ( 0 < transientBufferSize )
+      {
+        transientBufferData = std::unique_ptr<BufferData>(
+          new BufferData( physicalDevice,
+                          device,
+                          transientBufferSize,
+                          vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eStorageBuffer |
+                            vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer |
+                            vk::BufferUsageFlagBits::eTransferSrc ) );
+        transientData = device.mapMemory( transientBufferData->deviceMemory, 0, transientBufferSize );
+      }
+    }
 
-      deviceMemory = vk::su::allocateDeviceMemory(
-        device, physicalDevice.getMemoryProperties(), device.getImageMemoryRequirements( image ), memoryProperties );
+    TransientAllocation FrameData::allocateTransient( vk::DeviceSize size, vk::DeviceSize alignment )
+    {
+      assert( transientBufferData );
+      assert( ( 0 < alignment ) && !( alignment & ( alignment - 1 ) ) );
+      vk::DeviceSize offset = ( transientOffset + alignment - 1 ) & ~( alignment - 1 );
+      if ( transientBufferSize < offset + size )
+      {
+        throw std::runtime_error( "FrameData: out of transient memory" );
+      }
+      transientOffset = offset + size;
+      return { transientBufferData->buffer, offset, static_cast<uint8_t *>( transientData ) + offset };
+    }
 
-      device.bindImageMemory( image, deviceMemory, 0 );
+    FramesInFlight::FramesInFlight( vk::PhysicalDevice const & physicalDevice,
+                                    vk::Device const &         device,
+                                    uint32_t                   queueFamilyIndex,
+                                    uint32_t                   frameCount,
+                                    vk::DeviceSize             transientBufferSize )
+      : m_frameIndex( 0 ), m_submittedFrameIndex( 0 ), m_imageAcquired( false )
+    {
+      assert( 0 < frameCount );
+      m_frames.reserve( frameCount );
+      for ( uint32_t i = 0; i < frameCount; i++ )
+      {
+        m_frames.emplace_back( physicalDevice, device, queueFamilyIndex, transientBufferSize );
+      }
+    }
 
-      vk::ComponentMapping componentMapping(
-        ComponentSwizzle::eR, ComponentSwizzle::eG, ComponentSwizzle::eB, ComponentSwizzle::eA );
-      vk::ImageSubresourceRange imageSubresourceRange( aspectMask, 0, 1, 0, 1 );
-      vk::ImageViewCreateInfo   imageViewCreateInfo(
-        {}, image, vk::ImageViewType::e2D, format, componentMapping, imageSubresourceRange );
-      imageView = device.createImageView( imageViewCreateInfo );
+    void FramesInFlight::clear( vk::Device const & device )
+    {
+      waitIdle( device );
+      for ( auto & frame : m_frames )
+      {
+        frame.clear( device );
+      }
+      m_frames.clear();
     }
 
-    SurfaceData::SurfaceData( vk::Instance const & instance,
-                              std::string const &  windowName,
-                              vk::Extent2D const & extent_ )
-      : extent( extent_ ), window( vk::su::createWindow( windowName, extent ) )
+    FrameData & FramesInFlight::beginFrame( vk::Device const & device )
     {
-      VkSurfaceKHR _surface;
-      VkResult err = glfwCreateWindowSurface( static_cast<VkInstance>( instance ), window.handle, nullptr, &_surface );
-      if ( err != VK_SUCCESS )
-        throw std::runtime_error( "Failed to create window!" );
-      surface = vk::SurfaceKHR( _surface );
+      FrameData & frame = m_frames[m_frameIndex];
+      while ( vk::Result::eTimeout == device.waitForFences( frame.fence, VK_TRUE, vk::su::FenceTimeout ) )
+        ;
+      device.resetFences( frame.fence );
+      device.resetCommandPool( frame.commandPool, {} );
+      frame.transientOffset = 0;
+      m_imageAcquired       = false;
+
+      frame.commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+      return frame;
     }
 
-    SwapChainData::SwapChainData( vk::PhysicalDevice const & physicalDevice,
-                                  vk::Device const &         device,
-                                  vk::SurfaceKHR const &     surface,
-                                  vk::Extent2D const &       extent,
-                                  vk::ImageUsageFlags        usage,
-                                  vk::SwapchainKHR const &   oldSwapChain,
-                                  uint32_t                   graphicsQueueFamilyIndex,
-                                  uint32_t                   presentQueueFamilyIndex )
+    vk::ResultValue<uint32_t> FramesInFlight::acquireNextImage( vk::Device const &       device,
+                                                                vk::SwapchainKHR const & swapChain )
     {
-      vk::SurfaceFormatKHR surfaceFormat = vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( surface ) );
-      colorFormat                        = surfaceFormat.format;
+      // the imageAcquiredSemaphore is guaranteed to be unsignaled here, as beginFrame waited for the submission that
+      // consumed it the last time
+      vk::ResultValue<uint32_t> rv = device.acquireNextImageKHR(
+        swapChain, vk::su::FenceTimeout, m_frames[m_frameIndex].imageAcquiredSemaphore, nullptr );
+      m_imageAcquired = ( rv.result == vk::Result::eSuccess ) || ( rv.result == vk::Result::eSuboptimalKHR );
+      return rv;
+    }
 
-      vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR( surface );
-      VkExtent2D                 swapchainExtent;
-      if ( surfaceCapabilities.currentExtent.width == std::numeric_limits<uint32_t>::max() )
+    void FramesInFlight::submit( vk::Queue const & queue, vk::PipelineStageFlags waitDstStageMask )
+    {
+      FrameData & frame = m_frames[m_frameIndex];
+      frame.commandBuffer.end();
+
+      vk::SubmitInfo submitInfo( m_imageAcquired ? 1 : 0,
+                                 &frame.imageAcquiredSemaphore,
+                                 &waitDstStageMask,
+                                 1,
+                                 &frame.commandBuffer,
+                                 m_imageAcquired ? 1 : 0,
+                                 &frame.renderCompleteSemaphore );
+      queue.submit( submitInfo, frame.fence );
+
+      m_submittedFrameIndex = m_frameIndex;
+      m_frameIndex          = ( m_frameIndex + 1 ) % frameCount();
+    }
+
+    vk::Result FramesInFlight::present( vk::Queue const & queue, vk::SwapchainKHR const & swapChain, uint32_t imageIndex )
+    {
+      assert( m_imageAcquired );
+      m_imageAcquired = false;
+      return queue.presentKHR(
+        vk::PresentInfoKHR( m_frames[m_submittedFrameIndex].renderCompleteSemaphore, swapChain, imageIndex ) );
+    }
+
+    void FramesInFlight::waitIdle( vk::Device const & device ) const
+    {
+      std::vector<vk::Fence> fences;
+      fences.reserve( m_frames.size() );
+      for ( auto const & frame : m_frames )
       {
-        // If the surface size is undefined, the size is set to the size of the images requested.
-        swapchainExtent.width =
-          clamp( extent.width, surfaceCapabilities.minImageExtent.width, surfaceCapabilities.maxImageExtent.width );
-        swapchainExtent.height =
-          clamp( extent.height, surfaceCapabilities.minImageExtent.height, surfaceCapabilities.maxImageExtent.height );
+        fences.push_back( frame.fence );
       }
-      else
+      while ( vk::Result::eTimeout == device.waitForFences( fences, VK_TRUE, vk::su::FenceTimeout ) )
+        ;
+    }
+
+    namespace
+    {
+      // the sub-block a thread currently allocates from, valid for the allocator and frame with that generation
+      struct DynamicSubBlock
       {
-        // If the surface size is defined, the swap chain size must match
-        swapchainExtent = surfaceCapabilities.currentExtent;
+        uint64_t       generation;
+        vk::DeviceSize offset;
+        vk::DeviceSize end;
+      };
+
+      thread_local DynamicSubBlock dynamicSubBlock = { 0, 0, 0 };
+      std::atomic<uint64_t>        dynamicGeneration( 0 );
+
+      vk::DeviceSize alignUp( vk::DeviceSize value, vk::DeviceSize alignment )
+      {
+        assert( ( 0 < alignment ) && !( alignment & ( alignment - 1 ) ) );
+        return ( value + alignment - 1 ) & ~( alignment - 1 );
       }
-      vk::SurfaceTransformFlagBitsKHR preTransform =
-        ( surfaceCapabilities.supportedTransforms & vk::SurfaceTransformFlagBitsKHR::eIdentity )
-          ? vk::SurfaceTransformFlagBitsKHR::eIdentity
-          : surfaceCapabilities.currentTransform;
-      vk::CompositeAlphaFlagBitsKHR compositeAlpha =
-        ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePreMultiplied )
-          ? vk::CompositeAlphaFlagBitsKHR::ePreMultiplied
-        : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePostMultiplied )
-          ? vk::CompositeAlphaFlagBitsKHR::ePostMultiplied
-        : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::eInherit )
-          ? vk::CompositeAlphaFlagBitsKHR::eInherit
-          : vk::CompositeAlphaFlagBitsKHR::eOpaque;
-      vk::PresentModeKHR presentMode = vk::su::pickPresentMode( physicalDevice.getSurfacePresentModesKHR( surface ) );
-      vk::SwapchainCreateInfoKHR swapChainCreateInfo( {},
-                                                      surface,
-                                                      surfaceCapabilities.minImageCount,
-                                                      colorFormat,
-                                                      surfaceFormat.colorSpace,
-                                                      swapchainExtent,
-                                                      1,
-                                                      usage,
-                                                      vk::SharingMode::eExclusive,
-                                                      {},
-                                                      preTransform,
-                                                      compositeAlpha,
-                                                      presentMode,
-                                                      true,
-                                                      oldSwapChain );
-      if ( graphicsQueueFamilyIndex != presentQueueFamilyIndex )
+    }  // namespace
+
+    DynamicBufferAllocator::DynamicBufferAllocator( vk::PhysicalDevice const & physicalDevice,
+                                                    vk::Device const &         device,
+                                                    vk::DeviceSize             frameSize,
+                                                    uint32_t                   frameCount,
+                                                    vk::DeviceSize             subBlockSize,
+                                                    vk::BufferUsageFlags       usage )
+      : m_frameSize( frameSize )
+      , m_frameIndex( 0 )
+      , m_generation( ++dynamicGeneration )
+      , m_offset( 0 )
+      , m_subBlockCount( 0 )
+      , m_peak( 0 )
+    {
+      assert( ( 0 < frameCount ) && ( 0 < subBlockSize ) );
+      // the dynamic offsets are 32 bit values
+      assert( frameSize <= std::numeric_limits<uint32_t>::max() );
+
+      vk::PhysicalDeviceLimits limits = physicalDevice.getProperties().limits;
+      m_uniformAlignment              = std::max<vk::DeviceSize>( limits.minUniformBufferOffsetAlignment, 1 );
+      m_storageAlignment              = std::max<vk::DeviceSize>( limits.minStorageBufferOffsetAlignment, 1 );
+      m_blockAlignment                = std::max( m_uniformAlignment, m_storageAlignment );
+      m_subBlockSize                  = alignUp( subBlockSize, m_blockAlignment );
+
+      // host coherent memory, so nothing needs to be flushed
+      m_frames.reserve( frameCount );
+      m_mappedFrames.reserve( frameCount );
+      for ( uint32_t i = 0; i < frameCount; i++ )
       {
-        uint32_t queueFamilyIndices[2] = { graphicsQueueFamilyIndex, presentQueueFamilyIndex };
-        // If the graphics and present queues are from different queue families, we either have to explicitly transfer
-        // ownership of images between the queues, or we have to create the swapchain with imageSharingMode as
-        // vk::SharingMode::eConcurrent
-        swapChainCreateInfo.imageSharingMode      = vk::SharingMode::eConcurrent;
-        swapChainCreateInfo.queueFamilyIndexCount = 2;
-        swapChainCreateInfo.pQueueFamilyIndices   = queueFamilyIndices;
+        m_frames.emplace_back( physicalDevice, device, frameSize, usage );
+        m_mappedFrames.push_back(
+          static_cast<uint8_t *>( device.mapMemory( m_frames.back().deviceMemory, 0, frameSize ) ) );
       }
-      swapChain = device.createSwapchainKHR( swapChainCreateInfo );
+    }
 
-      images = device.getSwapchainImagesKHR( swapChain );
+    void DynamicBufferAllocator::clear( vk::Device const & device )
+    {
+      for ( auto & frame : m_frames )
+      {
+        device.unmapMemory( frame.deviceMemory );
+        frame.clear( device );
+      }
+      m_frames.clear();
+      m_mappedFrames.clear();
+    }
 
-      imageViews.reserve( images.size() );
-      vk::ComponentMapping componentMapping(
-        vk::ComponentSwizzle::eR, vk::ComponentSwizzle::eG, vk::ComponentSwizzle::eB, vk::ComponentSwizzle::eA );
-      vk::ImageSubresourceRange subResourceRange( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
-      for ( auto image : images )
+    void DynamicBufferAllocator::beginFrame( uint32_t frameIndex )
+    {
+      assert( frameIndex < m_frames.size() );
+      m_peak       = std::max( m_peak, std::min<vk::DeviceSize>( m_offset, m_frameSize ) );
+      m_frameIndex = frameIndex;
+      // a new generation invalidates the sub-blocks all the threads hold
+      m_generation    = ++dynamicGeneration;
+      m_offset        = 0;
+      m_subBlockCount = 0;
+    }
+
+    DynamicBufferAllocator::Statistics DynamicBufferAllocator::getStatistics() const
+    {
+      Statistics statistics;
+      statistics.frameSize     = m_frameSize;
+      statistics.used          = std::min<vk::DeviceSize>( m_offset, m_frameSize );
+      statistics.peak          = std::max( m_peak, statistics.used );
+      statistics.subBlockCount = m_subBlockCount;
+      return statistics;
+    }
+
+    DynamicAllocation DynamicBufferAllocator::allocate( vk::DeviceSize size, vk::DeviceSize alignment )
+    {
+      assert( 0 < size );
+      DynamicSubBlock & subBlock = dynamicSubBlock;
+      vk::DeviceSize    offset   = alignUp( subBlock.offset, alignment );
+      if ( ( subBlock.generation != m_generation ) || ( subBlock.end < offset + size ) )
       {
-        vk::ImageViewCreateInfo imageViewCreateInfo(
-          vk::ImageViewCreateFlags(), image, vk::ImageViewType::e2D, colorFormat, componentMapping, subResourceRange );
-        imageViews.push_back( device.createImageView( imageViewCreateInfo ) );
+        if ( m_subBlockSize < size )
+        {
+          // too large for a sub-block, so it gets a range of its own, and the thread keeps its current sub-block
+          offset = takeRange( alignUp( size, m_blockAlignment ), size ).first;
+          return { m_frames[m_frameIndex].buffer,
+                   static_cast<uint32_t>( offset ),
+                   m_mappedFrames[m_frameIndex] + offset };
+        }
+        std::pair<vk::DeviceSize, vk::DeviceSize> range = takeRange( m_subBlockSize, size );
+        subBlock.generation                             = m_generation;
+        subBlock.end                                    = range.second;
+        // each sub-block starts at a multiple of m_blockAlignment, and with that of alignment
+        offset = range.first;
       }
+      subBlock.offset = offset + size;
+      return { m_frames[m_frameIndex].buffer, static_cast<uint32_t>( offset ), m_mappedFrames[m_frameIndex] + offset };
     }
 
-    CheckerboardImageGenerator::CheckerboardImageGenerator( std::array<uint8_t, 3> const & rgb0,
-                                                            std::array<uint8_t, 3> const & rgb1 )
-      : m_rgb0( rgb0 ), m_rgb1( rgb1 )
-    {}
+    std::pair<vk::DeviceSize, vk::DeviceSize> DynamicBufferAllocator::takeRange( vk::DeviceSize size,
+                                                                                 vk::DeviceSize minSize )
+    {
+      vk::DeviceSize offset = m_offset.fetch_add( size, std::memory_order_relaxed );
+      // the last range of a frame buffer might be cut short
+      if ( ( m_frameSize <= offset ) || ( m_frameSize - offset < minSize ) )
+      {
+        throw std::runtime_error( "DynamicBufferAllocator: out of frame memory" );
+      }
+      m_subBlockCount.fetch_add( 1, std::memory_order_relaxed );
+      return std::make_pair( offset, std::min( offset + size, m_frameSize ) );
+    }
 
-    void CheckerboardImageGenerator::operator()( void * data, vk::Extent2D & extent ) const
+    ParallelCommandRecorder::ParallelCommandRecorder( vk::Device const & device,
+                                                      uint32_t           queueFamilyIndex,
+                                                      uint32_t           threadCount,
+                                                      uint32_t           frameCount )
+      : m_generation( 0 )
+      , m_pending( 0 )
+      , m_quit( false )
+      , m_frameIndex( 0 )
+      , m_inheritanceInfo( nullptr )
+      , m_itemCount( 0 )
+      , m_recordFunction( nullptr )
+      , m_exceptions( threadCount )
     {
-      // Checkerboard of 16x16 pixel squares
-      uint8_t * pImageMemory = static_cast<uint8_t *>( data );
-      for ( uint32_t row = 0; row < extent.height; row++ )
+      assert( ( 0 < threadCount ) && ( 0 < frameCount ) );
+      try
+      {
+        // a command pool must only be used by one thread at a time, so each thread of each frame gets its own one
+        m_commandPools.reserve( frameCount * threadCount );
+        m_commandBuffers.reserve( frameCount * threadCount );
+        for ( uint32_t i = 0; i < frameCount * threadCount; i++ )
+        {
+          m_commandPools.push_back( device.createCommandPool(
+            vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eTransient, queueFamilyIndex ) ) );
+          m_commandBuffers.push_back( device
+                                        .allocateCommandBuffers( vk::CommandBufferAllocateInfo(
+                                          m_commandPools.back(), vk::CommandBufferLevel::eSecondary, 1 ) )
+                                        .front() );
+        }
+
+        m_workers.reserve( threadCount - 1 );
+        for ( uint32_t i = 1; i < threadCount; i++ )
+        {
+          m_workers.push_back( std::thread( &ParallelCommandRecorder::workerLoop, this, i ) );
+        }
+      }
+      catch ( ... )
       {
-        for ( uint32_t col = 0; col < extent.width; col++ )
+        // the destructor isn't called for a throwing constructor, but the workers started so far need to be joined, as
+        // destroying a joinable std::thread calls std::terminate, and the pools created so far need to be destroyed
+        stopWorkers();
+        if ( m_commandBuffers.size() < m_commandPools.size() )
         {
-          std::array<uint8_t, 3> const & rgb = ( ( ( row & 0x10 ) == 0 ) ^ ( ( col & 0x10 ) == 0 ) ) ? m_rgb1 : m_rgb0;
-          pImageMemory[0]                    = rgb[0];
-          pImageMemory[1]                    = rgb[1];
-          pImageMemory[2]                    = rgb[2];
-          pImageMemory[3]                    = 255;
-          pImageMemory += 4;
+          device.destroyCommandPool( m_commandPools.back() );
+          m_commandPools.pop_back();
         }
+        clear( device );
+        throw;
       }
     }
 
-    MonochromeImageGenerator::MonochromeImageGenerator( std::array<unsigned char, 3> const & rgb ) : m_rgb( rgb ) {}
+    ParallelCommandRecorder::~ParallelCommandRecorder()
+    {
+      stopWorkers();
+    }
 
-    void MonochromeImageGenerator::operator()( void * data, vk::Extent2D const & extent ) const
+    void ParallelCommandRecorder::clear( vk::Device const & device )
     {
-      // fill in with the monochrome color
-      unsigned char * pImageMemory = static_cast<unsigned char *>( data );
-      for ( uint32_t row = 0; row < extent.height; row++ )
+      for ( size_t i = 0; i < m_commandPools.size(); i++ )
+      {
+        device.freeCommandBuffers( m_commandPools[i], m_commandBuffers[i] );
+        device.destroyCommandPool( m_commandPools[i] );
+      }
+      m_commandBuffers.clear();
+      m_commandPools.clear();
+    }
+
+    void ParallelCommandRecorder::record( vk::Device const &                       device,
+                                          uint32_t                                 frameIndex,
+                                          vk::CommandBuffer const &                primaryCommandBuffer,
+                                          vk::CommandBufferInheritanceInfo const & inheritanceInfo,
+                                          uint32_t                                 itemCount,
+                                          RecordFunction const &                   recordFunction )
+    {
+      uint32_t threads = threadCount();
+      assert( ( frameIndex + 1 ) * threads <= m_commandPools.size() );
+
+      // resetting the pools is cheaper than freeing and re-allocating the command buffers every frame
+      for ( uint32_t i = 0; i < threads; i++ )
+      {
+        device.resetCommandPool( m_commandPools[frameIndex * threads + i], {} );
+      }
+
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_frameIndex      = frameIndex;
+        m_inheritanceInfo = &inheritanceInfo;
+        m_itemCount       = itemCount;
+        m_recordFunction  = &recordFunction;
+        m_pending         = threads - 1;
+        m_generation++;
+      }
+      m_startCondition.notify_all();
+
+      // the calling thread takes the first slice
+      recordSlice( 0 );
+
+      {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        m_doneCondition.wait( lock, [this]() { return m_pending == 0; } );
+      }
+
+      for ( auto & exception : m_exceptions )
+      {
+        if ( exception )
+        {
+          std::exception_ptr e = exception;
+          std::fill( m_exceptions.begin(), m_exceptions.end(), nullptr );
+          std::rethrow_exception( e );
+        }
+      }
+
+      // stitch the slices together in order; empty slices haven't been recorded
+      std::vector<vk::CommandBuffer> commandBuffers;
+      commandBuffers.reserve( threads );
+      for ( uint32_t i = 0; i < threads; i++ )
       {
-        for ( uint32_t col = 0; col < extent.width; col++ )
+        if ( uint64_t( itemCount ) * i / threads < uint64_t( itemCount ) * ( i + 1 ) / threads )
         {
-          pImageMemory[0] = m_rgb[0];
-          pImageMemory[1] = m_rgb[1];
-          pImageMemory[2] = m_rgb[2];
-          pImageMemory[3] = 255;
-          pImageMemory += 4;
+          commandBuffers.push_back( m_commandBuffers[frameIndex * threads + i] );
         }
       }
+      if ( !commandBuffers.empty() )
+      {
+        primaryCommandBuffer.executeCommands( commandBuffers );
+      }
     }
 
-    PixelsImageGenerator::PixelsImageGenerator( vk::Extent2D const &  extent,
-                                                size_t                channels,
-                                                unsigned char const * pixels )
-      : m_extent( extent ), m_channels( channels ), m_pixels( pixels )
+    void ParallelCommandRecorder::recordSlice( uint32_t threadIndex )
     {
-      assert( m_channels == 4 );
+      try
+      {
+        uint32_t threads = threadCount();
+        // 64 bit intermediates, as itemCount * threads might overflow
+        uint32_t first = static_cast<uint32_t>( uint64_t( m_itemCount ) * threadIndex / threads );
+        uint32_t last  = static_cast<uint32_t>( uint64_t( m_itemCount ) * ( threadIndex + 1 ) / threads );
+        if ( first < last )
+        {
+          vk::CommandBuffer const & commandBuffer = m_commandBuffers[m_frameIndex * threads + threadIndex];
+          commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit |
+                                                             vk::CommandBufferUsageFlagBits::eRenderPassContinue,
+                                                           m_inheritanceInfo ) );
+          ( *m_recordFunction )( commandBuffer, first, last - first );
+          commandBuffer.end();
+        }
+      }
+      catch ( ... )
+      {
+        m_exceptions[threadIndex] = std::current_exception();
+      }
     }
 
-    void PixelsImageGenerator::operator()( void * data, vk::Extent2D const & extent ) const
+    void ParallelCommandRecorder::stopWorkers()
     {
-      assert( extent == m_extent );
-      memcpy( data, m_pixels, extent.width * extent.height * m_channels );
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_quit = true;
+      }
+      m_startCondition.notify_all();
+      for ( auto & worker : m_workers )
+      {
+        worker.join();
+      }
+      m_workers.clear();
+    }
+
+    void ParallelCommandRecorder::workerLoop( uint32_t threadIndex )
+    {
+      uint64_t generation = 0;
+      while ( true )
+      {
+        {
+          std::unique_lock<std::mutex> lock( m_mutex );
+          m_startCondition.wait( lock, [&]() { return m_quit || ( generation != m_generation ); } );
+          if ( m_quit )
+          {
+            return;
+          }
+          generation = m_generation;
+        }
+
+        recordSlice( threadIndex );
+
+        bool done;
+        {
+          std::lock_guard<std::mutex> lock( m_mutex );
+          done = ( --m_pending == 0 );
+        }
+        if ( done )
+        {
+          m_doneCondition.notify_one();
+        }
+      }
+    }
+
+    DescriptorAllocator::DescriptorAllocator( std::vector<vk::DescriptorPoolSize> const & poolSizes,
+                                              uint32_t                                    setsPerPool,
+                                              uint32_t                                    maxSetsPerPool )
+      : m_poolSizes( poolSizes )
+      , m_setsPerPool( setsPerPool )
+      , m_maxSetsPerPool( maxSetsPerPool )
+      , m_currentPool( 0 )
+      , m_poolExhaustions( 0 )
+    {
+      assert( !poolSizes.empty() && ( 0 < setsPerPool ) && ( setsPerPool <= maxSetsPerPool ) );
+    }
+
+    vk::DescriptorSet DescriptorAllocator::allocate( vk::Device const &              device,
+                                                     vk::DescriptorSetLayout const & descriptorSetLayout )
+    {
+      if ( m_pools.empty() )
+      {
+        // createPool already moves m_setsPerPool on to the size of the next pool
+        uint32_t maxSets = m_setsPerPool;
+        m_pools.push_back( { createPool( device ), maxSets, 0 } );
+      }
+
+      vk::DescriptorSetAllocateInfo descriptorSetAllocateInfo( nullptr, descriptorSetLayout );
+      while ( true )
+      {
+        Pool & pool                              = m_pools[m_currentPool];
+        descriptorSetAllocateInfo.descriptorPool = pool.pool;
+
+        // running out of a pool is the regular way to get to the next one, so the result is checked instead of
+        // throwing and catching an exception each time
+        vk::DescriptorSet descriptorSet;
+        vk::Result        result = device.allocateDescriptorSets( &descriptorSetAllocateInfo, &descriptorSet );
+        if ( result == vk::Result::eSuccess )
+        {
+          pool.allocatedSets++;
+          return descriptorSet;
+        }
+        if ( ( result != vk::Result::eErrorOutOfPoolMemory ) && ( result != vk::Result::eErrorFragmentedPool ) )
+        {
+          vk::createResultValue( result, "vk::su::DescriptorAllocator::allocate" );
+          return nullptr;  // only reached with VULKAN_HPP_NO_EXCEPTIONS
+        }
+
+        // a freshly reset or created pool that can't hold a single set of this layout won't get any better
+        if ( pool.allocatedSets == 0 )
+        {
+          throw std::runtime_error( "DescriptorAllocator: descriptor set layout exceeds the pool sizes" );
+        }
+        m_poolExhaustions++;
+        if ( ++m_currentPool == m_pools.size() )
+        {
+          uint32_t maxSets = m_setsPerPool;
+          m_pools.push_back( { createPool( device ), maxSets, 0 } );
+        }
+      }
+    }
+
+    void DescriptorAllocator::reset( vk::Device const & device )
+    {
+      for ( size_t i = 0; i < m_pools.size() && i <= m_currentPool; i++ )
+      {
+        device.resetDescriptorPool( m_pools[i].pool );
+        m_pools[i].allocatedSets = 0;
+      }
+      m_currentPool     = 0;
+      m_poolExhaustions = 0;
+    }
+
+    void DescriptorAllocator::clear( vk::Device const & device )
+    {
+      for ( auto const & pool : m_pools )
+      {
+        device.destroyDescriptorPool( pool.pool );
+      }
+      m_pools.clear();
+      m_currentPool = 0;
+    }
+
+    DescriptorAllocator::Statistics DescriptorAllocator::getStatistics() const
+    {
+      Statistics statistics = {};
+      statistics.poolCount       = checked_cast<uint32_t>( m_pools.size() );
+      statistics.usedPoolCount   = m_pools.empty() ? 0 : checked_cast<uint32_t>( m_currentPool + 1 );
+      statistics.poolExhaustions = m_poolExhaustions;
+      for ( uint32_t i = 0; i < statistics.usedPoolCount; i++ )
+      {
+        statistics.allocatedSets += m_pools[i].allocatedSets;
+        statistics.setCapacity += m_pools[i].maxSets;
+      }
+      statistics.utilization =
+        statistics.setCapacity ? static_cast<float>( statistics.allocatedSets ) / statistics.setCapacity : 0.0f;
+      return statistics;
+    }
+
+    vk::DescriptorPool DescriptorAllocator::createPool( vk::Device const & device )
+    {
+      std::vector<vk::DescriptorPoolSize> poolSizes( m_poolSizes );
+      for ( auto & poolSize : poolSizes )
+      {
+        poolSize.descriptorCount *= m_setsPerPool;
+      }
+      // no eFreeDescriptorSet, as the sets are only ever released by resetting the pool as a whole
+      vk::DescriptorPool descriptorPool =
+        device.createDescriptorPool( vk::DescriptorPoolCreateInfo( {}, m_setsPerPool, poolSizes ) );
+
+      // m_setsPerPool is the size of the pool just created; the next one is getting bigger
+      m_setsPerPool = ( std::min )( 2 * m_setsPerPool, m_maxSetsPerPool );
+      return descriptorPool;
+    }
+
+    void DescriptorWriteBatcher::writeBuffer( vk::DescriptorSet const & dstSet,
+                                              uint32_t                  dstBinding,
+                                              vk::DescriptorType        descriptorType,
+                                              vk::Buffer const &        buffer,
+                                              vk::DeviceSize            offset,
+                                              vk::DeviceSize            range )
+    {
+      vk::DescriptorBufferInfo * bufferInfo = m_bufferInfos.allocate( 1 );
+      *bufferInfo                           = vk::DescriptorBufferInfo( buffer, offset, range );
+      m_writeDescriptorSets.emplace_back( dstSet, dstBinding, 0, 1, descriptorType, nullptr, bufferInfo, nullptr );
+    }
+
+    void DescriptorWriteBatcher::writeImage( vk::DescriptorSet const & dstSet,
+                                             uint32_t                  dstBinding,
+                                             vk::DescriptorType        descriptorType,
+                                             vk::Sampler const &       sampler,
+                                             vk::ImageView const &     imageView,
+                                             vk::ImageLayout           imageLayout )
+    {
+      vk::DescriptorImageInfo * imageInfo = m_imageInfos.allocate( 1 );
+      *imageInfo                          = vk::DescriptorImageInfo( sampler, imageView, imageLayout );
+      m_writeDescriptorSets.emplace_back( dstSet, dstBinding, 0, 1, descriptorType, imageInfo, nullptr, nullptr );
+    }
+
+    void DescriptorWriteBatcher::writeImages( vk::DescriptorSet const &                             dstSet,
+                                              uint32_t                                              dstBinding,
+                                              vk::DescriptorType                                    descriptorType,
+                                              vk::ArrayProxy<const vk::DescriptorImageInfo> const & imageInfos )
+    {
+      assert( !imageInfos.empty() );
+      vk::DescriptorImageInfo * data = m_imageInfos.allocate( imageInfos.size() );
+      std::copy( imageInfos.begin(), imageInfos.end(), data );
+      m_writeDescriptorSets.emplace_back(
+        dstSet, dstBinding, 0, imageInfos.size(), descriptorType, data, nullptr, nullptr );
+    }
+
+    void DescriptorWriteBatcher::writeTexelBuffer( vk::DescriptorSet const & dstSet,
+                                                   uint32_t                  dstBinding,
+                                                   vk::DescriptorType        descriptorType,
+                                                   vk::BufferView const &    bufferView )
+    {
+      vk::BufferView * data = m_bufferViews.allocate( 1 );
+      *data                 = bufferView;
+      m_writeDescriptorSets.emplace_back( dstSet, dstBinding, 0, 1, descriptorType, nullptr, nullptr, data );
+    }
+
+    void DescriptorWriteBatcher::flush( vk::Device const & device )
+    {
+      if ( !m_writeDescriptorSets.empty() )
+      {
+        device.updateDescriptorSets( m_writeDescriptorSets, nullptr );
+        m_writeDescriptorSets.clear();
+      }
+      m_bufferInfos.reset();
+      m_imageInfos.reset();
+      m_bufferViews.reset();
+    }
+
+    namespace
+    {
+      // the format table covers all the core formats: the contiguous range of the Vulkan 1.0 formats, followed by the
+      // contiguous range of the Vulkan 1.1 YCbCr formats
+      const uint32_t vulkan10FormatCount = uint32_t( VK_FORMAT_ASTC_12x12_SRGB_BLOCK ) + 1;
+      const uint32_t vulkan11FormatCount =
+        uint32_t( VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM ) - uint32_t( VK_FORMAT_G8B8G8R8_422_UNORM ) + 1;
+      const uint32_t formatTableSize = vulkan10FormatCount + vulkan11FormatCount;
+
+      uint32_t formatIndex( vk::Format format )
+      {
+        uint32_t value = static_cast<uint32_t>( format );
+        if ( value < vulkan10FormatCount )
+        {
+          return value;
+        }
+        value -= uint32_t( VK_FORMAT_G8B8G8R8_422_UNORM );
+        return ( value < vulkan11FormatCount ) ? vulkan10FormatCount + value : formatTableSize;
+      }
+
+      vk::Format formatFromIndex( uint32_t index )
+      {
+        assert( index < formatTableSize );
+        return static_cast<vk::Format>( ( index < vulkan10FormatCount )
+                                          ? index
+                                          : uint32_t( VK_FORMAT_G8B8G8R8_422_UNORM ) + index - vulkan10FormatCount );
+      }
+
+      vk::FormatFeatureFlags getTilingFeatures( vk::FormatProperties const & formatProperties, vk::ImageTiling tiling )
+      {
+        assert( ( tiling == vk::ImageTiling::eLinear ) || ( tiling == vk::ImageTiling::eOptimal ) );
+        return ( tiling == vk::ImageTiling::eLinear ) ? formatProperties.linearTilingFeatures
+                                                      : formatProperties.optimalTilingFeatures;
+      }
+
+      // the serialized snapshot is a plain dump of the structures, preceded by a small header to detect data written
+      // by some other version of this code
+      const uint32_t capabilitiesMagic   = 0x50414356;  // "VCAP"
+      const uint32_t capabilitiesVersion = ( VK_HEADER_VERSION << 8 ) | 1;
+
+      template <typename T>
+      void appendBytes( std::vector<uint8_t> & data, T const * values, size_t count )
+      {
+        static_assert( std::is_trivially_copyable<T>::value, "only trivially copyable types can be serialized" );
+        size_t offset = data.size();
+        data.resize( offset + count * sizeof( T ) );
+        memcpy( data.data() + offset, values, count * sizeof( T ) );
+      }
+
+      template <typename T>
+      void extractBytes( std::vector<uint8_t> const & data, size_t & offset, T * values, size_t count )
+      {
+        static_assert( std::is_trivially_copyable<T>::value, "only trivially copyable types can be deserialized" );
+        if ( data.size() < offset + count * sizeof( T ) )
+        {
+          throw std::runtime_error( "PhysicalDeviceCapabilities: truncated data" );
+        }
+        memcpy( values, data.data() + offset, count * sizeof( T ) );
+        offset += count * sizeof( T );
+      }
+    }  // namespace
+
+    PhysicalDeviceCapabilities::PhysicalDeviceCapabilities( vk::PhysicalDevice const & physicalDevice )
+      : properties( physicalDevice.getProperties() )
+      , features( physicalDevice.getFeatures() )
+      , memoryProperties( physicalDevice.getMemoryProperties() )
+      , queueFamilyProperties( physicalDevice.getQueueFamilyProperties() )
+      , m_hasVulkan12( ( VK_API_VERSION_1_2 <= properties.apiVersion ) &&
+                       VULKAN_HPP_DEFAULT_DISPATCHER.vkGetPhysicalDeviceFeatures2 &&
+                       VULKAN_HPP_DEFAULT_DISPATCHER.vkGetPhysicalDeviceProperties2 )
+      , m_formatProperties( formatTableSize )
+    {
+      if ( m_hasVulkan12 )
+      {
+        auto featuresChain = physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2,
+                                                         vk::PhysicalDeviceVulkan11Features,
+                                                         vk::PhysicalDeviceVulkan12Features>();
+        vulkan11Features       = featuresChain.get<vk::PhysicalDeviceVulkan11Features>();
+        vulkan12Features       = featuresChain.get<vk::PhysicalDeviceVulkan12Features>();
+        vulkan11Features.pNext = nullptr;
+        vulkan12Features.pNext = nullptr;
+
+        auto propertiesChain = physicalDevice.getProperties2<vk::PhysicalDeviceProperties2,
+                                                             vk::PhysicalDeviceVulkan11Properties,
+                                                             vk::PhysicalDeviceVulkan12Properties>();
+        vulkan11Properties       = propertiesChain.get<vk::PhysicalDeviceVulkan11Properties>();
+        vulkan12Properties       = propertiesChain.get<vk::PhysicalDeviceVulkan12Properties>();
+        vulkan11Properties.pNext = nullptr;
+        vulkan12Properties.pNext = nullptr;
+      }
+
+      // the YCbCr formats are not to be queried on a Vulkan 1.0 device
+      uint32_t formatCount = ( VK_API_VERSION_1_1 <= properties.apiVersion ) ? formatTableSize : vulkan10FormatCount;
+      for ( uint32_t i = 0; i < formatCount; i++ )
+      {
+        m_formatProperties[i] = physicalDevice.getFormatProperties( formatFromIndex( i ) );
+      }
+    }
+
+    PhysicalDeviceCapabilities::PhysicalDeviceCapabilities( std::vector<uint8_t> const & data )
+      : m_formatProperties( formatTableSize )
+    {
+      size_t   offset = 0;
+      uint32_t header[2];
+      extractBytes( data, offset, header, 2 );
+      if ( ( header[0] != capabilitiesMagic ) || ( header[1] != capabilitiesVersion ) )
+      {
+        throw std::runtime_error( "PhysicalDeviceCapabilities: unknown data format" );
+      }
+
+      uint32_t hasVulkan12, queueFamilyCount;
+      extractBytes( data, offset, &properties, 1 );
+      extractBytes( data, offset, &features, 1 );
+      extractBytes( data, offset, &hasVulkan12, 1 );
+      extractBytes( data, offset, &vulkan11Properties, 1 );
+      extractBytes( data, offset, &vulkan11Features, 1 );
+      extractBytes( data, offset, &vulkan12Properties, 1 );
+      extractBytes( data, offset, &vulkan12Features, 1 );
+      extractBytes( data, offset, &memoryProperties, 1 );
+      extractBytes( data, offset, &queueFamilyCount, 1 );
+      if ( ( 1 < hasVulkan12 ) || ( data.size() - offset < queueFamilyCount * sizeof( vk::QueueFamilyProperties ) ) )
+      {
+        throw std::runtime_error( "PhysicalDeviceCapabilities: corrupted data" );
+      }
+      queueFamilyProperties.resize( queueFamilyCount );
+      extractBytes( data, offset, queueFamilyProperties.data(), queueFamilyCount );
+      extractBytes( data, offset, m_formatProperties.data(), formatTableSize );
+      if ( offset != data.size() )
+      {
+        throw std::runtime_error( "PhysicalDeviceCapabilities: corrupted data" );
+      }
+      m_hasVulkan12 = ( hasVulkan12 != 0 );
+
+      // the stored pNext pointers are meaningless
+      vulkan11Properties.pNext = nullptr;
+      vulkan11Features.pNext   = nullptr;
+      vulkan12Properties.pNext = nullptr;
+      vulkan12Features.pNext   = nullptr;
+    }
+
+    std::vector<uint8_t> PhysicalDeviceCapabilities::serialize() const
+    {
+      std::vector<uint8_t> data;
+      uint32_t             header[2]        = { capabilitiesMagic, capabilitiesVersion };
+      uint32_t             hasVulkan12      = m_hasVulkan12 ? 1 : 0;
+      uint32_t             queueFamilyCount = static_cast<uint32_t>( queueFamilyProperties.size() );
+      appendBytes( data, header, 2 );
+      appendBytes( data, &properties, 1 );
+      appendBytes( data, &features, 1 );
+      appendBytes( data, &hasVulkan12, 1 );
+      appendBytes( data, &vulkan11Properties, 1 );
+      appendBytes( data, &vulkan11Features, 1 );
+      appendBytes( data, &vulkan12Properties, 1 );
+      appendBytes( data, &vulkan12Features, 1 );
+      appendBytes( data, &memoryProperties, 1 );
+      appendBytes( data, &queueFamilyCount, 1 );
+      appendBytes( data, queueFamilyProperties.data(), queueFamilyCount );
+      appendBytes( data, m_formatProperties.data(), m_formatProperties.size() );
+      return data;
+    }
+
+    bool PhysicalDeviceCapabilities::describes( vk::PhysicalDeviceProperties const & physicalDeviceProperties ) const
+    {
+      return ( properties.vendorID == physicalDeviceProperties.vendorID ) &&
+             ( properties.deviceID == physicalDeviceProperties.deviceID ) &&
+             ( properties.driverVersion == physicalDeviceProperties.driverVersion ) &&
+             ( properties.apiVersion == physicalDeviceProperties.apiVersion ) &&
+             ( properties.pipelineCacheUUID == physicalDeviceProperties.pipelineCacheUUID );
+    }
+
+    vk::FormatProperties const & PhysicalDeviceCapabilities::getFormatProperties( vk::Format format ) const
+    {
+      static const vk::FormatProperties noFormatProperties;
+
+      uint32_t index = formatIndex( format );
+      return ( index < formatTableSize ) ? m_formatProperties[index] : noFormatProperties;
+    }
+
+    vk::Format PhysicalDeviceCapabilities::findSupportedFormat( std::vector<vk::Format> const & candidates,
+                                                                vk::ImageTiling                 tiling,
+                                                                vk::FormatFeatureFlags          formatFeatures ) const
+    {
+      auto formatIt = std::find_if( candidates.begin(), candidates.end(), [&]( vk::Format format ) {
+        return ( getTilingFeatures( getFormatProperties( format ), tiling ) & formatFeatures ) == formatFeatures;
+      } );
+      return ( formatIt != candidates.end() ) ? *formatIt : vk::Format::eUndefined;
+    }
+
+    vk::Format PhysicalDeviceCapabilities::findSupportedFormat( vk::ImageTiling        tiling,
+                                                                vk::FormatFeatureFlags formatFeatures ) const
+    {
+      // skip vk::Format::eUndefined
+      for ( uint32_t i = 1; i < formatTableSize; i++ )
+      {
+        if ( ( getTilingFeatures( m_formatProperties[i], tiling ) & formatFeatures ) == formatFeatures )
+        {
+          return formatFromIndex( i );
+        }
+      }
+      return vk::Format::eUndefined;
+    }
+
+    uint32_t PhysicalDeviceCapabilities::findMemoryType( uint32_t                typeBits,
+                                                         vk::MemoryPropertyFlags requirementsMask ) const
+    {
+      return vk::su::findMemoryType( memoryProperties, typeBits, requirementsMask );
+    }
+
+    namespace
+    {
+      const vk::AccessFlags writeAccessMask =
+        vk::AccessFlagBits::eShaderWrite | vk::AccessFlagBits::eColorAttachmentWrite |
+        vk::AccessFlagBits::eDepthStencilAttachmentWrite | vk::AccessFlagBits::eTransferWrite |
+        vk::AccessFlagBits::eHostWrite | vk::AccessFlagBits::eMemoryWrite;
+
+      bool overlaps( uint32_t base0, uint32_t count0, uint32_t base1, uint32_t count1 )
+      {
+        // VK_REMAINING_MIP_LEVELS and VK_REMAINING_ARRAY_LAYERS are just huge counts
+        return ( base0 < base1 + uint64_t( count1 ) ) && ( base1 < base0 + uint64_t( count0 ) );
+      }
+
+      bool overlaps( vk::ImageMemoryBarrier const & barrier0, vk::ImageMemoryBarrier const & barrier1 )
+      {
+        vk::ImageSubresourceRange const & range0 = barrier0.subresourceRange;
+        vk::ImageSubresourceRange const & range1 = barrier1.subresourceRange;
+        return ( barrier0.image == barrier1.image ) && ( range0.aspectMask & range1.aspectMask ) &&
+               overlaps( range0.baseMipLevel, range0.levelCount, range1.baseMipLevel, range1.levelCount ) &&
+               overlaps( range0.baseArrayLayer, range0.layerCount, range1.baseArrayLayer, range1.layerCount );
+      }
+
+      bool overlaps( vk::BufferMemoryBarrier const & barrier0, vk::BufferMemoryBarrier const & barrier1 )
+      {
+        // VK_WHOLE_SIZE is just a huge size
+        return ( barrier0.buffer == barrier1.buffer ) &&
+               ( ( barrier1.size == VK_WHOLE_SIZE ) || ( barrier0.offset < barrier1.offset + barrier1.size ) ) &&
+               ( ( barrier0.size == VK_WHOLE_SIZE ) || ( barrier1.offset < barrier0.offset + barrier0.size ) );
+      }
+
+      vk::PipelineStageFlags2KHR toStageMask2( vk::PipelineStageFlags stageMask )
+      {
+        // the first 32 bits of the synchronization2 flags match the original ones
+        return vk::PipelineStageFlags2KHR( static_cast<VkPipelineStageFlags>( stageMask ) );
+      }
+
+      vk::AccessFlags2KHR toAccessMask2( vk::AccessFlags accessMask )
+      {
+        return vk::AccessFlags2KHR( static_cast<VkAccessFlags>( accessMask ) );
+      }
+    }  // namespace
+
+    BarrierBatcher::BarrierBatcher( vk::CommandBuffer const & commandBuffer, bool useSynchronization2 )
+      : m_commandBuffer( commandBuffer ), m_useSynchronization2( useSynchronization2 ), m_flushCount( 0 )
+    {}
+
+    void BarrierBatcher::memoryBarrier( vk::PipelineStageFlags    srcStageMask,
+                                        vk::PipelineStageFlags    dstStageMask,
+                                        vk::MemoryBarrier const & barrier )
+    {
+      // a global memory barrier does not refer to any resource, so it never needs to flush the batch
+      m_memoryBarriers.push_back( barrier );
+      m_memoryStageMasks.push_back( { srcStageMask, dstStageMask } );
+    }
+
+    void BarrierBatcher::bufferBarrier( vk::PipelineStageFlags          srcStageMask,
+                                        vk::PipelineStageFlags          dstStageMask,
+                                        vk::BufferMemoryBarrier const & barrier )
+    {
+      if ( std::any_of( m_bufferBarriers.begin(),
+                        m_bufferBarriers.end(),
+                        [&barrier]( vk::BufferMemoryBarrier const & bmb ) { return overlaps( bmb, barrier ); } ) )
+      {
+        flush();
+      }
+      m_bufferBarriers.push_back( barrier );
+      m_bufferStageMasks.push_back( { srcStageMask, dstStageMask } );
+    }
+
+    void BarrierBatcher::imageBarrier( vk::PipelineStageFlags         srcStageMask,
+                                       vk::PipelineStageFlags         dstStageMask,
+                                       vk::ImageMemoryBarrier const & barrier )
+    {
+      if ( std::any_of( m_imageBarriers.begin(),
+                        m_imageBarriers.end(),
+                        [&barrier]( vk::ImageMemoryBarrier const & imb ) { return overlaps( imb, barrier ); } ) )
+      {
+        flush();
+      }
+      m_imageBarriers.push_back( barrier );
+      m_imageStageMasks.push_back( { srcStageMask, dstStageMask } );
+    }
+
+    void BarrierBatcher::flush()
+    {
+      if ( size() == 0 )
+      {
+        return;
+      }
+
+      if ( m_useSynchronization2 )
+      {
+        std::vector<vk::MemoryBarrier2KHR> memoryBarriers;
+        memoryBarriers.reserve( m_memoryBarriers.size() );
+        for ( size_t i = 0; i < m_memoryBarriers.size(); i++ )
+        {
+          memoryBarriers.push_back( vk::MemoryBarrier2KHR( toStageMask2( m_memoryStageMasks[i].src ),
+                                                           toAccessMask2( m_memoryBarriers[i].srcAccessMask ),
+                                                           toStageMask2( m_memoryStageMasks[i].dst ),
+                                                           toAccessMask2( m_memoryBarriers[i].dstAccessMask ) ) );
+        }
+        std::vector<vk::BufferMemoryBarrier2KHR> bufferBarriers;
+        bufferBarriers.reserve( m_bufferBarriers.size() );
+        for ( size_t i = 0; i < m_bufferBarriers.size(); i++ )
+        {
+          vk::BufferMemoryBarrier const & bmb = m_bufferBarriers[i];
+          bufferBarriers.push_back( vk::BufferMemoryBarrier2KHR( toStageMask2( m_bufferStageMasks[i].src ),
+                                                                 toAccessMask2( bmb.srcAccessMask ),
+                                                                 toStageMask2( m_bufferStageMasks[i].dst ),
+                                                                 toAccessMask2( bmb.dstAccessMask ),
+                                                                 bmb.srcQueueFamilyIndex,
+                                                                 bmb.dstQueueFamilyIndex,
+                                                                 bmb.buffer,
+                                                                 bmb.offset,
+                                                                 bmb.size ) );
+        }
+        std::vector<vk::ImageMemoryBarrier2KHR> imageBarriers;
+        imageBarriers.reserve( m_imageBarriers.size() );
+        for ( size_t i = 0; i < m_imageBarriers.size(); i++ )
+        {
+          vk::ImageMemoryBarrier const & imb = m_imageBarriers[i];
+          imageBarriers.push_back( vk::ImageMemoryBarrier2KHR( toStageMask2( m_imageStageMasks[i].src ),
+                                                               toAccessMask2( imb.srcAccessMask ),
+                                                               toStageMask2( m_imageStageMasks[i].dst ),
+                                                               toAccessMask2( imb.dstAccessMask ),
+                                                               imb.oldLayout,
+                                                               imb.newLayout,
+                                                               imb.srcQueueFamilyIndex,
+                                                               imb.dstQueueFamilyIndex,
+                                                               imb.image,
+                                                               imb.subresourceRange ) );
+        }
+        m_commandBuffer.pipelineBarrier2KHR(
+          vk::DependencyInfoKHR( {}, memoryBarriers, bufferBarriers, imageBarriers ) );
+      }
+      else
+      {
+        StageMasks stageMasks;
+        for ( auto const & sm : m_memoryStageMasks )
+        {
+          stageMasks.src |= sm.src;
+          stageMasks.dst |= sm.dst;
+        }
+        for ( auto const & sm : m_bufferStageMasks )
+        {
+          stageMasks.src |= sm.src;
+          stageMasks.dst |= sm.dst;
+        }
+        for ( auto const & sm : m_imageStageMasks )
+        {
+          stageMasks.src |= sm.src;
+          stageMasks.dst |= sm.dst;
+        }
+        // an empty stage mask is not allowed
+        if ( !stageMasks.src )
+        {
+          stageMasks.src = vk::PipelineStageFlagBits::eTopOfPipe;
+        }
+        if ( !stageMasks.dst )
+        {
+          stageMasks.dst = vk::PipelineStageFlagBits::eBottomOfPipe;
+        }
+        m_commandBuffer.pipelineBarrier(
+          stageMasks.src, stageMasks.dst, {}, m_memoryBarriers, m_bufferBarriers, m_imageBarriers );
+      }
+      m_flushCount++;
+
+      m_memoryBarriers.clear();
+      m_bufferBarriers.clear();
+      m_imageBarriers.clear();
+      m_memoryStageMasks.clear();
+      m_bufferStageMasks.clear();
+      m_imageStageMasks.clear();
+    }
+
+    std::pair<vk::PipelineStageFlags, vk::AccessFlags> getLayoutStageAndAccess( vk::ImageLayout layout )
+    {
+      switch ( layout )
+      {
+        case vk::ImageLayout::eUndefined: return { vk::PipelineStageFlagBits::eTopOfPipe, {} };
+        case vk::ImageLayout::ePreinitialized:
+          return { vk::PipelineStageFlagBits::eHost, vk::AccessFlagBits::eHostWrite };
+        case vk::ImageLayout::eColorAttachmentOptimal:
+          return { vk::PipelineStageFlagBits::eColorAttachmentOutput,
+                   vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite };
+        case vk::ImageLayout::eDepthStencilAttachmentOptimal:
+          return { vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests,
+                   vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eDepthStencilAttachmentWrite };
+        case vk::ImageLayout::eDepthStencilReadOnlyOptimal:
+          return { vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests |
+                     vk::PipelineStageFlagBits::eFragmentShader,
+                   vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eShaderRead };
+        case vk::ImageLayout::eShaderReadOnlyOptimal:
+          return { vk::PipelineStageFlagBits::eFragmentShader, vk::AccessFlagBits::eShaderRead };
+        case vk::ImageLayout::eTransferSrcOptimal:
+          return { vk::PipelineStageFlagBits::eTransfer, vk::AccessFlagBits::eTransferRead };
+        case vk::ImageLayout::eTransferDstOptimal:
+          return { vk::PipelineStageFlagBits::eTransfer, vk::AccessFlagBits::eTransferWrite };
+        case vk::ImageLayout::ePresentSrcKHR: return { vk::PipelineStageFlagBits::eBottomOfPipe, {} };
+        default:
+          return { vk::PipelineStageFlagBits::eAllCommands,
+                   vk::AccessFlagBits::eMemoryRead | vk::AccessFlagBits::eMemoryWrite };
+      }
+    }
+
+    void ImageStateTracker::addImage( vk::Image const &    image,
+                                      vk::ImageAspectFlags aspectMask,
+                                      uint32_t             mipLevels,
+                                      uint32_t             arrayLayers,
+                                      vk::ImageLayout      initialLayout )
+    {
+      assert( ( 0 < mipLevels ) && ( 0 < arrayLayers ) );
+      std::pair<vk::PipelineStageFlags, vk::AccessFlags> stageAndAccess = getLayoutStageAndAccess( initialLayout );
+
+      ImageState imageState;
+      imageState.aspectMask  = aspectMask;
+      imageState.mipLevels   = mipLevels;
+      imageState.arrayLayers = arrayLayers;
+      imageState.subresources.resize( mipLevels * arrayLayers,
+                                      { initialLayout, stageAndAccess.first, stageAndAccess.second } );
+      bool inserted = m_images.insert( std::make_pair( static_cast<VkImage>( image ), imageState ) ).second;
+      assert( inserted );
+      (void)inserted;
+    }
+
+    void ImageStateTracker::removeImage( vk::Image const & image )
+    {
+      size_t erased = m_images.erase( static_cast<VkImage>( image ) );
+      assert( erased == 1 );
+      (void)erased;
+    }
+
+    vk::ImageLayout
+      ImageStateTracker::getLayout( vk::Image const & image, uint32_t mipLevel, uint32_t arrayLayer ) const
+    {
+      auto imageIt = m_images.find( static_cast<VkImage>( image ) );
+      assert( imageIt != m_images.end() );
+      assert( ( mipLevel < imageIt->second.mipLevels ) && ( arrayLayer < imageIt->second.arrayLayers ) );
+      return imageIt->second.subresources[mipLevel * imageIt->second.arrayLayers + arrayLayer].layout;
+    }
+
+    void ImageStateTracker::transition( BarrierBatcher &                  batcher,
+                                        vk::Image const &                 image,
+                                        vk::ImageLayout                   newLayout,
+                                        vk::PipelineStageFlags            dstStageMask,
+                                        vk::AccessFlags                   dstAccessMask,
+                                        vk::ImageSubresourceRange const & range )
+    {
+      auto imageIt = m_images.find( static_cast<VkImage>( image ) );
+      assert( imageIt != m_images.end() );
+      ImageState & imageState = imageIt->second;
+
+      uint32_t levelCount =
+        ( range.levelCount == VK_REMAINING_MIP_LEVELS ) ? imageState.mipLevels - range.baseMipLevel : range.levelCount;
+      uint32_t layerCount = ( range.layerCount == VK_REMAINING_ARRAY_LAYERS )
+                            ? imageState.arrayLayers - range.baseArrayLayer
+                            : range.layerCount;
+      assert( ( range.baseMipLevel + levelCount <= imageState.mipLevels ) &&
+              ( range.baseArrayLayer + layerCount <= imageState.arrayLayers ) );
+
+      // collect the barriers for runs of layers in the same state, and merge them over consecutive mip levels
+      std::vector<std::pair<vk::PipelineStageFlags, vk::ImageMemoryBarrier>> barriers;
+      size_t                                                                 firstBarrierOfPreviousLevel = 0;
+      for ( uint32_t level = range.baseMipLevel; level < range.baseMipLevel + levelCount; level++ )
+      {
+        size_t firstBarrierOfLevel = barriers.size();
+        for ( uint32_t layer = range.baseArrayLayer; layer < range.baseArrayLayer + layerCount; layer++ )
+        {
+          SubresourceState & state = imageState.subresources[level * imageState.arrayLayers + layer];
+          if ( ( state.layout == newLayout ) && !( state.accessMask & writeAccessMask ) &&
+               !( dstAccessMask & writeAccessMask ) )
+          {
+            // read after read in the same layout: no barrier needed, but a later write has to wait for this read, too
+            state.stageMask |= dstStageMask;
+            state.accessMask |= dstAccessMask;
+            m_droppedCount++;
+            continue;
+          }
+
+          bool merged = false;
+          if ( firstBarrierOfLevel < barriers.size() )
+          {
+            // extend the barrier of the previous layer, if that was in the same state
+            auto & previous = barriers.back();
+            if ( ( previous.first == state.stageMask ) &&
+                 ( previous.second.srcAccessMask == ( state.accessMask & writeAccessMask ) ) &&
+                 ( previous.second.oldLayout == state.layout ) &&
+                 ( previous.second.subresourceRange.baseArrayLayer + previous.second.subresourceRange.layerCount ==
+                   layer ) )
+            {
+              previous.second.subresourceRange.layerCount++;
+              merged = true;
+            }
+          }
+          if ( !merged )
+          {
+            // only the writes need to be made available; the reads are covered by the execution dependency
+            barriers.push_back( std::make_pair(
+              state.stageMask,
+              vk::ImageMemoryBarrier( state.accessMask & writeAccessMask,
+                                      dstAccessMask,
+                                      state.layout,
+                                      newLayout,
+                                      VK_QUEUE_FAMILY_IGNORED,
+                                      VK_QUEUE_FAMILY_IGNORED,
+                                      image,
+                                      vk::ImageSubresourceRange( imageState.aspectMask, level, 1, layer, 1 ) ) ) );
+          }
+          state = { newLayout, dstStageMask, dstAccessMask };
+        }
+
+        // a level with just one barrier might be merged with the last barrier of the previous level
+        if ( ( firstBarrierOfLevel + 1 == barriers.size() ) &&
+             ( firstBarrierOfPreviousLevel + 1 == firstBarrierOfLevel ) )
+        {
+          auto const & current  = barriers[firstBarrierOfLevel];
+          auto &       previous = barriers[firstBarrierOfPreviousLevel];
+          if ( ( previous.first == current.first ) &&
+               ( previous.second.srcAccessMask == current.second.srcAccessMask ) &&
+               ( previous.second.oldLayout == current.second.oldLayout ) &&
+               ( previous.second.subresourceRange.baseArrayLayer ==
+                 current.second.subresourceRange.baseArrayLayer ) &&
+               ( previous.second.subresourceRange.layerCount == current.second.subresourceRange.layerCount ) &&
+               ( previous.second.subresourceRange.baseMipLevel + previous.second.subresourceRange.levelCount ==
+                 level ) )
+          {
+            previous.second.subresourceRange.levelCount++;
+            barriers.pop_back();
+            firstBarrierOfLevel = firstBarrierOfPreviousLevel;
+          }
+        }
+        firstBarrierOfPreviousLevel = firstBarrierOfLevel;
+      }
+
+      for ( auto const & barrier : barriers )
+      {
+        batcher.imageBarrier( barrier.first, dstStageMask, barrier.second );
+      }
+    }
+
+    void ImageStateTracker::transition( BarrierBatcher & batcher, vk::Image const & image, vk::ImageLayout newLayout )
+    {
+      std::pair<vk::PipelineStageFlags, vk::AccessFlags> stageAndAccess = getLayoutStageAndAccess( newLayout );
+      transition( batcher,
+                  image,
+                  newLayout,
+                  stageAndAccess.first,
+                  stageAndAccess.second,
+                  vk::ImageSubresourceRange( vk::ImageAspectFlags(),
+                                             0,
+                                             VK_REMAINING_MIP_LEVELS,
+                                             0,
+                                             VK_REMAINING_ARRAY_LAYERS ) );
+    }
+
+    std::vector<vk::DeviceQueueCreateInfo> QueueTopology::getQueueCreateInfos() const
+    {
+      static const float queuePriority = 0.0f;
+
+      std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos;
+      for ( uint32_t queueFamilyIndex :
+            { graphicsQueueFamilyIndex, presentQueueFamilyIndex, transferQueueFamilyIndex, computeQueueFamilyIndex } )
+      {
+        if ( std::find_if( queueCreateInfos.begin(),
+                           queueCreateInfos.end(),
+                           [queueFamilyIndex]( vk::DeviceQueueCreateInfo const & dqci ) {
+                             return dqci.queueFamilyIndex == queueFamilyIndex;
+                           } ) == queueCreateInfos.end() )
+        {
+          queueCreateInfos.push_back( vk::DeviceQueueCreateInfo( {}, queueFamilyIndex, 1, &queuePriority ) );
+        }
+      }
+      return queueCreateInfos;
+    }
+
+    namespace
+    {
+      // the first family with all of the required and none of the excluded flags, or defaultIndex if there's none; with
+      // texelGranularity, the family also has to copy images at any texel, as families with graphics or compute do
+      uint32_t findQueueFamilyIndex( std::vector<vk::QueueFamilyProperties> const & queueFamilyProperties,
+                                     vk::QueueFlags                                 requiredFlags,
+                                     vk::QueueFlags                                 excludedFlags,
+                                     bool                                           texelGranularity,
+                                     uint32_t                                       defaultIndex )
+      {
+        for ( size_t i = 0; i < queueFamilyProperties.size(); i++ )
+        {
+          vk::QueueFlags queueFlags = queueFamilyProperties[i].queueFlags;
+          if ( ( 0 < queueFamilyProperties[i].queueCount ) && ( ( queueFlags & requiredFlags ) == requiredFlags ) &&
+               !( queueFlags & excludedFlags ) &&
+               ( !texelGranularity ||
+                 ( queueFamilyProperties[i].minImageTransferGranularity == vk::Extent3D( 1, 1, 1 ) ) ) )
+          {
+            return static_cast<uint32_t>( i );
+          }
+        }
+        return defaultIndex;
+      }
+    }  // namespace
+
+    QueueTopology selectQueueTopology( std::vector<vk::QueueFamilyProperties> const & queueFamilyProperties )
+    {
+      assert( queueFamilyProperties.size() < std::numeric_limits<uint32_t>::max() );
+
+      QueueTopology topology;
+      topology.graphicsQueueFamilyIndex = findGraphicsQueueFamilyIndex( queueFamilyProperties );
+      topology.presentQueueFamilyIndex  = topology.graphicsQueueFamilyIndex;
+
+      // a compute family without graphics runs asynchronously to the graphics work
+      topology.computeQueueFamilyIndex = findQueueFamilyIndex( queueFamilyProperties,
+                                                               vk::QueueFlagBits::eCompute,
+                                                               vk::QueueFlagBits::eGraphics,
+                                                               false,
+                                                               topology.graphicsQueueFamilyIndex );
+
+      // a transfer-only family typically maps to the copy engines; graphics and compute families support transfers
+      // implicitly, so the next best choice is the async compute family. A transfer-only family might copy images only
+      // in blocks of its minImageTransferGranularity, or only whole mip levels, which the regions given to
+      // TransferScheduler::copyBufferToImage aren't restricted to, so such a family is skipped
+      topology.transferQueueFamilyIndex =
+        findQueueFamilyIndex( queueFamilyProperties,
+                              vk::QueueFlagBits::eTransfer,
+                              vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute,
+                              true,
+                              topology.computeQueueFamilyIndex );
+      return topology;
+    }
+
+    QueueTopology selectQueueTopology( vk::PhysicalDevice const & physicalDevice, vk::SurfaceKHR const & surface )
+    {
+      QueueTopology topology = selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+
+      std::pair<uint32_t, uint32_t> graphicsAndPresentQueueFamilyIndex =
+        findGraphicsAndPresentQueueFamilyIndex( physicalDevice, surface );
+      if ( topology.computeQueueFamilyIndex == topology.graphicsQueueFamilyIndex )
+      {
+        topology.computeQueueFamilyIndex = graphicsAndPresentQueueFamilyIndex.first;
+      }
+      if ( topology.transferQueueFamilyIndex == topology.graphicsQueueFamilyIndex )
+      {
+        topology.transferQueueFamilyIndex = graphicsAndPresentQueueFamilyIndex.first;
+      }
+      topology.graphicsQueueFamilyIndex = graphicsAndPresentQueueFamilyIndex.first;
+      topology.presentQueueFamilyIndex  = graphicsAndPresentQueueFamilyIndex.second;
+      return topology;
+    }
+
+    void releaseOwnership( vk::CommandBuffer const & commandBuffer, BufferOwnershipTransfer const & transfer )
+    {
+      if ( transfer.srcQueueFamilyIndex == transfer.dstQueueFamilyIndex )
+      {
+        vk::BufferMemoryBarrier barrier( transfer.srcAccessMask,
+                                         transfer.dstAccessMask,
+                                         VK_QUEUE_FAMILY_IGNORED,
+                                         VK_QUEUE_FAMILY_IGNORED,
+                                         transfer.buffer,
+                                         transfer.offset,
+                                         transfer.size );
+        commandBuffer.pipelineBarrier( transfer.srcStageMask, transfer.dstStageMask, {}, nullptr, barrier, nullptr );
+      }
+      else
+      {
+        // the dstAccessMask of a release barrier is ignored
+        vk::BufferMemoryBarrier barrier( transfer.srcAccessMask,
+                                         {},
+                                         transfer.srcQueueFamilyIndex,
+                                         transfer.dstQueueFamilyIndex,
+                                         transfer.buffer,
+                                         transfer.offset,
+                                         transfer.size );
+        commandBuffer.pipelineBarrier(
+          transfer.srcStageMask, vk::PipelineStageFlagBits::eBottomOfPipe, {}, nullptr, barrier, nullptr );
+      }
+    }
+
+    void acquireOwnership( vk::CommandBuffer const & commandBuffer, BufferOwnershipTransfer const & transfer )
+    {
+      if ( transfer.srcQueueFamilyIndex != transfer.dstQueueFamilyIndex )
+      {
+        // the srcAccessMask of an acquire barrier is ignored; its first scope is chained to the semaphore wait by
+        // using the dstStageMask on both sides
+        vk::BufferMemoryBarrier barrier( {},
+                                         transfer.dstAccessMask,
+                                         transfer.srcQueueFamilyIndex,
+                                         transfer.dstQueueFamilyIndex,
+                                         transfer.buffer,
+                                         transfer.offset,
+                                         transfer.size );
+        commandBuffer.pipelineBarrier( transfer.dstStageMask, transfer.dstStageMask, {}, nullptr, barrier, nullptr );
+      }
+    }
+
+    void releaseOwnership( vk::CommandBuffer const & commandBuffer, ImageOwnershipTransfer const & transfer )
+    {
+      if ( transfer.srcQueueFamilyIndex == transfer.dstQueueFamilyIndex )
+      {
+        vk::ImageMemoryBarrier barrier( transfer.srcAccessMask,
+                                        transfer.dstAccessMask,
+                                        transfer.oldLayout,
+                                        transfer.newLayout,
+                                        VK_QUEUE_FAMILY_IGNORED,
+                                        VK_QUEUE_FAMILY_IGNORED,
+                                        transfer.image,
+                                        transfer.subresourceRange );
+        commandBuffer.pipelineBarrier( transfer.srcStageMask, transfer.dstStageMask, {}, nullptr, nullptr, barrier );
+      }
+      else
+      {
+        vk::ImageMemoryBarrier barrier( transfer.srcAccessMask,
+                                        {},
+                                        transfer.oldLayout,
+                                        transfer.newLayout,
+                                        transfer.srcQueueFamilyIndex,
+                                        transfer.dstQueueFamilyIndex,
+                                        transfer.image,
+                                        transfer.subresourceRange );
+        commandBuffer.pipelineBarrier(
+          transfer.srcStageMask, vk::PipelineStageFlagBits::eBottomOfPipe, {}, nullptr, nullptr, barrier );
+      }
+    }
+
+    void acquireOwnership( vk::CommandBuffer const & commandBuffer, ImageOwnershipTransfer const & transfer )
+    {
+      if ( transfer.srcQueueFamilyIndex != transfer.dstQueueFamilyIndex )
+      {
+        vk::ImageMemoryBarrier barrier( {},
+                                        transfer.dstAccessMask,
+                                        transfer.oldLayout,
+                                        transfer.newLayout,
+                                        transfer.srcQueueFamilyIndex,
+                                        transfer.dstQueueFamilyIndex,
+                                        transfer.image,
+                                        transfer.subresourceRange );
+        commandBuffer.pipelineBarrier( transfer.dstStageMask, transfer.dstStageMask, {}, nullptr, nullptr, barrier );
+      }
+    }
+
+    TransferScheduler::TransferScheduler( vk::Device const &    device,
+                                          QueueTopology const & topology,
+                                          uint32_t              slotCount )
+      : m_topology( topology )
+      , m_transferQueue( device.getQueue( topology.transferQueueFamilyIndex, 0 ) )
+      , m_slotIndex( 0 )
+      , m_recording( false )
+    {
+      assert( 0 < slotCount );
+      m_slots.resize( slotCount );
+      for ( auto & slot : m_slots )
+      {
+        slot.commandPool = device.createCommandPool(
+          vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlagBits::eTransient, topology.transferQueueFamilyIndex ) );
+        slot.commandBuffer = device
+                               .allocateCommandBuffers(
+                                 vk::CommandBufferAllocateInfo( slot.commandPool, vk::CommandBufferLevel::ePrimary, 1 ) )
+                               .front();
+        // the fence starts signaled, such that the very first use of a slot doesn't block
+        slot.fence     = device.createFence( vk::FenceCreateInfo( vk::FenceCreateFlagBits::eSignaled ) );
+        slot.semaphore = device.createSemaphore( vk::SemaphoreCreateInfo() );
+      }
+    }
+
+    void TransferScheduler::clear( vk::Device const & device )
+    {
+      assert( !m_recording );
+      for ( auto & slot : m_slots )
+      {
+        while ( vk::Result::eTimeout == device.waitForFences( slot.fence, VK_TRUE, vk::su::FenceTimeout ) )
+          ;
+        device.destroySemaphore( slot.semaphore );
+        device.destroyFence( slot.fence );
+        device.freeCommandBuffers( slot.commandPool, slot.commandBuffer );
+        device.destroyCommandPool( slot.commandPool );
+      }
+      m_slots.clear();
+    }
+
+    void TransferScheduler::copyBuffer( vk::Device const &                           device,
+                                        vk::Buffer const &                           srcBuffer,
+                                        vk::Buffer const &                           dstBuffer,
+                                        vk::ArrayProxy<const vk::BufferCopy> const & regions,
+                                        vk::PipelineStageFlags                       dstStageMask,
+                                        vk::AccessFlags                              dstAccessMask )
+    {
+      vk::CommandBuffer const & commandBuffer = beginRecording( device );
+      commandBuffer.copyBuffer( srcBuffer, dstBuffer, regions );
+
+      // the regions might be scattered all over dstBuffer, so the whole buffer is transferred
+      BufferOwnershipTransfer transfer = { dstBuffer,
+                                           0,
+                                           VK_WHOLE_SIZE,
+                                           m_topology.transferQueueFamilyIndex,
+                                           m_topology.graphicsQueueFamilyIndex,
+                                           vk::PipelineStageFlagBits::eTransfer,
+                                           vk::AccessFlagBits::eTransferWrite,
+                                           dstStageMask,
+                                           dstAccessMask };
+      releaseOwnership( commandBuffer, transfer );
+      m_bufferTransfers.push_back( transfer );
+    }
+
+    void TransferScheduler::copyBufferToImage( vk::Device const &                                device,
+                                               vk::Buffer const &                                srcBuffer,
+                                               vk::Image const &                                 dstImage,
+                                               vk::ImageSubresourceRange const &                 subresourceRange,
+                                               vk::ArrayProxy<const vk::BufferImageCopy> const & regions,
+                                               vk::ImageLayout                                   finalLayout,
+                                               vk::PipelineStageFlags                            dstStageMask,
+                                               vk::AccessFlags                                   dstAccessMask )
+    {
+      vk::CommandBuffer const & commandBuffer = beginRecording( device );
+
+      // the previous content is discarded, so there's no need to acquire the image from the graphics queue first
+      vk::ImageMemoryBarrier toTransferDst( {},
+                                            vk::AccessFlagBits::eTransferWrite,
+                                            vk::ImageLayout::eUndefined,
+                                            vk::ImageLayout::eTransferDstOptimal,
+                                            VK_QUEUE_FAMILY_IGNORED,
+                                            VK_QUEUE_FAMILY_IGNORED,
+                                            dstImage,
+                                            subresourceRange );
+      commandBuffer.pipelineBarrier( vk::PipelineStageFlagBits::eTopOfPipe,
+                                     vk::PipelineStageFlagBits::eTransfer,
+                                     {},
+                                     nullptr,
+                                     nullptr,
+                                     toTransferDst );
+      commandBuffer.copyBufferToImage( srcBuffer, dstImage, vk::ImageLayout::eTransferDstOptimal, regions );
+
+      ImageOwnershipTransfer transfer = { dstImage,
+                                          subresourceRange,
+                                          vk::ImageLayout::eTransferDstOptimal,
+                                          finalLayout,
+                                          m_topology.transferQueueFamilyIndex,
+                                          m_topology.graphicsQueueFamilyIndex,
+                                          vk::PipelineStageFlagBits::eTransfer,
+                                          vk::AccessFlagBits::eTransferWrite,
+                                          dstStageMask,
+                                          dstAccessMask };
+      releaseOwnership( commandBuffer, transfer );
+      m_imageTransfers.push_back( transfer );
+    }
+
+    std::pair<vk::Semaphore, vk::PipelineStageFlags>
+      TransferScheduler::submit( vk::CommandBuffer const & graphicsCommandBuffer )
+    {
+      if ( !m_recording )
+      {
+        return std::make_pair( vk::Semaphore(), vk::PipelineStageFlags() );
+      }
+
+      Slot & slot = m_slots[m_slotIndex];
+      slot.commandBuffer.end();
+      m_transferQueue.submit( vk::SubmitInfo( nullptr, nullptr, slot.commandBuffer, slot.semaphore ), slot.fence );
+
+      // the acquire barriers wait on their dstStageMask, so the semaphore wait has to cover all of them
+      vk::PipelineStageFlags waitStageMask;
+      for ( auto const & transfer : m_bufferTransfers )
+      {
+        acquireOwnership( graphicsCommandBuffer, transfer );
+        waitStageMask |= transfer.dstStageMask;
+      }
+      for ( auto const & transfer : m_imageTransfers )
+      {
+        acquireOwnership( graphicsCommandBuffer, transfer );
+        waitStageMask |= transfer.dstStageMask;
+      }
+      m_bufferTransfers.clear();
+      m_imageTransfers.clear();
+
+      m_recording = false;
+      m_slotIndex = ( m_slotIndex + 1 ) % static_cast<uint32_t>( m_slots.size() );
+      return std::make_pair( slot.semaphore, waitStageMask );
+    }
+
+    vk::CommandBuffer const & TransferScheduler::beginRecording( vk::Device const & device )
+    {
+      Slot & slot = m_slots[m_slotIndex];
+      if ( !m_recording )
+      {
+        while ( vk::Result::eTimeout == device.waitForFences( slot.fence, VK_TRUE, vk::su::FenceTimeout ) )
+          ;
+        device.resetFences( slot.fence );
+        device.resetCommandPool( slot.commandPool, {} );
+        slot.commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+        m_recording = true;
+      }
+      return slot.commandBuffer;
+    }
+
+    HandleCache::HandleCache( size_t bucketCount )
+      : m_buckets( bucketCount ), m_size( 0 ), m_frame( 0 ), m_hits( 0 ), m_misses( 0 )
+    {
+      // the bucket index is taken from the lower bits of the hash
+      assert( ( 0 < bucketCount ) && ( ( bucketCount & ( bucketCount - 1 ) ) == 0 ) );
+      for ( auto & bucket : m_buckets )
+      {
+        bucket.store( nullptr, std::memory_order_relaxed );
+      }
+    }
+
+    HandleCache::~HandleCache()
+    {
+      for ( auto & bucket : m_buckets )
+      {
+        Entry * entry = bucket.load( std::memory_order_relaxed );
+        while ( entry )
+        {
+          Entry * next = entry->next.load( std::memory_order_relaxed );
+          delete entry;
+          entry = next;
+        }
+      }
+    }
+
+    namespace
+    {
+      size_t hashKey( std::vector<uint64_t> const & key )
+      {
+        // FNV-1a over the words of the key
+        uint64_t hash = 14695981039346656037ull;
+        for ( auto word : key )
+        {
+          hash = ( hash ^ word ) * 1099511628211ull;
+        }
+        return static_cast<size_t>( hash ^ ( hash >> 32 ) );
+      }
+    }  // namespace
+
+    uint64_t HandleCache::find( std::vector<uint64_t> const & key ) const
+    {
+      size_t hash = hashKey( key );
+      for ( Entry * entry = m_buckets[getBucketIndex( hash )].load( std::memory_order_acquire ); entry;
+            entry         = entry->next.load( std::memory_order_acquire ) )
+      {
+        if ( ( entry->hash == hash ) && ( entry->key == key ) )
+        {
+          // marking the entry as used in this frame races with remove claiming it as evicted, and only one of them
+          // wins; only write the entry when the frame changed, to keep its cache line shared between the readers
+          uint64_t frame         = m_frame.load( std::memory_order_relaxed );
+          uint64_t lastUsedFrame = entry->lastUsedFrame.load( std::memory_order_relaxed );
+          while ( ( lastUsedFrame != frame ) && ( lastUsedFrame != EvictedFrame ) &&
+                  !entry->lastUsedFrame.compare_exchange_weak( lastUsedFrame, frame, std::memory_order_relaxed ) )
+            ;
+          if ( lastUsedFrame == EvictedFrame )
+          {
+            break;
+          }
+          m_hits.fetch_add( 1, std::memory_order_relaxed );
+          return entry->handle;
+        }
+      }
+      m_misses.fetch_add( 1, std::memory_order_relaxed );
+      return 0;
+    }
+
+    uint64_t HandleCache::insert( std::vector<uint64_t> const & key, uint64_t handle )
+    {
+      size_t                      hash = hashKey( key );
+      std::atomic<Entry *> &      head = m_buckets[getBucketIndex( hash )];
+      std::lock_guard<std::mutex> lock( m_mutex );
+      for ( Entry * entry = head.load( std::memory_order_relaxed ); entry;
+            entry         = entry->next.load( std::memory_order_relaxed ) )
+      {
+        if ( ( entry->hash == hash ) && ( entry->key == key ) )
+        {
+          return entry->handle;
+        }
+      }
+
+      // the entry is completely set up before it's published to the readers
+      Entry * entry  = new Entry;
+      entry->key     = key;
+      entry->hash    = hash;
+      entry->handle  = handle;
+      entry->lastUsedFrame.store( m_frame.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+      entry->next.store( head.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+      head.store( entry, std::memory_order_release );
+      m_size++;
+      return handle;
+    }
+
+    std::vector<uint64_t> HandleCache::remove(
+      std::function<bool( std::vector<uint64_t> const & key, uint64_t lastUsedFrame )> const & predicate )
+    {
+      std::vector<uint64_t>       handles;
+      std::lock_guard<std::mutex> lock( m_mutex );
+      for ( auto & bucket : m_buckets )
+      {
+        // an unlinked entry keeps its next pointer, such that a reader standing on it still gets to the end of the list
+        std::atomic<Entry *> * link = &bucket;
+        while ( Entry * entry = link->load( std::memory_order_relaxed ) )
+        {
+          // the entry is only removed if it can be claimed as evicted, before a concurrent find marks it as used
+          uint64_t lastUsedFrame = entry->lastUsedFrame.load( std::memory_order_relaxed );
+          if ( predicate( entry->key, lastUsedFrame ) &&
+               entry->lastUsedFrame.compare_exchange_strong( lastUsedFrame, EvictedFrame, std::memory_order_relaxed ) )
+          {
+            link->store( entry->next.load( std::memory_order_relaxed ), std::memory_order_release );
+            handles.push_back( entry->handle );
+            m_unlinkedEntries.push_back( std::unique_ptr<Entry>( entry ) );
+            m_size--;
+          }
+          else
+          {
+            link = &entry->next;
+          }
+        }
+      }
+      return handles;
+    }
+
+    std::vector<uint64_t> HandleCache::trim( size_t maxSize, uint64_t completedFrame )
+    {
+      // find the frame up to which the entries are to be evicted, the least recently used first
+      std::vector<uint64_t> lastUsedFrames;
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( m_size <= maxSize )
+        {
+          return {};
+        }
+        lastUsedFrames.reserve( m_size );
+        for ( auto & bucket : m_buckets )
+        {
+          for ( Entry * entry = bucket.load( std::memory_order_relaxed ); entry;
+                entry         = entry->next.load( std::memory_order_relaxed ) )
+          {
+            uint64_t lastUsedFrame = entry->lastUsedFrame.load( std::memory_order_relaxed );
+            if ( lastUsedFrame <= completedFrame )
+            {
+              lastUsedFrames.push_back( lastUsedFrame );
+            }
+          }
+        }
+        if ( lastUsedFrames.empty() )
+        {
+          return {};
+        }
+        size_t evictCount = ( std::min )( m_size - maxSize, lastUsedFrames.size() );
+        std::nth_element( lastUsedFrames.begin(), lastUsedFrames.begin() + evictCount - 1, lastUsedFrames.end() );
+        completedFrame = lastUsedFrames[evictCount - 1];
+      }
+
+      // entries used in that very frame might be more than needed, which are just evicted as well
+      return remove( [completedFrame]( std::vector<uint64_t> const &, uint64_t lastUsedFrame ) {
+        return lastUsedFrame <= completedFrame;
+      } );
+    }
+
+    void HandleCache::collect()
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      m_unlinkedEntries.clear();
+    }
+
+    void HandleCache::setFrame( uint64_t frame )
+    {
+      m_frame.store( frame, std::memory_order_relaxed );
+    }
+
+    HandleCache::Statistics HandleCache::getStatistics() const
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      Statistics                  statistics;
+      statistics.size   = m_size;
+      statistics.hits   = m_hits.load( std::memory_order_relaxed );
+      statistics.misses = m_misses.load( std::memory_order_relaxed );
+      return statistics;
+    }
+
+    namespace
+    {
+      // the keys are built in a buffer per thread, such that a lookup doesn't allocate
+      std::vector<uint64_t> & getKeyBuffer()
+      {
+        static thread_local std::vector<uint64_t> key;
+        key.clear();
+        return key;
+      }
+
+      // the non-dispatchable handles are pointers with VK_USE_64_BIT_PTR_DEFINES, and uint64_t otherwise; the caches
+      // store them as uint64_t either way
+      template <typename HandleType>
+      uint64_t handleToUint64( HandleType const & handle )
+      {
+#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+        return reinterpret_cast<uint64_t>( static_cast<typename HandleType::CType>( handle ) );
+#else
+        return static_cast<uint64_t>( static_cast<typename HandleType::CType>( handle ) );
+#endif
+      }
+
+      template <typename HandleType>
+      HandleType uint64ToHandle( uint64_t handle )
+      {
+#if ( VK_USE_64_BIT_PTR_DEFINES == 1 )
+        return HandleType( reinterpret_cast<typename HandleType::CType>( handle ) );
+#else
+        return HandleType( static_cast<typename HandleType::CType>( handle ) );
+#endif
+      }
+
+      void appendAttachmentReferences( std::vector<uint64_t> &         key,
+                                       uint32_t                        count,
+                                       vk::AttachmentReference const * references )
+      {
+        key.push_back( references ? count : VK_ATTACHMENT_UNUSED );
+        for ( uint32_t i = 0; references && ( i < count ); i++ )
+        {
+          key.push_back( references[i].attachment );
+          key.push_back( static_cast<uint64_t>( references[i].layout ) );
+        }
+      }
+    }  // namespace
+
+    RenderPassCache::RenderPassCache( size_t bucketCount ) : m_cache( bucketCount ) {}
+
+    vk::RenderPass RenderPassCache::get( vk::Device const & device, vk::RenderPassCreateInfo const & createInfo )
+    {
+      // pNext chains, like multiview, are not part of the key
+      assert( !createInfo.pNext );
+
+      std::vector<uint64_t> & key = getKeyBuffer();
+      key.push_back( 0 );  // tells these keys apart from the keys of the other get
+      key.push_back( static_cast<VkRenderPassCreateFlags>( createInfo.flags ) );
+      key.push_back( createInfo.attachmentCount );
+      for ( uint32_t i = 0; i < createInfo.attachmentCount; i++ )
+      {
+        vk::AttachmentDescription const & attachment = createInfo.pAttachments[i];
+        key.push_back( static_cast<VkAttachmentDescriptionFlags>( attachment.flags ) );
+        key.push_back( static_cast<uint64_t>( attachment.format ) );
+        key.push_back( static_cast<uint64_t>( attachment.samples ) );
+        key.push_back( static_cast<uint64_t>( attachment.loadOp ) );
+        key.push_back( static_cast<uint64_t>( attachment.storeOp ) );
+        key.push_back( static_cast<uint64_t>( attachment.stencilLoadOp ) );
+        key.push_back( static_cast<uint64_t>( attachment.stencilStoreOp ) );
+        key.push_back( static_cast<uint64_t>( attachment.initialLayout ) );
+        key.push_back( static_cast<uint64_t>( attachment.finalLayout ) );
+      }
+      key.push_back( createInfo.subpassCount );
+      for ( uint32_t i = 0; i < createInfo.subpassCount; i++ )
+      {
+        vk::SubpassDescription const & subpass = createInfo.pSubpasses[i];
+        key.push_back( static_cast<VkSubpassDescriptionFlags>( subpass.flags ) );
+        key.push_back( static_cast<uint64_t>( subpass.pipelineBindPoint ) );
+        appendAttachmentReferences( key, subpass.inputAttachmentCount, subpass.pInputAttachments );
+        appendAttachmentReferences( key, subpass.colorAttachmentCount, subpass.pColorAttachments );
+        appendAttachmentReferences( key, subpass.colorAttachmentCount, subpass.pResolveAttachments );
+        appendAttachmentReferences( key, 1, subpass.pDepthStencilAttachment );
+        key.push_back( subpass.preserveAttachmentCount );
+        key.insert(
+          key.end(), subpass.pPreserveAttachments, subpass.pPreserveAttachments + subpass.preserveAttachmentCount );
+      }
+      key.push_back( createInfo.dependencyCount );
+      for ( uint32_t i = 0; i < createInfo.dependencyCount; i++ )
+      {
+        vk::SubpassDependency const & dependency = createInfo.pDependencies[i];
+        key.push_back( dependency.srcSubpass );
+        key.push_back( dependency.dstSubpass );
+        key.push_back( static_cast<VkPipelineStageFlags>( dependency.srcStageMask ) );
+        key.push_back( static_cast<VkPipelineStageFlags>( dependency.dstStageMask ) );
+        key.push_back( static_cast<VkAccessFlags>( dependency.srcAccessMask ) );
+        key.push_back( static_cast<VkAccessFlags>( dependency.dstAccessMask ) );
+        key.push_back( static_cast<VkDependencyFlags>( dependency.dependencyFlags ) );
+      }
+
+      uint64_t handle = m_cache.find( key );
+      if ( !handle )
+      {
+        vk::RenderPass renderPass = device.createRenderPass( createInfo );
+        handle                    = m_cache.insert( key, handleToUint64( renderPass ) );
+        if ( handle != handleToUint64( renderPass ) )
+        {
+          // another thread was faster
+          device.destroyRenderPass( renderPass );
+        }
+      }
+      return uint64ToHandle<vk::RenderPass>( handle );
+    }
+
+    vk::RenderPass RenderPassCache::get( vk::Device const &   device,
+                                         vk::Format           colorFormat,
+                                         vk::Format           depthFormat,
+                                         vk::AttachmentLoadOp loadOp,
+                                         vk::ImageLayout      colorFinalLayout )
+    {
+      std::vector<uint64_t> & key = getKeyBuffer();
+      key.push_back( 1 );
+      key.push_back( static_cast<uint64_t>( colorFormat ) );
+      key.push_back( static_cast<uint64_t>( depthFormat ) );
+      key.push_back( static_cast<uint64_t>( loadOp ) );
+      key.push_back( static_cast<uint64_t>( colorFinalLayout ) );
+
+      uint64_t handle = m_cache.find( key );
+      if ( !handle )
+      {
+        vk::RenderPass renderPass = createRenderPass( device, colorFormat, depthFormat, loadOp, colorFinalLayout );
+        handle                    = m_cache.insert( key, handleToUint64( renderPass ) );
+        if ( handle != handleToUint64( renderPass ) )
+        {
+          device.destroyRenderPass( renderPass );
+        }
+      }
+      return uint64ToHandle<vk::RenderPass>( handle );
+    }
+
+    void RenderPassCache::clear( vk::Device const & device )
+    {
+      for ( auto handle : m_cache.remove( []( std::vector<uint64_t> const &, uint64_t ) { return true; } ) )
+      {
+        device.destroyRenderPass( uint64ToHandle<vk::RenderPass>( handle ) );
+      }
+      m_cache.collect();
+    }
+
+    FramebufferCache::FramebufferCache( size_t bucketCount ) : m_cache( bucketCount ) {}
+
+    vk::Framebuffer FramebufferCache::get( vk::Device const &                          device,
+                                           vk::RenderPass const &                      renderPass,
+                                           vk::ArrayProxy<const vk::ImageView> const & attachments,
+                                           vk::Extent2D const &                        extent,
+                                           uint32_t                                    layers )
+    {
+      // the attachments come last, to be looked for by removeImageView
+      std::vector<uint64_t> & key = getKeyBuffer();
+      key.push_back( handleToUint64( renderPass ) );
+      key.push_back( extent.width );
+      key.push_back( extent.height );
+      key.push_back( layers );
+      for ( auto const & attachment : attachments )
+      {
+        key.push_back( handleToUint64( attachment ) );
+      }
+
+      uint64_t handle = m_cache.find( key );
+      if ( !handle )
+      {
+        vk::Framebuffer framebuffer = device.createFramebuffer( vk::FramebufferCreateInfo(
+          {}, renderPass, attachments.size(), attachments.data(), extent.width, extent.height, layers ) );
+        handle = m_cache.insert( key, handleToUint64( framebuffer ) );
+        if ( handle != handleToUint64( framebuffer ) )
+        {
+          device.destroyFramebuffer( framebuffer );
+        }
+      }
+      return uint64ToHandle<vk::Framebuffer>( handle );
+    }
+
+    void FramebufferCache::removeImageView( vk::Device const & device, vk::ImageView const & imageView )
+    {
+      uint64_t view = handleToUint64( imageView );
+      for ( auto handle : m_cache.remove( [view]( std::vector<uint64_t> const & key, uint64_t ) {
+              return std::find( key.begin() + 4, key.end(), view ) != key.end();
+            } ) )
+      {
+        device.destroyFramebuffer( uint64ToHandle<vk::Framebuffer>( handle ) );
+      }
+    }
+
+    size_t FramebufferCache::trim( vk::Device const & device, size_t maxSize, uint64_t completedFrame )
+    {
+      std::vector<uint64_t> handles = m_cache.trim( maxSize, completedFrame );
+      for ( auto handle : handles )
+      {
+        device.destroyFramebuffer( uint64ToHandle<vk::Framebuffer>( handle ) );
+      }
+      return handles.size();
+    }
+
+    void FramebufferCache::clear( vk::Device const & device )
+    {
+      for ( auto handle : m_cache.remove( []( std::vector<uint64_t> const &, uint64_t ) { return true; } ) )
+      {
+        device.destroyFramebuffer( uint64ToHandle<vk::Framebuffer>( handle ) );
+      }
+      m_cache.collect();
+    }
+
+    ImageData::ImageData( vk::PhysicalDevice const & physicalDevice,
+                          vk::Device const &         device,
+                          vk::Format                 format_,
+                          vk::Extent2D const &       extent,
+                          vk::ImageTiling            tiling,
+                          vk::ImageUsageFlags        usage,
+                          vk::ImageLayout            initialLayout,
+                          vk::MemoryPropertyFlags    memoryProperties,
+                          vk::ImageAspectFlags       aspectMask )
+      : format( format_ )
+    {
+      vk::ImageCreateInfo imageCreateInfo( vk::ImageCreateFlags(),
+                                           vk::ImageType::e2D,
+                                           format,
+                                           vk::Extent3D( extent, 1 ),
+                                           1,
+                                           1,
+                                           vk::SampleCountFlagBits::e1,
+                                           tiling,
+                                           usage | vk::ImageUsageFlagBits::eSampled,
+                                           vk::SharingMode::eExclusive,
+                                           {},
+                                           initialLayout );
+      image = device.createImage( imageCreateInfo );
+
+      deviceMemory = vk::su::allocateDeviceMemory(
+        device, physicalDevice.getMemoryProperties(), device.getImageMemoryRequirements( image ), memoryProperties );
+
+      device.bindImageMemory( image, deviceMemory, 0 );
+
+      vk::ComponentMapping componentMapping(
+        ComponentSwizzle::eR, ComponentSwizzle::eG, ComponentSwizzle::eB, ComponentSwizzle::eA );
+      vk::ImageSubresourceRange imageSubresourceRange( aspectMask, 0, 1, 0, 1 );
+      vk::ImageViewCreateInfo   imageViewCreateInfo(
+        {}, image, vk::ImageViewType::e2D, format, componentMapping, imageSubresourceRange );
+      imageView = device.createImageView( imageViewCreateInfo );
+    }
+
+    SurfaceData::SurfaceData( vk::Instance const & instance,
+                              std::string const &  windowName,
+                              vk::Extent2D const & extent_ )
+      : extent( extent_ ), window( vk::su::createWindow( windowName, extent ) )
+    {
+      VkSurfaceKHR _surface;
+      VkResult err = glfwCreateWindowSurface( static_cast<VkInstance>( instance ), window.handle, nullptr, &_surface );
+      if ( err != VK_SUCCESS )
+        throw std::runtime_error( "Failed to create window!" );
+      surface = vk::SurfaceKHR( _surface );
+    }
+
+    SwapChainData::SwapChainData( vk::PhysicalDevice const & physicalDevice,
+                                  vk::Device const &         device,
+                                  vk::SurfaceKHR const &     surface,
+                                  vk::Extent2D const &       extent,
+                                  vk::ImageUsageFlags        usage,
+                                  vk::SwapchainKHR const &   oldSwapChain,
+                                  uint32_t                   graphicsQueueFamilyIndex,
+                                  uint32_t                   presentQueueFamilyIndex )
+    {
+      vk::SurfaceFormatKHR surfaceFormat = vk::su::pickSurfaceFormat( physicalDevice.getSurfaceFormatsKHR( surface ) );
+      colorFormat                        = surfaceFormat.format;
+
+      vk::SurfaceCapabilitiesKHR surfaceCapabilities = physicalDevice.getSurfaceCapabilitiesKHR( surface );
+      VkExtent2D                 swapchainExtent;
+      if ( surfaceCapabilities.currentExtent.width == std::numeric_limits<uint32_t>::max() )
+      {
+        // If the surface size is undefined, the size is set to the size of the images requested.
+        swapchainExtent.width =
+          clamp( extent.width, surfaceCapabilities.minImageExtent.width, surfaceCapabilities.maxImageExtent.width );
+        swapchainExtent.height =
+          clamp( extent.height, surfaceCapabilities.minImageExtent.height, surfaceCapabilities.maxImageExtent.height );
+      }
+      else
+      {
+        // If the surface size is defined, the swap chain size must match
+        swapchainExtent = surfaceCapabilities.currentExtent;
+      }
+      vk::SurfaceTransformFlagBitsKHR preTransform =
+        ( surfaceCapabilities.supportedTransforms & vk::SurfaceTransformFlagBitsKHR::eIdentity )
+          ? vk::SurfaceTransformFlagBitsKHR::eIdentity
+          : surfaceCapabilities.currentTransform;
+      vk::CompositeAlphaFlagBitsKHR compositeAlpha =
+        ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePreMultiplied )
+          ? vk::CompositeAlphaFlagBitsKHR::ePreMultiplied
+        : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::ePostMultiplied )
+          ? vk::CompositeAlphaFlagBitsKHR::ePostMultiplied
+        : ( surfaceCapabilities.supportedCompositeAlpha & vk::CompositeAlphaFlagBitsKHR::eInherit )
+          ? vk::CompositeAlphaFlagBitsKHR::eInherit
+          : vk::CompositeAlphaFlagBitsKHR::eOpaque;
+      vk::PresentModeKHR presentMode = vk::su::pickPresentMode( physicalDevice.getSurfacePresentModesKHR( surface ) );
+      vk::SwapchainCreateInfoKHR swapChainCreateInfo( {},
+                                                      surface,
+                                                      surfaceCapabilities.minImageCount,
+                                                      colorFormat,
+                                                      surfaceFormat.colorSpace,
+                                                      swapchainExtent,
+                                                      1,
+                                                      usage,
+                                                      vk::SharingMode::eExclusive,
+                                                      {},
+                                                      preTransform,
+                                                      compositeAlpha,
+                                                      presentMode,
+                                                      true,
+                                                      oldSwapChain );
+      if ( graphicsQueueFamilyIndex != presentQueueFamilyIndex )
+      {
+        uint32_t queueFamilyIndices[2] = { graphicsQueueFamilyIndex, presentQueueFamilyIndex };
+        // If the graphics and present queues are from different queue families, we either have to explicitly transfer
+        // ownership of images between the queues, or we have to create the swapchain with imageSharingMode as
+        // vk::SharingMode::eConcurrent
+        swapChainCreateInfo.imageSharingMode      = vk::SharingMode::eConcurrent;
+        swapChainCreateInfo.queueFamilyIndexCount = 2;
+        swapChainCreateInfo.pQueueFamilyIndices   = queueFamilyIndices;
+      }
+      swapChain = device.createSwapchainKHR( swapChainCreateInfo );
+
+      images = device.getSwapchainImagesKHR( swapChain );
+
+      imageViews.reserve( images.size() );
+      vk::ComponentMapping componentMapping(
+        vk::ComponentSwizzle::eR, vk::ComponentSwizzle::eG, vk::ComponentSwizzle::eB, vk::ComponentSwizzle::eA );
+      vk::ImageSubresourceRange subResourceRange( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
+      for ( auto image : images )
+      {
+        vk::ImageViewCreateInfo imageViewCreateInfo(
+          vk::ImageViewCreateFlags(), image, vk::ImageViewType::e2D, colorFormat, componentMapping, subResourceRange );
+        imageViews.push_back( device.createImageView( imageViewCreateInfo ) );
+      }
+    }
+
+    namespace
+    {
+      uint32_t packRGBA( std::array<uint8_t, 3> const & rgb )
+      {
+        uint8_t  rgba[4] = { rgb[0], rgb[1], rgb[2], 255 };
+        uint32_t pixel;
+        memcpy( &pixel, rgba, 4 );
+        return pixel;
+      }
+
+      std::array<uint8_t, 256> const & getColorConversionTable( ColorConversion colorConversion )
+      {
+        assert( colorConversion != ColorConversion::eNone );
+        struct Tables
+        {
+          Tables()
+          {
+            for ( size_t i = 0; i < 256; i++ )
+            {
+              float c = i / 255.0f;
+              srgbToLinear[i] = static_cast<uint8_t>(
+                255.0f * ( ( c <= 0.04045f ) ? c / 12.92f : powf( ( c + 0.055f ) / 1.055f, 2.4f ) ) + 0.5f );
+              linearToSrgb[i] = static_cast<uint8_t>(
+                255.0f * ( ( c <= 0.0031308f ) ? c * 12.92f : 1.055f * powf( c, 1.0f / 2.4f ) - 0.055f ) + 0.5f );
+            }
+          }
+
+          std::array<uint8_t, 256> srgbToLinear;
+          std::array<uint8_t, 256> linearToSrgb;
+        };
+        static const Tables tables;
+        return ( colorConversion == ColorConversion::eSrgbToLinear ) ? tables.srgbToLinear : tables.linearToSrgb;
+      }
+    }  // namespace
+
+    void fillPixels( uint32_t * pixels, uint32_t value, size_t count )
+    {
+      size_t i = 0;
+#if defined( VK_SU_AVX2 )
+      __m256i value8 = _mm256_set1_epi32( static_cast<int>( value ) );
+      for ( ; i + 8 <= count; i += 8 )
+      {
+        _mm256_storeu_si256( reinterpret_cast<__m256i *>( pixels + i ), value8 );
+      }
+#endif
+#if defined( VK_SU_SSE2 )
+      __m128i value4 = _mm_set1_epi32( static_cast<int>( value ) );
+      for ( ; i + 4 <= count; i += 4 )
+      {
+        _mm_storeu_si128( reinterpret_cast<__m128i *>( pixels + i ), value4 );
+      }
+#endif
+      for ( ; i < count; i++ )
+      {
+        pixels[i] = value;
+      }
+    }
+
+    void convertRGBToRGBA( uint8_t * rgba, uint8_t const * rgb, size_t pixelCount, ColorConversion colorConversion )
+    {
+      if ( colorConversion != ColorConversion::eNone )
+      {
+        std::array<uint8_t, 256> const & table = getColorConversionTable( colorConversion );
+        for ( size_t i = 0; i < pixelCount; i++, rgba += 4, rgb += 3 )
+        {
+          rgba[0] = table[rgb[0]];
+          rgba[1] = table[rgb[1]];
+          rgba[2] = table[rgb[2]];
+          rgba[3] = 255;
+        }
+        return;
+      }
+
+      size_t i = 0;
+#if defined( VK_SU_SSSE3 )
+      // four pixels at a time: 16 bytes are loaded, of which the first 12 bytes are shuffled into place, and the alpha
+      // bytes are or'ed in; stop early enough to never read beyond the end of rgb
+      const __m128i shuffle = _mm_setr_epi8( 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1 );
+      const __m128i alpha   = _mm_set1_epi32( static_cast<int>( 0xFF000000 ) );
+      for ( ; i + 6 <= pixelCount; i += 4 )
+      {
+        __m128i source = _mm_loadu_si128( reinterpret_cast<__m128i const *>( rgb + 3 * i ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i *>( rgba + 4 * i ),
+                          _mm_or_si128( _mm_shuffle_epi8( source, shuffle ), alpha ) );
+      }
+#endif
+      for ( ; i < pixelCount; i++ )
+      {
+        rgba[4 * i + 0] = rgb[3 * i + 0];
+        rgba[4 * i + 1] = rgb[3 * i + 1];
+        rgba[4 * i + 2] = rgb[3 * i + 2];
+        rgba[4 * i + 3] = 255;
+      }
+    }
+
+    void convertRGBAToRGBA( uint8_t * dst, uint8_t const * src, size_t pixelCount, ColorConversion colorConversion )
+    {
+      if ( colorConversion == ColorConversion::eNone )
+      {
+        memcpy( dst, src, pixelCount * 4 );
+      }
+      else
+      {
+        std::array<uint8_t, 256> const & table = getColorConversionTable( colorConversion );
+        for ( size_t i = 0; i < pixelCount; i++, dst += 4, src += 4 )
+        {
+          dst[0] = table[src[0]];
+          dst[1] = table[src[1]];
+          dst[2] = table[src[2]];
+          dst[3] = src[3];
+        }
+      }
+    }
+
+    void forEachRowRange( vk::Extent2D const &                                                extent,
+                          vk::DeviceSize                                                      rowPitch,
+                          std::function<void( uint32_t firstRow, uint32_t rowCount )> const & rowFunction )
+    {
+      // below some MB, the costs of starting the threads outweigh the gain
+      const vk::DeviceSize minBytesPerThread = 1 << 20;
+      const uint32_t       minRowsPerThread  = 16;
+
+      uint32_t threadCount = ( std::max )( 1u, std::thread::hardware_concurrency() );
+      threadCount = ( std::min )( threadCount, static_cast<uint32_t>( extent.height * rowPitch / minBytesPerThread ) );
+      threadCount = ( std::min )( threadCount, extent.height / minRowsPerThread );
+      if ( threadCount <= 1 )
+      {
+        rowFunction( 0, extent.height );
+        return;
+      }
+
+      // an exception never leaves a range, but is kept until all the threads are joined, and the first one is rethrown
+      std::vector<std::exception_ptr> exceptions( threadCount );
+
+      auto rowRange = [&]( uint32_t i ) {
+        try
+        {
+          uint32_t firstRow = extent.height * i / threadCount;
+          uint32_t lastRow  = extent.height * ( i + 1 ) / threadCount;
+          rowFunction( firstRow, lastRow - firstRow );
+        }
+        catch ( ... )
+        {
+          exceptions[i] = std::current_exception();
+        }
+      };
+
+      std::vector<std::thread> threads;
+      threads.reserve( threadCount - 1 );
+      for ( uint32_t i = 1; i < threadCount; i++ )
+      {
+        try
+        {
+          threads.push_back( std::thread( rowRange, i ) );
+        }
+        catch ( std::system_error const & )
+        {
+          // no thread could be started, so this range is done right here
+          rowRange( i );
+        }
+      }
+      rowRange( 0 );
+      for ( auto & thread : threads )
+      {
+        thread.join();
+      }
+
+      for ( auto const & exception : exceptions )
+      {
+        if ( exception )
+        {
+          std::rethrow_exception( exception );
+        }
+      }
+    }
+
+    CheckerboardImageGenerator::CheckerboardImageGenerator( std::array<uint8_t, 3> const & rgb0,
+                                                            std::array<uint8_t, 3> const & rgb1 )
+      : m_rgb0( rgb0 ), m_rgb1( rgb1 )
+    {}
+
+    void CheckerboardImageGenerator::operator()( void *               data,
+                                                 vk::Extent2D const & extent,
+                                                 vk::DeviceSize       rowPitch ) const
+    {
+      assert( extent.width * 4 <= rowPitch );
+
+      // Checkerboard of 16x16 pixel squares: all the rows are one of two patterns, which are built once and then just
+      // copied, such that the (possibly write-combined) mapped memory is never read from
+      std::array<std::vector<uint32_t>, 2> patterns;
+      uint32_t                             pixels[2] = { packRGBA( m_rgb0 ), packRGBA( m_rgb1 ) };
+      for ( size_t i = 0; i < 2; i++ )
+      {
+        patterns[i].resize( extent.width );
+        for ( uint32_t col = 0; col < extent.width; col += 16 )
+        {
+          fillPixels( patterns[i].data() + col,
+                      pixels[( ( col & 0x10 ) == 0 ) ^ ( i == 0 )],
+                      ( std::min )( 16u, extent.width - col ) );
+        }
+      }
+
+      forEachRowRange( extent, rowPitch, [&]( uint32_t firstRow, uint32_t rowCount ) {
+        uint8_t * pImageMemory = static_cast<uint8_t *>( data ) + firstRow * rowPitch;
+        for ( uint32_t row = firstRow; row < firstRow + rowCount; row++ )
+        {
+          memcpy( pImageMemory, patterns[( row & 0x10 ) ? 1 : 0].data(), extent.width * 4 );
+          pImageMemory += rowPitch;
+        }
+      } );
+    }
+
+    MonochromeImageGenerator::MonochromeImageGenerator( std::array<unsigned char, 3> const & rgb ) : m_rgb( rgb ) {}
+
+    void MonochromeImageGenerator::operator()( void * data, vk::Extent2D const & extent, vk::DeviceSize rowPitch ) const
+    {
+      assert( extent.width * 4 <= rowPitch );
+
+      // fill in with the monochrome color
+      uint32_t pixel = packRGBA( m_rgb );
+      forEachRowRange( extent, rowPitch, [&]( uint32_t firstRow, uint32_t rowCount ) {
+        uint8_t * pImageMemory = static_cast<uint8_t *>( data ) + firstRow * rowPitch;
+        if ( rowPitch == extent.width * 4 )
+        {
+          fillPixels( reinterpret_cast<uint32_t *>( pImageMemory ), pixel, size_t( extent.width ) * rowCount );
+        }
+        else
+        {
+          for ( uint32_t row = 0; row < rowCount; row++ )
+          {
+            fillPixels( reinterpret_cast<uint32_t *>( pImageMemory ), pixel, extent.width );
+            pImageMemory += rowPitch;
+          }
+        }
+      } );
+    }
+
+    PixelsImageGenerator::PixelsImageGenerator( vk::Extent2D const &  extent,
+                                                size_t                channels,
+                                                unsigned char const * pixels,
+                                                ColorConversion       colorConversion )
+      : m_extent( extent ), m_channels( channels ), m_pixels( pixels ), m_colorConversion( colorConversion )
+    {
+      assert( ( m_channels == 3 ) || ( m_channels == 4 ) );
+    }
+
+    void PixelsImageGenerator::operator()( void * data, vk::Extent2D const & extent, vk::DeviceSize rowPitch ) const
+    {
+      assert( extent == m_extent );
+      assert( extent.width * 4 <= rowPitch );
+
+      if ( ( m_channels == 4 ) && ( m_colorConversion == ColorConversion::eNone ) &&
+           ( rowPitch == extent.width * 4 ) )
+      {
+        memcpy( data, m_pixels, extent.width * extent.height * m_channels );
+        return;
+      }
+
+      forEachRowRange( extent, rowPitch, [&]( uint32_t firstRow, uint32_t rowCount ) {
+        uint8_t *       pImageMemory = static_cast<uint8_t *>( data ) + firstRow * rowPitch;
+        uint8_t const * pPixels      = m_pixels + size_t( firstRow ) * extent.width * m_channels;
+        for ( uint32_t row = 0; row < rowCount; row++ )
+        {
+          if ( m_channels == 3 )
+          {
+            convertRGBToRGBA( pImageMemory, pPixels, extent.width, m_colorConversion );
+          }
+          else
+          {
+            convertRGBAToRGBA( pImageMemory, pPixels, extent.width, m_colorConversion );
+          }
+          pImageMemory += rowPitch;
+          pPixels += extent.width * m_channels;
+        }
+      } );
     }
 
     TextureData::TextureData( vk::PhysicalDevice const & physicalDevice,
@@ -1067,7 +3233,10 @@ namespace vk
       {
         assert( ( formatProperties.optimalTilingFeatures & formatFeatureFlags ) == formatFeatureFlags );
         stagingBufferData = std::unique_ptr<BufferData>( new BufferData(
-          physicalDevice, device, extent.width * extent.height * 4, vk::BufferUsageFlagBits::eTransferSrc ) );
+          physicalDevice,
+          device,
+          vk::su::getPackedImageSize( format, extent ),
+          vk::BufferUsageFlagBits::eTransferSrc ) );
         imageTiling       = vk::ImageTiling::eOptimal;
         usageFlags |= vk::ImageUsageFlagBits::eTransferDst;
         initialLayout = vk::ImageLayout::eUndefined;
@@ -19,8 +19,14 @@
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <thread>
 
 namespace vk
 {
@@ -252,17 +258,842 @@ namespace vk
       std::vector<vk::ImageView> imageViews;
     };
 
+    struct TransientAllocation
+    {
+      vk::Buffer     buffer;
+      vk::DeviceSize offset;
+      void *         pData;
+    };
+
+    struct DynamicAllocation
+    {
+      vk::Buffer buffer;
+      uint32_t   dynamicOffset;  // the dynamic offset to pass to bindDescriptorSets
+      void *     pData;
+    };
+
+    struct FrameData
+    {
+      FrameData( vk::PhysicalDevice const & physicalDevice,
+                 vk::Device const &         device,
+                 uint32_t                   queueFamilyIndex,
+                 vk::DeviceSize             transientBufferSize );
+
+      void clear( vk::Device const & device )
+      {
+        if ( transientBufferData )
+        {
+          device.unmapMemory( transientBufferData->deviceMemory );
+          transientBufferData->clear( device );
+        }
+        device.destroySemaphore( renderCompleteSemaphore );
+        device.destroySemaphore( imageAcquiredSemaphore );
+        device.destroyFence( fence );
+        device.freeCommandBuffers( commandPool, commandBuffer );
+        device.destroyCommandPool( commandPool );
+      }
+
+      // linear sub-allocation out of the persistently mapped transient buffer; everything handed out is invalidated
+      // with the next reset of this frame
+      TransientAllocation allocateTransient( vk::DeviceSize size, vk::DeviceSize alignment = 16 );
+
+      vk::CommandPool             commandPool;
+      vk::CommandBuffer           commandBuffer;
+      vk::Fence                   fence;
+      vk::Semaphore               imageAcquiredSemaphore;
+      vk::Semaphore               renderCompleteSemaphore;
+      std::unique_ptr<BufferData> transientBufferData;
+      vk::DeviceSize              transientBufferSize;
+      vk::DeviceSize              transientOffset;
+      void *                      transientData;
+    };
+
+    // A ring of frameCount FrameData, allowing the CPU to record frame n + 1 while the GPU is still working on frame n.
+    // Per frame, the sequence is beginFrame -> [acquireNextImage] -> record -> submit -> [present].
+    class FramesInFlight
+    {
+    public:
+      FramesInFlight( vk::PhysicalDevice const & physicalDevice,
+                      vk::Device const &         device,
+                      uint32_t                   queueFamilyIndex,
+                      uint32_t                   frameCount          = 2,
+                      vk::DeviceSize             transientBufferSize = 0 );
+
+      void clear( vk::Device const & device );
+
+      // waits for the GPU to finish the previous use of the current frame, then resets its fence, command pool and
+      // transient allocations and begins its command buffer
+      FrameData &               beginFrame( vk::Device const & device );
+      vk::ResultValue<uint32_t> acquireNextImage( vk::Device const & device, vk::SwapchainKHR const & swapChain );
+      // ends the command buffer and submits it, waiting on an acquired image (if any) and signaling the frame fence
+      void submit( vk::Queue const &      queue,
+                   vk::PipelineStageFlags waitDstStageMask = vk::PipelineStageFlagBits::eColorAttachmentOutput );
+      vk::Result present( vk::Queue const & queue, vk::SwapchainKHR const & swapChain, uint32_t imageIndex );
+      // waits for all frames in flight, without idling the queue
+      void waitIdle( vk::Device const & device ) const;
+
+      FrameData & currentFrame()
+      {
+        return m_frames[m_frameIndex];
+      }
+
+      uint32_t frameCount() const
+      {
+        return static_cast<uint32_t>( m_frames.size() );
+      }
+
+      uint32_t frameIndex() const
+      {
+        return m_frameIndex;
+      }
+
+    private:
+      std::vector<FrameData> m_frames;
+      uint32_t               m_frameIndex;
+      uint32_t               m_submittedFrameIndex;
+      bool                   m_imageAcquired;
+    };
+
+    // Hands out per-draw data, like the uniforms of a dynamic uniform buffer, out of one persistently mapped buffer per
+    // frame in flight, at offsets aligned for use as dynamic offsets with bindDescriptorSets. The threads allocating
+    // don't share a lock: each one takes sub-blocks of subBlockSize bytes from the frame buffer with a single atomic
+    // add, and sub-allocates linearly from its current sub-block. A thread keeps one sub-block at a time, of the
+    // allocator it allocated from last. beginFrame resets the whole frame buffer, and must not run concurrently with
+    // allocate.
+    class DynamicBufferAllocator
+    {
+    public:
+      struct Statistics
+      {
+        vk::DeviceSize frameSize;      // size of the buffer of each frame
+        vk::DeviceSize used;           // bytes taken in the current frame, including the unused rest of the sub-blocks
+        vk::DeviceSize peak;           // maximum of used over all the frames so far
+        uint32_t       subBlockCount;  // number of sub-blocks and larger allocations taken in the current frame
+      };
+
+    public:
+      DynamicBufferAllocator( vk::PhysicalDevice const & physicalDevice,
+                              vk::Device const &         device,
+                              vk::DeviceSize             frameSize,
+                              uint32_t                   frameCount   = 2,
+                              vk::DeviceSize             subBlockSize = 64 * 1024,
+                              vk::BufferUsageFlags       usage        = vk::BufferUsageFlagBits::eUniformBuffer |
+                                                                        vk::BufferUsageFlagBits::eStorageBuffer );
+
+      void clear( vk::Device const & device );
+
+      // starts allocating from the buffer of frameIndex, invalidating everything allocated from it before; the GPU has
+      // to be done with the previous use of that frame
+      void beginFrame( uint32_t frameIndex );
+
+      // allocates size bytes aligned to minUniformBufferOffsetAlignment, resp. minStorageBufferOffsetAlignment
+      DynamicAllocation allocateUniform( vk::DeviceSize size )
+      {
+        return allocate( size, m_uniformAlignment );
+      }
+      DynamicAllocation allocateStorage( vk::DeviceSize size )
+      {
+        return allocate( size, m_storageAlignment );
+      }
+
+      template <typename T>
+      DynamicAllocation pushUniform( T const & data )
+      {
+        DynamicAllocation allocation = allocateUniform( sizeof( T ) );
+        memcpy( allocation.pData, &data, sizeof( T ) );
+        return allocation;
+      }
+
+      // the buffer info for the dynamic uniform or storage buffer descriptor of the descriptor set used with
+      // frameIndex, with range being the size of the data of a single draw
+      vk::DescriptorBufferInfo getDescriptorBufferInfo( uint32_t frameIndex, vk::DeviceSize range ) const
+      {
+        return vk::DescriptorBufferInfo( m_frames[frameIndex].buffer, 0, range );
+      }
+
+      Statistics getStatistics() const;
+
+    private:
+      DynamicAllocation allocate( vk::DeviceSize size, vk::DeviceSize alignment );
+      // takes size bytes from the current frame buffer, or less at its very end; returns the offset and the end
+      std::pair<vk::DeviceSize, vk::DeviceSize> takeRange( vk::DeviceSize size, vk::DeviceSize minSize );
+
+    private:
+      std::vector<BufferData>     m_frames;
+      std::vector<uint8_t *>      m_mappedFrames;
+      vk::DeviceSize              m_frameSize;
+      vk::DeviceSize              m_subBlockSize;
+      vk::DeviceSize              m_uniformAlignment;
+      vk::DeviceSize              m_storageAlignment;
+      vk::DeviceSize              m_blockAlignment;  // the larger of the two alignments, each sub-block is aligned to
+      uint32_t                    m_frameIndex;
+      uint64_t                    m_generation;  // unique over all allocators and frames, to validate thread sub-blocks
+      std::atomic<vk::DeviceSize> m_offset;      // start of the next sub-block in the current frame buffer
+      std::atomic<uint32_t>       m_subBlockCount;
+      vk::DeviceSize              m_peak;
+    };
+
+    // Records secondary command buffers on threadCount threads (the calling thread being one of them). There's one
+    // command pool per thread and per frame, holding a single secondary command buffer; the pools of a frame are reset
+    // as a whole at the beginning of each record of that frame.
+    class ParallelCommandRecorder
+    {
+    public:
+      // records the items [first, first + count) into commandBuffer, which has already been begun
+      using RecordFunction = std::function<void( vk::CommandBuffer const & commandBuffer, uint32_t first, uint32_t count )>;
+
+      ParallelCommandRecorder( vk::Device const & device,
+                               uint32_t           queueFamilyIndex,
+                               uint32_t           threadCount,
+                               uint32_t           frameCount = 2 );
+      ~ParallelCommandRecorder();
+
+      void clear( vk::Device const & device );
+
+      // resets the command pools of frameIndex, splits itemCount items evenly over the threads, records each slice into
+      // a secondary command buffer and finally executes those in slice order from primaryCommandBuffer, which needs to
+      // be inside a render pass begun with vk::SubpassContents::eSecondaryCommandBuffers.
+      // The frame must not be in use by the GPU anymore.
+      void record( vk::Device const &                       device,
+                   uint32_t                                 frameIndex,
+                   vk::CommandBuffer const &                primaryCommandBuffer,
+                   vk::CommandBufferInheritanceInfo const & inheritanceInfo,
+                   uint32_t                                 itemCount,
+                   RecordFunction const &                   recordFunction );
+
+      uint32_t threadCount() const
+      {
+        return static_cast<uint32_t>( m_workers.size() + 1 );
+      }
+
+    private:
+      void recordSlice( uint32_t threadIndex );
+      void stopWorkers();
+      void workerLoop( uint32_t threadIndex );
+
+    private:
+      std::vector<vk::CommandPool>   m_commandPools;    // frameCount x threadCount
+      std::vector<vk::CommandBuffer> m_commandBuffers;  // frameCount x threadCount
+      std::vector<std::thread>       m_workers;
+
+      std::mutex              m_mutex;
+      std::condition_variable m_startCondition;
+      std::condition_variable m_doneCondition;
+      uint64_t                m_generation;
+      uint32_t                m_pending;
+      bool                    m_quit;
+
+      // the job of the current generation, set by record
+      uint32_t                                 m_frameIndex;
+      vk::CommandBufferInheritanceInfo const * m_inheritanceInfo;
+      uint32_t                                 m_itemCount;
+      RecordFunction const *                   m_recordFunction;
+      std::vector<std::exception_ptr>          m_exceptions;
+    };
+
+    // Allocates descriptor sets out of a chain of descriptor pools. Whenever the current pool is exhausted, the next one
+    // is taken, growing the chain as needed. Sets are never freed individually, but all pools are reset at once, which
+    // makes it a natural fit for one allocator per frame in flight, reset after the frame fence has been waited on.
+    class DescriptorAllocator
+    {
+    public:
+      struct Statistics
+      {
+        uint32_t poolCount;        // number of pools currently created
+        uint32_t usedPoolCount;    // number of pools sets have been allocated from since the last reset
+        uint32_t allocatedSets;    // number of sets allocated since the last reset
+        uint32_t setCapacity;      // sum of maxSets over the used pools
+        uint32_t poolExhaustions;  // number of times a pool ran out of memory or got fragmented, since the last reset
+        float    utilization;      // allocatedSets / setCapacity
+      };
+
+    public:
+      // poolSizes gives the number of descriptors per type needed by an average set; each pool is sized for
+      // setsPerPool such sets, and each newly created pool is twice the size of the previous one, up to maxSetsPerPool
+      DescriptorAllocator( std::vector<vk::DescriptorPoolSize> const & poolSizes,
+                           uint32_t                                    setsPerPool    = 64,
+                           uint32_t                                    maxSetsPerPool = 4096 );
+
+      vk::DescriptorSet allocate( vk::Device const & device, vk::DescriptorSetLayout const & descriptorSetLayout );
+      void              reset( vk::Device const & device );
+      void              clear( vk::Device const & device );
+
+      Statistics getStatistics() const;
+
+    private:
+      vk::DescriptorPool createPool( vk::Device const & device );
+
+    private:
+      struct Pool
+      {
+        vk::DescriptorPool pool;
+        uint32_t           maxSets;
+        uint32_t           allocatedSets;
+      };
+
+      std::vector<vk::DescriptorPoolSize> m_poolSizes;
+      uint32_t                            m_setsPerPool;
+      uint32_t                            m_maxSetsPerPool;
+      std::vector<Pool>                   m_pools;      // the pools [0, m_currentPool] are in use
+      size_t                              m_currentPool;
+      uint32_t                            m_poolExhaustions;
+    };
+
+    // A very simple arena handing out contiguous arrays of T. The memory is only given back with reset, where all the
+    // blocks are kept for re-use.
+    template <typename T>
+    class Arena
+    {
+    public:
+      explicit Arena( size_t blockSize = 1024 ) : m_blockSize( blockSize ), m_block( 0 ), m_used( 0 ) {}
+
+      T * allocate( size_t count )
+      {
+        while ( ( m_block < m_blocks.size() ) && ( m_blocks[m_block].size() < m_used + count ) )
+        {
+          m_block++;
+          m_used = 0;
+        }
+        if ( m_block == m_blocks.size() )
+        {
+          // moving the blocks around on growth of m_blocks keeps the data of each block in place
+          m_blocks.push_back( std::vector<T>( ( std::max )( m_blockSize, count ) ) );
+          m_used = 0;
+        }
+        T * data = m_blocks[m_block].data() + m_used;
+        m_used += count;
+        return data;
+      }
+
+      void reset()
+      {
+        m_block = 0;
+        m_used  = 0;
+      }
+
+    private:
+      std::vector<std::vector<T>> m_blocks;
+      size_t                      m_blockSize;
+      size_t                      m_block;
+      size_t                      m_used;
+    };
+
+    // Accumulates descriptor writes for any number of descriptor sets and flushes them with one single call to
+    // vk::Device::updateDescriptorSets. The info structures are kept in arenas, such that the pointers held by the
+    // vk::WriteDescriptorSets stay valid until the flush.
+    class DescriptorWriteBatcher
+    {
+    public:
+      void writeBuffer( vk::DescriptorSet const & dstSet,
+                        uint32_t                  dstBinding,
+                        vk::DescriptorType        descriptorType,
+                        vk::Buffer const &        buffer,
+                        vk::DeviceSize            offset = 0,
+                        vk::DeviceSize            range  = VK_WHOLE_SIZE );
+      void writeImage( vk::DescriptorSet const & dstSet,
+                       uint32_t                  dstBinding,
+                       vk::DescriptorType        descriptorType,
+                       vk::Sampler const &       sampler,
+                       vk::ImageView const &     imageView,
+                       vk::ImageLayout           imageLayout = vk::ImageLayout::eShaderReadOnlyOptimal );
+      void writeImages( vk::DescriptorSet const &                             dstSet,
+                        uint32_t                                              dstBinding,
+                        vk::DescriptorType                                    descriptorType,
+                        vk::ArrayProxy<const vk::DescriptorImageInfo> const & imageInfos );
+      void writeTexelBuffer( vk::DescriptorSet const & dstSet,
+                             uint32_t                  dstBinding,
+                             vk::DescriptorType        descriptorType,
+                             vk::BufferView const &    bufferView );
+
+      // issues all the accumulated writes and resets the batcher
+      void flush( vk::Device const & device );
+
+      size_t size() const
+      {
+        return m_writeDescriptorSets.size();
+      }
+
+    private:
+      std::vector<vk::WriteDescriptorSet> m_writeDescriptorSets;
+      Arena<vk::DescriptorBufferInfo>     m_bufferInfos;
+      Arena<vk::DescriptorImageInfo>      m_imageInfos;
+      Arena<vk::BufferView>               m_bufferViews;
+    };
+
+    // A snapshot of everything that can be queried about a physical device without a surface: properties, features,
+    // memory properties, queue families, and the format properties of all core formats, gathered in one sweep. Any
+    // later query is answered from the snapshot without going through the dispatcher. A snapshot can be serialized and
+    // restored on the next run, such that a warm start needs just the vk::PhysicalDevice::getProperties to check
+    // it still describes the device.
+    class PhysicalDeviceCapabilities
+    {
+    public:
+      explicit PhysicalDeviceCapabilities( vk::PhysicalDevice const & physicalDevice );
+      // restores a snapshot from the result of serialize; throws a std::runtime_error on malformed data
+      explicit PhysicalDeviceCapabilities( std::vector<uint8_t> const & data );
+
+      std::vector<uint8_t> serialize() const;
+
+      // true, if the snapshot was taken from a device with these properties, using the same driver
+      bool describes( vk::PhysicalDeviceProperties const & physicalDeviceProperties ) const;
+
+      // the Vulkan 1.1 and 1.2 features and properties are just available on Vulkan 1.2 devices
+      bool hasVulkan12() const
+      {
+        return m_hasVulkan12;
+      }
+
+      // returns empty format properties for any format not covered by the snapshot
+      vk::FormatProperties const & getFormatProperties( vk::Format format ) const;
+
+      // returns the first of the candidates supporting all of the formatFeatures with the given tiling, or
+      // vk::Format::eUndefined if there's none
+      vk::Format findSupportedFormat( std::vector<vk::Format> const & candidates,
+                                      vk::ImageTiling                 tiling,
+                                      vk::FormatFeatureFlags          formatFeatures ) const;
+      // same as above, with all the formats covered by the snapshot as the candidates
+      vk::Format findSupportedFormat( vk::ImageTiling tiling, vk::FormatFeatureFlags formatFeatures ) const;
+
+      uint32_t findMemoryType( uint32_t typeBits, vk::MemoryPropertyFlags requirementsMask ) const;
+
+    public:
+      vk::PhysicalDeviceProperties           properties;
+      vk::PhysicalDeviceFeatures             features;
+      vk::PhysicalDeviceVulkan11Properties   vulkan11Properties;
+      vk::PhysicalDeviceVulkan11Features     vulkan11Features;
+      vk::PhysicalDeviceVulkan12Properties   vulkan12Properties;
+      vk::PhysicalDeviceVulkan12Features     vulkan12Features;
+      vk::PhysicalDeviceMemoryProperties     memoryProperties;
+      std::vector<vk::QueueFamilyProperties> queueFamilyProperties;
+
+    private:
+      bool                              m_hasVulkan12;
+      std::vector<vk::FormatProperties> m_formatProperties;  // dense table, indexed by formatIndex
+    };
+
+    // Accumulates memory, buffer and image barriers and records them with one single call to
+    // vk::CommandBuffer::pipelineBarrier, merging their stage masks, or to vk::CommandBuffer::pipelineBarrier2KHR,
+    // keeping the stage masks per barrier. As the barriers of one such call are not ordered with respect to each other,
+    // a barrier on a buffer or image that already has a pending barrier first flushes the batch.
+    class BarrierBatcher
+    {
+    public:
+      explicit BarrierBatcher( vk::CommandBuffer const & commandBuffer, bool useSynchronization2 = false );
+
+      void memoryBarrier( vk::PipelineStageFlags    srcStageMask,
+                          vk::PipelineStageFlags    dstStageMask,
+                          vk::MemoryBarrier const & barrier );
+      void bufferBarrier( vk::PipelineStageFlags          srcStageMask,
+                          vk::PipelineStageFlags          dstStageMask,
+                          vk::BufferMemoryBarrier const & barrier );
+      void imageBarrier( vk::PipelineStageFlags         srcStageMask,
+                         vk::PipelineStageFlags         dstStageMask,
+                         vk::ImageMemoryBarrier const & barrier );
+
+      // records all the accumulated barriers and resets the batcher
+      void flush();
+
+      size_t size() const
+      {
+        return m_memoryBarriers.size() + m_bufferBarriers.size() + m_imageBarriers.size();
+      }
+
+      // the number of pipeline barrier commands recorded so far
+      uint32_t getFlushCount() const
+      {
+        return m_flushCount;
+      }
+
+    private:
+      struct StageMasks
+      {
+        vk::PipelineStageFlags src;
+        vk::PipelineStageFlags dst;
+      };
+
+      vk::CommandBuffer                    m_commandBuffer;
+      bool                                 m_useSynchronization2;
+      std::vector<vk::MemoryBarrier>       m_memoryBarriers;
+      std::vector<vk::BufferMemoryBarrier> m_bufferBarriers;
+      std::vector<vk::ImageMemoryBarrier>  m_imageBarriers;
+      std::vector<StageMasks>              m_memoryStageMasks;  // the stage masks per barrier, for synchronization2
+      std::vector<StageMasks>              m_bufferStageMasks;
+      std::vector<StageMasks>              m_imageStageMasks;
+      uint32_t                             m_flushCount;
+    };
+
+    // the pipeline stages and accesses an image in the given layout is typically used with
+    std::pair<vk::PipelineStageFlags, vk::AccessFlags> getLayoutStageAndAccess( vk::ImageLayout layout );
+
+    // Tracks the layout and the last accesses of each subresource of a set of images, to derive the barriers needed for
+    // a layout transition or a change of access. Transitions that need no barrier, like a repeated read in the same
+    // layout, are dropped. The tracked state is the state at the end of the command buffers recorded so far, so one
+    // tracker should be used per sequence of submissions to one queue.
+    class ImageStateTracker
+    {
+    public:
+      void addImage( vk::Image const &    image,
+                     vk::ImageAspectFlags aspectMask,
+                     uint32_t             mipLevels,
+                     uint32_t             arrayLayers,
+                     vk::ImageLayout      initialLayout = vk::ImageLayout::eUndefined );
+      void removeImage( vk::Image const & image );
+
+      vk::ImageLayout getLayout( vk::Image const & image, uint32_t mipLevel = 0, uint32_t arrayLayer = 0 ) const;
+
+      // adds the barriers needed to move the subresources in range into newLayout, to be used by the given stages
+      // and accesses; a range with levelCount or layerCount of VK_REMAINING_MIP_LEVELS / VK_REMAINING_ARRAY_LAYERS
+      // extends to the end of the image. The state is tracked per mip level and array layer, not per aspect, so the
+      // barriers always cover the aspectMask given on addImage.
+      void transition( BarrierBatcher &                  batcher,
+                       vk::Image const &                 image,
+                       vk::ImageLayout                   newLayout,
+                       vk::PipelineStageFlags            dstStageMask,
+                       vk::AccessFlags                   dstAccessMask,
+                       vk::ImageSubresourceRange const & range );
+      // same as above, on the whole image, with the stages and accesses from getLayoutStageAndAccess
+      void transition( BarrierBatcher & batcher, vk::Image const & image, vk::ImageLayout newLayout );
+
+      // the number of transitions per subresource dropped so far, as no barrier was needed
+      size_t getDroppedCount() const
+      {
+        return m_droppedCount;
+      }
+
+    private:
+      struct SubresourceState
+      {
+        vk::ImageLayout        layout;
+        vk::PipelineStageFlags stageMask;
+        vk::AccessFlags        accessMask;
+      };
+
+      struct ImageState
+      {
+        vk::ImageAspectFlags          aspectMask;
+        uint32_t                      mipLevels;
+        uint32_t                      arrayLayers;
+        std::vector<SubresourceState> subresources;  // indexed by mipLevel * arrayLayers + arrayLayer
+      };
+
+      std::map<VkImage, ImageState> m_images;
+      size_t                        m_droppedCount = 0;
+    };
+
+    // The queue families to use for graphics, present, transfers and compute. Transfers and compute are put on
+    // dedicated families, if available, such that uploads and compute work don't serialize with the graphics work.
+    // Without such families, they fall back to the graphics family.
+    struct QueueTopology
+    {
+      bool hasDedicatedTransfer() const
+      {
+        return transferQueueFamilyIndex != graphicsQueueFamilyIndex;
+      }
+
+      bool hasAsyncCompute() const
+      {
+        return computeQueueFamilyIndex != graphicsQueueFamilyIndex;
+      }
+
+      // one vk::DeviceQueueCreateInfo per distinct family, each with one queue
+      std::vector<vk::DeviceQueueCreateInfo> getQueueCreateInfos() const;
+
+      uint32_t graphicsQueueFamilyIndex;
+      uint32_t presentQueueFamilyIndex;
+      uint32_t transferQueueFamilyIndex;
+      uint32_t computeQueueFamilyIndex;
+    };
+
+    // transfers prefer a transfer-only family that copies images at texel granularity over a compute family without
+    // graphics; compute prefers a compute family without graphics; the present family is set to the graphics family
+    QueueTopology selectQueueTopology( std::vector<vk::QueueFamilyProperties> const & queueFamilyProperties );
+    // same as above, with graphics and present families from findGraphicsAndPresentQueueFamilyIndex
+    QueueTopology selectQueueTopology( vk::PhysicalDevice const & physicalDevice, vk::SurfaceKHR const & surface );
+
+    // The parameters of a queue family ownership transfer of a buffer range. The release barrier is recorded on the
+    // source queue, the matching acquire barrier on the destination queue, after waiting on a semaphore signaled by the
+    // submission holding the release barrier.
+    struct BufferOwnershipTransfer
+    {
+      vk::Buffer             buffer;
+      vk::DeviceSize         offset;
+      vk::DeviceSize         size;
+      uint32_t               srcQueueFamilyIndex;
+      uint32_t               dstQueueFamilyIndex;
+      vk::PipelineStageFlags srcStageMask;
+      vk::AccessFlags        srcAccessMask;
+      vk::PipelineStageFlags dstStageMask;
+      vk::AccessFlags        dstAccessMask;
+    };
+
+    // same as above for an image subresource range; a layout transition is done once, by the pair of barriers
+    struct ImageOwnershipTransfer
+    {
+      vk::Image                 image;
+      vk::ImageSubresourceRange subresourceRange;
+      vk::ImageLayout           oldLayout;
+      vk::ImageLayout           newLayout;
+      uint32_t                  srcQueueFamilyIndex;
+      uint32_t                  dstQueueFamilyIndex;
+      vk::PipelineStageFlags    srcStageMask;
+      vk::AccessFlags           srcAccessMask;
+      vk::PipelineStageFlags    dstStageMask;
+      vk::AccessFlags           dstAccessMask;
+    };
+
+    // Records the release and the acquire half of an ownership transfer. The acquire barrier waits on the
+    // dstStageMask, so the semaphore wait on the destination queue has to include that stage. With identical source
+    // and destination families, there's no ownership to transfer: the release records one ordinary barrier, and the
+    // acquire records nothing.
+    void releaseOwnership( vk::CommandBuffer const & commandBuffer, BufferOwnershipTransfer const & transfer );
+    void acquireOwnership( vk::CommandBuffer const & commandBuffer, BufferOwnershipTransfer const & transfer );
+    void releaseOwnership( vk::CommandBuffer const & commandBuffer, ImageOwnershipTransfer const & transfer );
+    void acquireOwnership( vk::CommandBuffer const & commandBuffer, ImageOwnershipTransfer const & transfer );
+
+    // Records copies into a command buffer for the transfer queue of a QueueTopology, and hands the results over to
+    // the graphics queue. The copies of one submit are followed by release barriers, and the command buffer is
+    // submitted to the transfer queue, signaling a semaphore. The acquire barriers are recorded into the given graphics
+    // command buffer, whose submission has to wait on that semaphore.
+    // The submissions cycle through slotCount slots, each with its own command pool, fence, and semaphore. A slot is
+    // reused after waiting on its fence, which does not cover the graphics submission waiting on its semaphore. With at
+    // most one submit per frame, slotCount has to be larger than the number of frames in flight, such that that
+    // graphics submission is known to be finished as well.
+    // The semaphores are binary, and each submit to the transfer queue signals the one of its slot, which must not be
+    // signaled again before it has been waited on. So every semaphore returned by submit has to be consumed, by
+    // submitting graphicsCommandBuffer with a wait on it, before the same slot is submitted again. The acquire barriers
+    // in graphicsCommandBuffer need that wait anyway, so a graphicsCommandBuffer that is dropped instead of submitted
+    // breaks both.
+    class TransferScheduler
+    {
+    public:
+      TransferScheduler( vk::Device const & device, QueueTopology const & topology, uint32_t slotCount = 3 );
+
+      void clear( vk::Device const & device );
+
+      // copies to a buffer that is used on the graphics queue with the given stages and accesses afterwards
+      void copyBuffer( vk::Device const &                           device,
+                       vk::Buffer const &                           srcBuffer,
+                       vk::Buffer const &                           dstBuffer,
+                       vk::ArrayProxy<const vk::BufferCopy> const & regions,
+                       vk::PipelineStageFlags                       dstStageMask,
+                       vk::AccessFlags                              dstAccessMask );
+      // copies to the subresourceRange of an image, discarding its previous content, and leaves it in finalLayout
+      void copyBufferToImage( vk::Device const &                                device,
+                              vk::Buffer const &                                srcBuffer,
+                              vk::Image const &                                 dstImage,
+                              vk::ImageSubresourceRange const &                 subresourceRange,
+                              vk::ArrayProxy<const vk::BufferImageCopy> const & regions,
+                              vk::ImageLayout                                   finalLayout,
+                              vk::PipelineStageFlags                            dstStageMask,
+                              vk::AccessFlags                                   dstAccessMask );
+
+      // submits the copies recorded since the last submit and records the acquire barriers into graphicsCommandBuffer;
+      // returns the semaphore and the stages the graphics submission has to wait on, or a null semaphore if there was
+      // nothing to submit; a semaphore returned must be waited on, see above
+      std::pair<vk::Semaphore, vk::PipelineStageFlags> submit( vk::CommandBuffer const & graphicsCommandBuffer );
+
+      bool isRecording() const
+      {
+        return m_recording;
+      }
+
+    private:
+      struct Slot
+      {
+        vk::CommandPool   commandPool;
+        vk::CommandBuffer commandBuffer;
+        vk::Fence         fence;
+        vk::Semaphore     semaphore;
+      };
+
+      vk::CommandBuffer const & beginRecording( vk::Device const & device );
+
+      QueueTopology                        m_topology;
+      vk::Queue                            m_transferQueue;
+      std::vector<Slot>                    m_slots;
+      uint32_t                             m_slotIndex;
+      bool                                 m_recording;
+      std::vector<BufferOwnershipTransfer> m_bufferTransfers;  // the transfers of the copies recorded so far
+      std::vector<ImageOwnershipTransfer>  m_imageTransfers;
+    };
+
+    // A hash map from keys made of 64 bit words to handles, the building block of RenderPassCache and FramebufferCache.
+    // Lookups are lock-free, as entries are only added and unlinked under a mutex, and the entries unlinked are kept
+    // until collect, as a concurrent lookup might still walk over them. Each entry remembers the last frame it was
+    // found in, for the least recently used ones to be evicted. A lookup and an eviction of the same entry race for its
+    // last used frame with a compare-exchange: either the lookup marks it as used and it stays, or it's evicted and the
+    // lookup misses, so a handle that has just been found is never handed back for destruction.
+    class HandleCache
+    {
+    public:
+      struct Statistics
+      {
+        size_t size;    // number of entries currently cached
+        size_t hits;    // number of lookups that found their entry
+        size_t misses;  // number of lookups that didn't
+      };
+
+    public:
+      explicit HandleCache( size_t bucketCount = 256 );
+      ~HandleCache();
+
+      // the handle cached for key, or 0
+      uint64_t find( std::vector<uint64_t> const & key ) const;
+      // caches handle for key, unless a concurrent insert was first; returns the handle that ends up in the cache
+      uint64_t insert( std::vector<uint64_t> const & key, uint64_t handle );
+      // unlinks all the entries the predicate holds for, and returns their handles for the caller to destroy them
+      std::vector<uint64_t>
+        remove( std::function<bool( std::vector<uint64_t> const & key, uint64_t lastUsedFrame )> const & predicate );
+      // unlinks the least recently used entries, last used up to completedFrame, until at most maxSize are left;
+      // completedFrame has to be older than the frame set by setFrame
+      std::vector<uint64_t> trim( size_t maxSize, uint64_t completedFrame );
+      // frees the entries unlinked so far; no other thread may be in find meanwhile
+      void collect();
+
+      // the frame the handles found from now on are used in
+      void setFrame( uint64_t frame );
+
+      Statistics getStatistics() const;
+
+    private:
+      struct Entry
+      {
+        std::vector<uint64_t> key;
+        size_t                hash;
+        uint64_t              handle;
+        std::atomic<uint64_t> lastUsedFrame;
+        std::atomic<Entry *>  next;
+      };
+
+      // the last used frame of an entry claimed by remove, which find treats as a miss
+      static const uint64_t EvictedFrame = ~0ull;
+
+      size_t getBucketIndex( size_t hash ) const
+      {
+        return hash & ( m_buckets.size() - 1 );
+      }
+
+    private:
+      std::vector<std::atomic<Entry *>>   m_buckets;
+      std::vector<std::unique_ptr<Entry>> m_unlinkedEntries;
+      mutable std::mutex                  m_mutex;  // guards all changes of the buckets
+      size_t                              m_size;
+      std::atomic<uint64_t>               m_frame;
+      mutable std::atomic<size_t>         m_hits;
+      mutable std::atomic<size_t>         m_misses;
+    };
+
+    // Hands out one render pass per distinct description, instead of creating a new one on each call as
+    // createRenderPass does. Lookups are lock-free, so one cache can be shared by all the threads recording command
+    // buffers. The render passes are destroyed by clear.
+    class RenderPassCache
+    {
+    public:
+      explicit RenderPassCache( size_t bucketCount = 64 );
+
+      // the create info is keyed by its attachments, subpasses and dependencies; it must not have a pNext chain
+      vk::RenderPass get( vk::Device const & device, vk::RenderPassCreateInfo const & createInfo );
+      // the render pass createRenderPass creates for these arguments
+      vk::RenderPass get( vk::Device const &   device,
+                          vk::Format           colorFormat,
+                          vk::Format           depthFormat,
+                          vk::AttachmentLoadOp loadOp           = vk::AttachmentLoadOp::eClear,
+                          vk::ImageLayout      colorFinalLayout = vk::ImageLayout::ePresentSrcKHR );
+      // destroys all the render passes; no other thread may use the cache meanwhile
+      void clear( vk::Device const & device );
+
+      HandleCache::Statistics getStatistics() const
+      {
+        return m_cache.getStatistics();
+      }
+
+    private:
+      HandleCache m_cache;
+    };
+
+    // Hands out one framebuffer per render pass, set of attachments and extent, instead of creating them anew as
+    // createFramebuffers does. Lookups are lock-free. Before an image view is destroyed, e.g. on swapchain recreation,
+    // removeImageView destroys the framebuffers using it; trim evicts the framebuffers least recently used, with
+    // setFrame marking the frame the framebuffers handed out are used in. The memory of the entries removed is only
+    // given back by collect, to be called while no other thread uses the cache.
+    class FramebufferCache
+    {
+    public:
+      explicit FramebufferCache( size_t bucketCount = 256 );
+
+      vk::Framebuffer get( vk::Device const &                          device,
+                           vk::RenderPass const &                      renderPass,
+                           vk::ArrayProxy<const vk::ImageView> const & attachments,
+                           vk::Extent2D const &                        extent,
+                           uint32_t                                    layers = 1 );
+
+      // destroys the framebuffers using imageView; the GPU has to be done with them, and no other thread may get a
+      // framebuffer with imageView meanwhile
+      void removeImageView( vk::Device const & device, vk::ImageView const & imageView );
+      // destroys the least recently used framebuffers not used after completedFrame, until at most maxSize are left;
+      // returns the number of framebuffers destroyed. It may run concurrently with get: a framebuffer found by get is
+      // marked as used in the current frame, which has to be newer than completedFrame, and is not destroyed.
+      size_t trim( vk::Device const & device, size_t maxSize, uint64_t completedFrame );
+      void   collect()
+      {
+        m_cache.collect();
+      }
+      // destroys all the framebuffers; no other thread may use the cache meanwhile
+      void clear( vk::Device const & device );
+
+      void setFrame( uint64_t frame )
+      {
+        m_cache.setFrame( frame );
+      }
+
+      HandleCache::Statistics getStatistics() const
+      {
+        return m_cache.getStatistics();
+      }
+
+    private:
+      HandleCache m_cache;
+    };
+
+    enum class ColorConversion
+    {
+      eNone,
+      eSrgbToLinear,
+      eLinearToSrgb
+    };
+
+    // Pixel kernels used by the image generators below, vectorized with AVX2 / SSE2 / SSSE3 where available at compile
+    // time, with a scalar fallback. Pixels are four bytes, in R, G, B, A order in memory.
+    void fillPixels( uint32_t * pixels, uint32_t value, size_t count );
+    // expands three channel pixels to four channels with an alpha of 255, optionally converting the color channels
+    void convertRGBToRGBA( uint8_t *       rgba,
+                           uint8_t const * rgb,
+                           size_t          pixelCount,
+                           ColorConversion colorConversion = ColorConversion::eNone );
+    // copies four channel pixels, optionally converting the color channels
+    void convertRGBAToRGBA( uint8_t *       dst,
+                            uint8_t const * src,
+                            size_t          pixelCount,
+                            ColorConversion colorConversion = ColorConversion::eNone );
+    // calls rowFunction( firstRow, rowCount ) for consecutive ranges of rows covering extent.height, spread over a
+    // number of threads if extent.height * rowPitch is large enough to make that worthwhile
+    void forEachRowRange( vk::Extent2D const &                                                extent,
+                          vk::DeviceSize                                                      rowPitch,
+                          std::function<void( uint32_t firstRow, uint32_t rowCount )> const & rowFunction );
+
+    // The image generators write four channel pixels to data, with rows rowPitch bytes apart. That's typically directly
+    // into mapped staging memory or the mapped memory of a linearly tiled image, so they only ever write to data.
     class CheckerboardImageGenerator
     {
     public:
       CheckerboardImageGenerator( std::array<uint8_t, 3> const & rgb0 = { { 0, 0, 0 } },
                                   std::array<uint8_t, 3> const & rgb1 = { { 255, 255, 255 } } );
 
-      void operator()( void * data, vk::Extent2D & extent ) const;
+      void operator()( void * data, vk::Extent2D const & extent, vk::DeviceSize rowPitch ) const;
 
     private:
-      std::array<uint8_t, 3> const & m_rgb0;
-      std::array<uint8_t, 3> const & m_rgb1;
+      std::array<uint8_t, 3> m_rgb0;
+      std::array<uint8_t, 3> m_rgb1;
     };
 
     class MonochromeImageGenerator
@@ -270,23 +1101,28 @@ namespace vk
     public:
       MonochromeImageGenerator( std::array<unsigned char, 3> const & rgb );
 
-      void operator()( void * data, vk::Extent2D const & extent ) const;
+      void operator()( void * data, vk::Extent2D const & extent, vk::DeviceSize rowPitch ) const;
 
     private:
-      std::array<unsigned char, 3> const & m_rgb;
+      std::array<unsigned char, 3> m_rgb;
     };
 
     class PixelsImageGenerator
     {
     public:
-      PixelsImageGenerator( vk::Extent2D const & extent, size_t channels, unsigned char const * pixels );
+      // channels might be 3 or 4; the pixels are expected to be tightly packed
+      PixelsImageGenerator( vk::Extent2D const &  extent,
+                            size_t                channels,
+                            unsigned char const * pixels,
+                            ColorConversion       colorConversion = ColorConversion::eNone );
 
-      void operator()( void * data, vk::Extent2D const & extent ) const;
+      void operator()( void * data, vk::Extent2D const & extent, vk::DeviceSize rowPitch ) const;
 
     private:
       vk::Extent2D          m_extent;
       size_t                m_channels;
       unsigned char const * m_pixels;
+      ColorConversion       m_colorConversion;
     };
 
     struct TextureData
@@ -314,13 +1150,25 @@ namespace vk
                      vk::CommandBuffer const & commandBuffer,
                      ImageGenerator const &    imageGenerator )
       {
-        void * data = needsStaging
-                        ? device.mapMemory( stagingBufferData->deviceMemory,
-                                            0,
-                                            device.getBufferMemoryRequirements( stagingBufferData->buffer ).size )
-                        : device.mapMemory(
-                            imageData->deviceMemory, 0, device.getImageMemoryRequirements( imageData->image ).size );
-        imageGenerator( data, extent );
+        void *         data;
+        vk::DeviceSize rowPitch;
+        if ( needsStaging )
+        {
+          // the staging buffer is tightly packed, matching the copyBufferToImage below
+          data     = device.mapMemory( stagingBufferData->deviceMemory,
+                                   0,
+                                   device.getBufferMemoryRequirements( stagingBufferData->buffer ).size );
+          rowPitch = vk::su::getPackedRowPitch( format, extent.width );
+        }
+        else
+        {
+          // a linearly tiled image might have some padding at the end of each row
+          vk::SubresourceLayout subresourceLayout = device.getImageSubresourceLayout(
+            imageData->image, vk::ImageSubresource( vk::ImageAspectFlagBits::eColor, 0, 0 ) );
+          data     = device.mapMemory( imageData->deviceMemory, subresourceLayout.offset, subresourceLayout.size );
+          rowPitch = subresourceLayout.rowPitch;
+        }
+        imageGenerator( data, extent, rowPitch );
         device.unmapMemory( needsStaging ? stagingBufferData->deviceMemory : imageData->deviceMemory );
 
         if ( needsStaging )
@@ -455,6 +1303,10 @@ namespace vk
     );
     std::vector<std::string>             getDeviceExtensions();
     std::vector<std::string>             getInstanceExtensions();
+    // the sizes of a tightly packed row of texel blocks, and of a tightly packed image, as copied from a buffer; the
+    // width and height are rounded up to whole texel blocks of format
+    vk::DeviceSize                       getPackedImageSize( vk::Format format, vk::Extent2D const & extent );
+    vk::DeviceSize                       getPackedRowPitch( vk::Format format, uint32_t width );
     vk::DebugUtilsMessengerCreateInfoEXT makeDebugUtilsMessengerCreateInfoEXT();
 #if defined( NDEBUG )
     vk::StructureChain<vk::InstanceCreateInfo>
@@ -465,8 +1317,11 @@ namespace vk
                                                       std::vector<char const *> const & layers,
                                                       std::vector<char const *> const & extensions );
     vk::Format           pickDepthFormat( vk::PhysicalDevice const & physicalDevice );
+    vk::Format           pickDepthFormat( PhysicalDeviceCapabilities const & capabilities );
     vk::PresentModeKHR   pickPresentMode( std::vector<vk::PresentModeKHR> const & presentModes );
     vk::SurfaceFormatKHR pickSurfaceFormat( std::vector<vk::SurfaceFormatKHR> const & formats );
+    // for one-time submissions, like an upload or the single frame of a sample, that have to be complete before
+    // anything is destroyed; a render loop paces its frames with FramesInFlight instead
     void submitAndWait( vk::Device const & device, vk::Queue const & queue, vk::CommandBuffer const & commandBuffer );
     void updateDescriptorSets(
       vk::Device const &                                                                              device,
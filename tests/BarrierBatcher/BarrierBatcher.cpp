@@ -0,0 +1,265 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : BarrierBatcher
+//                   Checks vk::su::BarrierBatcher and vk::su::ImageStateTracker against a stubbed dispatcher, and
+//                   counts the barrier commands recorded on a synthetic texture upload
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace stub
+{
+  struct Barrier
+  {
+    VkImage                  image;
+    VkImageLayout            oldLayout;
+    VkImageLayout            newLayout;
+    VkImageSubresourceRange  range;
+    VkPipelineStageFlags2KHR srcStageMask;  // just set with synchronization2
+  };
+
+  uint32_t             pipelineBarrierCount = 0;
+  std::vector<Barrier> lastBarriers;
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier( VkCommandBuffer,
+                                                   VkPipelineStageFlags srcStageMask,
+                                                   VkPipelineStageFlags dstStageMask,
+                                                   VkDependencyFlags,
+                                                   uint32_t,
+                                                   const VkMemoryBarrier *,
+                                                   uint32_t,
+                                                   const VkBufferMemoryBarrier *,
+                                                   uint32_t                     imageMemoryBarrierCount,
+                                                   const VkImageMemoryBarrier * pImageMemoryBarriers )
+  {
+    assert( srcStageMask && dstStageMask );
+    (void)srcStageMask;
+    (void)dstStageMask;
+    pipelineBarrierCount++;
+    lastBarriers.clear();
+    for ( uint32_t i = 0; i < imageMemoryBarrierCount; i++ )
+    {
+      VkImageMemoryBarrier const & imb = pImageMemoryBarriers[i];
+      lastBarriers.push_back( { imb.image, imb.oldLayout, imb.newLayout, imb.subresourceRange, 0 } );
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier2KHR( VkCommandBuffer, const VkDependencyInfoKHR * pDependencyInfo )
+  {
+    pipelineBarrierCount++;
+    lastBarriers.clear();
+    for ( uint32_t i = 0; i < pDependencyInfo->imageMemoryBarrierCount; i++ )
+    {
+      VkImageMemoryBarrier2KHR const & imb = pDependencyInfo->pImageMemoryBarriers[i];
+      lastBarriers.push_back( { imb.image, imb.oldLayout, imb.newLayout, imb.subresourceRange, imb.srcStageMask } );
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage(
+    VkCommandBuffer, VkBuffer, VkImage, VkImageLayout dstImageLayout, uint32_t, const VkBufferImageCopy * )
+  {
+    assert( dstImageLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL );
+    (void)dstImageLayout;
+  }
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCmdPipelineBarrier )
+    STUB_PROC_ADDR( vkCmdPipelineBarrier2KHR )
+    STUB_PROC_ADDR( vkCmdCopyBufferToImage )
+    return nullptr;
+  }
+}  // namespace stub
+
+vk::Image makeImage( size_t i )
+{
+  return vk::Image( (VkImage)( i + 1 ) );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyDevice, dummyCommandBuffer;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::CommandBuffer commandBuffer( reinterpret_cast<VkCommandBuffer>( &dummyCommandBuffer ) );
+    vk::Buffer        stagingBuffer( (VkBuffer)1 );
+
+    // the synthetic workload: upload all the mip levels of a couple of textures, and make them available for sampling
+    const size_t   textureCount = 512;
+    const uint32_t mipLevels    = 10;
+    auto           upload       = [&]( vk::Image const & image ) {
+      std::vector<vk::BufferImageCopy> regions;
+      for ( uint32_t level = 0; level < mipLevels; level++ )
+      {
+        regions.push_back( vk::BufferImageCopy(
+          0, 0, 0, vk::ImageSubresourceLayers( vk::ImageAspectFlagBits::eColor, level, 0, 1 ), {}, { 1, 1, 1 } ) );
+      }
+      commandBuffer.copyBufferToImage( stagingBuffer, image, vk::ImageLayout::eTransferDstOptimal, regions );
+    };
+
+    // one barrier command per transition, as issued by setImageLayout
+    stub::pipelineBarrierCount = 0;
+    auto start                 = std::chrono::high_resolution_clock::now();
+    for ( size_t i = 0; i < textureCount; i++ )
+    {
+      vk::su::setImageLayout( commandBuffer,
+                              makeImage( i ),
+                              vk::Format::eR8G8B8A8Unorm,
+                              vk::ImageLayout::eUndefined,
+                              vk::ImageLayout::eTransferDstOptimal );
+      upload( makeImage( i ) );
+      vk::su::setImageLayout( commandBuffer,
+                              makeImage( i ),
+                              vk::Format::eR8G8B8A8Unorm,
+                              vk::ImageLayout::eTransferDstOptimal,
+                              vk::ImageLayout::eShaderReadOnlyOptimal );
+    }
+    std::chrono::duration<double, std::micro> unbatchedDuration = std::chrono::high_resolution_clock::now() - start;
+    uint32_t                                  unbatchedCount    = stub::pipelineBarrierCount;
+    assert( unbatchedCount == 2 * textureCount );
+
+    // the same with a batcher and a tracker: one barrier command before and one after all the copies
+    vk::su::ImageStateTracker tracker;
+    for ( size_t i = 0; i < textureCount; i++ )
+    {
+      tracker.addImage( makeImage( i ), vk::ImageAspectFlagBits::eColor, mipLevels, 1 );
+    }
+    stub::pipelineBarrierCount = 0;
+    start                      = std::chrono::high_resolution_clock::now();
+    {
+      vk::su::BarrierBatcher batcher( commandBuffer );
+      for ( size_t i = 0; i < textureCount; i++ )
+      {
+        tracker.transition( batcher, makeImage( i ), vk::ImageLayout::eTransferDstOptimal );
+      }
+      batcher.flush();
+      for ( size_t i = 0; i < textureCount; i++ )
+      {
+        upload( makeImage( i ) );
+      }
+      for ( size_t i = 0; i < textureCount; i++ )
+      {
+        tracker.transition( batcher, makeImage( i ), vk::ImageLayout::eShaderReadOnlyOptimal );
+      }
+      batcher.flush();
+      assert( batcher.getFlushCount() == 2 );
+    }
+    std::chrono::duration<double, std::micro> batchedDuration = std::chrono::high_resolution_clock::now() - start;
+    assert( stub::pipelineBarrierCount == 2 );
+    // all the mip levels of an image are merged into one barrier
+    assert( stub::lastBarriers.size() == textureCount );
+    assert( ( stub::lastBarriers[0].range.baseMipLevel == 0 ) &&
+            ( stub::lastBarriers[0].range.levelCount == mipLevels ) );
+    assert( ( stub::lastBarriers[0].oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ) &&
+            ( stub::lastBarriers[0].newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ) );
+
+    std::cout << "BarrierBatcher: " << textureCount << " textures uploaded with " << unbatchedCount
+              << " barrier commands in " << unbatchedDuration.count() << " us unbatched, and with "
+              << stub::pipelineBarrierCount << " barrier commands in " << batchedDuration.count() << " us batched"
+              << std::endl;
+
+    // sampling again is a read after read in the same layout, which needs no barrier at all
+    {
+      stub::pipelineBarrierCount = 0;
+      size_t                 droppedCount = tracker.getDroppedCount();
+      vk::su::BarrierBatcher batcher( commandBuffer );
+      for ( size_t i = 0; i < textureCount; i++ )
+      {
+        tracker.transition( batcher, makeImage( i ), vk::ImageLayout::eShaderReadOnlyOptimal );
+      }
+      assert( batcher.size() == 0 );
+      batcher.flush();
+      assert( stub::pipelineBarrierCount == 0 );
+      assert( tracker.getDroppedCount() == droppedCount + textureCount * mipLevels );
+      (void)droppedCount;
+    }
+
+    // a mip chain generation: each level is read as the source for the next one, the subresources are tracked
+    // individually, and two transitions on the same image in one batch are flushed separately
+    {
+      vk::Image image = makeImage( textureCount );
+      tracker.addImage( image, vk::ImageAspectFlagBits::eColor, mipLevels, 6 );
+      vk::su::BarrierBatcher batcher( commandBuffer );
+      tracker.transition( batcher, image, vk::ImageLayout::eTransferDstOptimal );
+      for ( uint32_t level = 0; level + 1 < mipLevels; level++ )
+      {
+        tracker.transition( batcher,
+                            image,
+                            vk::ImageLayout::eTransferSrcOptimal,
+                            vk::PipelineStageFlagBits::eTransfer,
+                            vk::AccessFlagBits::eTransferRead,
+                            vk::ImageSubresourceRange( vk::ImageAspectFlagBits::eColor, level, 1, 0, 6 ) );
+        // here would be the blit from level to level + 1
+      }
+      assert( batcher.getFlushCount() == 1 );
+      batcher.flush();
+      assert( stub::lastBarriers.size() == mipLevels - 1 );
+      assert( ( stub::lastBarriers.back().range.baseMipLevel == mipLevels - 2 ) &&
+              ( stub::lastBarriers.back().range.layerCount == 6 ) );
+      assert( tracker.getLayout( image, 0, 3 ) == vk::ImageLayout::eTransferSrcOptimal );
+      assert( tracker.getLayout( image, mipLevels - 1, 3 ) == vk::ImageLayout::eTransferDstOptimal );
+
+      // the whole image to shader read: two runs of differently laid out subresources
+      tracker.transition( batcher, image, vk::ImageLayout::eShaderReadOnlyOptimal );
+      batcher.flush();
+      assert( stub::lastBarriers.size() == 2 );
+      assert( ( stub::lastBarriers[0].oldLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL ) &&
+              ( stub::lastBarriers[0].range.levelCount == mipLevels - 1 ) );
+      assert( ( stub::lastBarriers[1].oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ) &&
+              ( stub::lastBarriers[1].range.baseMipLevel == mipLevels - 1 ) );
+      tracker.removeImage( image );
+    }
+
+    // with synchronization2, each barrier keeps its own stage masks
+    {
+      vk::Image image0           = makeImage( 0 );
+      vk::Image image1           = makeImage( 1 );
+      stub::pipelineBarrierCount = 0;
+      vk::su::BarrierBatcher batcher( commandBuffer, true );
+      tracker.transition( batcher, image0, vk::ImageLayout::eColorAttachmentOptimal );
+      tracker.transition( batcher, image1, vk::ImageLayout::eTransferSrcOptimal );
+      batcher.flush();
+      assert( stub::pipelineBarrierCount == 1 );
+      assert( stub::lastBarriers.size() == 2 );
+      assert( stub::lastBarriers[0].srcStageMask == VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR );
+      assert( stub::lastBarriers[1].newLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL );
+    }
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,268 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : DeferredDestruction
+//                   Stress tests vk::raii::su::DeferredDestructionQueue against a stubbed dispatcher that checks that
+//                   no handle is destroyed before the GPU timeline passed the point it was retired at
+
+#include "../../RAII_Samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+namespace stub
+{
+  // each handle encodes the frame it is retired at in its upper bits, and the stub destroy functions check that the
+  // GPU has completed that frame
+  const int             tagShift = 20;
+  uint64_t              currentTag;
+  uint64_t              handleCounter;
+  std::atomic<uint64_t> gpuCompleted( 0 );
+  std::atomic<uint64_t> createdCount( 0 );
+  std::atomic<uint64_t> destroyedCount( 0 );
+  std::atomic<uint64_t> prematureCount( 0 );
+  std::atomic<uint64_t> freedOffMainThreadCount( 0 );
+  std::thread::id       mainThreadId;
+  uint64_t              semaphoreValue = 0;
+
+  uint64_t nextHandle()
+  {
+    createdCount++;
+    return ( currentTag << tagShift ) | ( ++handleCounter & ( ( 1 << tagShift ) - 1 ) );
+  }
+
+  void destroyHandle( uint64_t handle )
+  {
+    if ( gpuCompleted < ( handle >> tagShift ) )
+    {
+      prematureCount++;
+    }
+    destroyedCount++;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer( VkDevice,
+                                                 const VkBufferCreateInfo *,
+                                                 const VkAllocationCallbacks *,
+                                                 VkBuffer * pBuffer )
+  {
+    *pBuffer = (VkBuffer)nextHandle();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer( VkDevice, VkBuffer buffer, const VkAllocationCallbacks * )
+  {
+    destroyHandle( (uint64_t)buffer );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage( VkDevice,
+                                                const VkImageCreateInfo *,
+                                                const VkAllocationCallbacks *,
+                                                VkImage * pImage )
+  {
+    *pImage = (VkImage)nextHandle();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyImage( VkDevice, VkImage image, const VkAllocationCallbacks * )
+  {
+    destroyHandle( (uint64_t)image );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers( VkDevice,
+                                                           const VkCommandBufferAllocateInfo * pAllocateInfo,
+                                                           VkCommandBuffer *                   pCommandBuffers )
+  {
+    for ( uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++ )
+    {
+      pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>( static_cast<uintptr_t>( nextHandle() ) );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice,
+                                                   VkCommandPool,
+                                                   uint32_t                commandBufferCount,
+                                                   const VkCommandBuffer * pCommandBuffers )
+  {
+    // freeing command buffers needs the pool to be externally synchronized
+    if ( std::this_thread::get_id() != mainThreadId )
+    {
+      freedOffMainThreadCount++;
+    }
+    for ( uint32_t i = 0; i < commandBufferCount; i++ )
+    {
+      destroyHandle( reinterpret_cast<uintptr_t>( pCommandBuffers[i] ) );
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetSemaphoreCounterValue( VkDevice, VkSemaphore, uint64_t * pValue )
+  {
+    *pValue = semaphoreValue;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore( VkDevice, VkSemaphore, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCreateBuffer )
+    STUB_PROC_ADDR( vkDestroyBuffer )
+    STUB_PROC_ADDR( vkCreateImage )
+    STUB_PROC_ADDR( vkDestroyImage )
+    STUB_PROC_ADDR( vkAllocateCommandBuffers )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkGetSemaphoreCounterValue )
+    STUB_PROC_ADDR( vkDestroySemaphore )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+// the frame loop of a renderer with framesInFlight frames in flight, that replaces a couple of resources per frame
+double runFrames( vk::raii::Device const & device, bool useBackgroundThread, uint64_t frameCount )
+{
+  const uint64_t framesInFlight  = 3;
+  const uint32_t buffersPerFrame = 64;
+  const uint32_t imagesPerFrame  = 16;
+
+  uint64_t createdBefore   = stub::createdCount;
+  uint64_t destroyedBefore = stub::destroyedCount;
+  stub::gpuCompleted       = 0;
+
+  auto start = std::chrono::high_resolution_clock::now();
+  {
+    vk::raii::su::DeferredDestructionQueue deferredDestructionQueue( useBackgroundThread );
+    for ( uint64_t frame = 1; frame <= frameCount; frame++ )
+    {
+      // the fence of the frame framesInFlight frames back has been waited on
+      if ( framesInFlight < frame )
+      {
+        stub::gpuCompleted = frame - framesInFlight;
+        deferredDestructionQueue.collect( stub::gpuCompleted );
+      }
+
+      stub::currentTag = frame;
+      for ( uint32_t i = 0; i < buffersPerFrame; i++ )
+      {
+        deferredDestructionQueue.retire( vk::raii::Buffer( device, vk::BufferCreateInfo( {}, 256 ) ), frame );
+      }
+      for ( uint32_t i = 0; i < imagesPerFrame; i++ )
+      {
+        deferredDestructionQueue.retire(
+          vk::raii::su::make_unique<vk::raii::Image>( device, vk::ImageCreateInfo() ), frame );
+      }
+      deferredDestructionQueue.retire(
+        vk::raii::CommandBuffers( device, vk::CommandBufferAllocateInfo( {}, vk::CommandBufferLevel::ePrimary, 4 ) ),
+        frame );
+
+      // at most the frames in flight are kept alive, plus the batches on their way through the background thread
+      assert( useBackgroundThread ||
+              ( deferredDestructionQueue.size() <= framesInFlight * ( buffersPerFrame + imagesPerFrame + 1 ) ) );
+    }
+
+    // device idle
+    stub::gpuCompleted = frameCount;
+    deferredDestructionQueue.collect( stub::gpuCompleted );
+    deferredDestructionQueue.waitIdle();
+    assert( deferredDestructionQueue.size() == 0 );
+    assert( deferredDestructionQueue.getDestroyedCount() ==
+            frameCount * ( buffersPerFrame + imagesPerFrame + 1 ) );
+    assert( deferredDestructionQueue.getBatchCount() == frameCount - framesInFlight + 1 );
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+
+  assert( stub::createdCount - createdBefore == stub::destroyedCount - destroyedBefore );
+  (void)createdBefore;
+  (void)destroyedBefore;
+  return duration.count();
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+    stub::mainThreadId = std::this_thread::get_id();
+
+    // nothing is destroyed before it is collected
+    {
+      vk::raii::su::DeferredDestructionQueue deferredDestructionQueue;
+      stub::gpuCompleted = 0;
+      stub::currentTag   = 1;
+      deferredDestructionQueue.retire( vk::raii::Buffer( device, vk::BufferCreateInfo( {}, 256 ) ), 1 );
+      stub::currentTag = 2;
+      deferredDestructionQueue.retire( vk::raii::Buffer( device, vk::BufferCreateInfo( {}, 256 ) ), 2 );
+      assert( ( deferredDestructionQueue.size() == 2 ) && ( stub::destroyedCount == 0 ) );
+
+      deferredDestructionQueue.collect( 0 );
+      assert( ( deferredDestructionQueue.size() == 2 ) && ( deferredDestructionQueue.getBatchCount() == 0 ) );
+
+      stub::gpuCompleted = 1;
+      deferredDestructionQueue.collect( 1 );
+      assert( ( deferredDestructionQueue.size() == 1 ) && ( stub::destroyedCount == 1 ) );
+
+      // the point on the timeline might as well come from a timeline semaphore
+      vk::raii::Semaphore timelineSemaphore( device, (VkSemaphore)1 );
+      stub::semaphoreValue = 2;
+      stub::gpuCompleted   = 2;
+      deferredDestructionQueue.collect( timelineSemaphore );
+      assert( ( deferredDestructionQueue.size() == 0 ) && ( stub::destroyedCount == 2 ) );
+    }
+
+    // the handles that are still in the queue when it's destroyed are destroyed as well
+    {
+      vk::raii::su::DeferredDestructionQueue deferredDestructionQueue( true );
+      stub::currentTag = 0;
+      deferredDestructionQueue.retire( vk::raii::Buffer( device, vk::BufferCreateInfo( {}, 256 ) ), 5 );
+    }
+    assert( stub::createdCount == stub::destroyedCount );
+
+    // the stress tests, destroying on the calling thread and on a background thread
+    const uint64_t frameCount      = 2000;
+    double         synchronousTime = runFrames( device, false, frameCount );
+    double         backgroundTime  = runFrames( device, true, frameCount );
+    assert( stub::prematureCount == 0 );
+    assert( stub::freedOffMainThreadCount == 0 );
+    assert( stub::createdCount == stub::destroyedCount );
+
+    std::cout << "DeferredDestruction: " << frameCount << " frames, " << stub::destroyedCount << " handles destroyed\n";
+    std::cout << "  destroyed on the calling thread: " << synchronousTime << " ms\n";
+    std::cout << "  destroyed on a background thread: " << backgroundTime << " ms" << std::endl;
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
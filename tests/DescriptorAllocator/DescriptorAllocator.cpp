@@ -0,0 +1,189 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : DescriptorAllocator
+//                   Checks that vk::su::DescriptorAllocator grows its chain of pools on eErrorOutOfPoolMemory and
+//                   eErrorFragmentedPool, against a stubbed dispatcher
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <iostream>
+#include <map>
+
+namespace stub
+{
+  struct Pool
+  {
+    uint32_t maxSets;
+    uint32_t allocatedSets;
+  };
+
+  uint64_t                     handleCounter = 0;
+  std::map<uint64_t, Pool>     pools;
+  std::map<uint64_t, uint32_t> resetCounts;
+  uint32_t                     fragmentedAfter = ~0u;         // number of sets after which a pool is fragmented
+  VkResult                     forcedResult    = VK_SUCCESS;  // any other result of vkAllocateDescriptorSets
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorPool( VkDevice,
+                                                         const VkDescriptorPoolCreateInfo * pCreateInfo,
+                                                         const VkAllocationCallbacks *,
+                                                         VkDescriptorPool * pDescriptorPool )
+  {
+    uint64_t handle  = ++handleCounter;
+    pools[handle]    = { pCreateInfo->maxSets, 0 };
+    *pDescriptorPool = reinterpret_cast<VkDescriptorPool>( handle );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorPool( VkDevice,
+                                                      VkDescriptorPool descriptorPool,
+                                                      const VkAllocationCallbacks * )
+  {
+    pools.erase( reinterpret_cast<uint64_t>( descriptorPool ) );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkResetDescriptorPool( VkDevice,
+                                                        VkDescriptorPool descriptorPool,
+                                                        VkDescriptorPoolResetFlags )
+  {
+    pools[reinterpret_cast<uint64_t>( descriptorPool )].allocatedSets = 0;
+    resetCounts[reinterpret_cast<uint64_t>( descriptorPool )]++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets( VkDevice,
+                                                           const VkDescriptorSetAllocateInfo * pAllocateInfo,
+                                                           VkDescriptorSet *                   pDescriptorSets )
+  {
+    assert( pAllocateInfo->descriptorSetCount == 1 );
+    if ( forcedResult != VK_SUCCESS )
+    {
+      return forcedResult;
+    }
+    Pool & pool = pools[reinterpret_cast<uint64_t>( pAllocateInfo->descriptorPool )];
+    if ( pool.allocatedSets == fragmentedAfter )
+    {
+      return VK_ERROR_FRAGMENTED_POOL;
+    }
+    if ( pool.allocatedSets == pool.maxSets )
+    {
+      return VK_ERROR_OUT_OF_POOL_MEMORY;
+    }
+    pool.allocatedSets++;
+    *pDescriptorSets = reinterpret_cast<VkDescriptorSet>( ++handleCounter );
+    return VK_SUCCESS;
+  }
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCreateDescriptorPool )
+    STUB_PROC_ADDR( vkDestroyDescriptorPool )
+    STUB_PROC_ADDR( vkResetDescriptorPool )
+    STUB_PROC_ADDR( vkAllocateDescriptorSets )
+    return nullptr;
+  }
+}  // namespace stub
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyDevice;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::Device              device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::DescriptorSetLayout descriptorSetLayout( reinterpret_cast<VkDescriptorSetLayout>( uint64_t( 1 ) ) );
+
+    vk::su::DescriptorAllocator descriptorAllocator( { { vk::DescriptorType::eUniformBuffer, 1 } }, 2, 8 );
+
+    // the pools hold 2, 4, 8, 8 sets; out of pool memory moves on to the next one, creating it as needed
+    for ( int i = 0; i < 14; i++ )
+    {
+      vk::DescriptorSet descriptorSet = descriptorAllocator.allocate( device, descriptorSetLayout );
+      assert( descriptorSet );
+      (void)descriptorSet;
+    }
+    vk::su::DescriptorAllocator::Statistics statistics = descriptorAllocator.getStatistics();
+    assert( ( statistics.poolCount == 3 ) && ( statistics.usedPoolCount == 3 ) );
+    assert( ( statistics.allocatedSets == 14 ) && ( statistics.setCapacity == 14 ) );
+    assert( statistics.poolExhaustions == 2 );
+    assert( stub::pools.size() == 3 );
+
+    descriptorAllocator.allocate( device, descriptorSetLayout );
+    statistics = descriptorAllocator.getStatistics();
+    assert( ( statistics.poolCount == 4 ) && ( statistics.setCapacity == 22 ) && ( statistics.poolExhaustions == 3 ) );
+
+    // a reset re-uses the pools from the first one on, without creating new ones
+    descriptorAllocator.reset( device );
+    statistics = descriptorAllocator.getStatistics();
+    assert( ( statistics.usedPoolCount == 1 ) && ( statistics.allocatedSets == 0 ) );
+    assert( statistics.poolExhaustions == 0 );
+    for ( auto const & resetCount : stub::resetCounts )
+    {
+      assert( resetCount.second == 1 );
+      (void)resetCount;
+    }
+    assert( stub::resetCounts.size() == 4 );
+
+    // a fragmented pool is left just like an exhausted one
+    stub::fragmentedAfter = 1;
+    for ( int i = 0; i < 3; i++ )
+    {
+      descriptorAllocator.allocate( device, descriptorSetLayout );
+    }
+    statistics = descriptorAllocator.getStatistics();
+    assert( ( statistics.poolCount == 4 ) && ( statistics.usedPoolCount == 3 ) );
+    assert( ( statistics.allocatedSets == 3 ) && ( statistics.poolExhaustions == 2 ) );
+    stub::fragmentedAfter = ~0u;
+
+    // any other error is reported as usual, without moving on to the next pool
+    stub::forcedResult = VK_ERROR_OUT_OF_HOST_MEMORY;
+    bool reported      = false;
+    try
+    {
+      descriptorAllocator.allocate( device, descriptorSetLayout );
+    }
+    catch ( vk::OutOfHostMemoryError const & )
+    {
+      reported = true;
+    }
+    assert( reported && ( descriptorAllocator.getStatistics().poolExhaustions == 2 ) );
+    stub::forcedResult = VK_SUCCESS;
+
+    descriptorAllocator.clear( device );
+    assert( ( descriptorAllocator.getStatistics().poolCount == 0 ) && stub::pools.empty() );
+    (void)statistics;
+    (void)reported;
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,324 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : DescriptorUpdateTemplate
+//                   Checks that vk::raii::su::TypedDescriptorUpdateTemplate writes the same descriptors as
+//                   WriteDescriptorSets against a stubbed dispatcher, and compares the time of both ways of updating
+
+#include "../../RAII_Samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace stub
+{
+  // the descriptors written are summed up, to compare the two ways of updating
+  uint64_t checksum    = 0;
+  uint64_t updateCount = 0;
+  uint64_t pushCount   = 0;
+
+  std::vector<VkDescriptorUpdateTemplateEntry> templateEntries;
+
+  void addDescriptor( VkDescriptorType descriptorType, char const * pInfo )
+  {
+    switch ( descriptorType )
+    {
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+      {
+        VkDescriptorBufferInfo const * pBufferInfo = reinterpret_cast<VkDescriptorBufferInfo const *>( pInfo );
+        checksum += (uint64_t)pBufferInfo->buffer + pBufferInfo->offset + pBufferInfo->range;
+      }
+      break;
+      case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+      case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+        checksum += (uint64_t)*reinterpret_cast<VkBufferView const *>( pInfo );
+        break;
+      default:
+      {
+        VkDescriptorImageInfo const * pImageInfo = reinterpret_cast<VkDescriptorImageInfo const *>( pInfo );
+        checksum += (uint64_t)pImageInfo->sampler + (uint64_t)pImageInfo->imageView + pImageInfo->imageLayout;
+      }
+      break;
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSets( VkDevice,
+                                                     uint32_t                     descriptorWriteCount,
+                                                     const VkWriteDescriptorSet * pDescriptorWrites,
+                                                     uint32_t,
+                                                     const VkCopyDescriptorSet * )
+  {
+    for ( uint32_t i = 0; i < descriptorWriteCount; i++ )
+    {
+      VkWriteDescriptorSet const & write = pDescriptorWrites[i];
+      for ( uint32_t j = 0; j < write.descriptorCount; j++ )
+      {
+        char const * pInfo =
+          write.pBufferInfo
+            ? reinterpret_cast<char const *>( write.pBufferInfo + j )
+            : ( write.pImageInfo ? reinterpret_cast<char const *>( write.pImageInfo + j )
+                                 : reinterpret_cast<char const *>( write.pTexelBufferView + j ) );
+        addDescriptor( write.descriptorType, pInfo );
+      }
+    }
+    updateCount++;
+  }
+
+  void updateWithTemplate( const void * pData )
+  {
+    for ( auto const & entry : templateEntries )
+    {
+      for ( uint32_t j = 0; j < entry.descriptorCount; j++ )
+      {
+        addDescriptor( entry.descriptorType, static_cast<char const *>( pData ) + entry.offset + j * entry.stride );
+      }
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkUpdateDescriptorSetWithTemplate( VkDevice,
+                                                                VkDescriptorSet,
+                                                                VkDescriptorUpdateTemplate,
+                                                                const void * pData )
+  {
+    updateWithTemplate( pData );
+    updateCount++;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdPushDescriptorSetWithTemplateKHR(
+    VkCommandBuffer, VkDescriptorUpdateTemplate, VkPipelineLayout, uint32_t, const void * pData )
+  {
+    updateWithTemplate( pData );
+    pushCount++;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL
+    vkCreateDescriptorUpdateTemplate( VkDevice,
+                                      const VkDescriptorUpdateTemplateCreateInfo * pCreateInfo,
+                                      const VkAllocationCallbacks *,
+                                      VkDescriptorUpdateTemplate * pDescriptorUpdateTemplate )
+  {
+    templateEntries.assign( pCreateInfo->pDescriptorUpdateEntries,
+                            pCreateInfo->pDescriptorUpdateEntries + pCreateInfo->descriptorUpdateEntryCount );
+    *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)1;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorUpdateTemplate( VkDevice,
+                                                                VkDescriptorUpdateTemplate,
+                                                                const VkAllocationCallbacks * )
+  {}
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkFreeDescriptorSets( VkDevice, VkDescriptorPool, uint32_t, const VkDescriptorSet * )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice, VkCommandPool, uint32_t, const VkCommandBuffer * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorPool( VkDevice, VkDescriptorPool, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool( VkDevice, VkCommandPool, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorSetLayout( VkDevice,
+                                                           VkDescriptorSetLayout,
+                                                           const VkAllocationCallbacks * )
+  {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineLayout( VkDevice, VkPipelineLayout, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkUpdateDescriptorSets )
+    STUB_PROC_ADDR( vkUpdateDescriptorSetWithTemplate )
+    STUB_PROC_ADDR( vkCmdPushDescriptorSetWithTemplateKHR )
+    STUB_PROC_ADDR( vkCreateDescriptorUpdateTemplate )
+    STUB_PROC_ADDR( vkDestroyDescriptorUpdateTemplate )
+    STUB_PROC_ADDR( vkFreeDescriptorSets )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkDestroyDescriptorPool )
+    STUB_PROC_ADDR( vkDestroyCommandPool )
+    STUB_PROC_ADDR( vkDestroyDescriptorSetLayout )
+    STUB_PROC_ADDR( vkDestroyPipelineLayout )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+// a uniform buffer, four combined image samplers, two texel buffers, and a storage buffer
+using MaterialData =
+  vk::raii::su::DescriptorSetData<vk::raii::su::DescriptorBinding<0, vk::DescriptorType::eUniformBuffer>,
+                                  vk::raii::su::DescriptorBinding<1, vk::DescriptorType::eCombinedImageSampler, 4>,
+                                  vk::raii::su::DescriptorBinding<2, vk::DescriptorType::eUniformTexelBuffer, 2>,
+                                  vk::raii::su::DescriptorBinding<3, vk::DescriptorType::eStorageBuffer>>;
+
+// the image descriptor types are specialized explicitly, any other DescriptorType would not compile
+static_assert( std::is_same<vk::raii::su::DescriptorInfoType<vk::DescriptorType::eInputAttachment>::Type,
+                            vk::DescriptorImageInfo>::value,
+               "an input attachment is described by a DescriptorImageInfo" );
+static_assert( std::is_same<vk::raii::su::DescriptorInfoType<vk::DescriptorType::eStorageImage>::Type,
+                            vk::DescriptorImageInfo>::value,
+               "a storage image is described by a DescriptorImageInfo" );
+
+const uint32_t textureCount = 4;
+
+// the resources of the frame-th update
+vk::Buffer buffer( uint64_t frame )
+{
+  return vk::Buffer( (VkBuffer)( 0x1000 + frame ) );
+}
+
+vk::DescriptorImageInfo imageInfo( uint64_t frame, uint32_t i )
+{
+  return vk::DescriptorImageInfo( (VkSampler)( 0x2000 + i ),
+                                  (VkImageView)( 0x3000 + frame * textureCount + i ),
+                                  vk::ImageLayout::eShaderReadOnlyOptimal );
+}
+
+vk::BufferView bufferView( uint64_t frame, uint32_t i )
+{
+  return vk::BufferView( (VkBufferView)( 0x4000 + frame * 2 + i ) );
+}
+
+// the way of vk::raii::su::updateDescriptorSets, building the WriteDescriptorSets on each update
+void updateWithWrites( vk::raii::Device const & device, vk::raii::DescriptorSet const & descriptorSet, uint64_t frame )
+{
+  std::vector<vk::DescriptorBufferInfo> bufferInfos = { vk::DescriptorBufferInfo( buffer( frame ), 0, 256 ),
+                                                        vk::DescriptorBufferInfo( buffer( frame ), 256, 1024 ) };
+  std::vector<vk::DescriptorImageInfo>  imageInfos;
+  imageInfos.reserve( textureCount );
+  for ( uint32_t i = 0; i < textureCount; i++ )
+  {
+    imageInfos.push_back( imageInfo( frame, i ) );
+  }
+  std::vector<vk::BufferView> bufferViews = { bufferView( frame, 0 ), bufferView( frame, 1 ) };
+
+  std::vector<vk::WriteDescriptorSet> writeDescriptorSets;
+  writeDescriptorSets.reserve( 4 );
+  writeDescriptorSets.push_back(
+    vk::WriteDescriptorSet( *descriptorSet, 0, 0, vk::DescriptorType::eUniformBuffer, {}, bufferInfos[0] ) );
+  writeDescriptorSets.push_back(
+    vk::WriteDescriptorSet( *descriptorSet, 1, 0, vk::DescriptorType::eCombinedImageSampler, imageInfos ) );
+  writeDescriptorSets.push_back(
+    vk::WriteDescriptorSet( *descriptorSet, 2, 0, vk::DescriptorType::eUniformTexelBuffer, {}, {}, bufferViews ) );
+  writeDescriptorSets.push_back(
+    vk::WriteDescriptorSet( *descriptorSet, 3, 0, vk::DescriptorType::eStorageBuffer, {}, bufferInfos[1] ) );
+  device.updateDescriptorSets( writeDescriptorSets, nullptr );
+}
+
+void fillMaterialData( MaterialData & materialData, uint64_t frame )
+{
+  materialData.get<0>() = vk::DescriptorBufferInfo( buffer( frame ), 0, 256 );
+  for ( uint32_t i = 0; i < textureCount; i++ )
+  {
+    materialData.get<1>( i ) = imageInfo( frame, i );
+  }
+  materialData.get<2>( 0 ) = bufferView( frame, 0 );
+  materialData.get<2>( 1 ) = bufferView( frame, 1 );
+  materialData.get<3>()    = vk::DescriptorBufferInfo( buffer( frame ), 256, 1024 );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice, dummyDescriptorSet, dummyCommandBuffer;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    vk::raii::DescriptorPool      descriptorPool( device, (VkDescriptorPool)1 );
+    vk::raii::DescriptorSet       descriptorSet( device, (VkDescriptorSet)&dummyDescriptorSet, descriptorPool );
+    vk::raii::DescriptorSetLayout descriptorSetLayout( device, (VkDescriptorSetLayout)1 );
+    vk::raii::PipelineLayout      pipelineLayout( device, (VkPipelineLayout)1 );
+    vk::raii::CommandPool         commandPool( device, (VkCommandPool)1 );
+    vk::raii::CommandBuffer       commandBuffer( device, (VkCommandBuffer)&dummyCommandBuffer, commandPool );
+
+    // the offsets and strides are laid out at compile time
+    static_assert( MaterialData::size == 2 * sizeof( vk::DescriptorBufferInfo ) +
+                                           textureCount * sizeof( vk::DescriptorImageInfo ) +
+                                           2 * sizeof( vk::BufferView ),
+                   "unexpected size of MaterialData" );
+    auto const & entries = MaterialData::getDescriptorUpdateTemplateEntries();
+    assert( ( entries.size() == 4 ) && ( entries[1].descriptorCount == textureCount ) );
+    assert( ( entries[1].offset == sizeof( vk::DescriptorBufferInfo ) ) &&
+            ( entries[1].stride == sizeof( vk::DescriptorImageInfo ) ) );
+    assert( entries[3].offset == entries[2].offset + 2 * sizeof( vk::BufferView ) );
+    (void)entries;
+
+    vk::raii::su::TypedDescriptorUpdateTemplate<MaterialData> descriptorUpdateTemplate( device, descriptorSetLayout );
+    MaterialData                                              materialData;
+
+    // both ways of updating write the same descriptors
+    updateWithWrites( device, descriptorSet, 1 );
+    uint64_t writesChecksum = stub::checksum;
+    stub::checksum          = 0;
+    fillMaterialData( materialData, 1 );
+    descriptorUpdateTemplate.update( descriptorSet, materialData );
+    assert( ( writesChecksum != 0 ) && ( stub::checksum == writesChecksum ) );
+
+    // and so do push descriptors
+    vk::raii::su::TypedDescriptorUpdateTemplate<MaterialData> pushDescriptorUpdateTemplate(
+      device, pipelineLayout, vk::PipelineBindPoint::eGraphics, 0 );
+    stub::checksum = 0;
+    pushDescriptorUpdateTemplate.push( commandBuffer, materialData );
+    assert( ( stub::checksum == writesChecksum ) && ( stub::pushCount == 1 ) );
+    (void)writesChecksum;
+
+    // the benchmark
+    const uint64_t updateCount = 200000;
+
+    stub::checksum = 0;
+    auto start     = std::chrono::high_resolution_clock::now();
+    for ( uint64_t frame = 0; frame < updateCount; frame++ )
+    {
+      updateWithWrites( device, descriptorSet, frame );
+    }
+    std::chrono::duration<double, std::milli> writesTime = std::chrono::high_resolution_clock::now() - start;
+    writesChecksum                                        = stub::checksum;
+
+    stub::checksum = 0;
+    start          = std::chrono::high_resolution_clock::now();
+    for ( uint64_t frame = 0; frame < updateCount; frame++ )
+    {
+      fillMaterialData( materialData, frame );
+      descriptorUpdateTemplate.update( descriptorSet, materialData );
+    }
+    std::chrono::duration<double, std::milli> templateTime = std::chrono::high_resolution_clock::now() - start;
+    assert( stub::checksum == writesChecksum );
+
+    std::cout << "DescriptorUpdateTemplate: " << updateCount << " updates of " << textureCount + 4 << " descriptors\n";
+    std::cout << "  WriteDescriptorSets: " << writesTime.count() << " ms\n";
+    std::cout << "  TypedDescriptorUpdateTemplate: " << templateTime.count() << " ms" << std::endl;
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,353 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : DynamicBufferAllocator
+//                   Checks vk::su::DynamicBufferAllocator against a stubbed dispatcher backed by host memory, and
+//                   compares its allocations from 1..N recording threads to a mutex around a single bump allocator
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace stub
+{
+  const VkDeviceSize uniformAlignment = 256;
+  const VkDeviceSize storageAlignment = 64;
+
+  uint64_t                         handleCounter = 0;
+  std::map<uint64_t, VkDeviceSize> bufferSizes;
+  size_t                           liveBuffers  = 0;
+  size_t                           liveMemories = 0;
+  size_t                           mapCount     = 0;
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->limits.minUniformBufferOffsetAlignment = uniformAlignment;
+    pProperties->limits.minStorageBufferOffsetAlignment = storageAlignment;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties( VkPhysicalDevice,
+                                                                  VkPhysicalDeviceMemoryProperties * pMemoryProperties )
+  {
+    memset( pMemoryProperties, 0, sizeof( VkPhysicalDeviceMemoryProperties ) );
+    pMemoryProperties->memoryTypeCount = 1;
+    pMemoryProperties->memoryTypes[0].propertyFlags =
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    pMemoryProperties->memoryHeapCount = 1;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer( VkDevice,
+                                                 const VkBufferCreateInfo * pCreateInfo,
+                                                 const VkAllocationCallbacks *,
+                                                 VkBuffer * pBuffer )
+  {
+    bufferSizes[++handleCounter] = pCreateInfo->size;
+    liveBuffers++;
+    *pBuffer = (VkBuffer)handleCounter;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer( VkDevice, VkBuffer buffer, const VkAllocationCallbacks * )
+  {
+    if ( buffer )
+    {
+      bufferSizes.erase( (uint64_t)buffer );
+      liveBuffers--;
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements( VkDevice,
+                                                            VkBuffer               buffer,
+                                                            VkMemoryRequirements * pMemoryRequirements )
+  {
+    pMemoryRequirements->size           = bufferSizes[(uint64_t)buffer];
+    pMemoryRequirements->alignment      = uniformAlignment;
+    pMemoryRequirements->memoryTypeBits = 1;
+  }
+
+  // the memory handles are the host memory backing them
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory( VkDevice,
+                                                   const VkMemoryAllocateInfo * pAllocateInfo,
+                                                   const VkAllocationCallbacks *,
+                                                   VkDeviceMemory * pMemory )
+  {
+    *pMemory = (VkDeviceMemory)malloc( static_cast<size_t>( pAllocateInfo->allocationSize ) );
+    liveMemories++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeMemory( VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks * )
+  {
+    if ( memory )
+    {
+      free( (void *)memory );
+      liveMemories--;
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory( VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL
+    vkMapMemory( VkDevice, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize, VkMemoryMapFlags, void ** ppData )
+  {
+    mapCount++;
+    *ppData = static_cast<uint8_t *>( (void *)memory ) + offset;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkUnmapMemory( VkDevice, VkDeviceMemory ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetPhysicalDeviceProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceMemoryProperties )
+    STUB_PROC_ADDR( vkCreateBuffer )
+    STUB_PROC_ADDR( vkDestroyBuffer )
+    STUB_PROC_ADDR( vkGetBufferMemoryRequirements )
+    STUB_PROC_ADDR( vkAllocateMemory )
+    STUB_PROC_ADDR( vkFreeMemory )
+    STUB_PROC_ADDR( vkBindBufferMemory )
+    STUB_PROC_ADDR( vkMapMemory )
+    STUB_PROC_ADDR( vkUnmapMemory )
+    return nullptr;
+  }
+}  // namespace stub
+
+// the per-draw data of the benchmark, a model matrix and a color
+struct DrawData
+{
+  float model[16];
+  float color[4];
+};
+
+// the baseline: one bump allocator over the frame buffer, shared by all the threads under a mutex
+class LockedBumpAllocator
+{
+public:
+  LockedBumpAllocator( vk::Buffer const & buffer, uint8_t * pData )
+    : m_buffer( buffer ), m_pData( pData ), m_offset( 0 )
+  {}
+
+  vk::su::DynamicAllocation allocate( vk::DeviceSize size )
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    vk::DeviceSize offset = ( m_offset + stub::uniformAlignment - 1 ) & ~( stub::uniformAlignment - 1 );
+    m_offset              = offset + size;
+    return { m_buffer, static_cast<uint32_t>( offset ), m_pData + offset };
+  }
+
+  void reset()
+  {
+    m_offset = 0;
+  }
+
+private:
+  std::mutex     m_mutex;
+  vk::Buffer     m_buffer;
+  uint8_t *      m_pData;
+  vk::DeviceSize m_offset;
+};
+
+// each thread allocates and fills the data of drawCount draws
+template <typename Allocate>
+double runThreads( size_t threadCount, size_t drawCount, Allocate const & allocate )
+{
+  auto start = std::chrono::high_resolution_clock::now();
+  {
+    std::vector<std::thread> threads;
+    for ( size_t t = 0; t < threadCount; t++ )
+    {
+      threads.push_back( std::thread( [&allocate, drawCount, t]() {
+        DrawData drawData = {};
+        for ( size_t i = 0; i < drawCount; i++ )
+        {
+          drawData.color[0]                    = static_cast<float>( t );
+          vk::su::DynamicAllocation allocation = allocate( sizeof( DrawData ) );
+          memcpy( allocation.pData, &drawData, sizeof( DrawData ) );
+        }
+      } ) );
+    }
+    for ( auto & thread : threads )
+    {
+      thread.join();
+    }
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+  return duration.count();
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ) );
+    vk::Device         device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    const uint32_t       frameCount = 2;
+    const vk::DeviceSize frameSize  = 16 * 1024 * 1024;
+    {
+      vk::su::DynamicBufferAllocator dynamicBufferAllocator( physicalDevice, device, frameSize, frameCount, 4096 );
+
+      // the buffers are mapped once, on construction
+      assert( ( stub::liveBuffers == frameCount ) && ( stub::mapCount == frameCount ) );
+
+      // the offsets are aligned as needed for dynamic uniform and storage buffers, and the data is written in place
+      dynamicBufferAllocator.beginFrame( 0 );
+      vk::DescriptorBufferInfo  descriptorBufferInfo = dynamicBufferAllocator.getDescriptorBufferInfo( 0, 64 );
+      vk::su::DynamicAllocation uniform              = dynamicBufferAllocator.pushUniform( 1.0f );
+      vk::su::DynamicAllocation storage              = dynamicBufferAllocator.allocateStorage( 24 );
+      vk::su::DynamicAllocation nextUniform          = dynamicBufferAllocator.allocateUniform( 100 );
+      assert( ( uniform.buffer == descriptorBufferInfo.buffer ) && ( descriptorBufferInfo.range == 64 ) );
+      assert( ( uniform.dynamicOffset == 0 ) && ( *(float *)uniform.pData == 1.0f ) );
+      assert( ( storage.dynamicOffset % stub::storageAlignment == 0 ) &&
+              ( uniform.dynamicOffset < storage.dynamicOffset ) );
+      assert( ( nextUniform.dynamicOffset % stub::uniformAlignment == 0 ) &&
+              ( storage.dynamicOffset + 24 <= nextUniform.dynamicOffset ) );
+      assert( static_cast<uint8_t *>( nextUniform.pData ) - static_cast<uint8_t *>( uniform.pData ) ==
+              static_cast<ptrdiff_t>( nextUniform.dynamicOffset - uniform.dynamicOffset ) );
+      (void)descriptorBufferInfo;
+      (void)storage;
+      (void)nextUniform;
+
+      // an allocation larger than a sub-block gets its own range
+      vk::su::DynamicAllocation large = dynamicBufferAllocator.allocateStorage( 10000 );
+      assert( ( large.dynamicOffset % stub::uniformAlignment == 0 ) &&
+              ( dynamicBufferAllocator.getStatistics().subBlockCount == 2 ) );
+      (void)large;
+
+      // the next frame allocates from its own buffer, starting over
+      dynamicBufferAllocator.beginFrame( 1 );
+      vk::su::DynamicAllocation otherFrame = dynamicBufferAllocator.allocateUniform( 16 );
+      assert( ( otherFrame.buffer != uniform.buffer ) && ( otherFrame.dynamicOffset == 0 ) );
+      assert( dynamicBufferAllocator.getStatistics().peak == 4096 + 10240 );
+      (void)otherFrame;
+
+      // the threads never hand out overlapping ranges: each allocation is filled with the number of its thread, and
+      // checked after all threads are done
+      const size_t threadCount = 8;
+      const size_t drawCount   = 4096;
+      dynamicBufferAllocator.beginFrame( 0 );
+      std::vector<std::vector<vk::su::DynamicAllocation>> allocations( threadCount );
+      std::vector<std::thread>                            threads;
+      for ( size_t t = 0; t < threadCount; t++ )
+      {
+        threads.push_back( std::thread( [&dynamicBufferAllocator, &allocations, t]() {
+          for ( size_t i = 0; i < drawCount; i++ )
+          {
+            vk::DeviceSize            size       = ( i % 3 ) ? sizeof( DrawData ) : 16;
+            vk::su::DynamicAllocation allocation = ( i % 2 ) ? dynamicBufferAllocator.allocateUniform( size )
+                                                             : dynamicBufferAllocator.allocateStorage( size );
+            memset( allocation.pData, static_cast<int>( t ), static_cast<size_t>( size ) );
+            allocations[t].push_back( allocation );
+          }
+        } ) );
+      }
+      for ( auto & thread : threads )
+      {
+        thread.join();
+      }
+      size_t corrupted = 0;
+      for ( size_t t = 0; t < threadCount; t++ )
+      {
+        for ( size_t i = 0; i < drawCount; i++ )
+        {
+          vk::DeviceSize  size  = ( i % 3 ) ? sizeof( DrawData ) : 16;
+          uint8_t const * pData = static_cast<uint8_t const *>( allocations[t][i].pData );
+          corrupted += ( ( pData[0] != t ) || ( pData[size - 1] != t ) ) ? 1 : 0;
+          corrupted +=
+            ( allocations[t][i].dynamicOffset % ( ( i % 2 ) ? stub::uniformAlignment : stub::storageAlignment ) ) ? 1
+                                                                                                                   : 0;
+        }
+      }
+      assert( corrupted == 0 );
+      (void)corrupted;
+
+      vk::su::DynamicBufferAllocator::Statistics statistics = dynamicBufferAllocator.getStatistics();
+      std::cout << "DynamicBufferAllocator: " << threadCount * drawCount << " allocations on " << threadCount
+                << " threads used " << statistics.used << " bytes in " << statistics.subBlockCount << " sub-blocks\n";
+
+      // running out of frame memory throws
+      vk::su::DynamicBufferAllocator smallAllocator( physicalDevice, device, 8192, 1, 4096 );
+      bool                           outOfMemory = false;
+      try
+      {
+        for ( int i = 0; i < 64; i++ )
+        {
+          smallAllocator.allocateUniform( 200 );
+        }
+      }
+      catch ( std::runtime_error const & )
+      {
+        outOfMemory = true;
+      }
+      assert( outOfMemory && ( smallAllocator.getStatistics().used == 8192 ) );
+      (void)outOfMemory;
+      smallAllocator.clear( device );
+
+      // the benchmark: the per-draw data of a frame, spread over 1..N threads, allocated from lock-free sub-blocks
+      // and from a single locked bump allocator over the buffer of frame 0
+      const size_t        benchmarkDrawCount = 48 * 1024;
+      LockedBumpAllocator lockedBumpAllocator( descriptorBufferInfo.buffer, static_cast<uint8_t *>( uniform.pData ) );
+      std::cout << "  draws per frame: " << benchmarkDrawCount << "\n";
+      for ( size_t benchmarkThreads = 1; benchmarkThreads <= threadCount; benchmarkThreads *= 2 )
+      {
+        dynamicBufferAllocator.beginFrame( 0 );
+        double subBlockTime = runThreads( benchmarkThreads,
+                                          benchmarkDrawCount / benchmarkThreads,
+                                          [&dynamicBufferAllocator]( vk::DeviceSize size )
+                                          { return dynamicBufferAllocator.allocateUniform( size ); } );
+        lockedBumpAllocator.reset();
+        double lockedTime =
+          runThreads( benchmarkThreads,
+                      benchmarkDrawCount / benchmarkThreads,
+                      [&lockedBumpAllocator]( vk::DeviceSize size ) { return lockedBumpAllocator.allocate( size ); } );
+        std::cout << "  " << benchmarkThreads << " threads: sub-blocks " << subBlockTime << " ms, locked "
+                  << lockedTime << " ms\n";
+      }
+      std::cout << "  peak frame usage: " << dynamicBufferAllocator.getStatistics().peak << " bytes" << std::endl;
+
+      dynamicBufferAllocator.clear( device );
+    }
+    assert( ( stub::liveBuffers == 0 ) && ( stub::liveMemories == 0 ) );
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,153 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : FormatTraits
+//                   Cross-check vk::getFormatTraits on a selection of formats against the spec
+
+#include "vulkan/vulkan.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#if ( 14 <= VULKAN_HPP_CPP_VERSION )
+// with C++14, the traits are available at compile time
+static_assert( vk::getFormatTraits( vk::Format::eR8G8B8A8Unorm ).blockSize == 4, "unexpected blockSize" );
+static_assert( vk::getFormatTraits( vk::Format::eBc1RgbUnormBlock ).blockExtent[0] == 4, "unexpected blockExtent" );
+static_assert( vk::getFormatTraits( vk::Format::eD24UnormS8Uint ).hasStencilComponent, "missing stencil component" );
+#endif
+
+void checkComponents( vk::FormatTraits const & traits, char const * names, std::initializer_list<uint8_t> bits )
+{
+  assert( strcmp( traits.componentNames, names ) == 0 );
+  assert( traits.componentCount == bits.size() );
+  size_t i = 0;
+  for ( auto b : bits )
+  {
+    assert( traits.componentBits[i++] == b );
+  }
+  for ( ; i < 4; i++ )
+  {
+    assert( traits.componentBits[i] == 0 );
+  }
+  (void)names;
+}
+
+void checkBlock( vk::FormatTraits const & traits,
+                 uint8_t                  blockSize,
+                 uint8_t                  texelsPerBlock,
+                 uint8_t                  width,
+                 uint8_t                  height )
+{
+  assert( traits.blockSize == blockSize );
+  assert( traits.texelsPerBlock == texelsPerBlock );
+  assert( ( traits.blockExtent[0] == width ) && ( traits.blockExtent[1] == height ) && ( traits.blockExtent[2] == 1 ) );
+  (void)traits;
+  (void)blockSize;
+  (void)texelsPerBlock;
+  (void)width;
+  (void)height;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  // plain color formats
+  vk::FormatTraits traits = vk::getFormatTraits( vk::Format::eR8G8B8A8Unorm );
+  checkBlock( traits, 4, 1, 1, 1 );
+  checkComponents( traits, "RGBA", { 8, 8, 8, 8 } );
+  assert( ( traits.packed == 0 ) && ( traits.planeCount == 0 ) && ( *traits.compressionScheme == 0 ) );
+  assert( strcmp( traits.compatibilityClass, "32-bit" ) == 0 );
+  assert( !traits.hasDepthComponent && !traits.hasStencilComponent );
+
+  traits = vk::getFormatTraits( vk::Format::eB8G8R8A8Srgb );
+  checkBlock( traits, 4, 1, 1, 1 );
+  checkComponents( traits, "BGRA", { 8, 8, 8, 8 } );
+  assert( strcmp( traits.compatibilityClass, vk::getFormatTraits( vk::Format::eR8G8B8A8Unorm ).compatibilityClass ) ==
+          0 );
+
+  traits = vk::getFormatTraits( vk::Format::eR64G64B64A64Sfloat );
+  checkBlock( traits, 32, 1, 1, 1 );
+  checkComponents( traits, "RGBA", { 64, 64, 64, 64 } );
+
+  // packed formats
+  traits = vk::getFormatTraits( vk::Format::eR5G6B5UnormPack16 );
+  checkBlock( traits, 2, 1, 1, 1 );
+  checkComponents( traits, "RGB", { 5, 6, 5 } );
+  assert( traits.packed == 16 );
+
+  traits = vk::getFormatTraits( vk::Format::eA2B10G10R10UnormPack32 );
+  checkBlock( traits, 4, 1, 1, 1 );
+  checkComponents( traits, "ABGR", { 2, 10, 10, 10 } );
+  assert( traits.packed == 32 );
+
+  // depth/stencil formats
+  traits = vk::getFormatTraits( vk::Format::eD16Unorm );
+  checkBlock( traits, 2, 1, 1, 1 );
+  checkComponents( traits, "D", { 16 } );
+  assert( traits.hasDepthComponent && !traits.hasStencilComponent );
+
+  traits = vk::getFormatTraits( vk::Format::eS8Uint );
+  checkBlock( traits, 1, 1, 1, 1 );
+  assert( !traits.hasDepthComponent && traits.hasStencilComponent );
+
+  traits = vk::getFormatTraits( vk::Format::eD24UnormS8Uint );
+  checkBlock( traits, 4, 1, 1, 1 );
+  checkComponents( traits, "DS", { 24, 8 } );
+  assert( traits.hasDepthComponent && traits.hasStencilComponent );
+
+  traits = vk::getFormatTraits( vk::Format::eD32SfloatS8Uint );
+  checkBlock( traits, 5, 1, 1, 1 );
+  checkComponents( traits, "DS", { 32, 8 } );
+
+  // block compressed formats
+  traits = vk::getFormatTraits( vk::Format::eBc1RgbUnormBlock );
+  checkBlock( traits, 8, 16, 4, 4 );
+  checkComponents( traits, "RGB", { 0, 0, 0 } );
+  assert( strcmp( traits.compressionScheme, "BC" ) == 0 );
+
+  traits = vk::getFormatTraits( vk::Format::eBc7SrgbBlock );
+  checkBlock( traits, 16, 16, 4, 4 );
+  assert( strcmp( traits.compressionScheme, "BC" ) == 0 );
+
+  traits = vk::getFormatTraits( vk::Format::eEtc2R8G8B8A8UnormBlock );
+  checkBlock( traits, 16, 16, 4, 4 );
+  assert( strcmp( traits.compressionScheme, "ETC2" ) == 0 );
+
+  traits = vk::getFormatTraits( vk::Format::eAstc8x6UnormBlock );
+  checkBlock( traits, 16, 48, 8, 6 );
+  assert( strcmp( traits.compressionScheme, "ASTC LDR" ) == 0 );
+
+  // multi-planar and subsampled formats
+  traits = vk::getFormatTraits( vk::Format::eG8B8R83Plane420Unorm );
+  checkBlock( traits, 3, 1, 1, 1 );
+  checkComponents( traits, "GBR", { 8, 8, 8 } );
+  assert( traits.planeCount == 3 );
+
+  traits = vk::getFormatTraits( vk::Format::eG8B8G8R8422Unorm );
+  checkBlock( traits, 4, 1, 2, 1 );
+  checkComponents( traits, "GBGR", { 8, 8, 8, 8 } );
+  assert( traits.planeCount == 0 );
+
+  // the copy size of a 256x256 texture, as computed from the traits
+  traits = vk::getFormatTraits( vk::Format::eBc1RgbaUnormBlock );
+  size_t copySize = ( 256 / traits.blockExtent[0] ) * ( 256 / traits.blockExtent[1] ) * traits.blockSize;
+  assert( copySize == 256 * 256 / 2 );
+  (void)copySize;
+
+  // a format without traits
+  traits = vk::getFormatTraits( vk::Format::eUndefined );
+  assert( ( traits.blockSize == 0 ) && ( traits.componentCount == 0 ) );
+
+  std::cout << "FormatTraits: all checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,379 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : FramesInFlight
+//                   Checks the call sequence of vk::su::FramesInFlight against a stubbed dispatcher
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace stub
+{
+  struct Call
+  {
+    Call( std::string const & name_, uint64_t handle_ ) : name( name_ ), handle( handle_ ) {}
+
+    std::string name;
+    uint64_t    handle;
+  };
+
+  struct Submission
+  {
+    std::vector<uint64_t> waitSemaphores;
+    std::vector<uint64_t> signalSemaphores;
+    uint64_t              commandBuffer;
+    uint64_t              fence;
+  };
+
+  std::vector<Call>       calls;
+  std::vector<Submission> submissions;
+  std::vector<uint64_t>   presentWaitSemaphores;
+  std::set<uint64_t>      signaledFences;
+  std::set<uint64_t>      signaledSemaphores;
+  std::set<uint64_t>      liveHandles;
+  uintptr_t               handleCounter = 0;
+  uint32_t                imageIndex    = 0;
+
+  template <typename T>
+  T createHandle()
+  {
+    liveHandles.insert( ++handleCounter );
+    return (T)( handleCounter );
+  }
+
+  template <typename T>
+  uint64_t toId( T handle )
+  {
+    return (uint64_t)( handle );
+  }
+
+  void destroyHandle( uint64_t handle )
+  {
+    if ( handle )
+    {
+      assert( liveHandles.find( handle ) != liveHandles.end() );
+      liveHandles.erase( handle );
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool( VkDevice,
+                                                      const VkCommandPoolCreateInfo *,
+                                                      const VkAllocationCallbacks *,
+                                                      VkCommandPool * pCommandPool )
+  {
+    *pCommandPool = createHandle<VkCommandPool>();
+    calls.emplace_back( "vkCreateCommandPool", toId( *pCommandPool ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool( VkDevice, VkCommandPool commandPool, const VkAllocationCallbacks * )
+  {
+    calls.emplace_back( "vkDestroyCommandPool", toId( commandPool ) );
+    destroyHandle( toId( commandPool ) );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool( VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags )
+  {
+    calls.emplace_back( "vkResetCommandPool", toId( commandPool ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers( VkDevice,
+                                                           const VkCommandBufferAllocateInfo * pAllocateInfo,
+                                                           VkCommandBuffer *                   pCommandBuffers )
+  {
+    for ( uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++ )
+    {
+      pCommandBuffers[i] = createHandle<VkCommandBuffer>();
+      calls.emplace_back( "vkAllocateCommandBuffers", toId( pCommandBuffers[i] ) );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice,
+                                                   VkCommandPool,
+                                                   uint32_t                commandBufferCount,
+                                                   const VkCommandBuffer * pCommandBuffers )
+  {
+    for ( uint32_t i = 0; i < commandBufferCount; i++ )
+    {
+      calls.emplace_back( "vkFreeCommandBuffers", toId( pCommandBuffers[i] ) );
+      destroyHandle( toId( pCommandBuffers[i] ) );
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer( VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo * )
+  {
+    calls.emplace_back( "vkBeginCommandBuffer", toId( commandBuffer ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer( VkCommandBuffer commandBuffer )
+  {
+    calls.emplace_back( "vkEndCommandBuffer", toId( commandBuffer ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence( VkDevice,
+                                                const VkFenceCreateInfo * pCreateInfo,
+                                                const VkAllocationCallbacks *,
+                                                VkFence * pFence )
+  {
+    *pFence = createHandle<VkFence>();
+    if ( pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT )
+    {
+      signaledFences.insert( toId( *pFence ) );
+    }
+    calls.emplace_back( "vkCreateFence", toId( *pFence ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyFence( VkDevice, VkFence fence, const VkAllocationCallbacks * )
+  {
+    calls.emplace_back( "vkDestroyFence", toId( fence ) );
+    destroyHandle( toId( fence ) );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL
+    vkWaitForFences( VkDevice, uint32_t fenceCount, const VkFence * pFences, VkBool32 waitAll, uint64_t )
+  {
+    assert( waitAll );
+    for ( uint32_t i = 0; i < fenceCount; i++ )
+    {
+      // there's no GPU behind this stub: waiting on a fence that is never going to be signaled would hang forever
+      assert( signaledFences.find( toId( pFences[i] ) ) != signaledFences.end() );
+      calls.emplace_back( "vkWaitForFences", toId( pFences[i] ) );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkResetFences( VkDevice, uint32_t fenceCount, const VkFence * pFences )
+  {
+    for ( uint32_t i = 0; i < fenceCount; i++ )
+    {
+      signaledFences.erase( toId( pFences[i] ) );
+      calls.emplace_back( "vkResetFences", toId( pFences[i] ) );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore( VkDevice,
+                                                    const VkSemaphoreCreateInfo *,
+                                                    const VkAllocationCallbacks *,
+                                                    VkSemaphore * pSemaphore )
+  {
+    *pSemaphore = createHandle<VkSemaphore>();
+    calls.emplace_back( "vkCreateSemaphore", toId( *pSemaphore ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore( VkDevice, VkSemaphore semaphore, const VkAllocationCallbacks * )
+  {
+    calls.emplace_back( "vkDestroySemaphore", toId( semaphore ) );
+    destroyHandle( toId( semaphore ) );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImageKHR(
+    VkDevice, VkSwapchainKHR, uint64_t, VkSemaphore semaphore, VkFence, uint32_t * pImageIndex )
+  {
+    // a binary semaphore to be signaled must not have any pending signal
+    assert( signaledSemaphores.find( toId( semaphore ) ) == signaledSemaphores.end() );
+    signaledSemaphores.insert( toId( semaphore ) );
+    *pImageIndex = imageIndex;
+    imageIndex   = ( imageIndex + 1 ) % 3;
+    calls.emplace_back( "vkAcquireNextImageKHR", toId( semaphore ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit( VkQueue, uint32_t submitCount, const VkSubmitInfo * pSubmits, VkFence fence )
+  {
+    assert( submitCount == 1 );
+    assert( pSubmits->commandBufferCount == 1 );
+    Submission submission;
+    for ( uint32_t i = 0; i < pSubmits->waitSemaphoreCount; i++ )
+    {
+      assert( signaledSemaphores.find( toId( pSubmits->pWaitSemaphores[i] ) ) != signaledSemaphores.end() );
+      signaledSemaphores.erase( toId( pSubmits->pWaitSemaphores[i] ) );
+      submission.waitSemaphores.push_back( toId( pSubmits->pWaitSemaphores[i] ) );
+    }
+    for ( uint32_t i = 0; i < pSubmits->signalSemaphoreCount; i++ )
+    {
+      assert( signaledSemaphores.find( toId( pSubmits->pSignalSemaphores[i] ) ) == signaledSemaphores.end() );
+      signaledSemaphores.insert( toId( pSubmits->pSignalSemaphores[i] ) );
+      submission.signalSemaphores.push_back( toId( pSubmits->pSignalSemaphores[i] ) );
+    }
+    submission.commandBuffer = toId( pSubmits->pCommandBuffers[0] );
+    submission.fence         = toId( fence );
+    submissions.push_back( submission );
+
+    // the stubbed GPU finishes the work immediately
+    assert( signaledFences.find( toId( fence ) ) == signaledFences.end() );
+    signaledFences.insert( toId( fence ) );
+    calls.emplace_back( "vkQueueSubmit", toId( fence ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR( VkQueue, const VkPresentInfoKHR * pPresentInfo )
+  {
+    assert( pPresentInfo->waitSemaphoreCount == 1 );
+    assert( signaledSemaphores.find( toId( pPresentInfo->pWaitSemaphores[0] ) ) != signaledSemaphores.end() );
+    signaledSemaphores.erase( toId( pPresentInfo->pWaitSemaphores[0] ) );
+    presentWaitSemaphores.push_back( toId( pPresentInfo->pWaitSemaphores[0] ) );
+    calls.emplace_back( "vkQueuePresentKHR", toId( pPresentInfo->pWaitSemaphores[0] ) );
+    return VK_SUCCESS;
+  }
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCreateCommandPool )
+    STUB_PROC_ADDR( vkDestroyCommandPool )
+    STUB_PROC_ADDR( vkResetCommandPool )
+    STUB_PROC_ADDR( vkAllocateCommandBuffers )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkBeginCommandBuffer )
+    STUB_PROC_ADDR( vkEndCommandBuffer )
+    STUB_PROC_ADDR( vkCreateFence )
+    STUB_PROC_ADDR( vkDestroyFence )
+    STUB_PROC_ADDR( vkWaitForFences )
+    STUB_PROC_ADDR( vkResetFences )
+    STUB_PROC_ADDR( vkCreateSemaphore )
+    STUB_PROC_ADDR( vkDestroySemaphore )
+    STUB_PROC_ADDR( vkAcquireNextImageKHR )
+    STUB_PROC_ADDR( vkQueueSubmit )
+    STUB_PROC_ADDR( vkQueuePresentKHR )
+    return nullptr;
+  }
+}  // namespace stub
+
+// returns the name of the call directly following the call at index, and steps index
+std::string const & nextCall( size_t & index )
+{
+  assert( index < stub::calls.size() );
+  return stub::calls[index++].name;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyDevice, dummyQueue;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    vk::Device       device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::Queue        queue( reinterpret_cast<VkQueue>( &dummyQueue ) );
+    vk::SwapchainKHR swapChain( stub::createHandle<VkSwapchainKHR>() );
+
+    const uint32_t         frameCount = 2;
+    vk::su::FramesInFlight framesInFlight( vk::PhysicalDevice(), device, 0, frameCount );
+    assert( framesInFlight.frameCount() == frameCount );
+
+    // one command pool, command buffer, fence and two semaphores per frame; fences start signaled
+    assert( stub::liveHandles.size() == 1 + frameCount * 5 );
+    assert( stub::signaledFences.size() == frameCount );
+
+    std::vector<uint64_t> frameFences;
+    const uint32_t        presentedFrames = 3 * frameCount;
+    for ( uint32_t i = 0; i < presentedFrames; i++ )
+    {
+      assert( framesInFlight.frameIndex() == i % frameCount );
+
+      size_t             callIndex = stub::calls.size();
+      vk::su::FrameData & frame    = framesInFlight.beginFrame( device );
+
+      // beginFrame: wait on the frame fence, reset it, reset the command pool, then begin the command buffer
+      assert( nextCall( callIndex ) == "vkWaitForFences" );
+      assert( stub::calls[callIndex - 1].handle == stub::toId( static_cast<VkFence>( frame.fence ) ) );
+      assert( nextCall( callIndex ) == "vkResetFences" );
+      assert( nextCall( callIndex ) == "vkResetCommandPool" );
+      assert( stub::calls[callIndex - 1].handle == stub::toId( static_cast<VkCommandPool>( frame.commandPool ) ) );
+      assert( nextCall( callIndex ) == "vkBeginCommandBuffer" );
+      assert( callIndex == stub::calls.size() );
+      (void)callIndex;
+
+      vk::ResultValue<uint32_t> rv = framesInFlight.acquireNextImage( device, swapChain );
+      assert( rv.result == vk::Result::eSuccess );
+
+      framesInFlight.submit( queue );
+      assert( framesInFlight.frameIndex() == ( i + 1 ) % frameCount );
+
+      // the submission waits on the acquired image, signals the render complete semaphore and the frame fence
+      stub::Submission const & submission = stub::submissions.back();
+      assert( submission.commandBuffer == stub::toId( static_cast<VkCommandBuffer>( frame.commandBuffer ) ) );
+      assert( ( submission.waitSemaphores.size() == 1 ) &&
+              ( submission.waitSemaphores[0] ==
+                stub::toId( static_cast<VkSemaphore>( frame.imageAcquiredSemaphore ) ) ) );
+      assert( ( submission.signalSemaphores.size() == 1 ) &&
+              ( submission.signalSemaphores[0] ==
+                stub::toId( static_cast<VkSemaphore>( frame.renderCompleteSemaphore ) ) ) );
+      assert( submission.fence == stub::toId( static_cast<VkFence>( frame.fence ) ) );
+
+      vk::Result result = framesInFlight.present( queue, swapChain, rv.value );
+      assert( result == vk::Result::eSuccess );
+      assert( stub::presentWaitSemaphores.back() ==
+              stub::toId( static_cast<VkSemaphore>( frame.renderCompleteSemaphore ) ) );
+
+      frameFences.push_back( submission.fence );
+      (void)result;
+    }
+
+    // frame n + frameCount reuses the fence of frame n, neighbouring frames in flight don't share it
+    for ( uint32_t i = 0; i + 1 < presentedFrames; i++ )
+    {
+      assert( frameFences[i] != frameFences[i + 1] );
+      if ( i + frameCount < presentedFrames )
+      {
+        assert( frameFences[i] == frameFences[i + frameCount] );
+      }
+    }
+
+    // a frame without an acquired image (like an offscreen or upload frame) submits without any semaphores
+    framesInFlight.beginFrame( device );
+    framesInFlight.submit( queue );
+    assert( stub::submissions.back().waitSemaphores.empty() && stub::submissions.back().signalSemaphores.empty() );
+
+    assert( stub::submissions.size() == presentedFrames + 1 );
+    assert( stub::presentWaitSemaphores.size() == presentedFrames );
+    assert( stub::signaledSemaphores.empty() );
+
+    // clear waits on all the frames and destroys everything but the swapchain
+    framesInFlight.clear( device );
+    assert( stub::liveHandles.size() == 1 );
+    assert( framesInFlight.frameCount() == 0 );
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
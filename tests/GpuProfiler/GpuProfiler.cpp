@@ -0,0 +1,345 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : GpuProfiler
+//                   Runs vk::raii::su::GpuProfiler end to end against a stubbed dispatcher that returns synthetic
+//                   timestamps, and checks the calibration, the ring of query pools, and the Chrome trace export
+
+#include "../../RAII_Samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace stub
+{
+  const float                                  timestampPeriod      = 2.0f;  // nanoseconds per tick
+  uint64_t                                     currentTick          = 0;     // advanced by 1000 per timestamp written
+  bool                                         gpuDone              = true;  // if false, results are not ready
+  uint64_t                                     hostNs               = 0;     // the host time matching currentTick
+  uint32_t                                     writeTimestampCount  = 0;
+  uint32_t                                     writeTimestamp2Count = 0;
+  uint32_t                                     getResultsCount      = 0;
+  uintptr_t                                    handleCounter        = 0;
+  std::map<VkQueryPool, std::vector<uint64_t>> queryPools;
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->limits.timestampPeriod = timestampPeriod;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL
+    vkGetPhysicalDeviceQueueFamilyProperties( VkPhysicalDevice,
+                                              uint32_t *                pQueueFamilyPropertyCount,
+                                              VkQueueFamilyProperties * pQueueFamilyProperties )
+  {
+    if ( pQueueFamilyProperties )
+    {
+      assert( *pQueueFamilyPropertyCount == 1 );
+      *pQueueFamilyProperties = { VK_QUEUE_GRAPHICS_BIT, 1, 64, { 1, 1, 1 } };
+    }
+    else
+    {
+      *pQueueFamilyPropertyCount = 1;
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceCalibrateableTimeDomainsEXT( VkPhysicalDevice,
+                                                                                 uint32_t *        pTimeDomainCount,
+                                                                                 VkTimeDomainEXT * pTimeDomains )
+  {
+    if ( pTimeDomains )
+    {
+      assert( *pTimeDomainCount == 2 );
+      pTimeDomains[0] = VK_TIME_DOMAIN_DEVICE_EXT;
+      pTimeDomains[1] = VK_TIME_DOMAIN_CLOCK_MONOTONIC_EXT;
+    }
+    else
+    {
+      *pTimeDomainCount = 2;
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateQueryPool( VkDevice,
+                                                    const VkQueryPoolCreateInfo * pCreateInfo,
+                                                    const VkAllocationCallbacks *,
+                                                    VkQueryPool *                 pQueryPool )
+  {
+    assert( pCreateInfo->queryType == VK_QUERY_TYPE_TIMESTAMP );
+    *pQueryPool             = (VkQueryPool)( ++handleCounter );
+    queryPools[*pQueryPool] = std::vector<uint64_t>( pCreateInfo->queryCount, 0 );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyQueryPool( VkDevice, VkQueryPool queryPool, const VkAllocationCallbacks * )
+  {
+    assert( queryPools.find( queryPool ) != queryPools.end() );
+    queryPools.erase( queryPool );
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdResetQueryPool( VkCommandBuffer,
+                                                  VkQueryPool queryPool,
+                                                  uint32_t    firstQuery,
+                                                  uint32_t    queryCount )
+  {
+    std::vector<uint64_t> & queries = queryPools[queryPool];
+    assert( firstQuery + queryCount <= queries.size() );
+    std::fill( queries.begin() + firstQuery, queries.begin() + firstQuery + queryCount, 0 );
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp( VkCommandBuffer,
+                                                  VkPipelineStageFlagBits pipelineStage,
+                                                  VkQueryPool             queryPool,
+                                                  uint32_t                query )
+  {
+    assert( ( pipelineStage == VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT ) ||
+            ( pipelineStage == VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT ) );
+    (void)pipelineStage;
+    writeTimestampCount++;
+    queryPools[queryPool][query] = ( currentTick += 1000 );
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdWriteTimestamp2KHR( VkCommandBuffer,
+                                                      VkPipelineStageFlags2KHR,
+                                                      VkQueryPool queryPool,
+                                                      uint32_t    query )
+  {
+    writeTimestamp2Count++;
+    queryPools[queryPool][query] = ( currentTick += 1000 );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetQueryPoolResults( VkDevice,
+                                                        VkQueryPool        queryPool,
+                                                        uint32_t           firstQuery,
+                                                        uint32_t           queryCount,
+                                                        size_t             dataSize,
+                                                        void *             pData,
+                                                        VkDeviceSize       stride,
+                                                        VkQueryResultFlags flags )
+  {
+    // the profiler must never wait for results
+    assert( ( flags == VK_QUERY_RESULT_64_BIT ) && ( stride == sizeof( uint64_t ) ) );
+    assert( queryCount * sizeof( uint64_t ) <= dataSize );
+    (void)flags;
+    (void)stride;
+    (void)dataSize;
+    getResultsCount++;
+    if ( !gpuDone )
+    {
+      return VK_NOT_READY;
+    }
+    memcpy( pData, queryPools[queryPool].data() + firstQuery, queryCount * sizeof( uint64_t ) );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetCalibratedTimestampsEXT( VkDevice,
+                                                               uint32_t                             timestampCount,
+                                                               const VkCalibratedTimestampInfoEXT * pTimestampInfos,
+                                                               uint64_t *                           pTimestamps,
+                                                               uint64_t *                           pMaxDeviation )
+  {
+    for ( uint32_t i = 0; i < timestampCount; i++ )
+    {
+      pTimestamps[i] = ( pTimestampInfos[i].timeDomain == VK_TIME_DOMAIN_DEVICE_EXT ) ? currentTick : hostNs;
+    }
+    *pMaxDeviation = 1;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice, VkCommandPool, uint32_t, const VkCommandBuffer * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetPhysicalDeviceProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceQueueFamilyProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceCalibrateableTimeDomainsEXT )
+    STUB_PROC_ADDR( vkCreateQueryPool )
+    STUB_PROC_ADDR( vkDestroyQueryPool )
+    STUB_PROC_ADDR( vkCmdResetQueryPool )
+    STUB_PROC_ADDR( vkCmdWriteTimestamp )
+    STUB_PROC_ADDR( vkCmdWriteTimestamp2KHR )
+    STUB_PROC_ADDR( vkGetQueryPoolResults )
+    STUB_PROC_ADDR( vkGetCalibratedTimestampsEXT )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+size_t countOccurrences( std::string const & text, std::string const & pattern )
+{
+  size_t count = 0;
+  for ( size_t pos = text.find( pattern ); pos != std::string::npos; pos = text.find( pattern, pos + 1 ) )
+  {
+    count++;
+  }
+  return count;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice, dummyCommandBuffer;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::raii::CommandBuffer  commandBuffer( reinterpret_cast<VkCommandBuffer>( &dummyCommandBuffer ),
+                                           *device,
+                                           VkCommandPool( 0 ),
+                                           device.getDispatcher() );
+
+    {
+      // two frames in flight, up to four scopes per frame, calibrated against CLOCK_MONOTONIC
+      vk::raii::su::GpuProfiler profiler( physicalDevice, device, 0, 2, 4, true );
+      assert( profiler.isCalibrated() && ( stub::queryPools.size() == 2 ) );
+
+      // frame 0: nested scopes, with the timestamps 1000, 2000, ... 6000
+      profiler.beginFrame( commandBuffer );
+      profiler.beginScope( commandBuffer, "frame" );
+      profiler.beginScope( commandBuffer, "shadow" );
+      profiler.endScope( commandBuffer );
+      profiler.beginScope( commandBuffer, "main \"pass\"" );
+      profiler.endScope( commandBuffer );
+      profiler.endScope( commandBuffer );
+      profiler.endFrame();
+      assert( stub::writeTimestampCount == 6 );
+
+      // the GPU is still busy: nothing is read, and nothing is waited on
+      stub::gpuDone = false;
+      profiler.collect();
+      assert( profiler.getScopes().empty() && ( stub::getResultsCount == 1 ) );
+
+      // the GPU is done; tick 10000 corresponds to 5 ms on the host clock
+      stub::gpuDone     = true;
+      stub::currentTick = 10000;
+      stub::hostNs      = 5000000;
+      profiler.collect();
+      std::vector<vk::raii::su::GpuProfiler::Scope> const & scopes = profiler.getScopes();
+      assert( scopes.size() == 3 );
+      assert( ( scopes[0].name == "frame" ) && ( scopes[0].depth == 0 ) && ( scopes[0].frame == 0 ) );
+      assert( ( scopes[1].name == "shadow" ) && ( scopes[1].depth == 1 ) );
+      assert( ( scopes[2].name == "main \"pass\"" ) && ( scopes[2].depth == 1 ) );
+      // ( 1000 - 10000 ) ticks * 2 ns
+      assert( ( scopes[0].beginNs == 5000000 - 18000 ) && ( scopes[0].endNs == 5000000 - 8000 ) );
+      assert( ( scopes[1].beginNs == 5000000 - 16000 ) && ( scopes[1].endNs - scopes[1].beginNs == 2000 ) );
+      // the nested scopes are within their parent
+      assert( ( scopes[0].beginNs < scopes[1].beginNs ) && ( scopes[2].endNs < scopes[0].endNs ) );
+
+      // frame 1: more scopes than fit into the query pool
+      profiler.beginFrame( commandBuffer );
+      for ( int i = 0; i < 5; i++ )
+      {
+        profiler.beginScope( commandBuffer, "draw" );
+        profiler.endScope( commandBuffer );
+      }
+      profiler.endFrame();
+      assert( profiler.getDroppedScopeCount() == 1 );
+
+      // frame 2 reuses the query pool of frame 0, which has been read already; frame 1 is read in the same batch
+      profiler.beginFrame( commandBuffer );
+      profiler.beginScope( commandBuffer, "frame" );
+      profiler.endScope( commandBuffer );
+      profiler.endFrame();
+      profiler.collect();
+      assert( scopes.size() == 3 + 4 + 1 );
+      assert( ( scopes[3].frame == 1 ) && ( scopes[7].frame == 2 ) );
+
+      // frame 3 reuses the query pool of frame 1; if the results of a frame are not available by the time its pool
+      // is reused, that frame is dropped instead of waited on
+      profiler.beginFrame( commandBuffer );
+      profiler.beginScope( commandBuffer, "frame" );
+      profiler.endScope( commandBuffer );
+      profiler.endFrame();
+      stub::gpuDone = false;
+      profiler.beginFrame( commandBuffer );
+      profiler.endFrame();
+      profiler.beginFrame( commandBuffer );
+      profiler.endFrame();
+      assert( profiler.getDroppedFrameCount() == 1 );
+      stub::gpuDone = true;
+
+      std::string trace = profiler.toChromeTrace();
+      assert( ( trace.front() == '{' ) && ( trace.find( "\"traceEvents\":[" ) != std::string::npos ) );
+      assert( countOccurrences( trace, "\"ph\":\"X\"" ) == scopes.size() );
+      assert( trace.find( "\"name\":\"main \\\"pass\\\"\"" ) != std::string::npos );
+      assert( trace.find( "\"ts\":4982.000,\"dur\":10.000" ) != std::string::npos );
+      (void)trace;
+
+      profiler.clearScopes();
+      assert( profiler.getScopes().empty() );
+    }
+    assert( stub::queryPools.empty() );
+
+    {
+      // uncalibrated, with synchronization2: the first timestamp is mapped to the time it's read
+      vk::raii::su::GpuProfiler profiler( physicalDevice, device, 0, 3, 16, false, true );
+      assert( !profiler.isCalibrated() );
+
+      auto now = []() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch() )
+          .count();
+      };
+      for ( int frame = 0; frame < 3; frame++ )
+      {
+        profiler.beginFrame( commandBuffer );
+        profiler.beginScope( commandBuffer, "frame" );
+        profiler.beginScope( commandBuffer, "compute" );
+        profiler.endScope( commandBuffer );
+        profiler.endScope( commandBuffer );
+        profiler.endFrame();
+      }
+      assert( stub::writeTimestamp2Count == 12 );
+
+      int64_t before = now();
+      profiler.collect();
+      int64_t after = now();
+      std::vector<vk::raii::su::GpuProfiler::Scope> const & scopes = profiler.getScopes();
+      assert( scopes.size() == 6 );
+      assert( ( before <= scopes[0].beginNs ) && ( scopes[0].beginNs <= after ) );
+      assert( ( scopes[0].endNs - scopes[0].beginNs == 6000 ) && ( scopes[1].endNs - scopes[1].beginNs == 2000 ) );
+      // the frames are 4 timestamps apart
+      assert( scopes[2].beginNs - scopes[0].beginNs == 8000 );
+      (void)before;
+      (void)after;
+    }
+
+    std::cout << "GpuProfiler: all checks passed" << std::endl;
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,180 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : ImageGenerators
+//                   Checks the image generators of the samples against straight forward implementations, and measures
+//                   their throughput
+
+#include "../../samples/utils/utils.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// the reference implementations, one byte at a time
+void checkerboard( std::vector<uint8_t> &         data,
+                   vk::Extent2D const &           extent,
+                   vk::DeviceSize                 rowPitch,
+                   std::array<uint8_t, 3> const & rgb0,
+                   std::array<uint8_t, 3> const & rgb1 )
+{
+  for ( uint32_t row = 0; row < extent.height; row++ )
+  {
+    for ( uint32_t col = 0; col < extent.width; col++ )
+    {
+      std::array<uint8_t, 3> const & rgb = ( ( ( row & 0x10 ) == 0 ) ^ ( ( col & 0x10 ) == 0 ) ) ? rgb1 : rgb0;
+      uint8_t *                      p   = &data[row * rowPitch + col * 4];
+      p[0]                               = rgb[0];
+      p[1]                               = rgb[1];
+      p[2]                               = rgb[2];
+      p[3]                               = 255;
+    }
+  }
+}
+
+void monochrome( std::vector<uint8_t> &         data,
+                 vk::Extent2D const &           extent,
+                 vk::DeviceSize                 rowPitch,
+                 std::array<uint8_t, 3> const & rgb )
+{
+  checkerboard( data, extent, rowPitch, rgb, rgb );
+}
+
+void rgbToRgba( std::vector<uint8_t> &       data,
+                vk::Extent2D const &         extent,
+                vk::DeviceSize               rowPitch,
+                std::vector<uint8_t> const & rgb )
+{
+  for ( uint32_t row = 0; row < extent.height; row++ )
+  {
+    for ( uint32_t col = 0; col < extent.width; col++ )
+    {
+      uint8_t *       p = &data[row * rowPitch + col * 4];
+      uint8_t const * s = &rgb[( row * extent.width + col ) * 3];
+      p[0]              = s[0];
+      p[1]              = s[1];
+      p[2]              = s[2];
+      p[3]              = 255;
+    }
+  }
+}
+
+template <typename ImageGenerator>
+double measure( ImageGenerator const & imageGenerator, vk::Extent2D const & extent, size_t iterations )
+{
+  std::vector<uint8_t> data( extent.width * extent.height * 4 );
+  auto                 start = std::chrono::high_resolution_clock::now();
+  for ( size_t i = 0; i < iterations; i++ )
+  {
+    imageGenerator( data.data(), extent, extent.width * 4 );
+  }
+  std::chrono::duration<double> duration = std::chrono::high_resolution_clock::now() - start;
+  return data.size() * iterations / ( duration.count() * 1024.0 * 1024.0 );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    // the packed sizes of the staging buffers, in whole texel blocks
+    assert( vk::su::getPackedRowPitch( vk::Format::eR8G8B8A8Unorm, 7 ) == 28 );
+    assert( vk::su::getPackedImageSize( vk::Format::eR8G8B8A8Unorm, { 7, 5 } ) == 140 );
+    assert( vk::su::getPackedRowPitch( vk::Format::eBc1RgbUnormBlock, 7 ) == 16 );
+    assert( vk::su::getPackedImageSize( vk::Format::eBc1RgbUnormBlock, { 7, 5 } ) == 32 );
+    assert( vk::su::getPackedImageSize( vk::Format::eAstc10x8UnormBlock, { 21, 8 } ) == 48 );
+
+    std::array<uint8_t, 3> rgb0 = { { 10, 20, 30 } };
+    std::array<uint8_t, 3> rgb1 = { { 200, 210, 220 } };
+
+    // odd extents and padded rows, small and big enough to be spread over threads
+    std::vector<vk::Extent2D> extents = { { 1, 1 }, { 7, 5 }, { 33, 17 }, { 255, 129 }, { 1023, 1031 } };
+    for ( auto const & extent : extents )
+    {
+      for ( vk::DeviceSize padding : { 0, 12, 64 } )
+      {
+        vk::DeviceSize       rowPitch = extent.width * 4 + padding;
+        std::vector<uint8_t> expected( rowPitch * extent.height, 0 );
+        std::vector<uint8_t> data( rowPitch * extent.height, 0 );
+
+        checkerboard( expected, extent, rowPitch, rgb0, rgb1 );
+        vk::su::CheckerboardImageGenerator( rgb0, rgb1 )( data.data(), extent, rowPitch );
+        assert( data == expected );
+
+        monochrome( expected, extent, rowPitch, rgb1 );
+        vk::su::MonochromeImageGenerator( rgb1 )( data.data(), extent, rowPitch );
+        assert( data == expected );
+
+        std::vector<uint8_t> rgb( extent.width * extent.height * 3 );
+        for ( size_t i = 0; i < rgb.size(); i++ )
+        {
+          rgb[i] = static_cast<uint8_t>( i * 7 + 3 );
+        }
+        rgbToRgba( expected, extent, rowPitch, rgb );
+        vk::su::PixelsImageGenerator( extent, 3, rgb.data() )( data.data(), extent, rowPitch );
+        assert( data == expected );
+      }
+    }
+
+    // sRGB conversions: the end points are kept, and the round trip is close to the identity
+    std::vector<uint8_t> rgba( 256 * 4 ), linear( 256 * 4 ), srgb( 256 * 4 );
+    for ( size_t i = 0; i < 256; i++ )
+    {
+      rgba[4 * i + 0] = rgba[4 * i + 1] = rgba[4 * i + 2] = static_cast<uint8_t>( i );
+      rgba[4 * i + 3]                                     = static_cast<uint8_t>( 255 - i );
+    }
+    vk::su::convertRGBAToRGBA( linear.data(), rgba.data(), 256, vk::su::ColorConversion::eSrgbToLinear );
+    vk::su::convertRGBAToRGBA( srgb.data(), linear.data(), 256, vk::su::ColorConversion::eLinearToSrgb );
+    assert( ( linear[0] == 0 ) && ( linear[4 * 255] == 255 ) && ( linear[4 * 128] < 128 ) );
+    for ( size_t i = 0; i < 256; i++ )
+    {
+      assert( linear[4 * i + 3] == rgba[4 * i + 3] );
+      // the dark sRGB values are squeezed together in the 8 bit linear space, so only check the brighter ones
+      assert( ( i < 64 ) || ( std::abs( srgb[4 * i] - rgba[4 * i] ) <= 2 ) );
+    }
+
+    // throughput
+    vk::Extent2D               extent( 4096, 4096 );
+    const size_t               iterations = 8;
+    std::vector<unsigned char> rgbPixels( extent.width * extent.height * 3, 128 );
+    std::cout << std::fixed << std::setprecision( 1 );
+    std::cout << "CheckerboardImageGenerator  : "
+              << measure( vk::su::CheckerboardImageGenerator( rgb0, rgb1 ), extent, iterations ) << " MB/s\n";
+    std::cout << "MonochromeImageGenerator    : "
+              << measure( vk::su::MonochromeImageGenerator( rgb0 ), extent, iterations ) << " MB/s\n";
+    std::cout << "PixelsImageGenerator (RGB)  : "
+              << measure( vk::su::PixelsImageGenerator( extent, 3, rgbPixels.data() ), extent, iterations )
+              << " MB/s\n";
+    std::cout << "PixelsImageGenerator (sRGB) : "
+              << measure( vk::su::PixelsImageGenerator(
+                            extent, 3, rgbPixels.data(), vk::su::ColorConversion::eSrgbToLinear ),
+                          extent,
+                          iterations )
+              << " MB/s\n";
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
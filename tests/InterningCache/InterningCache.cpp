@@ -0,0 +1,273 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : InterningCache
+//                   Checks the generated interning caches of the raii handles against a stubbed dispatcher: equal
+//                   create infos give the same handle, also from many threads, and unused handles are trimmed
+
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan_raii.hpp"
+
+#include <array>
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+namespace stub
+{
+  std::atomic<uint64_t> handleCounter( 0 );
+  std::atomic<uint64_t> createdCount( 0 );
+  std::atomic<uint64_t> destroyedCount( 0 );
+
+  template <typename HandleType>
+  HandleType createHandle()
+  {
+    createdCount++;
+    return (HandleType)( ++handleCounter );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateSampler( VkDevice,
+                                                  const VkSamplerCreateInfo *,
+                                                  const VkAllocationCallbacks *,
+                                                  VkSampler * pSampler )
+  {
+    *pSampler = createHandle<VkSampler>();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySampler( VkDevice, VkSampler, const VkAllocationCallbacks * )
+  {
+    destroyedCount++;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateDescriptorSetLayout( VkDevice,
+                                                              const VkDescriptorSetLayoutCreateInfo *,
+                                                              const VkAllocationCallbacks *,
+                                                              VkDescriptorSetLayout * pSetLayout )
+  {
+    *pSetLayout = createHandle<VkDescriptorSetLayout>();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDescriptorSetLayout( VkDevice,
+                                                           VkDescriptorSetLayout,
+                                                           const VkAllocationCallbacks * )
+  {
+    destroyedCount++;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreatePipelineLayout( VkDevice,
+                                                         const VkPipelineLayoutCreateInfo *,
+                                                         const VkAllocationCallbacks *,
+                                                         VkPipelineLayout * pPipelineLayout )
+  {
+    *pPipelineLayout = createHandle<VkPipelineLayout>();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyPipelineLayout( VkDevice, VkPipelineLayout, const VkAllocationCallbacks * )
+  {
+    destroyedCount++;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass( VkDevice,
+                                                     const VkRenderPassCreateInfo *,
+                                                     const VkAllocationCallbacks *,
+                                                     VkRenderPass * pRenderPass )
+  {
+    *pRenderPass = createHandle<VkRenderPass>();
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyRenderPass( VkDevice, VkRenderPass, const VkAllocationCallbacks * )
+  {
+    destroyedCount++;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCreateSampler )
+    STUB_PROC_ADDR( vkDestroySampler )
+    STUB_PROC_ADDR( vkCreateDescriptorSetLayout )
+    STUB_PROC_ADDR( vkDestroyDescriptorSetLayout )
+    STUB_PROC_ADDR( vkCreatePipelineLayout )
+    STUB_PROC_ADDR( vkDestroyPipelineLayout )
+    STUB_PROC_ADDR( vkCreateRenderPass )
+    STUB_PROC_ADDR( vkDestroyRenderPass )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    // equal create infos give the same sampler, a different one gives another sampler
+    {
+      vk::raii::SamplerInterningCache samplerCache( device );
+
+      vk::SamplerCreateInfo linearCreateInfo( {}, vk::Filter::eLinear, vk::Filter::eLinear );
+      vk::SamplerCreateInfo nearestCreateInfo( {}, vk::Filter::eNearest, vk::Filter::eNearest );
+
+      std::shared_ptr<vk::raii::Sampler const> linear0  = samplerCache.get( linearCreateInfo );
+      std::shared_ptr<vk::raii::Sampler const> linear1  = samplerCache.get( linearCreateInfo );
+      std::shared_ptr<vk::raii::Sampler const> nearest0 = samplerCache.get( nearestCreateInfo );
+      assert( ( linear0 == linear1 ) && ( linear0 != nearest0 ) && ( **linear0 != **nearest0 ) );
+      assert( stub::createdCount == 2 );
+
+      // a create info with a pNext chain is not keyed, and gives a sampler of its own
+      vk::SamplerReductionModeCreateInfo reductionModeCreateInfo( vk::SamplerReductionMode::eMin );
+      vk::SamplerCreateInfo              chainedCreateInfo = linearCreateInfo;
+      chainedCreateInfo.pNext                              = &reductionModeCreateInfo;
+
+      std::shared_ptr<vk::raii::Sampler const> chained = samplerCache.get( chainedCreateInfo );
+      assert( ( chained != linear0 ) && ( stub::createdCount == 3 ) );
+
+      vk::raii::SamplerInterningCache::Statistics statistics = samplerCache.getStatistics();
+      assert( ( statistics.size == 2 ) && ( statistics.hits == 1 ) && ( statistics.misses == 2 ) &&
+              ( statistics.uncached == 1 ) );
+
+      // the unused sampler is trimmed, the one still held is kept
+      linear0.reset();
+      linear1.reset();
+      assert( samplerCache.trim() == 1 );
+      assert( ( samplerCache.getStatistics().size == 1 ) && ( stub::destroyedCount == 1 ) );
+      assert( samplerCache.get( nearestCreateInfo ) == nearest0 );
+      (void)statistics;
+    }
+    // the handles handed out outlive the cache
+    assert( stub::createdCount == stub::destroyedCount );
+
+    // the keys are deep: the arrays of equal create infos may be at different addresses
+    {
+      vk::raii::DescriptorSetLayoutInterningCache descriptorSetLayoutCache( device );
+
+      std::array<vk::DescriptorSetLayoutBinding, 2> bindings0 = {
+        { vk::DescriptorSetLayoutBinding( 0, vk::DescriptorType::eUniformBuffer, 1, vk::ShaderStageFlagBits::eVertex ),
+          vk::DescriptorSetLayoutBinding(
+            1, vk::DescriptorType::eCombinedImageSampler, 1, vk::ShaderStageFlagBits::eFragment ) }
+      };
+      std::array<vk::DescriptorSetLayoutBinding, 2> bindings1 = bindings0;
+
+      std::shared_ptr<vk::raii::DescriptorSetLayout const> layout0 =
+        descriptorSetLayoutCache.get( vk::DescriptorSetLayoutCreateInfo( {}, bindings0 ) );
+      std::shared_ptr<vk::raii::DescriptorSetLayout const> layout1 =
+        descriptorSetLayoutCache.get( vk::DescriptorSetLayoutCreateInfo( {}, bindings1 ) );
+      assert( layout0 == layout1 );
+
+      bindings1[1].stageFlags |= vk::ShaderStageFlagBits::eVertex;
+      std::shared_ptr<vk::raii::DescriptorSetLayout const> layout2 =
+        descriptorSetLayoutCache.get( vk::DescriptorSetLayoutCreateInfo( {}, bindings1 ) );
+      assert( layout2 != layout0 );
+
+      // the immutable samplers are part of the key
+      vk::raii::SamplerInterningCache samplerCache( device );
+      vk::Sampler immutableSampler = **samplerCache.get( vk::SamplerCreateInfo() );
+      bindings1[1].stageFlags      = vk::ShaderStageFlagBits::eFragment;
+      bindings1[1].setImmutableSamplers( immutableSampler );
+      std::shared_ptr<vk::raii::DescriptorSetLayout const> layout3 =
+        descriptorSetLayoutCache.get( vk::DescriptorSetLayoutCreateInfo( {}, bindings1 ) );
+      assert( ( layout3 != layout0 ) && ( layout3 != layout2 ) );
+
+      // a pipeline layout keyed by the interned set layout
+      vk::raii::PipelineLayoutInterningCache pipelineLayoutCache( device );
+      vk::DescriptorSetLayout                setLayout = **layout0;
+      vk::PushConstantRange                  pushConstantRange( vk::ShaderStageFlagBits::eVertex, 0, 64 );
+      std::shared_ptr<vk::raii::PipelineLayout const> pipelineLayout0 =
+        pipelineLayoutCache.get( vk::PipelineLayoutCreateInfo( {}, setLayout, pushConstantRange ) );
+      std::shared_ptr<vk::raii::PipelineLayout const> pipelineLayout1 =
+        pipelineLayoutCache.get( vk::PipelineLayoutCreateInfo( {}, setLayout, pushConstantRange ) );
+      assert( pipelineLayout0 == pipelineLayout1 );
+    }
+    assert( stub::createdCount == stub::destroyedCount );
+
+    // many threads asking for the same few render passes create each of them once
+    {
+      const uint32_t threadCount     = 8;
+      const uint32_t getsPerThread   = 10000;
+      const uint32_t renderPassCount = 16;
+
+      vk::raii::RenderPassInterningCache renderPassCache( device );
+      uint64_t                           createdBefore = stub::createdCount;
+
+      std::vector<std::thread> threads;
+      for ( uint32_t t = 0; t < threadCount; t++ )
+      {
+        threads.push_back( std::thread( [&renderPassCache, t]() {
+          for ( uint32_t i = 0; i < getsPerThread; i++ )
+          {
+            // each of the render passes differs in the format of its color attachment
+            vk::Format format = static_cast<vk::Format>( static_cast<uint32_t>( vk::Format::eR8Unorm ) +
+                                                         ( t + i ) % renderPassCount );
+            vk::AttachmentDescription colorAttachment( {},
+                                                       format,
+                                                       vk::SampleCountFlagBits::e1,
+                                                       vk::AttachmentLoadOp::eClear,
+                                                       vk::AttachmentStoreOp::eStore,
+                                                       vk::AttachmentLoadOp::eDontCare,
+                                                       vk::AttachmentStoreOp::eDontCare,
+                                                       vk::ImageLayout::eUndefined,
+                                                       vk::ImageLayout::ePresentSrcKHR );
+            vk::AttachmentReference colorReference( 0, vk::ImageLayout::eColorAttachmentOptimal );
+            vk::SubpassDescription  subpass( {}, vk::PipelineBindPoint::eGraphics, {}, colorReference );
+            std::shared_ptr<vk::raii::RenderPass const> renderPass =
+              renderPassCache.get( vk::RenderPassCreateInfo( {}, colorAttachment, subpass ) );
+            assert( renderPass && **renderPass );
+          }
+        } ) );
+      }
+      for ( auto & thread : threads )
+      {
+        thread.join();
+      }
+
+      vk::raii::RenderPassInterningCache::Statistics statistics = renderPassCache.getStatistics();
+      assert( ( statistics.size == renderPassCount ) && ( statistics.misses == renderPassCount ) );
+      assert( statistics.hits == threadCount * getsPerThread - renderPassCount );
+      assert( stub::createdCount - createdBefore == renderPassCount );
+      (void)createdBefore;
+
+      std::cout << "InterningCache: " << threadCount * getsPerThread << " gets on " << threadCount << " threads, "
+                << statistics.misses << " render passes created, " << statistics.hits << " hits\n";
+    }
+    assert( stub::createdCount == stub::destroyedCount );
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
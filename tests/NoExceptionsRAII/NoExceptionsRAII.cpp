@@ -0,0 +1,78 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Samples : NoExceptionsRAII
+//                     Compile test on the raii classes with VULKAN_HPP_NO_EXCEPTIONS set, using the create functions
+//                     Note: this is _no_ functional test!! Don't ever code this way!!
+
+#define VULKAN_HPP_NO_EXCEPTIONS
+
+#include "vulkan/vulkan_raii.hpp"
+
+#include <iostream>
+
+static char const * AppName    = "NoExceptionsRAII";
+static char const * EngineName = "Vulkan.hpp";
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  vk::raii::Context context;
+
+  vk::ApplicationInfo appInfo( AppName, 1, EngineName, 1, VK_API_VERSION_1_1 );
+  auto instance = vk::raii::Instance::create( context, vk::InstanceCreateInfo( {}, &appInfo ) );
+  if ( !instance )
+  {
+    std::cout << "failed to create an instance: " << vk::to_string( instance.result() ) << std::endl;
+    return -1;
+  }
+
+  vk::raii::PhysicalDevices physicalDevices( *instance );
+  assert( !physicalDevices.empty() );
+
+  // get the QueueFamilyProperties of the first PhysicalDevice
+  std::vector<vk::QueueFamilyProperties> queueFamilyProperties = physicalDevices[0].getQueueFamilyProperties();
+
+  // get the first index into queueFamiliyProperties which supports graphics
+  size_t graphicsQueueFamilyIndex = std::distance( queueFamilyProperties.begin(),
+                                                   std::find_if( queueFamilyProperties.begin(),
+                                                                 queueFamilyProperties.end(),
+                                                                 []( vk::QueueFamilyProperties const & qfp ) {
+                                                                   return qfp.queueFlags & vk::QueueFlagBits::eGraphics;
+                                                                 } ) );
+  assert( graphicsQueueFamilyIndex < queueFamilyProperties.size() );
+
+  // create a Device
+  float                     queuePriority = 0.0f;
+  vk::DeviceQueueCreateInfo deviceQueueCreateInfo(
+    vk::DeviceQueueCreateFlags(), static_cast<uint32_t>( graphicsQueueFamilyIndex ), 1, &queuePriority );
+  auto device = vk::raii::Device::create(
+    physicalDevices[0], vk::DeviceCreateInfo( vk::DeviceCreateFlags(), deviceQueueCreateInfo ) );
+  if ( !device )
+  {
+    std::cout << "failed to create a device: " << vk::to_string( device.result() ) << std::endl;
+    return -1;
+  }
+
+  // create a CommandPool to allocate a CommandBuffer from
+  auto commandPool = vk::raii::CommandPool::create(
+    *device, vk::CommandPoolCreateInfo( vk::CommandPoolCreateFlags(), deviceQueueCreateInfo.queueFamilyIndex ) );
+  assert( commandPool );
+
+  // allocate a CommandBuffer from the CommandPool
+  auto commandBuffers = vk::raii::CommandBuffers::create(
+    *device, vk::CommandBufferAllocateInfo( **commandPool, vk::CommandBufferLevel::ePrimary, 1 ) );
+  assert( commandBuffers && ( commandBuffers->size() == 1 ) );
+
+  return 0;
+}
@@ -0,0 +1,340 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : ParallelCommandRecorder
+//                   Checks vk::su::ParallelCommandRecorder against a stubbed dispatcher and measures its scaling over
+//                   the number of recording threads
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace stub
+{
+  struct CommandBuffer
+  {
+    bool                        recording = false;
+    bool                        secondary = false;
+    std::vector<uint32_t>       draws;
+    std::vector<CommandBuffer *> executed;
+  };
+
+  // command pools and buffers are only created, reset and destroyed on the main thread, so no locking is needed
+  // for these; a command buffer in turn is only recorded by one thread at a time
+  std::map<uint64_t, std::vector<CommandBuffer *>> commandPools;
+  uint64_t                                         commandPoolCounter = 0;
+
+  // the creation of the next command pool or the allocation of the next command buffer beyond these limits fails
+  size_t commandPoolLimit   = ~size_t( 0 );
+  size_t commandBufferLimit = ~size_t( 0 );
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool( VkDevice,
+                                                      const VkCommandPoolCreateInfo *,
+                                                      const VkAllocationCallbacks *,
+                                                      VkCommandPool * pCommandPool )
+  {
+    if ( commandPoolLimit <= commandPools.size() )
+    {
+      return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    *pCommandPool = (VkCommandPool)( ++commandPoolCounter );
+    commandPools[commandPoolCounter];
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool( VkDevice, VkCommandPool commandPool, const VkAllocationCallbacks * )
+  {
+    assert( commandPools.find( (uint64_t)commandPool ) != commandPools.end() );
+    assert( commandPools[(uint64_t)commandPool].empty() );
+    commandPools.erase( (uint64_t)commandPool );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool( VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags )
+  {
+    // resetting the pool moves all its command buffers back to the initial state, even those still recording
+    for ( auto commandBuffer : commandPools[(uint64_t)commandPool] )
+    {
+      commandBuffer->recording = false;
+      commandBuffer->draws.clear();
+      commandBuffer->executed.clear();
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers( VkDevice,
+                                                           const VkCommandBufferAllocateInfo * pAllocateInfo,
+                                                           VkCommandBuffer *                   pCommandBuffers )
+  {
+    size_t commandBufferCount = 0;
+    for ( auto const & commandPool : commandPools )
+    {
+      commandBufferCount += commandPool.second.size();
+    }
+    if ( commandBufferLimit < commandBufferCount + pAllocateInfo->commandBufferCount )
+    {
+      return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    for ( uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++ )
+    {
+      CommandBuffer * commandBuffer = new CommandBuffer;
+      commandBuffer->secondary      = ( pAllocateInfo->level == VK_COMMAND_BUFFER_LEVEL_SECONDARY );
+      commandPools[(uint64_t)pAllocateInfo->commandPool].push_back( commandBuffer );
+      pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>( commandBuffer );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice,
+                                                   VkCommandPool           commandPool,
+                                                   uint32_t                commandBufferCount,
+                                                   const VkCommandBuffer * pCommandBuffers )
+  {
+    std::vector<CommandBuffer *> & commandBuffers = commandPools[(uint64_t)commandPool];
+    for ( uint32_t i = 0; i < commandBufferCount; i++ )
+    {
+      CommandBuffer * commandBuffer = reinterpret_cast<CommandBuffer *>( pCommandBuffers[i] );
+      commandBuffers.erase( std::find( commandBuffers.begin(), commandBuffers.end(), commandBuffer ) );
+      delete commandBuffer;
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer( VkCommandBuffer                  commandBuffer,
+                                                       const VkCommandBufferBeginInfo * pBeginInfo )
+  {
+    CommandBuffer * cb = reinterpret_cast<CommandBuffer *>( commandBuffer );
+    assert( cb->secondary && !cb->recording );
+    // the pools are created without VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, so they need to be reset before
+    // any re-recording
+    assert( cb->draws.empty() );
+    assert( ( pBeginInfo->flags & VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT ) && pBeginInfo->pInheritanceInfo &&
+            pBeginInfo->pInheritanceInfo->renderPass );
+    cb->recording = true;
+    (void)pBeginInfo;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer( VkCommandBuffer commandBuffer )
+  {
+    CommandBuffer * cb = reinterpret_cast<CommandBuffer *>( commandBuffer );
+    assert( cb->recording );
+    cb->recording = false;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL
+    vkCmdDraw( VkCommandBuffer commandBuffer, uint32_t, uint32_t, uint32_t, uint32_t firstInstance )
+  {
+    CommandBuffer * cb = reinterpret_cast<CommandBuffer *>( commandBuffer );
+    assert( cb->recording );
+    cb->draws.push_back( firstInstance );
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdExecuteCommands( VkCommandBuffer         commandBuffer,
+                                                   uint32_t                commandBufferCount,
+                                                   const VkCommandBuffer * pCommandBuffers )
+  {
+    CommandBuffer * cb = reinterpret_cast<CommandBuffer *>( commandBuffer );
+    for ( uint32_t i = 0; i < commandBufferCount; i++ )
+    {
+      assert( !reinterpret_cast<CommandBuffer *>( pCommandBuffers[i] )->recording );
+      cb->executed.push_back( reinterpret_cast<CommandBuffer *>( pCommandBuffers[i] ) );
+    }
+  }
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCreateCommandPool )
+    STUB_PROC_ADDR( vkDestroyCommandPool )
+    STUB_PROC_ADDR( vkResetCommandPool )
+    STUB_PROC_ADDR( vkAllocateCommandBuffers )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkBeginCommandBuffer )
+    STUB_PROC_ADDR( vkEndCommandBuffer )
+    STUB_PROC_ADDR( vkCmdDraw )
+    STUB_PROC_ADDR( vkCmdExecuteCommands )
+    return nullptr;
+  }
+}  // namespace stub
+
+// returns the draws of all the secondary command buffers executed by primary, in execution order
+std::vector<uint32_t> gatherDraws( stub::CommandBuffer const & primary )
+{
+  std::vector<uint32_t> draws;
+  for ( auto secondary : primary.executed )
+  {
+    draws.insert( draws.end(), secondary->draws.begin(), secondary->draws.end() );
+  }
+  return draws;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyDevice;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::Device device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    stub::CommandBuffer primary;
+    vk::CommandBuffer   primaryCommandBuffer( reinterpret_cast<VkCommandBuffer>( &primary ) );
+
+    int                              dummyRenderPass;
+    vk::CommandBufferInheritanceInfo inheritanceInfo(
+      vk::RenderPass( (VkRenderPass)( reinterpret_cast<uintptr_t>( &dummyRenderPass ) ) ), 0 );
+
+    vk::su::ParallelCommandRecorder::RecordFunction recordFunction =
+      []( vk::CommandBuffer const & commandBuffer, uint32_t first, uint32_t count ) {
+        for ( uint32_t i = first; i < first + count; i++ )
+        {
+          commandBuffer.draw( 36, 1, 0, i );
+        }
+      };
+
+    // fewer items than threads, and no items at all
+    {
+      vk::su::ParallelCommandRecorder recorder( device, 0, 4 );
+      for ( uint32_t itemCount = 0; itemCount < 6; itemCount++ )
+      {
+        primary.executed.clear();
+        recorder.record( device, itemCount % 2, primaryCommandBuffer, inheritanceInfo, itemCount, recordFunction );
+        assert( primary.executed.size() == std::min<size_t>( itemCount, 4 ) );
+        std::vector<uint32_t> draws = gatherDraws( primary );
+        std::vector<uint32_t> expected( itemCount );
+        std::iota( expected.begin(), expected.end(), 0 );
+        assert( draws == expected );
+      }
+      recorder.clear( device );
+    }
+
+    // an exception thrown on a worker thread is re-thrown by record, and the recorder stays usable
+    {
+      vk::su::ParallelCommandRecorder recorder( device, 0, 3, 1 );
+      bool                            caught = false;
+      try
+      {
+        recorder.record( device,
+                         0,
+                         primaryCommandBuffer,
+                         inheritanceInfo,
+                         30,
+                         []( vk::CommandBuffer const &, uint32_t first, uint32_t ) {
+                           if ( first == 20 )
+                           {
+                             throw std::runtime_error( "failing slice" );
+                           }
+                         } );
+      }
+      catch ( std::runtime_error const & )
+      {
+        caught = true;
+      }
+      assert( caught );
+      (void)caught;
+
+      // the failed slice has been left in recording state, the next reset of the pools takes care of that
+      primary.executed.clear();
+      recorder.record( device, 0, primaryCommandBuffer, inheritanceInfo, 30, recordFunction );
+      assert( gatherDraws( primary ).size() == 30 );
+      recorder.clear( device );
+    }
+    assert( stub::commandPools.empty() );
+
+    // a constructor failing part way through destroys the pools created so far
+    bool caught            = false;
+    stub::commandPoolLimit = 5;
+    try
+    {
+      vk::su::ParallelCommandRecorder recorder( device, 0, 3, 2 );
+    }
+    catch ( vk::OutOfHostMemoryError const & )
+    {
+      caught = true;
+    }
+    assert( caught && stub::commandPools.empty() );
+    stub::commandPoolLimit = ~size_t( 0 );
+
+    caught                   = false;
+    stub::commandBufferLimit = 3;
+    try
+    {
+      vk::su::ParallelCommandRecorder recorder( device, 0, 3, 2 );
+    }
+    catch ( vk::OutOfDeviceMemoryError const & )
+    {
+      caught = true;
+    }
+    assert( caught && stub::commandPools.empty() );
+    stub::commandBufferLimit = ~size_t( 0 );
+    (void)caught;
+
+    // scalability over the number of threads
+    const uint32_t itemCount  = 50000;
+    const uint32_t frameCount = 20;
+    uint32_t       maxThreads = std::min( 16u, std::max( 1u, std::thread::hardware_concurrency() ) );
+    double         singleThreadedTime = 0.0;
+    std::cout << std::setw( 8 ) << "threads" << std::setw( 16 ) << "draws / ms" << std::setw( 10 ) << "speedup"
+              << std::endl;
+    for ( uint32_t threads = 1; threads <= maxThreads; threads++ )
+    {
+      vk::su::ParallelCommandRecorder recorder( device, 0, threads );
+
+      std::chrono::duration<double, std::milli> duration( 0.0 );
+      for ( uint32_t frame = 0; frame < frameCount; frame++ )
+      {
+        primary.executed.clear();
+        auto start = std::chrono::high_resolution_clock::now();
+        recorder.record( device, frame % 2, primaryCommandBuffer, inheritanceInfo, itemCount, recordFunction );
+        duration += std::chrono::high_resolution_clock::now() - start;
+        assert( gatherDraws( primary ).size() == itemCount );
+      }
+      if ( threads == 1 )
+      {
+        singleThreadedTime = duration.count();
+      }
+      std::cout << std::setw( 8 ) << threads << std::setw( 16 ) << std::fixed << std::setprecision( 1 )
+                << itemCount * frameCount / duration.count() << std::setw( 10 ) << std::setprecision( 2 )
+                << singleThreadedTime / duration.count() << std::endl;
+
+      recorder.clear( device );
+    }
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,248 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : PhysicalDeviceCapabilities
+//                   Checks vk::su::PhysicalDeviceCapabilities against a stubbed dispatcher: one sweep of queries on
+//                   construction, none afterwards, and a lossless round trip through serialization
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+namespace stub
+{
+  uint32_t queryCount = 0;
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    queryCount++;
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->apiVersion                  = VK_API_VERSION_1_2;
+    pProperties->driverVersion               = 42;
+    pProperties->vendorID                    = 0x10DE;
+    pProperties->deviceID                    = 0x1234;
+    pProperties->deviceType                  = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+    pProperties->pipelineCacheUUID[0]        = 7;
+    pProperties->limits.maxSamplerAnisotropy = 16.0f;
+    strcpy( pProperties->deviceName, "stub device" );
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties2( VkPhysicalDevice              physicalDevice,
+                                                             VkPhysicalDeviceProperties2 * pProperties )
+  {
+    vkGetPhysicalDeviceProperties( physicalDevice, &pProperties->properties );
+    for ( auto next = reinterpret_cast<VkBaseOutStructure *>( pProperties->pNext ); next; next = next->pNext )
+    {
+      if ( next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES )
+      {
+        reinterpret_cast<VkPhysicalDeviceVulkan11Properties *>( next )->maxMultiviewViewCount = 6;
+      }
+      else if ( next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES )
+      {
+        reinterpret_cast<VkPhysicalDeviceVulkan12Properties *>( next )->maxUpdateAfterBindDescriptorsInAllPools = 1000;
+      }
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures( VkPhysicalDevice, VkPhysicalDeviceFeatures * pFeatures )
+  {
+    queryCount++;
+    memset( pFeatures, 0, sizeof( VkPhysicalDeviceFeatures ) );
+    pFeatures->samplerAnisotropy = VK_TRUE;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFeatures2( VkPhysicalDevice            physicalDevice,
+                                                           VkPhysicalDeviceFeatures2 * pFeatures )
+  {
+    vkGetPhysicalDeviceFeatures( physicalDevice, &pFeatures->features );
+    for ( auto next = reinterpret_cast<VkBaseOutStructure *>( pFeatures->pNext ); next; next = next->pNext )
+    {
+      if ( next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES )
+      {
+        reinterpret_cast<VkPhysicalDeviceVulkan12Features *>( next )->timelineSemaphore = VK_TRUE;
+      }
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceMemoryProperties( VkPhysicalDevice,
+                                                                  VkPhysicalDeviceMemoryProperties * pMemoryProperties )
+  {
+    queryCount++;
+    memset( pMemoryProperties, 0, sizeof( VkPhysicalDeviceMemoryProperties ) );
+    pMemoryProperties->memoryTypeCount              = 2;
+    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    pMemoryProperties->memoryTypes[1].propertyFlags =
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    pMemoryProperties->memoryHeapCount     = 1;
+    pMemoryProperties->memoryHeaps[0].size = 1 << 30;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL
+    vkGetPhysicalDeviceQueueFamilyProperties( VkPhysicalDevice,
+                                              uint32_t *                pQueueFamilyPropertyCount,
+                                              VkQueueFamilyProperties * pQueueFamilyProperties )
+  {
+    queryCount++;
+    if ( pQueueFamilyProperties )
+    {
+      assert( *pQueueFamilyPropertyCount == 2 );
+      memset( pQueueFamilyProperties, 0, 2 * sizeof( VkQueueFamilyProperties ) );
+      pQueueFamilyProperties[0].queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+      pQueueFamilyProperties[0].queueCount = 16;
+      pQueueFamilyProperties[1].queueFlags = VK_QUEUE_TRANSFER_BIT;
+      pQueueFamilyProperties[1].queueCount = 2;
+    }
+    *pQueueFamilyPropertyCount = 2;
+  }
+
+  // D32Sfloat is not renderable, but D32SfloatS8Uint is; R8G8B8A8Unorm can be sampled with linear tiling and all the
+  // YCbCr formats can be sampled with optimal tiling
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceFormatProperties( VkPhysicalDevice,
+                                                                  VkFormat             format,
+                                                                  VkFormatProperties * pFormatProperties )
+  {
+    queryCount++;
+    memset( pFormatProperties, 0, sizeof( VkFormatProperties ) );
+    switch ( format )
+    {
+      case VK_FORMAT_D32_SFLOAT: pFormatProperties->optimalTilingFeatures = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT; break;
+      case VK_FORMAT_D32_SFLOAT_S8_UINT:
+        pFormatProperties->optimalTilingFeatures = VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT;
+        break;
+      case VK_FORMAT_R8G8B8A8_UNORM:
+        pFormatProperties->linearTilingFeatures  = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+        pFormatProperties->optimalTilingFeatures = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+        break;
+      default:
+        if ( VK_FORMAT_G8B8G8R8_422_UNORM <= format )
+        {
+          pFormatProperties->optimalTilingFeatures = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+        }
+        break;
+    }
+  }
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetPhysicalDeviceProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceProperties2 )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceFeatures )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceFeatures2 )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceMemoryProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceQueueFamilyProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceFormatProperties )
+    return nullptr;
+  }
+}  // namespace stub
+
+void checkCapabilities( vk::su::PhysicalDeviceCapabilities const & capabilities )
+{
+  assert( capabilities.properties.deviceID == 0x1234 );
+  assert( capabilities.features.samplerAnisotropy );
+  assert( capabilities.hasVulkan12() );
+  assert( capabilities.vulkan11Properties.maxMultiviewViewCount == 6 );
+  assert( capabilities.vulkan12Properties.maxUpdateAfterBindDescriptorsInAllPools == 1000 );
+  assert( capabilities.vulkan12Features.timelineSemaphore );
+  assert( !capabilities.vulkan12Features.pNext );
+  assert( capabilities.queueFamilyProperties.size() == 2 );
+  assert( capabilities.queueFamilyProperties[1].queueFlags == vk::QueueFlagBits::eTransfer );
+
+  assert( vk::su::pickDepthFormat( capabilities ) == vk::Format::eD32SfloatS8Uint );
+  assert( capabilities.findSupportedFormat( vk::ImageTiling::eLinear, vk::FormatFeatureFlagBits::eSampledImage ) ==
+          vk::Format::eR8G8B8A8Unorm );
+  assert( capabilities.findSupportedFormat( { vk::Format::eR8G8B8A8Srgb, vk::Format::eG8B8R83Plane420Unorm },
+                                            vk::ImageTiling::eOptimal,
+                                            vk::FormatFeatureFlagBits::eSampledImage ) ==
+          vk::Format::eG8B8R83Plane420Unorm );
+  assert( capabilities.findSupportedFormat( vk::ImageTiling::eLinear,
+                                            vk::FormatFeatureFlagBits::eDepthStencilAttachment ) ==
+          vk::Format::eUndefined );
+  // formats outside the snapshot are not supported at all
+  assert( !capabilities.getFormatProperties( vk::Format::eA4R4G4B4UnormPack16EXT ).optimalTilingFeatures );
+
+  assert( capabilities.findMemoryType( 3, vk::MemoryPropertyFlagBits::eHostVisible ) == 1 );
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ), &stub::vkGetInstanceProcAddr );
+    vk::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ) );
+
+    // the cold start queries everything once...
+    vk::su::PhysicalDeviceCapabilities capabilities( physicalDevice );
+    uint32_t                           coldQueryCount = stub::queryCount;
+    std::cout << "PhysicalDeviceCapabilities: " << coldQueryCount << " queries on a cold start" << std::endl;
+
+    // ... and no query is needed afterwards
+    checkCapabilities( capabilities );
+    assert( stub::queryCount == coldQueryCount );
+
+    // the warm start just needs the properties to check the snapshot
+    std::vector<uint8_t> data = capabilities.serialize();
+    stub::queryCount          = 0;
+    vk::su::PhysicalDeviceCapabilities restored( data );
+    assert( restored.describes( physicalDevice.getProperties() ) );
+    assert( stub::queryCount == 1 );
+    checkCapabilities( restored );
+    assert( restored.serialize() == data );
+
+    // a different driver invalidates the snapshot
+    vk::PhysicalDeviceProperties updatedDriver = physicalDevice.getProperties();
+    updatedDriver.driverVersion++;
+    assert( !restored.describes( updatedDriver ) );
+
+    // malformed data is rejected
+    for ( size_t size : { size_t( 0 ), size_t( 4 ), data.size() - 1, data.size() + 1 } )
+    {
+      std::vector<uint8_t> malformed = data;
+      malformed.resize( size );
+      bool caught = false;
+      try
+      {
+        vk::su::PhysicalDeviceCapabilities rejected( malformed );
+      }
+      catch ( std::runtime_error const & )
+      {
+        caught = true;
+      }
+      assert( caught );
+      (void)caught;
+    }
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,431 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : QueueTopology
+//                   Checks vk::su::selectQueueTopology on devices with and without dedicated transfer and compute
+//                   families, and the ownership transfers of vk::su::TransferScheduler against a stubbed dispatcher
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace stub
+{
+  struct Barrier
+  {
+    VkCommandBuffer      commandBuffer;
+    VkPipelineStageFlags srcStageMask;
+    VkPipelineStageFlags dstStageMask;
+    bool                 isImageBarrier;
+    uint32_t             srcQueueFamilyIndex;
+    uint32_t             dstQueueFamilyIndex;
+    VkImageLayout        oldLayout;
+    VkImageLayout        newLayout;
+  };
+
+  std::vector<VkQueueFamilyProperties> queueFamilyProperties;
+  std::vector<Barrier>                 barriers;
+  uint32_t                             queueFamilyIndex = ~0u;  // the family of the last queue requested
+  uint64_t                             nextHandle       = 1;
+  int                                  commandBufferStorage[16];
+  size_t                               commandBufferCount = 0;
+  uint32_t                             submitCount        = 0;
+  VkSemaphore                          lastSignalSemaphore;
+  uint32_t                             waitForFencesCount = 0;
+
+  VKAPI_ATTR void VKAPI_CALL
+    vkGetPhysicalDeviceQueueFamilyProperties( VkPhysicalDevice,
+                                              uint32_t *                pQueueFamilyPropertyCount,
+                                              VkQueueFamilyProperties * pQueueFamilyProperties )
+  {
+    if ( pQueueFamilyProperties )
+    {
+      assert( *pQueueFamilyPropertyCount <= queueFamilyProperties.size() );
+      memcpy( pQueueFamilyProperties,
+              queueFamilyProperties.data(),
+              *pQueueFamilyPropertyCount * sizeof( VkQueueFamilyProperties ) );
+    }
+    else
+    {
+      *pQueueFamilyPropertyCount = static_cast<uint32_t>( queueFamilyProperties.size() );
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetDeviceQueue( VkDevice, uint32_t queueFamilyIndex_, uint32_t, VkQueue * pQueue )
+  {
+    static int dummyQueue;
+    queueFamilyIndex = queueFamilyIndex_;
+    *pQueue          = reinterpret_cast<VkQueue>( &dummyQueue );
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateCommandPool( VkDevice,
+                                                      const VkCommandPoolCreateInfo * pCreateInfo,
+                                                      const VkAllocationCallbacks *,
+                                                      VkCommandPool *                 pCommandPool )
+  {
+    assert( pCreateInfo->queueFamilyIndex == queueFamilyIndex );
+    (void)pCreateInfo;
+    *pCommandPool = (VkCommandPool)nextHandle++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers( VkDevice,
+                                                           const VkCommandBufferAllocateInfo * pAllocateInfo,
+                                                           VkCommandBuffer *                   pCommandBuffers )
+  {
+    for ( uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++ )
+    {
+      assert( commandBufferCount < 16 );
+      pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>( &commandBufferStorage[commandBufferCount++] );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence( VkDevice,
+                                                const VkFenceCreateInfo * pCreateInfo,
+                                                const VkAllocationCallbacks *,
+                                                VkFence *                 pFence )
+  {
+    assert( pCreateInfo->flags & VK_FENCE_CREATE_SIGNALED_BIT );
+    (void)pCreateInfo;
+    *pFence = (VkFence)nextHandle++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore( VkDevice,
+                                                    const VkSemaphoreCreateInfo *,
+                                                    const VkAllocationCallbacks *,
+                                                    VkSemaphore * pSemaphore )
+  {
+    *pSemaphore = (VkSemaphore)nextHandle++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkWaitForFences( VkDevice, uint32_t, const VkFence *, VkBool32, uint64_t )
+  {
+    waitForFencesCount++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkResetFences( VkDevice, uint32_t, const VkFence * )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkResetCommandPool( VkDevice, VkCommandPool, VkCommandPoolResetFlags )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBeginCommandBuffer( VkCommandBuffer, const VkCommandBufferBeginInfo * )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkEndCommandBuffer( VkCommandBuffer )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit( VkQueue,
+                                                uint32_t             submitCount_,
+                                                const VkSubmitInfo * pSubmits,
+                                                VkFence              fence )
+  {
+    assert( ( submitCount_ == 1 ) && ( pSubmits->commandBufferCount == 1 ) && ( pSubmits->signalSemaphoreCount == 1 ) );
+    assert( fence );
+    (void)submitCount_;
+    (void)fence;
+    submitCount++;
+    lastSignalSemaphore = pSubmits->pSignalSemaphores[0];
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdCopyBuffer( VkCommandBuffer, VkBuffer, VkBuffer, uint32_t, const VkBufferCopy * ) {}
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdCopyBufferToImage(
+    VkCommandBuffer, VkBuffer, VkImage, VkImageLayout dstImageLayout, uint32_t, const VkBufferImageCopy * )
+  {
+    assert( dstImageLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL );
+    (void)dstImageLayout;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkCmdPipelineBarrier( VkCommandBuffer               commandBuffer,
+                                                   VkPipelineStageFlags          srcStageMask,
+                                                   VkPipelineStageFlags          dstStageMask,
+                                                   VkDependencyFlags,
+                                                   uint32_t,
+                                                   const VkMemoryBarrier *,
+                                                   uint32_t                      bufferMemoryBarrierCount,
+                                                   const VkBufferMemoryBarrier * pBufferMemoryBarriers,
+                                                   uint32_t                      imageMemoryBarrierCount,
+                                                   const VkImageMemoryBarrier *  pImageMemoryBarriers )
+  {
+    for ( uint32_t i = 0; i < bufferMemoryBarrierCount; i++ )
+    {
+      barriers.push_back( { commandBuffer,
+                            srcStageMask,
+                            dstStageMask,
+                            false,
+                            pBufferMemoryBarriers[i].srcQueueFamilyIndex,
+                            pBufferMemoryBarriers[i].dstQueueFamilyIndex,
+                            VK_IMAGE_LAYOUT_UNDEFINED,
+                            VK_IMAGE_LAYOUT_UNDEFINED } );
+    }
+    for ( uint32_t i = 0; i < imageMemoryBarrierCount; i++ )
+    {
+      barriers.push_back( { commandBuffer,
+                            srcStageMask,
+                            dstStageMask,
+                            true,
+                            pImageMemoryBarriers[i].srcQueueFamilyIndex,
+                            pImageMemoryBarriers[i].dstQueueFamilyIndex,
+                            pImageMemoryBarriers[i].oldLayout,
+                            pImageMemoryBarriers[i].newLayout } );
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore( VkDevice, VkSemaphore, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyFence( VkDevice, VkFence, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice, VkCommandPool, uint32_t, const VkCommandBuffer * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyCommandPool( VkDevice, VkCommandPool, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetPhysicalDeviceQueueFamilyProperties )
+    STUB_PROC_ADDR( vkGetDeviceQueue )
+    STUB_PROC_ADDR( vkCreateCommandPool )
+    STUB_PROC_ADDR( vkAllocateCommandBuffers )
+    STUB_PROC_ADDR( vkCreateFence )
+    STUB_PROC_ADDR( vkCreateSemaphore )
+    STUB_PROC_ADDR( vkWaitForFences )
+    STUB_PROC_ADDR( vkResetFences )
+    STUB_PROC_ADDR( vkResetCommandPool )
+    STUB_PROC_ADDR( vkBeginCommandBuffer )
+    STUB_PROC_ADDR( vkEndCommandBuffer )
+    STUB_PROC_ADDR( vkQueueSubmit )
+    STUB_PROC_ADDR( vkCmdCopyBuffer )
+    STUB_PROC_ADDR( vkCmdCopyBufferToImage )
+    STUB_PROC_ADDR( vkCmdPipelineBarrier )
+    STUB_PROC_ADDR( vkDestroySemaphore )
+    STUB_PROC_ADDR( vkDestroyFence )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkDestroyCommandPool )
+    return nullptr;
+  }
+}  // namespace stub
+
+VkQueueFamilyProperties makeFamily( VkQueueFlags queueFlags,
+                                    uint32_t     queueCount                  = 1,
+                                    VkExtent3D   minImageTransferGranularity = { 1, 1, 1 } )
+{
+  return { queueFlags, queueCount, 64, minImageTransferGranularity };
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice, dummyGraphicsCommandBuffer;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ) );
+    vk::Device         device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::CommandBuffer  graphicsCommandBuffer( reinterpret_cast<VkCommandBuffer>( &dummyGraphicsCommandBuffer ) );
+
+    const VkQueueFlags universal = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    const VkQueueFlags compute   = VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    const VkQueueFlags transfer  = VK_QUEUE_TRANSFER_BIT;
+
+    // a single universal family: everything falls back to the graphics family
+    stub::queueFamilyProperties = { makeFamily( universal ) };
+    vk::su::QueueTopology topology = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+    assert( ( topology.graphicsQueueFamilyIndex == 0 ) && ( topology.presentQueueFamilyIndex == 0 ) );
+    assert( !topology.hasDedicatedTransfer() && !topology.hasAsyncCompute() );
+    assert( topology.getQueueCreateInfos().size() == 1 );
+
+    // a typical discrete GPU: universal, async compute, and transfer-only families
+    stub::queueFamilyProperties = { makeFamily( universal, 16 ), makeFamily( compute, 2 ), makeFamily( transfer, 2 ) };
+    topology                    = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+    assert( ( topology.graphicsQueueFamilyIndex == 0 ) && ( topology.computeQueueFamilyIndex == 1 ) &&
+            ( topology.transferQueueFamilyIndex == 2 ) );
+    assert( topology.hasDedicatedTransfer() && topology.hasAsyncCompute() );
+    std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos = topology.getQueueCreateInfos();
+    assert( queueCreateInfos.size() == 3 );
+    for ( auto const & dqci : queueCreateInfos )
+    {
+      assert( ( dqci.queueCount == 1 ) && dqci.pQueuePriorities );
+      (void)dqci;
+    }
+
+    // without a transfer-only family, transfers share the async compute family
+    stub::queueFamilyProperties = { makeFamily( universal ), makeFamily( compute ) };
+    topology                    = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+    assert( ( topology.computeQueueFamilyIndex == 1 ) && ( topology.transferQueueFamilyIndex == 1 ) );
+    assert( topology.getQueueCreateInfos().size() == 2 );
+
+    // a transfer-only family listed first, but no compute family without graphics; a family without queues is skipped
+    stub::queueFamilyProperties = { makeFamily( compute, 0 ), makeFamily( transfer ), makeFamily( universal ) };
+    topology                    = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+    assert( ( topology.graphicsQueueFamilyIndex == 2 ) && ( topology.computeQueueFamilyIndex == 2 ) &&
+            ( topology.transferQueueFamilyIndex == 1 ) );
+    assert( topology.hasDedicatedTransfer() && !topology.hasAsyncCompute() );
+
+    // transfer-only families that copy images only in blocks, or only whole mip levels, are skipped
+    stub::queueFamilyProperties = { makeFamily( universal ),
+                                    makeFamily( transfer, 1, { 8, 8, 1 } ),
+                                    makeFamily( transfer, 1, { 0, 0, 0 } ),
+                                    makeFamily( compute ) };
+    topology                    = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+    assert( ( topology.computeQueueFamilyIndex == 3 ) && ( topology.transferQueueFamilyIndex == 3 ) );
+    stub::queueFamilyProperties.push_back( makeFamily( transfer ) );
+    topology = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+    assert( topology.transferQueueFamilyIndex == 4 );
+
+    vk::Buffer                stagingBuffer( (VkBuffer)1001 );
+    vk::Buffer                vertexBuffer( (VkBuffer)1002 );
+    vk::Image                 texture( (VkImage)1003 );
+    vk::ImageSubresourceRange range( vk::ImageAspectFlagBits::eColor, 0, 1, 0, 1 );
+    vk::BufferImageCopy       region(
+      0, 0, 0, vk::ImageSubresourceLayers( vk::ImageAspectFlagBits::eColor, 0, 0, 1 ), {}, { 4, 4, 1 } );
+    auto                      uploadAll = [&]( vk::su::TransferScheduler & scheduler ) {
+      scheduler.copyBuffer( device,
+                            stagingBuffer,
+                            vertexBuffer,
+                            vk::BufferCopy( 0, 0, 256 ),
+                            vk::PipelineStageFlagBits::eVertexInput,
+                            vk::AccessFlagBits::eVertexAttributeRead );
+      scheduler.copyBufferToImage( device,
+                                   stagingBuffer,
+                                   texture,
+                                   range,
+                                   region,
+                                   vk::ImageLayout::eShaderReadOnlyOptimal,
+                                   vk::PipelineStageFlagBits::eFragmentShader,
+                                   vk::AccessFlagBits::eShaderRead );
+    };
+
+    // with a dedicated transfer family, the copies run on the transfer queue and are handed over to graphics
+    {
+      stub::queueFamilyProperties = { makeFamily( universal ), makeFamily( transfer ) };
+      topology                    = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+      vk::su::TransferScheduler scheduler( device, topology );
+      assert( stub::queueFamilyIndex == 1 );
+
+      // nothing to submit
+      std::pair<vk::Semaphore, vk::PipelineStageFlags> wait = scheduler.submit( graphicsCommandBuffer );
+      assert( !wait.first && ( stub::submitCount == 0 ) );
+
+      stub::barriers.clear();
+      uploadAll( scheduler );
+      assert( scheduler.isRecording() );
+      wait = scheduler.submit( graphicsCommandBuffer );
+      assert( !scheduler.isRecording() );
+      assert( ( stub::submitCount == 1 ) && ( static_cast<VkSemaphore>( wait.first ) == stub::lastSignalSemaphore ) );
+      assert( wait.second ==
+              ( vk::PipelineStageFlagBits::eVertexInput | vk::PipelineStageFlagBits::eFragmentShader ) );
+
+      // on the transfer queue: the transition to eTransferDstOptimal and the two release barriers
+      assert( stub::barriers.size() == 5 );
+      VkCommandBuffer transferCommandBuffer = stub::barriers[0].commandBuffer;
+      assert( transferCommandBuffer != static_cast<VkCommandBuffer>( graphicsCommandBuffer ) );
+      (void)transferCommandBuffer;
+      assert( !stub::barriers[0].isImageBarrier && ( stub::barriers[0].srcQueueFamilyIndex == 1 ) &&
+              ( stub::barriers[0].dstQueueFamilyIndex == 0 ) &&
+              ( stub::barriers[0].dstStageMask == VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT ) );
+      assert( stub::barriers[1].isImageBarrier && ( stub::barriers[1].oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ) &&
+              ( stub::barriers[1].srcQueueFamilyIndex == VK_QUEUE_FAMILY_IGNORED ) );
+      assert( stub::barriers[2].isImageBarrier && ( stub::barriers[2].commandBuffer == transferCommandBuffer ) &&
+              ( stub::barriers[2].srcQueueFamilyIndex == 1 ) && ( stub::barriers[2].dstQueueFamilyIndex == 0 ) &&
+              ( stub::barriers[2].oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ) &&
+              ( stub::barriers[2].newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ) );
+
+      // on the graphics queue: the matching acquire barriers, waiting on the stages of the semaphore wait
+      for ( size_t i = 3; i < 5; i++ )
+      {
+        assert( stub::barriers[i].commandBuffer == static_cast<VkCommandBuffer>( graphicsCommandBuffer ) );
+        assert( ( stub::barriers[i].srcQueueFamilyIndex == 1 ) && ( stub::barriers[i].dstQueueFamilyIndex == 0 ) );
+        assert( ( stub::barriers[i].srcStageMask & static_cast<VkPipelineStageFlags>( wait.second ) ) ==
+                stub::barriers[i].srcStageMask );
+      }
+      assert( stub::barriers[4].isImageBarrier &&
+              ( stub::barriers[4].oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL ) &&
+              ( stub::barriers[4].newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ) );
+
+      // the slots are cycled, each one waited on before being reused
+      std::vector<VkSemaphore> semaphores = { stub::lastSignalSemaphore };
+      for ( size_t i = 0; i < 3; i++ )
+      {
+        uploadAll( scheduler );
+        semaphores.push_back( static_cast<VkSemaphore>( scheduler.submit( graphicsCommandBuffer ).first ) );
+      }
+      assert( ( semaphores[0] != semaphores[1] ) && ( semaphores[1] != semaphores[2] ) &&
+              ( semaphores[0] != semaphores[2] ) && ( semaphores[3] == semaphores[0] ) );
+      assert( stub::waitForFencesCount == 4 );
+
+      scheduler.clear( device );
+    }
+
+    // without a dedicated transfer family, there's no ownership to transfer
+    {
+      stub::queueFamilyProperties = { makeFamily( universal ) };
+      topology                    = vk::su::selectQueueTopology( physicalDevice.getQueueFamilyProperties() );
+      vk::su::TransferScheduler scheduler( device, topology, 2 );
+      assert( stub::queueFamilyIndex == 0 );
+
+      stub::barriers.clear();
+      uploadAll( scheduler );
+      std::pair<vk::Semaphore, vk::PipelineStageFlags> wait = scheduler.submit( graphicsCommandBuffer );
+      assert( wait.first );
+      assert( stub::barriers.size() == 3 );
+      for ( auto const & barrier : stub::barriers )
+      {
+        assert( barrier.commandBuffer != static_cast<VkCommandBuffer>( graphicsCommandBuffer ) );
+        assert( ( barrier.srcQueueFamilyIndex == VK_QUEUE_FAMILY_IGNORED ) &&
+                ( barrier.dstQueueFamilyIndex == VK_QUEUE_FAMILY_IGNORED ) );
+        (void)barrier;
+      }
+      // the release barriers are ordinary barriers into the final stages
+      assert( stub::barriers[0].dstStageMask == VK_PIPELINE_STAGE_VERTEX_INPUT_BIT );
+      assert( ( stub::barriers[2].dstStageMask == VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT ) &&
+              ( stub::barriers[2].newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL ) );
+      (void)wait;
+
+      scheduler.clear( device );
+    }
+
+    std::cout << "QueueTopology: all checks passed" << std::endl;
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,186 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : RAIIExpected
+//                   Checks the create functions of the raii handles returning an Expected, and compares handling an
+//                   exhausted descriptor pool via exceptions and via Expected, against a stubbed dispatcher
+
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan_raii.hpp"
+
+#include <chrono>
+#include <iostream>
+
+namespace stub
+{
+  uint32_t  poolCapacity  = 8;
+  uint32_t  poolUsed      = 0;
+  uint32_t  liveSets      = 0;
+  uintptr_t handleCounter = 0;
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets( VkDevice,
+                                                           const VkDescriptorSetAllocateInfo * pAllocateInfo,
+                                                           VkDescriptorSet *                   pDescriptorSets )
+  {
+    if ( poolCapacity < poolUsed + pAllocateInfo->descriptorSetCount )
+    {
+      return VK_ERROR_OUT_OF_POOL_MEMORY;
+    }
+    for ( uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++ )
+    {
+      pDescriptorSets[i] = (VkDescriptorSet)( ++handleCounter );
+    }
+    poolUsed += pAllocateInfo->descriptorSetCount;
+    liveSets += pAllocateInfo->descriptorSetCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkFreeDescriptorSets( VkDevice,
+                                                       VkDescriptorPool,
+                                                       uint32_t descriptorSetCount,
+                                                       const VkDescriptorSet * )
+  {
+    liveSets -= descriptorSetCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateSampler( VkDevice,
+                                                  const VkSamplerCreateInfo * pCreateInfo,
+                                                  const VkAllocationCallbacks *,
+                                                  VkSampler * pSampler )
+  {
+    // a maxAnisotropy above 16 is treated as failing, to test the error path
+    if ( 16.0f < pCreateInfo->maxAnisotropy )
+    {
+      *pSampler = (VkSampler)( 0xBAD );  // the output is undefined on failure
+      return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+    *pSampler = (VkSampler)( ++handleCounter );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySampler( VkDevice, VkSampler sampler, const VkAllocationCallbacks * )
+  {
+    assert( sampler != (VkSampler)( 0xBAD ) );
+    (void)sampler;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkAllocateDescriptorSets )
+    STUB_PROC_ADDR( vkFreeDescriptorSets )
+    STUB_PROC_ADDR( vkCreateSampler )
+    STUB_PROC_ADDR( vkDestroySampler )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice, dummyPool;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    // a successful create function holds the handle
+    vk::raii::Expected<vk::raii::Sampler> sampler = vk::raii::Sampler::create( device, vk::SamplerCreateInfo() );
+    assert( sampler && ( sampler.result() == vk::Result::eSuccess ) && **sampler );
+
+    // and gives const access to it
+    vk::raii::Expected<vk::raii::Sampler> const & constSampler = sampler;
+    assert( ( &constSampler.value() == &*sampler ) && ( **constSampler == **sampler ) );
+    (void)constSampler;
+
+    // a failing create function holds the result, and an empty handle that's not destroyed
+    vk::raii::Expected<vk::raii::Sampler> failedSampler = vk::raii::Sampler::create(
+      device, vk::SamplerCreateInfo().setAnisotropyEnable( true ).setMaxAnisotropy( 32.0f ) );
+    assert( !failedSampler && ( failedSampler.result() == vk::Result::eErrorOutOfDeviceMemory ) );
+
+    vk::DescriptorPool                   pool( reinterpret_cast<VkDescriptorPool>( &dummyPool ) );
+    std::vector<vk::DescriptorSetLayout> layouts( 4 );
+    vk::DescriptorSetAllocateInfo        allocateInfo( pool, layouts );
+
+    {
+      auto descriptorSets = vk::raii::DescriptorSets::create( device, allocateInfo );
+      assert( descriptorSets && ( descriptorSets->size() == 4 ) && ( stub::liveSets == 4 ) );
+      auto exhausted = vk::raii::DescriptorSets::create( device, allocateInfo );
+      assert( exhausted && ( stub::liveSets == 8 ) );
+      exhausted = vk::raii::DescriptorSets::create( device, allocateInfo );
+      assert( !exhausted && ( exhausted.result() == vk::Result::eErrorOutOfPoolMemory ) && ( stub::liveSets == 4 ) );
+    }
+    assert( stub::liveSets == 0 );
+
+    // the renderer pattern: allocate until the pool is exhausted, then "grow" to a new pool and try again
+    const size_t iterations = 1000 * 1000;
+    stub::poolCapacity      = 64;
+
+    size_t poolCount = 0;
+    stub::poolUsed   = 0;
+    auto start       = std::chrono::high_resolution_clock::now();
+    for ( size_t i = 0; i < iterations; i++ )
+    {
+      try
+      {
+        vk::raii::DescriptorSets descriptorSets( device, allocateInfo );
+      }
+      catch ( vk::OutOfPoolMemoryError const & )
+      {
+        stub::poolUsed = 0;
+        poolCount++;
+      }
+    }
+    std::chrono::duration<double, std::milli> throwDuration = std::chrono::high_resolution_clock::now() - start;
+
+    size_t expectedPoolCount = 0;
+    stub::poolUsed           = 0;
+    start                    = std::chrono::high_resolution_clock::now();
+    for ( size_t i = 0; i < iterations; i++ )
+    {
+      auto descriptorSets = vk::raii::DescriptorSets::create( device, allocateInfo );
+      if ( !descriptorSets )
+      {
+        assert( descriptorSets.result() == vk::Result::eErrorOutOfPoolMemory );
+        stub::poolUsed = 0;
+        expectedPoolCount++;
+      }
+    }
+    std::chrono::duration<double, std::milli> expectedDuration = std::chrono::high_resolution_clock::now() - start;
+    assert( poolCount == expectedPoolCount );
+    assert( stub::liveSets == 0 );
+
+    std::cout << "RAIIExpected: " << iterations << " allocations with " << poolCount << " pool exhaustions\n";
+    std::cout << "  exceptions: " << throwDuration.count() << " ms\n";
+    std::cout << "  Expected:   " << expectedDuration.count() << " ms" << std::endl;
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
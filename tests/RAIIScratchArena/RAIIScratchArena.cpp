@@ -0,0 +1,229 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : RAIIScratchArena
+//                   Counts the heap allocations of the raii handle collections against a stubbed dispatcher: the
+//                   transient arrays come from the per-thread scratch arena, and the pmr collections allocate nothing
+
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan_raii.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+static size_t allocationCount = 0;
+
+void * operator new( size_t size )
+{
+  allocationCount++;
+  void * p = std::malloc( size ? size : 1 );
+  if ( !p )
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete( void * p ) noexcept
+{
+  std::free( p );
+}
+
+void operator delete( void * p, size_t ) noexcept
+{
+  std::free( p );
+}
+
+namespace stub
+{
+  uint32_t  liveObjects   = 0;
+  uintptr_t handleCounter = 0;
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateDescriptorSets( VkDevice,
+                                                           const VkDescriptorSetAllocateInfo * pAllocateInfo,
+                                                           VkDescriptorSet *                   pDescriptorSets )
+  {
+    for ( uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++ )
+    {
+      pDescriptorSets[i] = (VkDescriptorSet)( ++handleCounter );
+    }
+    liveObjects += pAllocateInfo->descriptorSetCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkFreeDescriptorSets( VkDevice,
+                                                       VkDescriptorPool,
+                                                       uint32_t descriptorSetCount,
+                                                       const VkDescriptorSet * )
+  {
+    liveObjects -= descriptorSetCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateCommandBuffers( VkDevice,
+                                                           const VkCommandBufferAllocateInfo * pAllocateInfo,
+                                                           VkCommandBuffer *                   pCommandBuffers )
+  {
+    for ( uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++ )
+    {
+      pCommandBuffers[i] = (VkCommandBuffer)( ++handleCounter );
+    }
+    liveObjects += pAllocateInfo->commandBufferCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeCommandBuffers( VkDevice,
+                                                   VkCommandPool,
+                                                   uint32_t commandBufferCount,
+                                                   const VkCommandBuffer * )
+  {
+    liveObjects -= commandBufferCount;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateGraphicsPipelines( VkDevice,
+                                                            VkPipelineCache,
+                                                            uint32_t createInfoCount,
+                                                            const VkGraphicsPipelineCreateInfo *,
+                                                            const VkAllocationCallbacks *,
+                                                            VkPipeline * pPipelines )
+  {
+    for ( uint32_t i = 0; i < createInfoCount; i++ )
+    {
+      pPipelines[i] = (VkPipeline)( ++handleCounter );
+    }
+    liveObjects += createInfoCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyPipeline( VkDevice, VkPipeline, const VkAllocationCallbacks * )
+  {
+    liveObjects--;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkAllocateDescriptorSets )
+    STUB_PROC_ADDR( vkFreeDescriptorSets )
+    STUB_PROC_ADDR( vkAllocateCommandBuffers )
+    STUB_PROC_ADDR( vkFreeCommandBuffers )
+    STUB_PROC_ADDR( vkCreateGraphicsPipelines )
+    STUB_PROC_ADDR( vkDestroyPipeline )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice, dummyDescriptorPool, dummyCommandPool;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    vk::DescriptorPool descriptorPool( reinterpret_cast<VkDescriptorPool>( &dummyDescriptorPool ) );
+
+    std::vector<vk::DescriptorSetLayout>          layouts( 4 );
+    vk::DescriptorSetAllocateInfo                 descriptorSetAllocateInfo( descriptorPool, layouts );
+    vk::CommandBufferAllocateInfo                 commandBufferAllocateInfo(
+      reinterpret_cast<VkCommandPool>( &dummyCommandPool ), vk::CommandBufferLevel::ePrimary, 3 );
+    std::array<vk::GraphicsPipelineCreateInfo, 2> pipelineCreateInfos;
+
+    vk::raii::ScratchArena & scratchArena = vk::raii::ScratchArena::get();
+
+    // the plain collections allocate their own storage, but nothing for the transient arrays
+    size_t allocationsBefore = allocationCount;
+    {
+      vk::raii::DescriptorSets descriptorSets( device, descriptorSetAllocateInfo );
+      assert( ( descriptorSets.size() == 4 ) && ( stub::liveObjects == 4 ) );
+    }
+    assert( ( allocationCount - allocationsBefore == 1 ) && ( stub::liveObjects == 0 ) );
+    assert( scratchArena.getOverflowCount() == 0 );
+
+    // the pmr collections on a per-frame monotonic buffer don't touch the heap at all
+    std::array<std::byte, 4096>         frameMemory;
+    std::pmr::monotonic_buffer_resource frameResource(
+      frameMemory.data(), frameMemory.size(), std::pmr::null_memory_resource() );
+
+    const size_t frameCount = 1000;
+    allocationsBefore       = allocationCount;
+    for ( size_t frame = 0; frame < frameCount; frame++ )
+    {
+      {
+        vk::raii::pmr::DescriptorSets descriptorSets( device, descriptorSetAllocateInfo, &frameResource );
+        vk::raii::pmr::CommandBuffers commandBuffers( device, commandBufferAllocateInfo, &frameResource );
+        vk::raii::pmr::Pipelines      pipelines( device, nullptr, pipelineCreateInfos, nullptr, &frameResource );
+        auto                          expectedDescriptorSets =
+          vk::raii::pmr::DescriptorSets::create( device, descriptorSetAllocateInfo, &frameResource );
+        assert( ( descriptorSets.size() == 4 ) && ( commandBuffers.size() == 3 ) && ( pipelines.size() == 2 ) );
+        assert( expectedDescriptorSets && ( expectedDescriptorSets->size() == 4 ) );
+        assert( stub::liveObjects == 13 );
+      }
+      frameResource.release();
+    }
+    size_t frameAllocations = allocationCount - allocationsBefore;
+    assert( ( frameAllocations == 0 ) && ( stub::liveObjects == 0 ) );
+    assert( scratchArena.getOverflowCount() == 0 );
+
+    // a transient array too large for the arena goes to the upstream resource, if there is one, or to the heap
+    std::vector<vk::DescriptorSetLayout> manyLayouts( 2 * VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE /
+                                                      sizeof( VkDescriptorSet ) );
+    vk::DescriptorSetAllocateInfo          largeAllocateInfo( descriptorPool, manyLayouts );
+    std::pmr::unsynchronized_pool_resource overflowResource;
+    scratchArena.setUpstreamResource( &overflowResource );
+    {
+      vk::raii::pmr::DescriptorSets descriptorSets( device, largeAllocateInfo, &overflowResource );
+      assert( descriptorSets.size() == manyLayouts.size() );
+    }
+    assert( scratchArena.getOverflowCount() == 1 );
+    overflowResource.release();
+    scratchArena.setUpstreamResource( nullptr );
+    {
+      vk::raii::DescriptorSets descriptorSets( device, largeAllocateInfo );
+      assert( descriptorSets.size() == manyLayouts.size() );
+    }
+    assert( ( scratchArena.getOverflowCount() == 2 ) && ( stub::liveObjects == 0 ) );
+
+    // the arena is rewound after each use, so small requests keep fitting
+    for ( size_t i = 0; i < frameCount; i++ )
+    {
+      vk::raii::CommandBuffers commandBuffers( device, commandBufferAllocateInfo );
+    }
+    assert( scratchArena.getOverflowCount() == 2 );
+
+    std::cout << "RAIIScratchArena: " << frameAllocations << " heap allocations in " << frameCount
+              << " frames of pmr collections\n";
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
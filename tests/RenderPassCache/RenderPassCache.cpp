@@ -0,0 +1,361 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : RenderPassCache
+//                   Checks vk::su::RenderPassCache and vk::su::FramebufferCache against a stubbed dispatcher, and
+//                   compares their lookups from 1..N recording threads to a mutex around a std::map
+
+#include "../../samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+#include "vulkan/vulkan.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <set>
+#include <vector>
+
+namespace stub
+{
+  std::atomic<uint64_t> handleCounter( 0 );
+  std::atomic<size_t>   renderPassCount( 0 );  // number of render passes currently alive
+  std::atomic<size_t>   framebufferCount( 0 );
+  std::atomic<size_t>   createCount( 0 );
+
+  std::mutex              liveFramebuffersMutex;
+  std::set<VkFramebuffer> liveFramebuffers;
+
+  bool isLive( VkFramebuffer framebuffer )
+  {
+    std::lock_guard<std::mutex> lock( liveFramebuffersMutex );
+    return liveFramebuffers.count( framebuffer ) != 0;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateRenderPass( VkDevice,
+                                                     const VkRenderPassCreateInfo *,
+                                                     const VkAllocationCallbacks *,
+                                                     VkRenderPass * pRenderPass )
+  {
+    *pRenderPass = (VkRenderPass)++handleCounter;
+    renderPassCount++;
+    createCount++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyRenderPass( VkDevice, VkRenderPass renderPass, const VkAllocationCallbacks * )
+  {
+    if ( renderPass )
+    {
+      renderPassCount--;
+    }
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateFramebuffer( VkDevice,
+                                                      const VkFramebufferCreateInfo * pCreateInfo,
+                                                      const VkAllocationCallbacks *,
+                                                      VkFramebuffer * pFramebuffer )
+  {
+    assert( pCreateInfo->renderPass && pCreateInfo->attachmentCount );
+    (void)pCreateInfo;
+    *pFramebuffer = (VkFramebuffer)++handleCounter;
+    framebufferCount++;
+    std::lock_guard<std::mutex> lock( liveFramebuffersMutex );
+    liveFramebuffers.insert( *pFramebuffer );
+    createCount++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyFramebuffer( VkDevice, VkFramebuffer framebuffer, const VkAllocationCallbacks * )
+  {
+    if ( framebuffer )
+    {
+      framebufferCount--;
+      std::lock_guard<std::mutex> lock( liveFramebuffersMutex );
+      liveFramebuffers.erase( framebuffer );
+    }
+  }
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkCreateRenderPass )
+    STUB_PROC_ADDR( vkDestroyRenderPass )
+    STUB_PROC_ADDR( vkCreateFramebuffer )
+    STUB_PROC_ADDR( vkDestroyFramebuffer )
+    return nullptr;
+  }
+}  // namespace stub
+
+vk::ImageView makeImageView( size_t i )
+{
+  return vk::ImageView( (VkImageView)( i + 1 ) );
+}
+
+// the baseline: the same lookups, with a mutex around a std::map
+class LockedFramebufferMap
+{
+public:
+  vk::Framebuffer get( vk::Device const &     device,
+                       vk::RenderPass const & renderPass,
+                       vk::ImageView const &  colorView,
+                       vk::ImageView const &  depthView,
+                       vk::Extent2D const &   extent )
+  {
+    std::lock_guard<std::mutex> lock( m_mutex );
+    Key                         key( renderPass, colorView, depthView, extent.width, extent.height );
+    auto                        it = m_framebuffers.find( key );
+    if ( it == m_framebuffers.end() )
+    {
+      vk::ImageView   attachments[] = { colorView, depthView };
+      vk::Framebuffer framebuffer   = device.createFramebuffer(
+        vk::FramebufferCreateInfo( {}, renderPass, 2, attachments, extent.width, extent.height, 1 ) );
+      it = m_framebuffers.insert( std::make_pair( key, framebuffer ) ).first;
+    }
+    return it->second;
+  }
+
+  void clear( vk::Device const & device )
+  {
+    for ( auto const & framebuffer : m_framebuffers )
+    {
+      device.destroyFramebuffer( framebuffer.second );
+    }
+    m_framebuffers.clear();
+  }
+
+private:
+  typedef std::tuple<VkRenderPass, VkImageView, VkImageView, uint32_t, uint32_t> Key;
+
+  std::mutex                     m_mutex;
+  std::map<Key, vk::Framebuffer> m_framebuffers;
+};
+
+// each thread records lookupCount draws, each looking up its render pass and framebuffer
+template <typename Lookup>
+double runThreads( size_t threadCount, size_t lookupCount, Lookup const & lookup )
+{
+  auto start = std::chrono::high_resolution_clock::now();
+  {
+    std::vector<std::thread> threads;
+    for ( size_t t = 0; t < threadCount; t++ )
+    {
+      threads.push_back( std::thread( [&lookup, lookupCount, t]() {
+        for ( size_t i = 0; i < lookupCount; i++ )
+        {
+          lookup( ( t + i ) % 3 );
+        }
+      } ) );
+    }
+    for ( auto & thread : threads )
+    {
+      thread.join();
+    }
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+  return duration.count();
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyDevice;
+    VULKAN_HPP_DEFAULT_DISPATCHER.init( reinterpret_cast<VkInstance>( &dummyInstance ),
+                                        &stub::vkGetInstanceProcAddr,
+                                        reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::Device   device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::Extent2D extent( 1280, 720 );
+
+    vk::su::RenderPassCache renderPassCache;
+    {
+      // the arguments of createRenderPass
+      vk::RenderPass renderPass = renderPassCache.get( device, vk::Format::eB8G8R8A8Unorm, vk::Format::eD16Unorm );
+      assert( renderPass == renderPassCache.get( device, vk::Format::eB8G8R8A8Unorm, vk::Format::eD16Unorm ) );
+      assert( renderPass != renderPassCache.get( device,
+                                                 vk::Format::eB8G8R8A8Unorm,
+                                                 vk::Format::eD16Unorm,
+                                                 vk::AttachmentLoadOp::eLoad ) );
+      assert( stub::renderPassCount == 2 );
+      (void)renderPass;
+
+      // a full create info: equal content in other arrays is the same render pass, another dependency is not
+      auto makeCreateInfo = []( std::vector<vk::AttachmentDescription> & attachments,
+                                vk::AttachmentReference &                colorReference,
+                                vk::SubpassDescription &                 subpass,
+                                vk::SubpassDependency &                  dependency ) {
+        attachments.assign( 1,
+                            vk::AttachmentDescription( {},
+                                                       vk::Format::eR16G16B16A16Sfloat,
+                                                       vk::SampleCountFlagBits::e1,
+                                                       vk::AttachmentLoadOp::eClear,
+                                                       vk::AttachmentStoreOp::eStore,
+                                                       vk::AttachmentLoadOp::eDontCare,
+                                                       vk::AttachmentStoreOp::eDontCare,
+                                                       vk::ImageLayout::eUndefined,
+                                                       vk::ImageLayout::eShaderReadOnlyOptimal ) );
+        colorReference = vk::AttachmentReference( 0, vk::ImageLayout::eColorAttachmentOptimal );
+        subpass        = vk::SubpassDescription( {}, vk::PipelineBindPoint::eGraphics, {}, colorReference );
+        dependency     = vk::SubpassDependency( 0,
+                                            VK_SUBPASS_EXTERNAL,
+                                            vk::PipelineStageFlagBits::eColorAttachmentOutput,
+                                            vk::PipelineStageFlagBits::eFragmentShader,
+                                            vk::AccessFlagBits::eColorAttachmentWrite,
+                                            vk::AccessFlagBits::eShaderRead );
+        return vk::RenderPassCreateInfo( {}, attachments, subpass, dependency );
+      };
+      std::vector<vk::AttachmentDescription> attachments0, attachments1;
+      vk::AttachmentReference                colorReference0, colorReference1;
+      vk::SubpassDescription                 subpass0, subpass1;
+      vk::SubpassDependency                  dependency0, dependency1;
+      vk::RenderPassCreateInfo createInfo0 = makeCreateInfo( attachments0, colorReference0, subpass0, dependency0 );
+      vk::RenderPassCreateInfo createInfo1 = makeCreateInfo( attachments1, colorReference1, subpass1, dependency1 );
+      vk::RenderPass           offscreenRenderPass = renderPassCache.get( device, createInfo0 );
+      assert( offscreenRenderPass == renderPassCache.get( device, createInfo1 ) );
+      dependency1.dstStageMask = vk::PipelineStageFlagBits::eComputeShader;
+      assert( offscreenRenderPass != renderPassCache.get( device, createInfo1 ) );
+      assert( stub::renderPassCount == 4 );
+      (void)offscreenRenderPass;
+
+      vk::su::HandleCache::Statistics statistics = renderPassCache.getStatistics();
+      assert( ( statistics.size == 4 ) && ( statistics.hits == 2 ) && ( statistics.misses == 4 ) );
+      (void)statistics;
+    }
+
+    vk::su::FramebufferCache framebufferCache;
+    {
+      // the framebuffers of three swapchain images sharing one depth buffer
+      vk::RenderPass renderPass = renderPassCache.get( device, vk::Format::eB8G8R8A8Unorm, vk::Format::eD16Unorm );
+      vk::ImageView  depthView  = makeImageView( 100 );
+      auto           getFramebuffer = [&]( size_t i ) {
+        std::array<vk::ImageView, 2> attachments = { { makeImageView( i ), depthView } };
+        return framebufferCache.get( device, renderPass, attachments, extent );
+      };
+      std::vector<vk::Framebuffer> framebuffers;
+      for ( size_t i = 0; i < 3; i++ )
+      {
+        framebuffers.push_back( getFramebuffer( i ) );
+      }
+      for ( size_t i = 0; i < 3; i++ )
+      {
+        assert( framebuffers[i] == getFramebuffer( i ) );
+      }
+      assert( stub::framebufferCount == 3 );
+
+      // swapchain recreation: the framebuffers of the old image views are destroyed with them
+      framebufferCache.removeImageView( device, makeImageView( 0 ) );
+      assert( stub::framebufferCount == 2 );
+      framebufferCache.removeImageView( device, depthView );
+      assert( stub::framebufferCount == 0 );
+      framebufferCache.collect();
+
+      // least recently used: the framebuffers used in frame 1 only are evicted first, those used in frame 2 are
+      // not evicted as long as frame 2 is not completed
+      framebufferCache.setFrame( 1 );
+      for ( size_t i = 0; i < 10; i++ )
+      {
+        getFramebuffer( 10 + i );
+      }
+      framebufferCache.setFrame( 2 );
+      for ( size_t i = 0; i < 5; i++ )
+      {
+        getFramebuffer( 10 + i );
+      }
+      size_t evictedCount = framebufferCache.trim( device, 5, 1 );
+      assert( evictedCount == 5 );
+      evictedCount = framebufferCache.trim( device, 0, 1 );
+      assert( evictedCount == 0 );
+      assert( ( stub::framebufferCount == 5 ) && ( framebufferCache.getStatistics().size == 5 ) );
+      (void)evictedCount;
+
+      // trim may run while another thread gets framebuffers: one found in frame 3 is never evicted by trimming up to
+      // frame 2, even if it was last used before
+      framebufferCache.setFrame( 3 );
+      std::atomic<bool> destroyedWhileUsed( false );
+      std::thread       recorder( [&]() {
+        for ( size_t i = 0; i < 10000; i++ )
+        {
+          if ( !stub::isLive( static_cast<VkFramebuffer>( getFramebuffer( 10 + i % 20 ) ) ) )
+          {
+            destroyedWhileUsed = true;
+          }
+        }
+      } );
+      for ( size_t i = 0; i < 1000; i++ )
+      {
+        framebufferCache.trim( device, 0, 2 );
+      }
+      recorder.join();
+      assert( !destroyedWhileUsed );
+      framebufferCache.collect();
+      framebufferCache.clear( device );
+      assert( stub::framebufferCount == 0 );
+    }
+
+    // the lookups of the recording threads: after the first frame, all of them are hits
+    const size_t   lookupCount   = 100000;
+    vk::RenderPass renderPass    = renderPassCache.get( device, vk::Format::eB8G8R8A8Unorm, vk::Format::eD16Unorm );
+    vk::ImageView  depthView     = makeImageView( 100 );
+    auto           cachedLookup  = [&]( size_t imageIndex ) {
+      std::array<vk::ImageView, 2> attachments = { { makeImageView( imageIndex ), depthView } };
+      framebufferCache.get( device,
+                            renderPassCache.get( device, vk::Format::eB8G8R8A8Unorm, vk::Format::eD16Unorm ),
+                            attachments,
+                            extent );
+    };
+    LockedFramebufferMap lockedFramebufferMap;
+    auto                 lockedLookup = [&]( size_t imageIndex ) {
+      lockedFramebufferMap.get( device, renderPass, makeImageView( imageIndex ), depthView, extent );
+    };
+
+    std::cout << "RenderPassCache: " << lookupCount << " lookups per thread\n";
+    size_t maxThreadCount = ( std::max )( 2u, std::thread::hardware_concurrency() );
+    for ( size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2 )
+    {
+      size_t createCount = stub::createCount;
+      double cachedTime  = runThreads( threadCount, lookupCount, cachedLookup );
+      double lockedTime  = runThreads( threadCount, lookupCount, lockedLookup );
+      std::cout << "  " << threadCount << " threads: " << cachedTime << " ms lock-free, " << lockedTime
+                << " ms with a mutex, " << ( stub::createCount - createCount ) << " handles created\n";
+    }
+    vk::su::HandleCache::Statistics renderPassStatistics  = renderPassCache.getStatistics();
+    vk::su::HandleCache::Statistics framebufferStatistics = framebufferCache.getStatistics();
+    std::cout << "  render pass hit rate: "
+              << 100.0 * renderPassStatistics.hits / ( renderPassStatistics.hits + renderPassStatistics.misses )
+              << "%, framebuffer hit rate: "
+              << 100.0 * framebufferStatistics.hits / ( framebufferStatistics.hits + framebufferStatistics.misses )
+              << "%" << std::endl;
+    // a miss racing with another thread might create and destroy a handle again, but it's cached only once
+    assert( framebufferStatistics.size == 3 );
+
+    lockedFramebufferMap.clear( device );
+    framebufferCache.clear( device );
+    renderPassCache.clear( device );
+    assert( ( stub::renderPassCount == 0 ) && ( stub::framebufferCount == 0 ) );
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception const & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,367 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : ResourceBatch
+//                   Counts the driver calls of vk::raii::su::ResourceBatch against a stubbed dispatcher that checks
+//                   each binding, and compares its load time to creating a BufferData per buffer
+
+#include "../../RAII_Samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+namespace stub
+{
+  const VkDeviceSize bufferAlignment        = 256;
+  const VkDeviceSize imageAlignment         = 4096;
+  const VkDeviceSize bufferImageGranularity = 1024;
+
+  enum Call
+  {
+    CreateBuffer,
+    CreateImage,
+    GetMemoryRequirements,
+    AllocateMemory,
+    BindMemory,
+    BindMemory2,
+    CallCount
+  };
+  size_t callCounts[CallCount];
+
+  // the memory requirements of each handle and the size of each allocation, to check the bindings against them
+  std::map<uint64_t, VkMemoryRequirements> requirements;
+  std::map<uint64_t, VkDeviceSize>         allocations;
+  uint64_t                                 handleCounter  = 0;
+  size_t                                   liveCount      = 0;
+  size_t                                   bindErrorCount = 0;
+
+  size_t takeCallCount( Call call )
+  {
+    size_t count     = callCounts[call];
+    callCounts[call] = 0;
+    return count;
+  }
+
+  uint64_t nextHandle( VkDeviceSize size, VkDeviceSize alignment, uint32_t memoryTypeBits )
+  {
+    uint64_t handle      = ++handleCounter;
+    requirements[handle] = { ( size + alignment - 1 ) / alignment * alignment, alignment, memoryTypeBits };
+    liveCount++;
+    return handle;
+  }
+
+  void checkBinding( uint64_t handle, VkDeviceMemory memory, VkDeviceSize offset )
+  {
+    auto requirementsIt = requirements.find( handle );
+    auto allocationIt   = allocations.find( (uint64_t)memory );
+    if ( ( requirementsIt == requirements.end() ) || ( allocationIt == allocations.end() ) ||
+         ( offset % requirementsIt->second.alignment ) ||
+         ( allocationIt->second < offset + requirementsIt->second.size ) )
+    {
+      bindErrorCount++;
+    }
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetPhysicalDeviceProperties( VkPhysicalDevice, VkPhysicalDeviceProperties * pProperties )
+  {
+    memset( pProperties, 0, sizeof( VkPhysicalDeviceProperties ) );
+    pProperties->apiVersion                    = VK_API_VERSION_1_1;
+    pProperties->limits.bufferImageGranularity = bufferImageGranularity;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL
+    vkGetPhysicalDeviceMemoryProperties( VkPhysicalDevice, VkPhysicalDeviceMemoryProperties * pMemoryProperties )
+  {
+    memset( pMemoryProperties, 0, sizeof( VkPhysicalDeviceMemoryProperties ) );
+    pMemoryProperties->memoryTypeCount              = 2;
+    pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    pMemoryProperties->memoryTypes[1].propertyFlags =
+      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    pMemoryProperties->memoryTypes[1].heapIndex = 1;
+    pMemoryProperties->memoryHeapCount          = 2;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateBuffer( VkDevice,
+                                                 const VkBufferCreateInfo * pCreateInfo,
+                                                 const VkAllocationCallbacks *,
+                                                 VkBuffer * pBuffer )
+  {
+    callCounts[CreateBuffer]++;
+    *pBuffer = (VkBuffer)nextHandle( pCreateInfo->size, bufferAlignment, 0x3 );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyBuffer( VkDevice, VkBuffer, const VkAllocationCallbacks * )
+  {
+    liveCount--;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateImage( VkDevice,
+                                                const VkImageCreateInfo * pCreateInfo,
+                                                const VkAllocationCallbacks *,
+                                                VkImage * pImage )
+  {
+    callCounts[CreateImage]++;
+    VkDeviceSize size = VkDeviceSize( 4 ) * pCreateInfo->extent.width * pCreateInfo->extent.height;
+    *pImage           = (VkImage)nextHandle( size, imageAlignment, 0x1 );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyImage( VkDevice, VkImage, const VkAllocationCallbacks * )
+  {
+    liveCount--;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetBufferMemoryRequirements( VkDevice,
+                                                            VkBuffer               buffer,
+                                                            VkMemoryRequirements * pMemoryRequirements )
+  {
+    callCounts[GetMemoryRequirements]++;
+    *pMemoryRequirements = requirements[(uint64_t)buffer];
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetImageMemoryRequirements( VkDevice,
+                                                           VkImage                image,
+                                                           VkMemoryRequirements * pMemoryRequirements )
+  {
+    callCounts[GetMemoryRequirements]++;
+    *pMemoryRequirements = requirements[(uint64_t)image];
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAllocateMemory( VkDevice,
+                                                   const VkMemoryAllocateInfo * pAllocateInfo,
+                                                   const VkAllocationCallbacks *,
+                                                   VkDeviceMemory * pMemory )
+  {
+    callCounts[AllocateMemory]++;
+    uint64_t handle     = ++handleCounter;
+    allocations[handle] = pAllocateInfo->allocationSize;
+    *pMemory            = (VkDeviceMemory)handle;
+    liveCount++;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkFreeMemory( VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks * )
+  {
+    allocations.erase( (uint64_t)memory );
+    liveCount--;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory( VkDevice,
+                                                     VkBuffer       buffer,
+                                                     VkDeviceMemory memory,
+                                                     VkDeviceSize   memoryOffset )
+  {
+    callCounts[BindMemory]++;
+    checkBinding( (uint64_t)buffer, memory, memoryOffset );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBindBufferMemory2( VkDevice,
+                                                      uint32_t                       bindInfoCount,
+                                                      const VkBindBufferMemoryInfo * pBindInfos )
+  {
+    callCounts[BindMemory2]++;
+    for ( uint32_t i = 0; i < bindInfoCount; i++ )
+    {
+      checkBinding( (uint64_t)pBindInfos[i].buffer, pBindInfos[i].memory, pBindInfos[i].memoryOffset );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkBindImageMemory2( VkDevice,
+                                                     uint32_t                      bindInfoCount,
+                                                     const VkBindImageMemoryInfo * pBindInfos )
+  {
+    callCounts[BindMemory2]++;
+    for ( uint32_t i = 0; i < bindInfoCount; i++ )
+    {
+      checkBinding( (uint64_t)pBindInfos[i].image, pBindInfos[i].memory, pBindInfos[i].memoryOffset );
+    }
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetPhysicalDeviceProperties )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceMemoryProperties )
+    STUB_PROC_ADDR( vkCreateBuffer )
+    STUB_PROC_ADDR( vkDestroyBuffer )
+    STUB_PROC_ADDR( vkCreateImage )
+    STUB_PROC_ADDR( vkDestroyImage )
+    STUB_PROC_ADDR( vkGetBufferMemoryRequirements )
+    STUB_PROC_ADDR( vkGetImageMemoryRequirements )
+    STUB_PROC_ADDR( vkAllocateMemory )
+    STUB_PROC_ADDR( vkFreeMemory )
+    STUB_PROC_ADDR( vkBindBufferMemory )
+    STUB_PROC_ADDR( vkBindBufferMemory2 )
+    STUB_PROC_ADDR( vkBindImageMemory2 )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+// the buffers of a level load: a few distinct sizes, as they come out of a mesh streamer
+vk::DeviceSize bufferSize( size_t index )
+{
+  return 1024 << ( index % 4 );
+}
+
+double loadWithBufferData( vk::raii::PhysicalDevice const & physicalDevice,
+                           vk::raii::Device const &         device,
+                           size_t                           bufferCount )
+{
+  auto start = std::chrono::high_resolution_clock::now();
+  {
+    std::vector<std::unique_ptr<vk::raii::su::BufferData>> buffers;
+    buffers.reserve( bufferCount );
+    for ( size_t i = 0; i < bufferCount; i++ )
+    {
+      buffers.push_back(
+        vk::raii::su::make_unique<vk::raii::su::BufferData>( physicalDevice,
+                                                             device,
+                                                             bufferSize( i ),
+                                                             vk::BufferUsageFlagBits::eVertexBuffer,
+                                                             vk::MemoryPropertyFlagBits::eDeviceLocal ) );
+    }
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+  return duration.count();
+}
+
+double loadWithResourceBatch( vk::raii::PhysicalDevice const & physicalDevice,
+                              vk::raii::Device const &         device,
+                              size_t                           bufferCount )
+{
+  auto start = std::chrono::high_resolution_clock::now();
+  {
+    std::vector<vk::BufferCreateInfo> createInfos;
+    createInfos.reserve( bufferCount );
+    for ( size_t i = 0; i < bufferCount; i++ )
+    {
+      createInfos.push_back( vk::BufferCreateInfo( {}, bufferSize( i ), vk::BufferUsageFlagBits::eVertexBuffer ) );
+    }
+    vk::raii::su::ResourceBatch resourceBatch( physicalDevice, device );
+    resourceBatch.addBuffers( createInfos );
+    resourceBatch.bindMemory();
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+  return duration.count();
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+
+    {
+      vk::raii::su::ResourceBatch resourceBatch(
+        physicalDevice, device, vk::MemoryPropertyFlagBits::eDeviceLocal, 8192 );
+
+      // identical create infos share their memory requirements query
+      vk::BufferCreateInfo              bufferCreateInfo( {}, 1000, vk::BufferUsageFlagBits::eVertexBuffer );
+      std::vector<vk::BufferCreateInfo> bufferCreateInfos( 6, bufferCreateInfo );
+      bufferCreateInfos[5].size = 3000;
+      assert( resourceBatch.addBuffers( bufferCreateInfos ) == 0 );
+      assert( stub::takeCallCount( stub::CreateBuffer ) == 6 );
+      assert( stub::takeCallCount( stub::GetMemoryRequirements ) == 2 );
+
+      vk::ImageCreateInfo imageCreateInfo( {},
+                                           vk::ImageType::e2D,
+                                           vk::Format::eR8G8B8A8Unorm,
+                                           vk::Extent3D( 16, 16, 1 ),
+                                           1,
+                                           1,
+                                           vk::SampleCountFlagBits::e1,
+                                           vk::ImageTiling::eOptimal,
+                                           vk::ImageUsageFlagBits::eSampled );
+      std::vector<vk::ImageCreateInfo> imageCreateInfos( 3, imageCreateInfo );
+      imageCreateInfos[2].extent = vk::Extent3D( 64, 64, 1 );
+      assert( resourceBatch.addImages( imageCreateInfos ) == 0 );
+      assert( stub::takeCallCount( stub::CreateImage ) == 3 );
+      assert( stub::takeCallCount( stub::GetMemoryRequirements ) == 2 );
+
+      // everything is bound with one call per kind of resource: the buffers fill a block of 8192 bytes, the two small
+      // images another one, and the large image gets a block of its own
+      resourceBatch.bindMemory();
+      assert( stub::takeCallCount( stub::BindMemory2 ) == 2 );
+      assert( stub::takeCallCount( stub::BindMemory ) == 0 );
+      assert( stub::takeCallCount( stub::AllocateMemory ) == resourceBatch.getAllocationCount() );
+      assert( resourceBatch.getAllocationCount() == 3 );
+      assert( stub::bindErrorCount == 0 );
+
+      // the first image doesn't fit behind the buffers, the second one does fit behind the first one
+      assert( resourceBatch.getBufferMemory( 0 ).deviceMemory == resourceBatch.getBufferMemory( 5 ).deviceMemory );
+      assert( resourceBatch.getBufferMemory( 5 ).offset == 5 * 1024 );
+      assert( resourceBatch.getImageMemory( 0 ).deviceMemory != resourceBatch.getBufferMemory( 0 ).deviceMemory );
+      assert( resourceBatch.getImageMemory( 1 ).deviceMemory == resourceBatch.getImageMemory( 0 ).deviceMemory );
+      assert( resourceBatch.getImageMemory( 1 ).offset == 4096 );
+      assert( resourceBatch.getImageMemory( 2 ).size == 16384 );
+
+      // a second round binds only the new resources, and reuses the memoized requirements
+      resourceBatch.addBuffers( bufferCreateInfo );
+      resourceBatch.bindMemory();
+      assert( ( stub::takeCallCount( stub::GetMemoryRequirements ) == 0 ) &&
+              ( stub::takeCallCount( stub::BindMemory2 ) == 1 ) && ( resourceBatch.getAllocationCount() == 4 ) );
+      assert( resourceBatch.getMemoryRequirementsQueryCount() == 4 );
+    }
+    assert( stub::liveCount == 0 );
+
+    // a level load, creating a BufferData per buffer or all of them in one batch
+    const size_t bufferCount = 10000;
+    for ( size_t i = 0; i < stub::CallCount; i++ )
+    {
+      stub::callCounts[i] = 0;
+    }
+    double bufferDataTime = loadWithBufferData( physicalDevice, device, bufferCount );
+    std::cout << "ResourceBatch: " << bufferCount << " buffers\n";
+    std::cout << "  BufferData per buffer:   " << bufferDataTime << " ms, "
+              << stub::takeCallCount( stub::GetMemoryRequirements ) << " requirements queries, "
+              << stub::takeCallCount( stub::AllocateMemory ) << " allocations, "
+              << stub::takeCallCount( stub::BindMemory ) << " bind calls\n";
+    double resourceBatchTime = loadWithResourceBatch( physicalDevice, device, bufferCount );
+    std::cout << "  ResourceBatch:           " << resourceBatchTime << " ms, "
+              << stub::takeCallCount( stub::GetMemoryRequirements ) << " requirements queries, "
+              << stub::takeCallCount( stub::AllocateMemory ) << " allocations, "
+              << stub::takeCallCount( stub::BindMemory2 ) << " bind calls" << std::endl;
+    assert( ( stub::liveCount == 0 ) && ( stub::bindErrorCount == 0 ) );
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
@@ -0,0 +1,91 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : ResultCheck
+//                   Test the out-of-line throwing keyed by CommandId, and measure the success path of the result checks
+
+#include "vulkan/vulkan.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+
+// the pattern generated into the wrapper functions: a hinted failure check around a cold call
+VULKAN_HPP_NOINLINE vk::Result checkWaitForFences( vk::Result result )
+{
+  if ( VULKAN_HPP_UNLIKELY( ( result != vk::Result::eSuccess ) && ( result != vk::Result::eTimeout ) ) )
+  {
+    vk::throwResultException( result, vk::CommandId::eWaitForFences );
+  }
+  return result;
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    // a failing result throws the matching exception, carrying the name of the command
+    bool caught = false;
+    try
+    {
+      checkWaitForFences( vk::Result::eErrorDeviceLost );
+    }
+    catch ( vk::DeviceLostError const & err )
+    {
+      caught = ( strstr( err.what(), "vkWaitForFences" ) != nullptr );
+    }
+    assert( caught );
+    (void)caught;
+
+    caught = false;
+    try
+    {
+      vk::throwResultException( vk::Result::eErrorOutOfDeviceMemory, vk::CommandId::eAllocateMemory );
+    }
+    catch ( vk::OutOfDeviceMemoryError const & err )
+    {
+      caught = ( strstr( err.what(), "vkAllocateMemory" ) != nullptr );
+    }
+    assert( caught );
+
+    // all success codes pass
+    assert( checkWaitForFences( vk::Result::eTimeout ) == vk::Result::eTimeout );
+
+    // the success path, as taken on every call of a hot wrapper function like Queue::submit or Device::waitForFences
+    const size_t iterations = 100 * 1000 * 1000;
+    size_t       successCount = 0;
+    auto         start        = std::chrono::high_resolution_clock::now();
+    for ( size_t i = 0; i < iterations; i++ )
+    {
+      successCount +=
+        ( checkWaitForFences( ( i & 1 ) ? vk::Result::eSuccess : vk::Result::eTimeout ) == vk::Result::eSuccess );
+    }
+    std::chrono::duration<double, std::nano> duration = std::chrono::high_resolution_clock::now() - start;
+    assert( successCount == iterations / 2 );
+    std::cout << "ResultCheck: " << duration.count() / iterations << " ns per checked call (" << successCount
+              << " successful calls)" << std::endl;
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : SingleCallEnumerate
+//                   Counts the calls of the enumerate functions filling a caller-provided vector against a stubbed
+//                   dispatcher: with enough capacity, one call suffices; otherwise they fall back to two calls
+
+#include "vulkan/vulkan.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+// enumerates count copies of value, following the usual two-step protocol
+template <typename T>
+VkResult enumerate( uint32_t count, T const & value, uint32_t * pCount, T * pData )
+{
+  if ( !pData )
+  {
+    *pCount = count;
+    return VK_SUCCESS;
+  }
+  *pCount = ( std::min )( *pCount, count );
+  std::fill( pData, pData + *pCount, value );
+  return ( *pCount < count ) ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+class StubDispatcher
+{
+public:
+  VkResult vkGetPhysicalDeviceSurfacePresentModesKHR( VkPhysicalDevice,
+                                                      VkSurfaceKHR,
+                                                      uint32_t *         pPresentModeCount,
+                                                      VkPresentModeKHR * pPresentModes ) const
+  {
+    callCount++;
+    return enumerate( presentModeCount, VK_PRESENT_MODE_FIFO_KHR, pPresentModeCount, pPresentModes );
+  }
+
+  void vkGetPhysicalDeviceQueueFamilyProperties( VkPhysicalDevice,
+                                                 uint32_t *                pQueueFamilyPropertyCount,
+                                                 VkQueueFamilyProperties * pQueueFamilyProperties ) const
+  {
+    callCount++;
+    VkQueueFamilyProperties queueFamilyProperties = {};
+    queueFamilyProperties.queueCount              = 1;
+    enumerate( queueFamilyCount, queueFamilyProperties, pQueueFamilyPropertyCount, pQueueFamilyProperties );
+  }
+
+  VkResult vkEnumerateDeviceExtensionProperties( VkPhysicalDevice,
+                                                 const char *,
+                                                 uint32_t *              pPropertyCount,
+                                                 VkExtensionProperties * pProperties ) const
+  {
+    callCount++;
+    return enumerate( extensionCount, VkExtensionProperties(), pPropertyCount, pProperties );
+  }
+
+  size_t takeCallCount()
+  {
+    size_t count = callCount;
+    callCount    = 0;
+    return count;
+  }
+
+public:
+  uint32_t presentModeCount = 4;
+  uint32_t queueFamilyCount = 3;
+  uint32_t extensionCount   = 5;
+
+private:
+  mutable size_t callCount = 0;
+};
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int                dummyPhysicalDevice;
+    vk::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ) );
+    vk::SurfaceKHR     surface;
+    StubDispatcher     dispatcher;
+
+    // the functions returning a new vector always take two calls
+    std::vector<vk::PresentModeKHR> presentModes = physicalDevice.getSurfacePresentModesKHR( surface, dispatcher );
+    assert( ( presentModes.size() == 4 ) && ( dispatcher.takeCallCount() == 2 ) );
+
+    // without capacity, the two-step protocol is used
+    std::vector<vk::PresentModeKHR> reusedPresentModes;
+    physicalDevice.getSurfacePresentModesKHR( surface, reusedPresentModes, dispatcher );
+    assert( ( reusedPresentModes.size() == 4 ) && ( dispatcher.takeCallCount() == 2 ) );
+
+    // reusing the vector, or reserving an upper bound, takes a single call
+    physicalDevice.getSurfacePresentModesKHR( surface, reusedPresentModes, dispatcher );
+    assert( ( reusedPresentModes.size() == 4 ) && ( dispatcher.takeCallCount() == 1 ) );
+    std::vector<vk::PresentModeKHR> reservedPresentModes;
+    reservedPresentModes.reserve( 8 );
+    physicalDevice.getSurfacePresentModesKHR( surface, reservedPresentModes, dispatcher );
+    assert( ( reservedPresentModes.size() == 4 ) && ( reservedPresentModes.capacity() == 8 ) &&
+            ( dispatcher.takeCallCount() == 1 ) );
+    assert( reservedPresentModes[3] == vk::PresentModeKHR::eFifo );
+
+    // if the capacity turns out too small, eIncomplete triggers the two-step protocol
+    dispatcher.presentModeCount = 6;
+    physicalDevice.getSurfacePresentModesKHR( surface, reusedPresentModes, dispatcher );
+    assert( ( reusedPresentModes.size() == 6 ) && ( dispatcher.takeCallCount() == 3 ) );
+
+    // there's no eIncomplete with the void functions: only a count below the capacity is known to be complete
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties;
+    physicalDevice.getQueueFamilyProperties( queueFamilyProperties, dispatcher );
+    assert( ( queueFamilyProperties.size() == 3 ) && ( dispatcher.takeCallCount() == 2 ) );
+    assert( queueFamilyProperties[2].queueCount == 1 );
+    physicalDevice.getQueueFamilyProperties( queueFamilyProperties, dispatcher );
+    assert( ( queueFamilyProperties.size() == 3 ) && ( dispatcher.takeCallCount() == 2 ) );
+    queueFamilyProperties.reserve( 4 );
+    physicalDevice.getQueueFamilyProperties( queueFamilyProperties, dispatcher );
+    assert( ( queueFamilyProperties.size() == 3 ) && ( dispatcher.takeCallCount() == 1 ) );
+    dispatcher.queueFamilyCount = 5;
+    physicalDevice.getQueueFamilyProperties( queueFamilyProperties, dispatcher );
+    assert( ( queueFamilyProperties.size() == 5 ) && ( dispatcher.takeCallCount() == 3 ) );
+
+    // the optional arguments in front of the vector have to be given explicitly
+    std::vector<vk::ExtensionProperties> extensionProperties;
+    extensionProperties.reserve( 16 );
+    physicalDevice.enumerateDeviceExtensionProperties( nullptr, extensionProperties, dispatcher );
+    assert( ( extensionProperties.size() == 5 ) && ( dispatcher.takeCallCount() == 1 ) );
+    dispatcher.extensionCount = 0;
+    physicalDevice.enumerateDeviceExtensionProperties( nullptr, extensionProperties, dispatcher );
+    assert( extensionProperties.empty() && ( dispatcher.takeCallCount() == 1 ) );
+
+    std::cout << "SingleCallEnumerate: all call counts as expected\n";
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
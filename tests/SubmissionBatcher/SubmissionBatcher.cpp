@@ -0,0 +1,337 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : SubmissionBatcher
+//                   Checks vk::raii::su::SubmissionBatcher against a stubbed dispatcher that verifies the order of
+//                   each producer's batches, and compares it to a mutex around each submit over 1..N producers
+
+#include "../../RAII_Samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+
+namespace stub
+{
+  // each command buffer encodes its producer in the upper and a sequence number in the lower 32 bits
+  const uint32_t        maxProducers = 16;
+  uint64_t              lastSequence[maxProducers];
+  std::atomic<bool>     queueInUse( false );
+  std::atomic<uint64_t> submitCallCount( 0 );
+  std::atomic<uint64_t> batchCount( 0 );
+  std::atomic<uint64_t> orderViolationCount( 0 );
+  std::atomic<uint64_t> syncViolationCount( 0 );
+  std::atomic<uint64_t> timelineValue( 0 );
+  std::atomic<uint64_t> fenceCount( 0 );
+  std::atomic<int>      failNextSubmit( 0 );
+
+  uint64_t encode( uint32_t producer, uint32_t sequence )
+  {
+    return ( static_cast<uint64_t>( producer ) << 32 ) | sequence;
+  }
+
+  void checkCommandBuffer( VkCommandBuffer commandBuffer )
+  {
+    uint64_t value    = reinterpret_cast<uintptr_t>( commandBuffer );
+    uint32_t producer = static_cast<uint32_t>( value >> 32 );
+    uint64_t sequence = value & 0xFFFFFFFF;
+    if ( sequence <= lastSequence[producer] )
+    {
+      orderViolationCount++;
+    }
+    lastSequence[producer] = sequence;
+  }
+
+  // the queue needs external synchronization, so no two submit calls may overlap
+  VkResult beginSubmit()
+  {
+    if ( queueInUse.exchange( true ) )
+    {
+      syncViolationCount++;
+    }
+    submitCallCount++;
+    int fail = 1;
+    return failNextSubmit.compare_exchange_strong( fail, 0 ) ? VK_ERROR_DEVICE_LOST : VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit( VkQueue, uint32_t submitCount, const VkSubmitInfo * pSubmits, VkFence )
+  {
+    VkResult result = beginSubmit();
+    for ( uint32_t i = 0; ( result == VK_SUCCESS ) && ( i < submitCount ); i++ )
+    {
+      for ( uint32_t j = 0; j < pSubmits[i].commandBufferCount; j++ )
+      {
+        checkCommandBuffer( pSubmits[i].pCommandBuffers[j] );
+      }
+      // the GPU is done right away
+      if ( pSubmits[i].pNext )
+      {
+        VkTimelineSemaphoreSubmitInfo const * timelineSemaphoreSubmitInfo =
+          static_cast<VkTimelineSemaphoreSubmitInfo const *>( pSubmits[i].pNext );
+        for ( uint32_t j = 0; j < timelineSemaphoreSubmitInfo->signalSemaphoreValueCount; j++ )
+        {
+          timelineValue = ( std::max )( timelineValue.load(), timelineSemaphoreSubmitInfo->pSignalSemaphoreValues[j] );
+        }
+      }
+      batchCount++;
+    }
+    queueInUse = false;
+    return result;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkQueueSubmit2KHR( VkQueue,
+                                                    uint32_t                 submitCount,
+                                                    const VkSubmitInfo2KHR * pSubmits,
+                                                    VkFence )
+  {
+    VkResult result = beginSubmit();
+    for ( uint32_t i = 0; ( result == VK_SUCCESS ) && ( i < submitCount ); i++ )
+    {
+      for ( uint32_t j = 0; j < pSubmits[i].commandBufferInfoCount; j++ )
+      {
+        checkCommandBuffer( pSubmits[i].pCommandBufferInfos[j].commandBuffer );
+      }
+      for ( uint32_t j = 0; j < pSubmits[i].signalSemaphoreInfoCount; j++ )
+      {
+        timelineValue = ( std::max )( timelineValue.load(), pSubmits[i].pSignalSemaphoreInfos[j].value );
+      }
+      batchCount++;
+    }
+    queueInUse = false;
+    return result;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateFence( VkDevice,
+                                                const VkFenceCreateInfo *,
+                                                const VkAllocationCallbacks *,
+                                                VkFence * pFence )
+  {
+    *pFence = (VkFence)( ++fenceCount );
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyFence( VkDevice, VkFence, const VkAllocationCallbacks * ) {}
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkWaitForFences( VkDevice, uint32_t, const VkFence *, VkBool32, uint64_t )
+  {
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateSemaphore( VkDevice,
+                                                    const VkSemaphoreCreateInfo *,
+                                                    const VkAllocationCallbacks *,
+                                                    VkSemaphore * pSemaphore )
+  {
+    *pSemaphore = (VkSemaphore)1;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySemaphore( VkDevice, VkSemaphore, const VkAllocationCallbacks * ) {}
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkWaitSemaphores( VkDevice, const VkSemaphoreWaitInfo * pWaitInfo, uint64_t )
+  {
+    return ( pWaitInfo->pValues[0] <= timelineValue ) ? VK_SUCCESS : VK_TIMEOUT;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkQueueSubmit )
+    STUB_PROC_ADDR( vkQueueSubmit2KHR )
+    STUB_PROC_ADDR( vkCreateFence )
+    STUB_PROC_ADDR( vkDestroyFence )
+    STUB_PROC_ADDR( vkWaitForFences )
+    STUB_PROC_ADDR( vkCreateSemaphore )
+    STUB_PROC_ADDR( vkDestroySemaphore )
+    STUB_PROC_ADDR( vkWaitSemaphores )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+
+
+  void reset()
+  {
+    std::fill( lastSequence, lastSequence + maxProducers, 0 );
+    submitCallCount = 0;
+    batchCount      = 0;
+  }
+}  // namespace stub
+
+vk::CommandBuffer makeCommandBuffer( uint32_t producer, uint32_t sequence )
+{
+  return vk::CommandBuffer(
+    reinterpret_cast<VkCommandBuffer>( static_cast<uintptr_t>( stub::encode( producer, sequence ) ) ) );
+}
+
+// each producer submits submitsPerProducer batches, either by locking a mutex around each submit or through a batcher
+// with a submitter thread; returns the time in milliseconds
+double runProducers( vk::raii::Device const & device,
+                     vk::raii::Queue const &  queue,
+                     uint32_t                 producerCount,
+                     uint32_t                 submitsPerProducer,
+                     bool                     useBatcher )
+{
+  stub::reset();
+  std::mutex queueMutex;
+
+  auto start = std::chrono::high_resolution_clock::now();
+  {
+    vk::raii::su::SubmissionBatcher batcher( device, queue, true, std::chrono::microseconds( 50 ) );
+
+    std::vector<std::thread> producers;
+    for ( uint32_t producer = 0; producer < producerCount; producer++ )
+    {
+      producers.push_back( std::thread( [&, producer]() {
+        vk::raii::su::SubmissionFuture future;
+        for ( uint32_t sequence = 1; sequence <= submitsPerProducer; sequence++ )
+        {
+          vk::CommandBuffer commandBuffer = makeCommandBuffer( producer, sequence );
+          vk::SubmitInfo    submitInfo( {}, {}, commandBuffer );
+          if ( useBatcher )
+          {
+            future = batcher.enqueue( submitInfo );
+          }
+          else
+          {
+            std::lock_guard<std::mutex> lock( queueMutex );
+            queue.submit( submitInfo );
+          }
+        }
+        if ( useBatcher )
+        {
+          vk::Result result = future.wait();
+          assert( result == vk::Result::eSuccess );
+          (void)result;
+        }
+      } ) );
+    }
+    for ( auto & producer : producers )
+    {
+      producer.join();
+    }
+  }
+  std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+
+  assert( stub::batchCount == producerCount * submitsPerProducer );
+  assert( ( stub::orderViolationCount == 0 ) && ( stub::syncViolationCount == 0 ) );
+  return duration.count();
+}
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice, dummyQueue;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::raii::Queue          queue( device, reinterpret_cast<VkQueue>( &dummyQueue ) );
+
+    // nothing is submitted before a flush, and a flush submits everything with one call, in the order of enqueuing
+    {
+      vk::raii::su::SubmissionBatcher batcher( device, queue );
+
+      vk::CommandBuffer              commandBuffers[] = { makeCommandBuffer( 0, 1 ), makeCommandBuffer( 0, 2 ) };
+      vk::SubmitInfo                 submitInfo( {}, {}, commandBuffers[0] );
+      vk::raii::su::SubmissionFuture firstFuture = batcher.enqueue( submitInfo );
+      submitInfo.setCommandBuffers( commandBuffers[1] );
+      vk::raii::su::SubmissionFuture secondFuture = batcher.enqueue( submitInfo );
+      assert( !firstFuture.isSubmitted() && ( firstFuture.wait( 0 ) == vk::Result::eTimeout ) );
+      assert( stub::submitCallCount == 0 );
+
+      size_t batchCount = batcher.flush();
+      assert( ( batchCount == 2 ) && ( stub::submitCallCount == 1 ) && ( stub::batchCount == 2 ) );
+      assert( firstFuture.isReady() && secondFuture.isReady() );
+      assert( ( batcher.flush() == 0 ) && ( batcher.getFlushCount() == 1 ) );
+      (void)batchCount;
+    }
+
+    // SubmitInfo2KHR batches signal the timeline semaphore just as well; a switch between SubmitInfo and SubmitInfo2KHR
+    // takes one more submit call
+    {
+      stub::reset();
+      vk::raii::su::SubmissionBatcher batcher( device, queue, true );
+
+      vk::CommandBufferSubmitInfoKHR commandBufferSubmitInfo( makeCommandBuffer( 1, 1 ) );
+      vk::SubmitInfo2KHR             submitInfo2( {}, {}, commandBufferSubmitInfo );
+      vk::raii::su::SubmissionFuture firstFuture = batcher.enqueue( submitInfo2 );
+      batcher.flush();
+      assert( ( firstFuture.getTimelineValue() == 1 ) && firstFuture.isReady() && ( stub::timelineValue == 1 ) );
+
+      vk::CommandBuffer commandBuffer = makeCommandBuffer( 1, 2 );
+      batcher.enqueue( vk::SubmitInfo( {}, {}, commandBuffer ) );
+      commandBufferSubmitInfo.commandBuffer = makeCommandBuffer( 1, 3 );
+      vk::raii::su::SubmissionFuture lastFuture = batcher.enqueue( submitInfo2 );
+      batcher.flush();
+      assert( ( lastFuture.getTimelineValue() == 2 ) && lastFuture.isReady() );
+      assert( ( batcher.getSubmitCount() == 3 ) && ( stub::orderViolationCount == 0 ) );
+    }
+
+    // a failing submit reaches the futures of all its batches
+    {
+      vk::raii::su::SubmissionBatcher batcher( device, queue );
+      vk::raii::su::SubmissionFuture  future = batcher.enqueue( vk::SubmitInfo() );
+      stub::failNextSubmit                   = 1;
+      bool thrown                            = false;
+      try
+      {
+        batcher.flush();
+      }
+      catch ( vk::DeviceLostError const & )
+      {
+        thrown = true;
+      }
+      assert( thrown && ( future.wait() == vk::Result::eErrorDeviceLost ) );
+      (void)thrown;
+    }
+
+    // the contention benchmark
+    const uint32_t submitsPerProducer = 20000;
+    const uint32_t maxProducerCount =
+      ( std::min )( ( std::max )( std::thread::hardware_concurrency(), 2u ), stub::maxProducers );
+    std::cout << "SubmissionBatcher: " << submitsPerProducer << " submits per producer\n";
+    for ( uint32_t producerCount = 1; producerCount <= maxProducerCount; producerCount *= 2 )
+    {
+      double   lockedTime         = runProducers( device, queue, producerCount, submitsPerProducer, false );
+      uint64_t lockedSubmitCount  = stub::submitCallCount;
+      double   batchedTime        = runProducers( device, queue, producerCount, submitsPerProducer, true );
+      uint64_t batchedSubmitCount = stub::submitCallCount;
+      std::cout << "  " << producerCount << " producers: mutex around each submit " << lockedTime << " ms ("
+                << lockedSubmitCount << " submit calls), batched " << batchedTime << " ms (" << batchedSubmitCount
+                << " submit calls)\n";
+    }
+    std::cout << std::flush;
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
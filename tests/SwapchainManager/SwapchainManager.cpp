@@ -0,0 +1,351 @@
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : SwapchainManager
+//                   Runs a frame loop with vk::raii::su::SwapchainManager against a stubbed dispatcher that reports
+//                   out of date and suboptimal swapchains, and checks that each swapchain is recreated with the
+//                   previous one as oldSwapchain, which is destroyed only after its last frame is complete
+
+#include "../../RAII_Samples/utils/utils.hpp"
+#include "../utils/StubDispatcher.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <map>
+
+namespace stub
+{
+  const uint32_t imageCount = 3;
+
+  VkExtent2D surfaceExtent = { 800, 600 };
+  VkResult   acquireResult = VK_SUCCESS;  // the result of the next vkAcquireNextImageKHR, reset after use
+  VkResult   presentResult = VK_SUCCESS;  // the result of the next vkQueuePresentKHR, reset after use
+  uint64_t   gpuCompleted  = 0;
+
+  uint64_t                     handleCounter    = 0;
+  uint64_t                     currentSwapchain = 0;
+  std::map<uint64_t, uint64_t> lastPresentedFrames;  // the frame presented last from each live swapchain
+  uint64_t                     presentCount   = 0;
+  uint32_t                     nextImageIndex = 0;
+
+  size_t formatQueryCount        = 0;
+  size_t presentModeQueryCount   = 0;
+  size_t oldSwapchainMismatches  = 0;
+  size_t prematureCount          = 0;
+  size_t liveImageViews          = 0;
+  size_t liveFramebuffers        = 0;
+  size_t framebufferMismatches   = 0;
+  size_t swapchainCreateCount    = 0;
+  size_t swapchainDestroyedCount = 0;
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceCapabilitiesKHR( VkPhysicalDevice,
+                                                                            VkSurfaceKHR,
+                                                                            VkSurfaceCapabilitiesKHR * pCapabilities )
+  {
+    memset( pCapabilities, 0, sizeof( VkSurfaceCapabilitiesKHR ) );
+    pCapabilities->minImageCount           = imageCount;
+    pCapabilities->maxImageCount           = 8;
+    pCapabilities->currentExtent           = surfaceExtent;
+    pCapabilities->minImageExtent          = { 1, 1 };
+    pCapabilities->maxImageExtent          = { 4096, 4096 };
+    pCapabilities->maxImageArrayLayers     = 1;
+    pCapabilities->supportedTransforms     = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    pCapabilities->currentTransform        = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    pCapabilities->supportedCompositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    pCapabilities->supportedUsageFlags     = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfaceFormatsKHR( VkPhysicalDevice,
+                                                                       VkSurfaceKHR,
+                                                                       uint32_t *           pSurfaceFormatCount,
+                                                                       VkSurfaceFormatKHR * pSurfaceFormats )
+  {
+    if ( pSurfaceFormats )
+    {
+      formatQueryCount++;
+      pSurfaceFormats[0] = { VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
+    }
+    *pSurfaceFormatCount = 1;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceSurfacePresentModesKHR( VkPhysicalDevice,
+                                                                            VkSurfaceKHR,
+                                                                            uint32_t *         pPresentModeCount,
+                                                                            VkPresentModeKHR * pPresentModes )
+  {
+    if ( pPresentModes )
+    {
+      presentModeQueryCount++;
+      pPresentModes[0] = VK_PRESENT_MODE_FIFO_KHR;
+    }
+    *pPresentModeCount = 1;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateSwapchainKHR( VkDevice,
+                                                       const VkSwapchainCreateInfoKHR * pCreateInfo,
+                                                       const VkAllocationCallbacks *,
+                                                       VkSwapchainKHR * pSwapchain )
+  {
+    // the swapchain to be replaced is handed over to the presentation engine
+    if ( (uint64_t)pCreateInfo->oldSwapchain != currentSwapchain )
+    {
+      oldSwapchainMismatches++;
+    }
+    currentSwapchain                      = ++handleCounter;
+    lastPresentedFrames[currentSwapchain] = 0;
+    swapchainCreateCount++;
+    *pSwapchain = (VkSwapchainKHR)currentSwapchain;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroySwapchainKHR( VkDevice, VkSwapchainKHR swapchain, const VkAllocationCallbacks * )
+  {
+    std::map<uint64_t, uint64_t>::iterator it = lastPresentedFrames.find( (uint64_t)swapchain );
+    if ( gpuCompleted < it->second )
+    {
+      prematureCount++;
+    }
+    lastPresentedFrames.erase( it );
+    swapchainDestroyedCount++;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkGetSwapchainImagesKHR( VkDevice,
+                                                          VkSwapchainKHR,
+                                                          uint32_t * pSwapchainImageCount,
+                                                          VkImage *  pSwapchainImages )
+  {
+    if ( pSwapchainImages )
+    {
+      for ( uint32_t i = 0; i < imageCount; i++ )
+      {
+        pSwapchainImages[i] = (VkImage)++handleCounter;
+      }
+    }
+    *pSwapchainImageCount = imageCount;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateImageView( VkDevice,
+                                                    const VkImageViewCreateInfo *,
+                                                    const VkAllocationCallbacks *,
+                                                    VkImageView * pView )
+  {
+    liveImageViews++;
+    *pView = (VkImageView)++handleCounter;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyImageView( VkDevice, VkImageView, const VkAllocationCallbacks * )
+  {
+    liveImageViews--;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkCreateFramebuffer( VkDevice,
+                                                      const VkFramebufferCreateInfo * pCreateInfo,
+                                                      const VkAllocationCallbacks *,
+                                                      VkFramebuffer * pFramebuffer )
+  {
+    // a swapchain image view and a depth view, matching the extent of the surface
+    if ( ( pCreateInfo->attachmentCount != 2 ) || ( pCreateInfo->width != surfaceExtent.width ) ||
+         ( pCreateInfo->height != surfaceExtent.height ) )
+    {
+      framebufferMismatches++;
+    }
+    liveFramebuffers++;
+    *pFramebuffer = (VkFramebuffer)++handleCounter;
+    return VK_SUCCESS;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyFramebuffer( VkDevice, VkFramebuffer, const VkAllocationCallbacks * )
+  {
+    liveFramebuffers--;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImageKHR(
+    VkDevice, VkSwapchainKHR, uint64_t, VkSemaphore, VkFence, uint32_t * pImageIndex )
+  {
+    VkResult result = acquireResult;
+    acquireResult   = VK_SUCCESS;
+    if ( result != VK_ERROR_OUT_OF_DATE_KHR )
+    {
+      *pImageIndex   = nextImageIndex;
+      nextImageIndex = ( nextImageIndex + 1 ) % imageCount;
+    }
+    return result;
+  }
+
+  VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR( VkQueue, const VkPresentInfoKHR * pPresentInfo )
+  {
+    lastPresentedFrames[(uint64_t)pPresentInfo->pSwapchains[0]] = ++presentCount;
+    VkResult result                                            = presentResult;
+    presentResult                                              = VK_SUCCESS;
+    return result;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkGetDeviceQueue( VkDevice, uint32_t, uint32_t, VkQueue * pQueue )
+  {
+    *pQueue = (VkQueue)1;
+  }
+
+  VKAPI_ATTR void VKAPI_CALL vkDestroyRenderPass( VkDevice, VkRenderPass, const VkAllocationCallbacks * ) {}
+  VKAPI_ATTR void VKAPI_CALL vkDestroyDevice( VkDevice, const VkAllocationCallbacks * ) {}
+
+  PFN_vkVoidFunction getProcAddr( const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetPhysicalDeviceSurfaceCapabilitiesKHR )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceSurfaceFormatsKHR )
+    STUB_PROC_ADDR( vkGetPhysicalDeviceSurfacePresentModesKHR )
+    STUB_PROC_ADDR( vkCreateSwapchainKHR )
+    STUB_PROC_ADDR( vkDestroySwapchainKHR )
+    STUB_PROC_ADDR( vkGetSwapchainImagesKHR )
+    STUB_PROC_ADDR( vkCreateImageView )
+    STUB_PROC_ADDR( vkDestroyImageView )
+    STUB_PROC_ADDR( vkCreateFramebuffer )
+    STUB_PROC_ADDR( vkDestroyFramebuffer )
+    STUB_PROC_ADDR( vkAcquireNextImageKHR )
+    STUB_PROC_ADDR( vkQueuePresentKHR )
+    STUB_PROC_ADDR( vkGetDeviceQueue )
+    STUB_PROC_ADDR( vkDestroyRenderPass )
+    STUB_PROC_ADDR( vkDestroyDevice )
+    return nullptr;
+  }
+}  // namespace stub
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int dummyInstance, dummyPhysicalDevice, dummyDevice;
+
+    vk::raii::InstanceDispatcher instanceDispatcher( &stub::vkGetInstanceProcAddr );
+    instanceDispatcher.init( reinterpret_cast<VkInstance>( &dummyInstance ) );
+    vk::raii::PhysicalDevice physicalDevice( reinterpret_cast<VkPhysicalDevice>( &dummyPhysicalDevice ),
+                                             &instanceDispatcher );
+    vk::raii::Device         device( physicalDevice, reinterpret_cast<VkDevice>( &dummyDevice ) );
+    vk::raii::Queue          presentQueue( device, 0, 0 );
+    vk::raii::RenderPass     renderPass( device, (VkRenderPass)1 );
+    vk::SurfaceKHR           surface( (VkSurfaceKHR)1 );
+    vk::Semaphore            imageAcquiredSemaphore( (VkSemaphore)1 );
+    vk::Semaphore            renderCompleteSemaphore( (VkSemaphore)2 );
+
+    const uint64_t framesInFlight = 2;
+    const uint64_t frameCount     = 100;
+    {
+      vk::raii::su::SwapchainManager swapchainManager(
+        physicalDevice, device, surface, vk::Extent2D( 800, 600 ), vk::ImageUsageFlagBits::eColorAttachment, 0, 0 );
+      assert( ( stub::swapchainCreateCount == 1 ) && ( stub::liveImageViews == stub::imageCount ) );
+
+      // the framebuffers get the view of a depth buffer that would be resized along with the swapchain
+      vk::Extent2D depthExtent;
+      swapchainManager.setRenderPass( renderPass, [&depthExtent]( vk::Extent2D const & extent ) {
+        depthExtent = extent;
+        return std::vector<vk::ImageView>( 1, vk::ImageView( (VkImageView)1 ) );
+      } );
+      assert( stub::liveFramebuffers == stub::imageCount );
+
+      size_t   minimizedCount = 0;
+      uint64_t iteration      = 0;
+      while ( swapchainManager.getFrameCount() < frameCount )
+      {
+        iteration++;
+
+        // after waiting on the fence of this frame, the frame framesInFlight frames back is complete
+        if ( framesInFlight <= swapchainManager.getFrameCount() )
+        {
+          stub::gpuCompleted = swapchainManager.getFrameCount() + 1 - framesInFlight;
+          swapchainManager.collect( stub::gpuCompleted );
+        }
+
+        switch ( iteration )
+        {
+          case 10: stub::acquireResult = VK_ERROR_OUT_OF_DATE_KHR; break;
+          case 20: stub::acquireResult = VK_SUBOPTIMAL_KHR; break;
+          case 30: stub::presentResult = VK_ERROR_OUT_OF_DATE_KHR; break;
+          case 40:
+            stub::surfaceExtent = { 1024, 768 };
+            swapchainManager.resize( vk::Extent2D( 1024, 768 ) );
+            break;
+          case 50:
+            // minimized, so the swapchain can't be recreated until the window is restored
+            stub::surfaceExtent = { 0, 0 };
+            stub::acquireResult = VK_ERROR_OUT_OF_DATE_KHR;
+            break;
+          case 53: stub::surfaceExtent = { 640, 480 }; break;
+          default: break;
+        }
+
+        uint64_t                        recreateCount = swapchainManager.getRecreateCount();
+        std::pair<vk::Result, uint32_t> acquired      = swapchainManager.acquireNextImage( imageAcquiredSemaphore );
+        if ( acquired.first == vk::Result::eErrorOutOfDateKHR )
+        {
+          minimizedCount++;
+          continue;
+        }
+        assert( ( acquired.first == vk::Result::eSuccess ) || ( acquired.first == vk::Result::eSuboptimalKHR ) );
+        assert( *swapchainManager.getFramebuffer( acquired.second ) );
+
+        swapchainManager.present( presentQueue, renderCompleteSemaphore, acquired.second );
+
+        // the replaced swapchain is kept alive until its frames are complete
+        if ( recreateCount < swapchainManager.getRecreateCount() )
+        {
+          assert( ( 0 < swapchainManager.getRetiredCount() ) &&
+                  ( stub::swapchainDestroyedCount + 1 < stub::swapchainCreateCount ) );
+        }
+      }
+      assert( minimizedCount == 3 );
+      assert( ( depthExtent.width == 640 ) && ( swapchainManager.getExtent().width == 640 ) );
+      (void)minimizedCount;
+
+      // the initial swapchain, recreated once on out of date acquire, suboptimal acquire, out of date present, resize,
+      // and restore
+      assert( ( swapchainManager.getRecreateCount() == 6 ) && ( stub::swapchainCreateCount == 6 ) );
+
+      // the swapchain formats and present modes were queried only once
+      assert( ( stub::formatQueryCount == 1 ) && ( stub::presentModeQueryCount == 1 ) );
+
+      // once the device is idle, all the retired swapchains are gone
+      stub::gpuCompleted = swapchainManager.getFrameCount();
+      swapchainManager.collect( stub::gpuCompleted );
+      assert( ( swapchainManager.getRetiredCount() == 0 ) && ( stub::swapchainDestroyedCount == 5 ) );
+      assert( ( stub::liveImageViews == stub::imageCount ) && ( stub::liveFramebuffers == stub::imageCount ) );
+    }
+    assert( ( stub::oldSwapchainMismatches == 0 ) && ( stub::framebufferMismatches == 0 ) );
+    assert( stub::prematureCount == 0 );
+    assert( stub::swapchainDestroyedCount == 6 );
+    assert( ( stub::liveImageViews == 0 ) && ( stub::liveFramebuffers == 0 ) );
+
+    std::cout << "SwapchainManager: " << frameCount << " frames, " << stub::swapchainCreateCount
+              << " swapchains created, each with the previous one as oldSwapchain" << std::endl;
+  }
+  catch ( vk::SystemError & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( std::exception & err )
+  {
+    std::cout << "std::exception: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+  return 0;
+}
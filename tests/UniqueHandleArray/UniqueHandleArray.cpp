@@ -0,0 +1,154 @@
+// Copyright(c) 2021, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : UniqueHandleArray
+//                   Checks the *UniqueArray commands against a stubbed dispatcher: pool allocated handles are freed
+//                   with a single call, and single handles can be released or extracted
+
+#include "vulkan/vulkan.hpp"
+
+#include <iostream>
+
+class StubDispatcher
+{
+public:
+  VkResult vkAllocateCommandBuffers( VkDevice,
+                                     const VkCommandBufferAllocateInfo * pAllocateInfo,
+                                     VkCommandBuffer *                   pCommandBuffers ) const
+  {
+    for ( uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++ )
+    {
+      pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>( ++handleCounter );
+    }
+    liveObjects += pAllocateInfo->commandBufferCount;
+    return VK_SUCCESS;
+  }
+
+  void vkFreeCommandBuffers( VkDevice,
+                             VkCommandPool,
+                             uint32_t                commandBufferCount,
+                             const VkCommandBuffer * pCommandBuffers ) const
+  {
+    freeCallCount++;
+    for ( uint32_t i = 0; i < commandBufferCount; i++ )
+    {
+      // null handles are ignored
+      if ( pCommandBuffers[i] )
+      {
+        liveObjects--;
+      }
+    }
+  }
+
+  VkResult vkCreateGraphicsPipelines( VkDevice,
+                                      VkPipelineCache,
+                                      uint32_t createInfoCount,
+                                      const VkGraphicsPipelineCreateInfo *,
+                                      const VkAllocationCallbacks *,
+                                      VkPipeline * pPipelines ) const
+  {
+    for ( uint32_t i = 0; i < createInfoCount; i++ )
+    {
+      pPipelines[i] = (VkPipeline)( ++handleCounter );
+    }
+    liveObjects += createInfoCount;
+    return VK_SUCCESS;
+  }
+
+  void vkDestroyPipeline( VkDevice, VkPipeline, const VkAllocationCallbacks * ) const
+  {
+    destroyCallCount++;
+    liveObjects--;
+  }
+
+public:
+  mutable uintptr_t handleCounter    = 0;
+  mutable size_t    liveObjects      = 0;
+  mutable size_t    freeCallCount    = 0;
+  mutable size_t    destroyCallCount = 0;
+};
+
+int main( int /*argc*/, char ** /*argv*/ )
+{
+  try
+  {
+    int            dummyDevice, dummyCommandPool;
+    vk::Device     device( reinterpret_cast<VkDevice>( &dummyDevice ) );
+    StubDispatcher dispatcher;
+
+    vk::CommandBufferAllocateInfo commandBufferAllocateInfo(
+      vk::CommandPool( reinterpret_cast<VkCommandPool>( &dummyCommandPool ) ), vk::CommandBufferLevel::ePrimary, 8 );
+
+    // a vector of UniqueHandles frees its command buffers one by one
+    {
+      std::vector<vk::UniqueHandle<vk::CommandBuffer, StubDispatcher>> commandBuffers =
+        device.allocateCommandBuffersUnique( commandBufferAllocateInfo, dispatcher );
+      assert( ( commandBuffers.size() == 8 ) && ( dispatcher.liveObjects == 8 ) );
+    }
+    assert( ( dispatcher.liveObjects == 0 ) && ( dispatcher.freeCallCount == 8 ) );
+    size_t vectorSize = 8 * sizeof( vk::UniqueHandle<vk::CommandBuffer, StubDispatcher> );
+
+    // a UniqueHandleArray frees them with one call, leaving out the released ones
+    dispatcher.freeCallCount = 0;
+    size_t arraySize         = 0;
+    {
+      vk::UniqueHandleArray<vk::CommandBuffer, StubDispatcher> commandBuffers =
+        device.allocateCommandBuffersUniqueArray( commandBufferAllocateInfo, dispatcher );
+      assert( ( commandBuffers.size() == 8 ) && ( dispatcher.liveObjects == 8 ) );
+      arraySize = sizeof( commandBuffers ) + commandBuffers.size() * sizeof( vk::CommandBuffer );
+
+      // the handles are contiguous, and can be passed on as an ArrayProxy
+      vk::ArrayProxy<const vk::CommandBuffer> commandBufferProxy( commandBuffers.get() );
+      assert( ( commandBufferProxy.size() == 8 ) && ( commandBufferProxy.data() == commandBuffers.data() ) );
+
+      vk::CommandBuffer released = commandBuffers.release( 1 );
+      assert( released && !commandBuffers[1] );
+      device.freeCommandBuffers( commandBufferAllocateInfo.commandPool, released, dispatcher );
+
+      vk::UniqueHandle<vk::CommandBuffer, StubDispatcher> extracted = commandBuffers.extract( 2 );
+      assert( extracted && !commandBuffers[2] && ( extracted.getPool() == commandBufferAllocateInfo.commandPool ) );
+      assert( ( dispatcher.liveObjects == 7 ) && ( dispatcher.freeCallCount == 1 ) );
+
+      // moving keeps the handles alive
+      vk::UniqueHandleArray<vk::CommandBuffer, StubDispatcher> movedCommandBuffers( std::move( commandBuffers ) );
+      assert( commandBuffers.empty() && ( movedCommandBuffers.size() == 8 ) && ( dispatcher.liveObjects == 7 ) );
+    }
+    assert( ( dispatcher.liveObjects == 0 ) && ( dispatcher.freeCallCount == 3 ) );
+
+    // handles destroyed by their parent are destroyed one by one, as there is no bulk destroy command
+    {
+      std::array<vk::GraphicsPipelineCreateInfo, 4> createInfos;
+      auto pipelines = device.createGraphicsPipelinesUniqueArray( nullptr, createInfos, nullptr, dispatcher );
+      assert( ( pipelines.result == vk::Result::eSuccess ) && ( pipelines.value.size() == 4 ) );
+      pipelines.value.release( 0 );
+      dispatcher.liveObjects--;
+    }
+    assert( ( dispatcher.liveObjects == 0 ) && ( dispatcher.destroyCallCount == 3 ) );
+
+    std::cout << "UniqueHandleArray: 8 command buffers take " << vectorSize << " bytes as UniqueHandles, " << arraySize
+              << " bytes as a UniqueHandleArray\n";
+  }
+  catch ( vk::SystemError const & err )
+  {
+    std::cout << "vk::SystemError: " << err.what() << std::endl;
+    exit( -1 );
+  }
+  catch ( ... )
+  {
+    std::cout << "unknown error\n";
+    exit( -1 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+// Copyright(c) 2018, NVIDIA CORPORATION. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// VulkanHpp Tests : StubDispatcher
+//                   The dispatcher of the tests that run against stubbed Vulkan functions instead of a driver. A test
+//                   defines its stubs in namespace stub, and resolves them in stub::getProcAddr, with a STUB_PROC_ADDR
+//                   per stub, ending with "return nullptr;". Its dispatcher is initialized with
+//                   stub::vkGetInstanceProcAddr, which resolves vkGetDeviceProcAddr as well.
+
+#include "vulkan/vulkan.hpp"
+
+#include <cstring>
+
+#define STUB_PROC_ADDR( name )                                                                                         \
+  if ( strcmp( pName, #name ) == 0 )                                                                                   \
+  {                                                                                                                    \
+    return reinterpret_cast<PFN_vkVoidFunction>( &name );                                                              \
+  }
+
+namespace stub
+{
+  // defined by each test, resolving its stubs
+  PFN_vkVoidFunction getProcAddr( const char * pName );
+
+  inline VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr( VkDevice, const char * pName );
+
+  inline VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr( VkInstance, const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetDeviceProcAddr )
+    return getProcAddr( pName );
+  }
+
+  inline VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr( VkDevice, const char * pName )
+  {
+    STUB_PROC_ADDR( vkGetDeviceProcAddr )
+    return getProcAddr( pName );
+  }
+}  // namespace stub
@@ -8,8 +8,17 @@
 #ifndef VULKAN_RAII_HPP
 #define VULKAN_RAII_HPP
 
+#include <atomic>
+#include <mutex>
 #include <vulkan/vulkan.hpp>
 
+#if ( 17 <= VULKAN_HPP_CPP_VERSION ) && defined( __has_include )
+#  if __has_include( <memory_resource> )
+#    include <memory_resource>
+#    define VULKAN_HPP_RAII_HAS_PMR
+#  endif
+#endif
+
 #if !defined( VULKAN_HPP_RAII_NAMESPACE )
 #  define VULKAN_HPP_RAII_NAMESPACE raii
 #endif
@@ -18,7 +27,7 @@ namespace VULKAN_HPP_NAMESPACE
 {
   namespace VULKAN_HPP_RAII_NAMESPACE
   {
-#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE ) && !defined( VULKAN_HPP_NO_EXCEPTIONS )
+#if !defined( VULKAN_HPP_DISABLE_ENHANCED_MODE )
 
     template <class T, class U = T>
     VULKAN_HPP_CONSTEXPR_14 VULKAN_HPP_INLINE T exchange( T & obj, U && newValue )
@@ -32,6 +41,229 @@ namespace VULKAN_HPP_NAMESPACE
 #  endif
     }
 
+    // the result of a create function: on success, the created handle; on failure, the failing Result together with
+    // an empty handle, such that failures can be handled without exceptions
+    template <typename T>
+    class Expected
+    {
+    public:
+      Expected( VULKAN_HPP_NAMESPACE::Result result, T && value ) : m_result( result ), m_value( std::move( value ) ) {}
+
+      Expected( Expected const & )             = delete;
+      Expected( Expected && rhs )              = default;
+      Expected & operator=( Expected const & ) = delete;
+      Expected & operator=( Expected && rhs )  = default;
+
+      bool has_value() const VULKAN_HPP_NOEXCEPT
+      {
+        // all error codes are negative
+        return 0 <= static_cast<int32_t>( m_result );
+      }
+
+      explicit operator bool() const VULKAN_HPP_NOEXCEPT
+      {
+        return has_value();
+      }
+
+      VULKAN_HPP_NAMESPACE::Result result() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_result;
+      }
+
+      T & value() & VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( has_value() );
+        return m_value;
+      }
+
+      T const & value() const & VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( has_value() );
+        return m_value;
+      }
+
+      T && value() && VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( has_value() );
+        return std::move( m_value );
+      }
+
+      T & operator*() & VULKAN_HPP_NOEXCEPT
+      {
+        return value();
+      }
+
+      T const & operator*() const & VULKAN_HPP_NOEXCEPT
+      {
+        return value();
+      }
+
+      T * operator->() VULKAN_HPP_NOEXCEPT
+      {
+        return &value();
+      }
+
+      T const * operator->() const VULKAN_HPP_NOEXCEPT
+      {
+        return &value();
+      }
+
+    private:
+      VULKAN_HPP_NAMESPACE::Result m_result;
+      T                            m_value;
+    };
+
+#  if defined( VULKAN_HPP_NO_EXCEPTIONS )
+    // without exceptions, a failing constructor or member function just asserts on the result;
+    // use the create functions returning an Expected to handle such failures
+    VULKAN_HPP_INLINE void throwResultException( VULKAN_HPP_NAMESPACE::Result    result,
+                                                 VULKAN_HPP_NAMESPACE::CommandId commandId )
+    {
+      ignore( result );
+      ignore( commandId );
+      VULKAN_HPP_ASSERT_ON_RESULT( false );
+    }
+#  endif
+
+#  if !defined( VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE )
+#    define VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE 16384
+#  endif
+
+    // a per-thread bump allocator for the transient arrays inside the raii constructors and functions, like the
+    // plain handles returned by vkAllocateDescriptorSets before they are wrapped; an allocation not fitting into the
+    // remaining space goes to the upstream memory resource (C++17) or to the heap
+    class ScratchArena
+    {
+    public:
+      static ScratchArena & get() VULKAN_HPP_NOEXCEPT
+      {
+        static thread_local ScratchArena arena;
+        return arena;
+      }
+
+      void * allocate( size_t size, size_t alignment )
+      {
+        VULKAN_HPP_ASSERT( alignment <= alignof( std::max_align_t ) );
+        size_t offset = ( m_offset + alignment - 1 ) & ~( alignment - 1 );
+        if ( offset + size <= VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE )
+        {
+          m_offset = offset + size;
+          m_liveCount++;
+          return m_buffer + offset;
+        }
+        m_overflowCount++;
+        m_liveOverflowCount++;
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+        if ( m_upstream )
+        {
+          return m_upstream->allocate( size, alignment );
+        }
+#  endif
+        return ::operator new( size );
+      }
+
+      void deallocate( void * p, size_t size, size_t alignment ) VULKAN_HPP_NOEXCEPT
+      {
+        char * c = static_cast<char *>( p );
+        if ( !std::less<char *>()( c, m_buffer ) &&
+             std::less<char *>()( c, m_buffer + VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE ) )
+        {
+          VULKAN_HPP_ASSERT( 0 < m_liveCount );
+          if ( --m_liveCount == 0 )
+          {
+            m_offset = 0;
+          }
+          else if ( c + size == m_buffer + m_offset )
+          {
+            // the top-most allocation is released, its space can be reused right away
+            m_offset = static_cast<size_t>( c - m_buffer );
+          }
+        }
+        else
+        {
+          VULKAN_HPP_ASSERT( 0 < m_liveOverflowCount );
+          m_liveOverflowCount--;
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+          if ( m_upstream )
+          {
+            m_upstream->deallocate( p, size, alignment );
+            return;
+          }
+#  endif
+          ignore( alignment );
+          ::operator delete( p );
+        }
+      }
+
+      // the number of allocations that did not fit into the arena; stays zero while the arena is large enough
+      size_t getOverflowCount() const VULKAN_HPP_NOEXCEPT
+      {
+        return m_overflowCount;
+      }
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+      // the memory resource for overflowing allocations of this thread; only to be changed while nothing is allocated,
+      // as an allocation from the previous upstream resource would otherwise be deallocated to the new one
+      void setUpstreamResource( std::pmr::memory_resource * upstream ) VULKAN_HPP_NOEXCEPT
+      {
+        VULKAN_HPP_ASSERT( ( m_liveCount == 0 ) && ( m_liveOverflowCount == 0 ) );
+        m_upstream = upstream;
+      }
+#  endif
+
+    private:
+      ScratchArena() = default;
+
+    private:
+      alignas( std::max_align_t ) char m_buffer[VULKAN_HPP_RAII_SCRATCH_ARENA_SIZE];
+      size_t m_offset            = 0;
+      size_t m_liveCount         = 0;
+      size_t m_overflowCount     = 0;
+      size_t m_liveOverflowCount = 0;  // the overflowing allocations not deallocated yet
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+      std::pmr::memory_resource * m_upstream = nullptr;
+#  endif
+    };
+
+    // allocates from the ScratchArena of the current thread; a container using it must not leave that thread
+    template <typename T>
+    class ScratchAllocator
+    {
+    public:
+      using value_type = T;
+
+      ScratchAllocator() = default;
+
+      template <typename U>
+      ScratchAllocator( ScratchAllocator<U> const & ) VULKAN_HPP_NOEXCEPT
+      {}
+
+      T * allocate( size_t n )
+      {
+        return static_cast<T *>( ScratchArena::get().allocate( n * sizeof( T ), alignof( T ) ) );
+      }
+
+      void deallocate( T * p, size_t n ) VULKAN_HPP_NOEXCEPT
+      {
+        ScratchArena::get().deallocate( p, n * sizeof( T ), alignof( T ) );
+      }
+
+      template <typename U>
+      bool operator==( ScratchAllocator<U> const & ) const VULKAN_HPP_NOEXCEPT
+      {
+        return true;
+      }
+
+      template <typename U>
+      bool operator!=( ScratchAllocator<U> const & ) const VULKAN_HPP_NOEXCEPT
+      {
+        return false;
+      }
+    };
+
+    template <typename T>
+    using ScratchVector = std::vector<T, ScratchAllocator<T>>;
+
     class ContextDispatcher
     {
     public:
@@ -1509,13 +1741,45 @@ namespace VULKAN_HPP_NAMESPACE
           context.getDispatcher()->vkCreateInstance( reinterpret_cast<const VkInstanceCreateInfo *>( &createInfo ),
                                                      m_allocator,
                                                      reinterpret_cast<VkInstance *>( &m_instance ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateInstance" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateInstance );
         }
         m_dispatcher.init( static_cast<VkInstance>( m_instance ) );
       }
 
+      Instance( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Context const &                context,
+                VULKAN_HPP_NAMESPACE::InstanceCreateInfo const &                                createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( context.getDispatcher()->vkGetInstanceProcAddr )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          context.getDispatcher()->vkCreateInstance( reinterpret_cast<const VkInstanceCreateInfo *>( &createInfo ),
+                                                     m_allocator,
+                                                     reinterpret_cast<VkInstance *>( &m_instance ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_instance = nullptr;
+        }
+        else
+        {
+          m_dispatcher.init( static_cast<VkInstance>( m_instance ) );
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Instance>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Context const &                context,
+                VULKAN_HPP_NAMESPACE::InstanceCreateInfo const &                                createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Instance                     instance( result, context, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Instance>( result, std::move( instance ) );
+      }
+
       Instance( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Context const &                context,
                 VkInstance                                                                      instance,
                 VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -1853,16 +2117,20 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::InstanceDispatcher const * m_dispatcher;
     };
 
-    class PhysicalDevices : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice>
+    template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice>>
+    class BasicPhysicalDevices
+      : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice, Allocator>
     {
     public:
-      PhysicalDevices( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const & instance )
+      BasicPhysicalDevices( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const & instance,
+                            Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::InstanceDispatcher const * dispatcher =
           instance.getDispatcher();
-        std::vector<VkPhysicalDevice> physicalDevices;
-        uint32_t                      physicalDeviceCount;
-        VULKAN_HPP_NAMESPACE::Result  result;
+        ScratchVector<VkPhysicalDevice> physicalDevices;
+        uint32_t                        physicalDeviceCount;
+        VULKAN_HPP_NAMESPACE::Result    result;
         do
         {
           result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkEnumeratePhysicalDevices(
@@ -1875,7 +2143,7 @@ namespace VULKAN_HPP_NAMESPACE
             VULKAN_HPP_ASSERT( physicalDeviceCount <= physicalDevices.size() );
           }
         } while ( result == VULKAN_HPP_NAMESPACE::Result::eIncomplete );
-        if ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
           this->reserve( physicalDeviceCount );
           for ( auto const & physicalDevice : physicalDevices )
@@ -1885,17 +2153,27 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkEnumeratePhysicalDevices" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumeratePhysicalDevices );
         }
       }
 
-      PhysicalDevices()                          = delete;
-      PhysicalDevices( PhysicalDevices const & ) = delete;
-      PhysicalDevices( PhysicalDevices && rhs )  = default;
-      PhysicalDevices & operator=( PhysicalDevices const & ) = delete;
-      PhysicalDevices & operator=( PhysicalDevices && rhs ) = default;
+      BasicPhysicalDevices()                                           = delete;
+      BasicPhysicalDevices( BasicPhysicalDevices const & )             = delete;
+      BasicPhysicalDevices( BasicPhysicalDevices && rhs )              = default;
+      BasicPhysicalDevices & operator=( BasicPhysicalDevices const & ) = delete;
+      BasicPhysicalDevices & operator=( BasicPhysicalDevices && rhs )  = default;
     };
 
+    using PhysicalDevices = BasicPhysicalDevices<>;
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+    namespace pmr
+    {
+      using PhysicalDevices = BasicPhysicalDevices<
+        std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice>>;
+    }
+#  endif
+
     class Device
     {
     public:
@@ -1919,13 +2197,46 @@ namespace VULKAN_HPP_NAMESPACE
                                                           reinterpret_cast<const VkDeviceCreateInfo *>( &createInfo ),
                                                           m_allocator,
                                                           reinterpret_cast<VkDevice *>( &m_device ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDevice" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDevice );
         }
         m_dispatcher.init( static_cast<VkDevice>( m_device ) );
       }
 
+      Device( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+              VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const &         physicalDevice,
+              VULKAN_HPP_NAMESPACE::DeviceCreateInfo const &                                  createInfo,
+              VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( physicalDevice.getDispatcher()->vkGetDeviceProcAddr )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          physicalDevice.getDispatcher()->vkCreateDevice( static_cast<VkPhysicalDevice>( *physicalDevice ),
+                                                          reinterpret_cast<const VkDeviceCreateInfo *>( &createInfo ),
+                                                          m_allocator,
+                                                          reinterpret_cast<VkDevice *>( &m_device ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_device = nullptr;
+        }
+        else
+        {
+          m_dispatcher.init( static_cast<VkDevice>( m_device ) );
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Device>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const &         physicalDevice,
+                VULKAN_HPP_NAMESPACE::DeviceCreateInfo const &                                  createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Device                       device( result, physicalDevice, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Device>( result, std::move( device ) );
+      }
+
       Device( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const &         physicalDevice,
               VkDevice                                                                        device,
               VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -2283,12 +2594,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAccelerationStructureCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkAccelerationStructureKHR *>( &m_accelerationStructureKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateAccelerationStructureKHR );
+        }
+      }
+
+      AccelerationStructureKHR(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::AccelerationStructureCreateInfoKHR const &                createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateAccelerationStructureKHR(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkAccelerationStructureCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkAccelerationStructureKHR *>( &m_accelerationStructureKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateAccelerationStructureKHR" );
+          m_accelerationStructureKHR = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<AccelerationStructureKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::AccelerationStructureCreateInfoKHR const &                createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        AccelerationStructureKHR     accelerationStructureKHR( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<AccelerationStructureKHR>(
+          result, std::move( accelerationStructureKHR ) );
+      }
+
       AccelerationStructureKHR(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkAccelerationStructureKHR                                                      accelerationStructureKHR,
@@ -2377,12 +2720,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAccelerationStructureCreateInfoNV *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkAccelerationStructureNV *>( &m_accelerationStructureNV ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateAccelerationStructureNV );
+        }
+      }
+
+      AccelerationStructureNV(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::AccelerationStructureCreateInfoNV const &                 createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateAccelerationStructureNV(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkAccelerationStructureCreateInfoNV *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkAccelerationStructureNV *>( &m_accelerationStructureNV ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateAccelerationStructureNV" );
+          m_accelerationStructureNV = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<AccelerationStructureNV>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::AccelerationStructureCreateInfoNV const &                 createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        AccelerationStructureNV      accelerationStructureNV( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<AccelerationStructureNV>(
+          result, std::move( accelerationStructureNV ) );
+      }
+
       AccelerationStructureNV(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkAccelerationStructureNV                                                       accelerationStructureNV,
@@ -2475,12 +2850,42 @@ namespace VULKAN_HPP_NAMESPACE
                                            reinterpret_cast<const VkBufferCreateInfo *>( &createInfo ),
                                            m_allocator,
                                            reinterpret_cast<VkBuffer *>( &m_buffer ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateBuffer );
+        }
+      }
+
+      Buffer( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+              VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+              VULKAN_HPP_NAMESPACE::BufferCreateInfo const &                                  createInfo,
+              VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateBuffer( static_cast<VkDevice>( *device ),
+                                           reinterpret_cast<const VkBufferCreateInfo *>( &createInfo ),
+                                           m_allocator,
+                                           reinterpret_cast<VkBuffer *>( &m_buffer ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateBuffer" );
+          m_buffer = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Buffer>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::BufferCreateInfo const &                                  createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Buffer                       buffer( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Buffer>( result, std::move( buffer ) );
+      }
+
       Buffer( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
               VkBuffer                                                                        buffer,
               VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -2566,12 +2971,42 @@ namespace VULKAN_HPP_NAMESPACE
                                                reinterpret_cast<const VkBufferViewCreateInfo *>( &createInfo ),
                                                m_allocator,
                                                reinterpret_cast<VkBufferView *>( &m_bufferView ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateBufferView );
+        }
+      }
+
+      BufferView( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                  VULKAN_HPP_NAMESPACE::BufferViewCreateInfo const &                              createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateBufferView( static_cast<VkDevice>( *device ),
+                                               reinterpret_cast<const VkBufferViewCreateInfo *>( &createInfo ),
+                                               m_allocator,
+                                               reinterpret_cast<VkBufferView *>( &m_bufferView ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateBufferView" );
+          m_bufferView = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BufferView>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::BufferViewCreateInfo const &                              createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BufferView                   bufferView( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BufferView>( result, std::move( bufferView ) );
+      }
+
       BufferView( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                   VkBufferView                                                                    bufferView,
                   VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -2653,27 +3088,58 @@ namespace VULKAN_HPP_NAMESPACE
                                                 reinterpret_cast<const VkCommandPoolCreateInfo *>( &createInfo ),
                                                 m_allocator,
                                                 reinterpret_cast<VkCommandPool *>( &m_commandPool ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateCommandPool" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateCommandPool );
         }
       }
 
-      CommandPool( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
-                   VkCommandPool                                                                   commandPool,
+      CommandPool( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                   VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                   VULKAN_HPP_NAMESPACE::CommandPoolCreateInfo const &                             createInfo,
                    VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
-        : m_commandPool( commandPool )
-        , m_device( *device )
+        : m_device( *device )
         , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
             static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
         , m_dispatcher( device.getDispatcher() )
-      {}
-
-      ~CommandPool()
       {
-        if ( m_commandPool )
-        {
-          getDispatcher()->vkDestroyCommandPool( m_device, static_cast<VkCommandPool>( m_commandPool ), m_allocator );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateCommandPool( static_cast<VkDevice>( *device ),
+                                                reinterpret_cast<const VkCommandPoolCreateInfo *>( &createInfo ),
+                                                m_allocator,
+                                                reinterpret_cast<VkCommandPool *>( &m_commandPool ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_commandPool = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<CommandPool>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::CommandPoolCreateInfo const &                             createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        CommandPool                  commandPool( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<CommandPool>( result,
+                                                                                       std::move( commandPool ) );
+      }
+
+      CommandPool( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                   VkCommandPool                                                                   commandPool,
+                   VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_commandPool( commandPool )
+        , m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {}
+
+      ~CommandPool()
+      {
+        if ( m_commandPool )
+        {
+          getDispatcher()->vkDestroyCommandPool( m_device, static_cast<VkCommandPool>( m_commandPool ), m_allocator );
         }
       }
 
@@ -3350,19 +3816,23 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * m_dispatcher;
     };
 
-    class CommandBuffers : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::CommandBuffer>
+    template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::CommandBuffer>>
+    class BasicCommandBuffers
+      : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::CommandBuffer, Allocator>
     {
     public:
-      CommandBuffers( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
-                      VULKAN_HPP_NAMESPACE::CommandBufferAllocateInfo const &         allocateInfo )
+      BasicCommandBuffers( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                           VULKAN_HPP_NAMESPACE::CommandBufferAllocateInfo const &         allocateInfo,
+                           Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::CommandBuffer, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkCommandBuffer> commandBuffers( allocateInfo.commandBufferCount );
+        ScratchVector<VkCommandBuffer> commandBuffers( allocateInfo.commandBufferCount );
         VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
           dispatcher->vkAllocateCommandBuffers( static_cast<VkDevice>( *device ),
                                                 reinterpret_cast<const VkCommandBufferAllocateInfo *>( &allocateInfo ),
                                                 commandBuffers.data() ) );
-        if ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
           this->reserve( allocateInfo.commandBufferCount );
           for ( auto const & commandBuffer : commandBuffers )
@@ -3375,17 +3845,63 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkAllocateCommandBuffers" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAllocateCommandBuffers );
+        }
+      }
+
+      BasicCommandBuffers( VULKAN_HPP_NAMESPACE::Result &                                  result,
+                           VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                           VULKAN_HPP_NAMESPACE::CommandBufferAllocateInfo const &         allocateInfo,
+                           Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::CommandBuffer, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkCommandBuffer> commandBuffers( allocateInfo.commandBufferCount );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          dispatcher->vkAllocateCommandBuffers( static_cast<VkDevice>( *device ),
+                                                reinterpret_cast<const VkCommandBufferAllocateInfo *>( &allocateInfo ),
+                                                commandBuffers.data() ) );
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          this->reserve( allocateInfo.commandBufferCount );
+          for ( auto const & commandBuffer : commandBuffers )
+          {
+            this->emplace_back( commandBuffer,
+                                static_cast<VkDevice>( *device ),
+                                static_cast<VkCommandPool>( allocateInfo.commandPool ),
+                                dispatcher );
+          }
         }
       }
 
-      CommandBuffers()                         = delete;
-      CommandBuffers( CommandBuffers const & ) = delete;
-      CommandBuffers( CommandBuffers && rhs )  = default;
-      CommandBuffers & operator=( CommandBuffers const & ) = delete;
-      CommandBuffers & operator=( CommandBuffers && rhs ) = default;
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicCommandBuffers>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                VULKAN_HPP_NAMESPACE::CommandBufferAllocateInfo const &         allocateInfo,
+                Allocator const &                                               handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicCommandBuffers          commandBuffers( result, device, allocateInfo, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicCommandBuffers>(
+          result, std::move( commandBuffers ) );
+      }
+
+      BasicCommandBuffers()                                          = delete;
+      BasicCommandBuffers( BasicCommandBuffers const & )             = delete;
+      BasicCommandBuffers( BasicCommandBuffers && rhs )              = default;
+      BasicCommandBuffers & operator=( BasicCommandBuffers const & ) = delete;
+      BasicCommandBuffers & operator=( BasicCommandBuffers && rhs )  = default;
     };
 
+    using CommandBuffers = BasicCommandBuffers<>;
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+    namespace pmr
+    {
+      using CommandBuffers = BasicCommandBuffers<
+        std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::CommandBuffer>>;
+    }
+#  endif
+
     class DebugReportCallbackEXT
     {
     public:
@@ -3412,12 +3928,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkDebugReportCallbackEXT *>( &m_debugReportCallbackEXT ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDebugReportCallbackEXT );
+        }
+      }
+
+      DebugReportCallbackEXT(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+        VULKAN_HPP_NAMESPACE::DebugReportCallbackCreateInfoEXT const &                  createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDebugReportCallbackEXT(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkDebugReportCallbackEXT *>( &m_debugReportCallbackEXT ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDebugReportCallbackEXT" );
+          m_debugReportCallbackEXT = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DebugReportCallbackEXT>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::DebugReportCallbackCreateInfoEXT const &                  createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DebugReportCallbackEXT       debugReportCallbackEXT( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DebugReportCallbackEXT>(
+          result, std::move( debugReportCallbackEXT ) );
+      }
+
       DebugReportCallbackEXT(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
         VkDebugReportCallbackEXT                                                        debugReportCallbackEXT,
@@ -3506,12 +4054,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkDebugUtilsMessengerEXT *>( &m_debugUtilsMessengerEXT ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDebugUtilsMessengerEXT );
+        }
+      }
+
+      DebugUtilsMessengerEXT(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+        VULKAN_HPP_NAMESPACE::DebugUtilsMessengerCreateInfoEXT const &                  createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDebugUtilsMessengerEXT(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkDebugUtilsMessengerEXT *>( &m_debugUtilsMessengerEXT ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDebugUtilsMessengerEXT" );
+          m_debugUtilsMessengerEXT = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DebugUtilsMessengerEXT>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::DebugUtilsMessengerCreateInfoEXT const &                  createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DebugUtilsMessengerEXT       debugUtilsMessengerEXT( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DebugUtilsMessengerEXT>(
+          result, std::move( debugUtilsMessengerEXT ) );
+      }
+
       DebugUtilsMessengerEXT(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
         VkDebugUtilsMessengerEXT                                                        debugUtilsMessengerEXT,
@@ -3598,12 +4178,41 @@ namespace VULKAN_HPP_NAMESPACE
             static_cast<VkDevice>( *device ),
             m_allocator,
             reinterpret_cast<VkDeferredOperationKHR *>( &m_deferredOperationKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDeferredOperationKHR );
+        }
+      }
+
+      DeferredOperationKHR(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDeferredOperationKHR(
+          static_cast<VkDevice>( *device ),
+          m_allocator,
+          reinterpret_cast<VkDeferredOperationKHR *>( &m_deferredOperationKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDeferredOperationKHR" );
+          m_deferredOperationKHR = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DeferredOperationKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DeferredOperationKHR         deferredOperationKHR( result, device, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DeferredOperationKHR>(
+          result, std::move( deferredOperationKHR ) );
+      }
+
       DeferredOperationKHR(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkDeferredOperationKHR                                                          deferredOperationKHR,
@@ -3697,12 +4306,44 @@ namespace VULKAN_HPP_NAMESPACE
                                                    reinterpret_cast<const VkDescriptorPoolCreateInfo *>( &createInfo ),
                                                    m_allocator,
                                                    reinterpret_cast<VkDescriptorPool *>( &m_descriptorPool ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDescriptorPool );
+        }
+      }
+
+      DescriptorPool(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::DescriptorPoolCreateInfo const &                          createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateDescriptorPool( static_cast<VkDevice>( *device ),
+                                                   reinterpret_cast<const VkDescriptorPoolCreateInfo *>( &createInfo ),
+                                                   m_allocator,
+                                                   reinterpret_cast<VkDescriptorPool *>( &m_descriptorPool ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDescriptorPool" );
+          m_descriptorPool = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DescriptorPool>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::DescriptorPoolCreateInfo const &                          createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DescriptorPool               descriptorPool( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DescriptorPool>( result,
+                                                                                          std::move( descriptorPool ) );
+      }
+
       DescriptorPool(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkDescriptorPool                                                                descriptorPool,
@@ -3848,19 +4489,23 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * m_dispatcher;
     };
 
-    class DescriptorSets : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSet>
+    template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSet>>
+    class BasicDescriptorSets
+      : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSet, Allocator>
     {
     public:
-      DescriptorSets( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
-                      VULKAN_HPP_NAMESPACE::DescriptorSetAllocateInfo const &         allocateInfo )
+      BasicDescriptorSets( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                           VULKAN_HPP_NAMESPACE::DescriptorSetAllocateInfo const &         allocateInfo,
+                           Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSet, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkDescriptorSet> descriptorSets( allocateInfo.descriptorSetCount );
+        ScratchVector<VkDescriptorSet> descriptorSets( allocateInfo.descriptorSetCount );
         VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
           dispatcher->vkAllocateDescriptorSets( static_cast<VkDevice>( *device ),
                                                 reinterpret_cast<const VkDescriptorSetAllocateInfo *>( &allocateInfo ),
                                                 descriptorSets.data() ) );
-        if ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
           this->reserve( allocateInfo.descriptorSetCount );
           for ( auto const & descriptorSet : descriptorSets )
@@ -3873,17 +4518,63 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkAllocateDescriptorSets" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAllocateDescriptorSets );
+        }
+      }
+
+      BasicDescriptorSets( VULKAN_HPP_NAMESPACE::Result &                                  result,
+                           VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                           VULKAN_HPP_NAMESPACE::DescriptorSetAllocateInfo const &         allocateInfo,
+                           Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSet, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkDescriptorSet> descriptorSets( allocateInfo.descriptorSetCount );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          dispatcher->vkAllocateDescriptorSets( static_cast<VkDevice>( *device ),
+                                                reinterpret_cast<const VkDescriptorSetAllocateInfo *>( &allocateInfo ),
+                                                descriptorSets.data() ) );
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          this->reserve( allocateInfo.descriptorSetCount );
+          for ( auto const & descriptorSet : descriptorSets )
+          {
+            this->emplace_back( descriptorSet,
+                                static_cast<VkDevice>( *device ),
+                                static_cast<VkDescriptorPool>( allocateInfo.descriptorPool ),
+                                dispatcher );
+          }
         }
       }
 
-      DescriptorSets()                         = delete;
-      DescriptorSets( DescriptorSets const & ) = delete;
-      DescriptorSets( DescriptorSets && rhs )  = default;
-      DescriptorSets & operator=( DescriptorSets const & ) = delete;
-      DescriptorSets & operator=( DescriptorSets && rhs ) = default;
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicDescriptorSets>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                VULKAN_HPP_NAMESPACE::DescriptorSetAllocateInfo const &         allocateInfo,
+                Allocator const &                                               handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicDescriptorSets          descriptorSets( result, device, allocateInfo, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicDescriptorSets>(
+          result, std::move( descriptorSets ) );
+      }
+
+      BasicDescriptorSets()                                          = delete;
+      BasicDescriptorSets( BasicDescriptorSets const & )             = delete;
+      BasicDescriptorSets( BasicDescriptorSets && rhs )              = default;
+      BasicDescriptorSets & operator=( BasicDescriptorSets const & ) = delete;
+      BasicDescriptorSets & operator=( BasicDescriptorSets && rhs )  = default;
     };
 
+    using DescriptorSets = BasicDescriptorSets<>;
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+    namespace pmr
+    {
+      using DescriptorSets = BasicDescriptorSets<
+        std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSet>>;
+    }
+#  endif
+
     class DescriptorSetLayout
     {
     public:
@@ -3910,12 +4601,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDescriptorSetLayoutCreateInfo *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkDescriptorSetLayout *>( &m_descriptorSetLayout ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDescriptorSetLayout );
+        }
+      }
+
+      DescriptorSetLayout(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::DescriptorSetLayoutCreateInfo const &                     createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDescriptorSetLayout(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkDescriptorSetLayoutCreateInfo *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkDescriptorSetLayout *>( &m_descriptorSetLayout ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDescriptorSetLayout" );
+          m_descriptorSetLayout = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DescriptorSetLayout>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::DescriptorSetLayoutCreateInfo const &                     createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DescriptorSetLayout          descriptorSetLayout( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DescriptorSetLayout>(
+          result, std::move( descriptorSetLayout ) );
+      }
+
       DescriptorSetLayout(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkDescriptorSetLayout                                                           descriptorSetLayout,
@@ -4004,12 +4727,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDescriptorUpdateTemplateCreateInfo *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkDescriptorUpdateTemplate *>( &m_descriptorUpdateTemplate ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDescriptorUpdateTemplate );
+        }
+      }
+
+      DescriptorUpdateTemplate(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplateCreateInfo const &                createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDescriptorUpdateTemplate(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkDescriptorUpdateTemplateCreateInfo *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkDescriptorUpdateTemplate *>( &m_descriptorUpdateTemplate ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDescriptorUpdateTemplate" );
+          m_descriptorUpdateTemplate = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DescriptorUpdateTemplate>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::DescriptorUpdateTemplateCreateInfo const &                createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DescriptorUpdateTemplate     descriptorUpdateTemplate( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DescriptorUpdateTemplate>(
+          result, std::move( descriptorUpdateTemplate ) );
+      }
+
       DescriptorUpdateTemplate(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkDescriptorUpdateTemplate                                                      descriptorUpdateTemplate,
@@ -4097,12 +4852,44 @@ namespace VULKAN_HPP_NAMESPACE
                                              reinterpret_cast<const VkMemoryAllocateInfo *>( &allocateInfo ),
                                              m_allocator,
                                              reinterpret_cast<VkDeviceMemory *>( &m_deviceMemory ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAllocateMemory );
+        }
+      }
+
+      DeviceMemory(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::MemoryAllocateInfo const &                                allocateInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkAllocateMemory( static_cast<VkDevice>( *device ),
+                                             reinterpret_cast<const VkMemoryAllocateInfo *>( &allocateInfo ),
+                                             m_allocator,
+                                             reinterpret_cast<VkDeviceMemory *>( &m_deviceMemory ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkAllocateMemory" );
+          m_deviceMemory = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DeviceMemory>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::MemoryAllocateInfo const &                                allocateInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DeviceMemory                 deviceMemory( result, device, allocateInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DeviceMemory>( result,
+                                                                                        std::move( deviceMemory ) );
+      }
+
       DeviceMemory(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkDeviceMemory                                                                  deviceMemory,
@@ -4197,11 +4984,38 @@ namespace VULKAN_HPP_NAMESPACE
                                                        &dpy,
                                                        rrOutput,
                                                        reinterpret_cast<VkDisplayKHR *>( &m_displayKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetRandROutputDisplayEXT );
+        }
+      }
+
+      DisplayKHR( VULKAN_HPP_NAMESPACE::Result &                                          result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
+                  Display &                                                               dpy,
+                  RROutput                                                                rrOutput )
+        : m_physicalDevice( *physicalDevice ), m_dispatcher( physicalDevice.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkGetRandROutputDisplayEXT( static_cast<VkPhysicalDevice>( *physicalDevice ),
+                                                       &dpy,
+                                                       rrOutput,
+                                                       reinterpret_cast<VkDisplayKHR *>( &m_displayKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkGetRandROutputDisplayEXT" );
+          m_displayKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DisplayKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
+                Display &                                                               dpy,
+                RROutput                                                                rrOutput )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DisplayKHR                   displayKHR( result, physicalDevice, dpy, rrOutput );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DisplayKHR>( result, std::move( displayKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
 
 #  if defined( VK_USE_PLATFORM_WIN32_KHR )
@@ -4213,25 +5027,49 @@ namespace VULKAN_HPP_NAMESPACE
           getDispatcher()->vkGetWinrtDisplayNV( static_cast<VkPhysicalDevice>( *physicalDevice ),
                                                 deviceRelativeId,
                                                 reinterpret_cast<VkDisplayKHR *>( &m_displayKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkGetWinrtDisplayNV" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetWinrtDisplayNV );
         }
       }
-#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
-
-      DisplayKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
-                  VkDisplayKHR                                                            displayKHR )
-        : m_displayKHR( displayKHR )
-        , m_physicalDevice( *physicalDevice )
-        , m_dispatcher( physicalDevice.getDispatcher() )
-      {}
 
-      DisplayKHR( VkDisplayKHR                                                                displayKHR,
-                  VkPhysicalDevice                                                            physicalDevice,
-                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::InstanceDispatcher const * dispatcher )
-        : m_displayKHR( displayKHR ), m_physicalDevice( physicalDevice ), m_dispatcher( dispatcher )
-      {}
+      DisplayKHR( VULKAN_HPP_NAMESPACE::Result &                                          result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
+                  uint32_t                                                                deviceRelativeId )
+        : m_physicalDevice( *physicalDevice ), m_dispatcher( physicalDevice.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkGetWinrtDisplayNV( static_cast<VkPhysicalDevice>( *physicalDevice ),
+                                                deviceRelativeId,
+                                                reinterpret_cast<VkDisplayKHR *>( &m_displayKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_displayKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DisplayKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
+                uint32_t                                                                deviceRelativeId )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DisplayKHR                   displayKHR( result, physicalDevice, deviceRelativeId );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DisplayKHR>( result, std::move( displayKHR ) );
+      }
+#  endif /*VK_USE_PLATFORM_WIN32_KHR*/
+
+      DisplayKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
+                  VkDisplayKHR                                                            displayKHR )
+        : m_displayKHR( displayKHR )
+        , m_physicalDevice( *physicalDevice )
+        , m_dispatcher( physicalDevice.getDispatcher() )
+      {}
+
+      DisplayKHR( VkDisplayKHR                                                                displayKHR,
+                  VkPhysicalDevice                                                            physicalDevice,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::InstanceDispatcher const * dispatcher )
+        : m_displayKHR( displayKHR ), m_physicalDevice( physicalDevice ), m_dispatcher( dispatcher )
+      {}
 
       ~DisplayKHR()
       {
@@ -4285,15 +5123,18 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::InstanceDispatcher const * m_dispatcher;
     };
 
-    class DisplayKHRs : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR>
+    template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR>>
+    class BasicDisplayKHRs : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR, Allocator>
     {
     public:
-      DisplayKHRs( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
-                   uint32_t                                                                planeIndex )
+      BasicDisplayKHRs( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
+                        uint32_t                                                                planeIndex,
+                        Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::InstanceDispatcher const * dispatcher =
           physicalDevice.getDispatcher();
-        std::vector<VkDisplayKHR>    displays;
+        ScratchVector<VkDisplayKHR>  displays;
         uint32_t                     displayCount;
         VULKAN_HPP_NAMESPACE::Result result;
         do
@@ -4308,7 +5149,7 @@ namespace VULKAN_HPP_NAMESPACE
             VULKAN_HPP_ASSERT( displayCount <= displays.size() );
           }
         } while ( result == VULKAN_HPP_NAMESPACE::Result::eIncomplete );
-        if ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
           this->reserve( displayCount );
           for ( auto const & displayKHR : displays )
@@ -4318,17 +5159,27 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkGetDisplayPlaneSupportedDisplaysKHR" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDisplayPlaneSupportedDisplaysKHR );
         }
       }
 
-      DisplayKHRs()                      = delete;
-      DisplayKHRs( DisplayKHRs const & ) = delete;
-      DisplayKHRs( DisplayKHRs && rhs )  = default;
-      DisplayKHRs & operator=( DisplayKHRs const & ) = delete;
-      DisplayKHRs & operator=( DisplayKHRs && rhs ) = default;
+      BasicDisplayKHRs()                                       = delete;
+      BasicDisplayKHRs( BasicDisplayKHRs const & )             = delete;
+      BasicDisplayKHRs( BasicDisplayKHRs && rhs )              = default;
+      BasicDisplayKHRs & operator=( BasicDisplayKHRs const & ) = delete;
+      BasicDisplayKHRs & operator=( BasicDisplayKHRs && rhs )  = default;
     };
 
+    using DisplayKHRs = BasicDisplayKHRs<>;
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+    namespace pmr
+    {
+      using DisplayKHRs =
+        BasicDisplayKHRs<std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR>>;
+    }
+#  endif
+
     class DisplayModeKHR
     {
     public:
@@ -4355,12 +5206,45 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAllocationCallbacks *>(
               static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
             reinterpret_cast<VkDisplayModeKHR *>( &m_displayModeKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDisplayModeKHR );
+        }
+      }
+
+      DisplayModeKHR(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const &         physicalDevice,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR const &             display,
+        VULKAN_HPP_NAMESPACE::DisplayModeCreateInfoKHR const &                          createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_physicalDevice( *physicalDevice ), m_dispatcher( physicalDevice.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDisplayModeKHR(
+          static_cast<VkPhysicalDevice>( *physicalDevice ),
+          static_cast<VkDisplayKHR>( *display ),
+          reinterpret_cast<const VkDisplayModeCreateInfoKHR *>( &createInfo ),
+          reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+          reinterpret_cast<VkDisplayModeKHR *>( &m_displayModeKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDisplayModeKHR" );
+          m_displayModeKHR = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DisplayModeKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const &         physicalDevice,
+                VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR const &             display,
+                VULKAN_HPP_NAMESPACE::DisplayModeCreateInfoKHR const &                          createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        DisplayModeKHR               displayModeKHR( result, physicalDevice, display, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<DisplayModeKHR>( result,
+                                                                                          std::move( displayModeKHR ) );
+      }
+
       DisplayModeKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PhysicalDevice const & physicalDevice,
                       VkDisplayModeKHR                                                        displayModeKHR )
         : m_displayModeKHR( displayModeKHR )
@@ -4428,12 +5312,42 @@ namespace VULKAN_HPP_NAMESPACE
                                           reinterpret_cast<const VkEventCreateInfo *>( &createInfo ),
                                           m_allocator,
                                           reinterpret_cast<VkEvent *>( &m_event ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateEvent );
+        }
+      }
+
+      Event( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+             VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+             VULKAN_HPP_NAMESPACE::EventCreateInfo const &                                   createInfo,
+             VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateEvent( static_cast<VkDevice>( *device ),
+                                          reinterpret_cast<const VkEventCreateInfo *>( &createInfo ),
+                                          m_allocator,
+                                          reinterpret_cast<VkEvent *>( &m_event ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateEvent" );
+          m_event = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Event>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::EventCreateInfo const &                                   createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Event                        event( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Event>( result, std::move( event ) );
+      }
+
       Event( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
              VkEvent                                                                         event,
              VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -4521,12 +5435,42 @@ namespace VULKAN_HPP_NAMESPACE
                                           reinterpret_cast<const VkFenceCreateInfo *>( &createInfo ),
                                           m_allocator,
                                           reinterpret_cast<VkFence *>( &m_fence ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateFence );
+        }
+      }
+
+      Fence( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+             VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+             VULKAN_HPP_NAMESPACE::FenceCreateInfo const &                                   createInfo,
+             VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateFence( static_cast<VkDevice>( *device ),
+                                          reinterpret_cast<const VkFenceCreateInfo *>( &createInfo ),
+                                          m_allocator,
+                                          reinterpret_cast<VkFence *>( &m_fence ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateFence" );
+          m_fence = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Fence>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::FenceCreateInfo const &                                   createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Fence                        fence( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Fence>( result, std::move( fence ) );
+      }
+
       Fence( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
              VULKAN_HPP_NAMESPACE::DeviceEventInfoEXT const &                                deviceEventInfo,
              VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -4540,12 +5484,42 @@ namespace VULKAN_HPP_NAMESPACE
                                                      reinterpret_cast<const VkDeviceEventInfoEXT *>( &deviceEventInfo ),
                                                      m_allocator,
                                                      reinterpret_cast<VkFence *>( &m_fence ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eRegisterDeviceEventEXT );
+        }
+      }
+
+      Fence( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+             VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+             VULKAN_HPP_NAMESPACE::DeviceEventInfoEXT const &                                deviceEventInfo,
+             VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkRegisterDeviceEventEXT( static_cast<VkDevice>( *device ),
+                                                     reinterpret_cast<const VkDeviceEventInfoEXT *>( &deviceEventInfo ),
+                                                     m_allocator,
+                                                     reinterpret_cast<VkFence *>( &m_fence ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkRegisterDeviceEventEXT" );
+          m_fence = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Fence>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::DeviceEventInfoEXT const &                                deviceEventInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Fence                        fence( result, device, deviceEventInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Fence>( result, std::move( fence ) );
+      }
+
       Fence( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
              VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR const &             display,
              VULKAN_HPP_NAMESPACE::DisplayEventInfoEXT const &                               displayEventInfo,
@@ -4562,12 +5536,45 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDisplayEventInfoEXT *>( &displayEventInfo ),
             m_allocator,
             reinterpret_cast<VkFence *>( &m_fence ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkRegisterDisplayEventEXT" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eRegisterDisplayEventEXT );
         }
       }
 
+      Fence( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+             VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+             VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR const &             display,
+             VULKAN_HPP_NAMESPACE::DisplayEventInfoEXT const &                               displayEventInfo,
+             VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkRegisterDisplayEventEXT(
+          static_cast<VkDevice>( *device ),
+          static_cast<VkDisplayKHR>( *display ),
+          reinterpret_cast<const VkDisplayEventInfoEXT *>( &displayEventInfo ),
+          m_allocator,
+          reinterpret_cast<VkFence *>( &m_fence ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_fence = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Fence>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DisplayKHR const &             display,
+                VULKAN_HPP_NAMESPACE::DisplayEventInfoEXT const &                               displayEventInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Fence                        fence( result, device, display, displayEventInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Fence>( result, std::move( fence ) );
+      }
+
       Fence( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
              VkFence                                                                         fence,
              VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -4651,12 +5658,43 @@ namespace VULKAN_HPP_NAMESPACE
                                                 reinterpret_cast<const VkFramebufferCreateInfo *>( &createInfo ),
                                                 m_allocator,
                                                 reinterpret_cast<VkFramebuffer *>( &m_framebuffer ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateFramebuffer );
+        }
+      }
+
+      Framebuffer( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                   VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                   VULKAN_HPP_NAMESPACE::FramebufferCreateInfo const &                             createInfo,
+                   VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateFramebuffer( static_cast<VkDevice>( *device ),
+                                                reinterpret_cast<const VkFramebufferCreateInfo *>( &createInfo ),
+                                                m_allocator,
+                                                reinterpret_cast<VkFramebuffer *>( &m_framebuffer ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateFramebuffer" );
+          m_framebuffer = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Framebuffer>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::FramebufferCreateInfo const &                             createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Framebuffer                  framebuffer( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Framebuffer>( result,
+                                                                                       std::move( framebuffer ) );
+      }
+
       Framebuffer( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                    VkFramebuffer                                                                   framebuffer,
                    VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -4738,12 +5776,42 @@ namespace VULKAN_HPP_NAMESPACE
                                           reinterpret_cast<const VkImageCreateInfo *>( &createInfo ),
                                           m_allocator,
                                           reinterpret_cast<VkImage *>( &m_image ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateImage );
+        }
+      }
+
+      Image( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+             VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+             VULKAN_HPP_NAMESPACE::ImageCreateInfo const &                                   createInfo,
+             VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateImage( static_cast<VkDevice>( *device ),
+                                          reinterpret_cast<const VkImageCreateInfo *>( &createInfo ),
+                                          m_allocator,
+                                          reinterpret_cast<VkImage *>( &m_image ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateImage" );
+          m_image = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Image>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::ImageCreateInfo const &                                   createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Image                        image( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Image>( result, std::move( image ) );
+      }
+
       Image( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
              VkImage                                                                         image,
              VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -4838,12 +5906,42 @@ namespace VULKAN_HPP_NAMESPACE
                                               reinterpret_cast<const VkImageViewCreateInfo *>( &createInfo ),
                                               m_allocator,
                                               reinterpret_cast<VkImageView *>( &m_imageView ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateImageView );
+        }
+      }
+
+      ImageView( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                 VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                 VULKAN_HPP_NAMESPACE::ImageViewCreateInfo const &                               createInfo,
+                 VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateImageView( static_cast<VkDevice>( *device ),
+                                              reinterpret_cast<const VkImageViewCreateInfo *>( &createInfo ),
+                                              m_allocator,
+                                              reinterpret_cast<VkImageView *>( &m_imageView ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateImageView" );
+          m_imageView = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<ImageView>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::ImageViewCreateInfo const &                               createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        ImageView                    imageView( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<ImageView>( result, std::move( imageView ) );
+      }
+
       ImageView( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                  VkImageView                                                                     imageView,
                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -4929,12 +6027,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkIndirectCommandsLayoutCreateInfoNV *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkIndirectCommandsLayoutNV *>( &m_indirectCommandsLayoutNV ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateIndirectCommandsLayoutNV );
+        }
+      }
+
+      IndirectCommandsLayoutNV(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::IndirectCommandsLayoutCreateInfoNV const &                createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateIndirectCommandsLayoutNV(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkIndirectCommandsLayoutCreateInfoNV *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkIndirectCommandsLayoutNV *>( &m_indirectCommandsLayoutNV ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateIndirectCommandsLayoutNV" );
+          m_indirectCommandsLayoutNV = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<IndirectCommandsLayoutNV>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::IndirectCommandsLayoutCreateInfoNV const &                createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        IndirectCommandsLayoutNV     indirectCommandsLayoutNV( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<IndirectCommandsLayoutNV>(
+          result, std::move( indirectCommandsLayoutNV ) );
+      }
+
       IndirectCommandsLayoutNV(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkIndirectCommandsLayoutNV                                                      indirectCommandsLayoutNV,
@@ -5018,12 +6148,38 @@ namespace VULKAN_HPP_NAMESPACE
             static_cast<VkDevice>( *device ),
             reinterpret_cast<const VkPerformanceConfigurationAcquireInfoINTEL *>( &acquireInfo ),
             reinterpret_cast<VkPerformanceConfigurationINTEL *>( &m_performanceConfigurationINTEL ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquirePerformanceConfigurationINTEL );
+        }
+      }
+
+      PerformanceConfigurationINTEL(
+        VULKAN_HPP_NAMESPACE::Result &                                         result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &        device,
+        VULKAN_HPP_NAMESPACE::PerformanceConfigurationAcquireInfoINTEL const & acquireInfo )
+        : m_device( *device ), m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkAcquirePerformanceConfigurationINTEL(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkPerformanceConfigurationAcquireInfoINTEL *>( &acquireInfo ),
+          reinterpret_cast<VkPerformanceConfigurationINTEL *>( &m_performanceConfigurationINTEL ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkAcquirePerformanceConfigurationINTEL" );
+          m_performanceConfigurationINTEL = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PerformanceConfigurationINTEL>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &        device,
+                VULKAN_HPP_NAMESPACE::PerformanceConfigurationAcquireInfoINTEL const & acquireInfo )
+      {
+        VULKAN_HPP_NAMESPACE::Result  result;
+        PerformanceConfigurationINTEL performanceConfigurationINTEL( result, device, acquireInfo );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PerformanceConfigurationINTEL>(
+          result, std::move( performanceConfigurationINTEL ) );
+      }
+
       PerformanceConfigurationINTEL( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
                                      VkPerformanceConfigurationINTEL performanceConfigurationINTEL )
         : m_performanceConfigurationINTEL( performanceConfigurationINTEL )
@@ -5104,12 +6260,44 @@ namespace VULKAN_HPP_NAMESPACE
                                                   reinterpret_cast<const VkPipelineCacheCreateInfo *>( &createInfo ),
                                                   m_allocator,
                                                   reinterpret_cast<VkPipelineCache *>( &m_pipelineCache ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreatePipelineCache );
+        }
+      }
+
+      PipelineCache(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::PipelineCacheCreateInfo const &                           createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreatePipelineCache( static_cast<VkDevice>( *device ),
+                                                  reinterpret_cast<const VkPipelineCacheCreateInfo *>( &createInfo ),
+                                                  m_allocator,
+                                                  reinterpret_cast<VkPipelineCache *>( &m_pipelineCache ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreatePipelineCache" );
+          m_pipelineCache = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PipelineCache>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::PipelineCacheCreateInfo const &                           createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        PipelineCache                pipelineCache( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PipelineCache>( result,
+                                                                                         std::move( pipelineCache ) );
+      }
+
       PipelineCache(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkPipelineCache                                                                 pipelineCache,
@@ -5203,10 +6391,10 @@ namespace VULKAN_HPP_NAMESPACE
           reinterpret_cast<const VkComputePipelineCreateInfo *>( &createInfo ),
           m_allocator,
           reinterpret_cast<VkPipeline *>( &m_pipeline ) ) );
-        if ( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_UNLIKELY( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
-          throwResultException( m_constructorSuccessCode, "vkCreateComputePipelines" );
+          throwResultException( m_constructorSuccessCode, VULKAN_HPP_NAMESPACE::CommandId::eCreateComputePipelines );
         }
       }
 
@@ -5229,10 +6417,10 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkGraphicsPipelineCreateInfo *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkPipeline *>( &m_pipeline ) ) );
-        if ( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_UNLIKELY( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
-          throwResultException( m_constructorSuccessCode, "vkCreateGraphicsPipelines" );
+          throwResultException( m_constructorSuccessCode, VULKAN_HPP_NAMESPACE::CommandId::eCreateGraphicsPipelines );
         }
       }
 
@@ -5258,12 +6446,12 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkRayTracingPipelineCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkPipeline *>( &m_pipeline ) ) );
-        if ( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+        if ( VULKAN_HPP_UNLIKELY( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
              ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) &&
              ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) &&
-             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
-          throwResultException( m_constructorSuccessCode, "vkCreateRayTracingPipelinesKHR" );
+          throwResultException( m_constructorSuccessCode, VULKAN_HPP_NAMESPACE::CommandId::eCreateRayTracingPipelinesKHR );
         }
       }
 
@@ -5286,10 +6474,10 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkRayTracingPipelineCreateInfoNV *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkPipeline *>( &m_pipeline ) ) );
-        if ( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_UNLIKELY( ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+             ( m_constructorSuccessCode != VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
-          throwResultException( m_constructorSuccessCode, "vkCreateRayTracingPipelinesNV" );
+          throwResultException( m_constructorSuccessCode, VULKAN_HPP_NAMESPACE::CommandId::eCreateRayTracingPipelinesNV );
         }
       }
 
@@ -5393,18 +6581,21 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * m_dispatcher;
     };
 
-    class Pipelines : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline>
+    template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline>>
+    class BasicPipelines : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>
     {
     public:
-      Pipelines(
+      BasicPipelines(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
         VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
                                                                                                   pipelineCache,
         VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::ComputePipelineCreateInfo> const & createInfos,
-        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>           allocator = nullptr )
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>           allocator = nullptr,
+        Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkPipeline>                                                   pipelines( createInfos.size() );
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
         VULKAN_HPP_NAMESPACE::Result                                              result =
           static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateComputePipelines(
             static_cast<VkDevice>( *device ),
@@ -5414,8 +6605,8 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAllocationCallbacks *>(
               static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
             pipelines.data() ) );
-        if ( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
-             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
           this->reserve( createInfos.size() );
           for ( auto const & pipeline : pipelines )
@@ -5430,20 +6621,72 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkCreateComputePipelines" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateComputePipelines );
         }
       }
 
-      Pipelines(
+      BasicPipelines(
+        VULKAN_HPP_NAMESPACE::Result &                                  result,
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
         VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
-                                                                                                   pipelineCache,
-        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::GraphicsPipelineCreateInfo> const & createInfos,
-        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>            allocator = nullptr )
+                                                                                                  pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::ComputePipelineCreateInfo> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>           allocator = nullptr,
+        Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkPipeline>                                                   pipelines( createInfos.size() );
-        VULKAN_HPP_NAMESPACE::Result                                              result =
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateComputePipelines(
+          static_cast<VkDevice>( *device ),
+          pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+          createInfos.size(),
+          reinterpret_cast<const VkComputePipelineCreateInfo *>( createInfos.data() ),
+          reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+          pipelines.data() ) );
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
+        {
+          this->reserve( createInfos.size() );
+          for ( auto const & pipeline : pipelines )
+          {
+            this->emplace_back( pipeline,
+                                static_cast<VkDevice>( *device ),
+                                reinterpret_cast<const VkAllocationCallbacks *>(
+                                  static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+                                result,
+                                dispatcher );
+          }
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines> create(
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                  pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::ComputePipelineCreateInfo> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>           allocator = nullptr,
+        Allocator const & handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicPipelines pipelines( result, device, pipelineCache, createInfos, allocator, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines>( result,
+                                                                                          std::move( pipelines ) );
+      }
+
+      BasicPipelines(
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                   pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::GraphicsPipelineCreateInfo> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>            allocator = nullptr,
+        Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
+        VULKAN_HPP_NAMESPACE::Result                                              result =
           static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateGraphicsPipelines(
             static_cast<VkDevice>( *device ),
             pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
@@ -5452,8 +6695,8 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAllocationCallbacks *>(
               static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
             pipelines.data() ) );
-        if ( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
-             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
           this->reserve( createInfos.size() );
           for ( auto const & pipeline : pipelines )
@@ -5468,21 +6711,73 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkCreateGraphicsPipelines" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateGraphicsPipelines );
+        }
+      }
+
+      BasicPipelines(
+        VULKAN_HPP_NAMESPACE::Result &                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                   pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::GraphicsPipelineCreateInfo> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>            allocator = nullptr,
+        Allocator const & handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateGraphicsPipelines(
+          static_cast<VkDevice>( *device ),
+          pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+          createInfos.size(),
+          reinterpret_cast<const VkGraphicsPipelineCreateInfo *>( createInfos.data() ),
+          reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+          pipelines.data() ) );
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
+        {
+          this->reserve( createInfos.size() );
+          for ( auto const & pipeline : pipelines )
+          {
+            this->emplace_back( pipeline,
+                                static_cast<VkDevice>( *device ),
+                                reinterpret_cast<const VkAllocationCallbacks *>(
+                                  static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+                                result,
+                                dispatcher );
+          }
         }
       }
 
-      Pipelines(
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines> create(
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                   pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::GraphicsPipelineCreateInfo> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>            allocator = nullptr,
+        Allocator const & handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicPipelines pipelines( result, device, pipelineCache, createInfos, allocator, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines>( result,
+                                                                                          std::move( pipelines ) );
+      }
+
+      BasicPipelines(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
         VULKAN_HPP_NAMESPACE::Optional<
           const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeferredOperationKHR> const & deferredOperation,
         VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
                                                                                                         pipelineCache,
         VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::RayTracingPipelineCreateInfoKHR> const & createInfos,
-        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator        = nullptr,
+        Allocator const &                                                               handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkPipeline>                                                   pipelines( createInfos.size() );
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
         VULKAN_HPP_NAMESPACE::Result                                              result =
           static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateRayTracingPipelinesKHR(
             static_cast<VkDevice>( *device ),
@@ -5493,10 +6788,10 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAllocationCallbacks *>(
               static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
             pipelines.data() ) );
-        if ( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
-             ( result == VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) ||
-             ( result == VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ||
-             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
           this->reserve( createInfos.size() );
           for ( auto const & pipeline : pipelines )
@@ -5511,19 +6806,79 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkCreateRayTracingPipelinesKHR" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateRayTracingPipelinesKHR );
+        }
+      }
+
+      BasicPipelines(
+        VULKAN_HPP_NAMESPACE::Result &                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<
+          const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeferredOperationKHR> const & deferredOperation,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                        pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::RayTracingPipelineCreateInfoKHR> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator        = nullptr,
+        Allocator const &                                                               handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateRayTracingPipelinesKHR(
+          static_cast<VkDevice>( *device ),
+          deferredOperation ? static_cast<VkDeferredOperationKHR>( **deferredOperation ) : 0,
+          pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+          createInfos.size(),
+          reinterpret_cast<const VkRayTracingPipelineCreateInfoKHR *>( createInfos.data() ),
+          reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+          pipelines.data() ) );
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
+        {
+          this->reserve( createInfos.size() );
+          for ( auto const & pipeline : pipelines )
+          {
+            this->emplace_back( pipeline,
+                                static_cast<VkDevice>( *device ),
+                                reinterpret_cast<const VkAllocationCallbacks *>(
+                                  static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+                                result,
+                                dispatcher );
+          }
         }
       }
 
-      Pipelines(
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines> create(
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<
+          const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeferredOperationKHR> const & deferredOperation,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                        pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::RayTracingPipelineCreateInfoKHR> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator        = nullptr,
+        Allocator const &                                                               handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicPipelines               pipelines(
+          result, device, deferredOperation, pipelineCache, createInfos, allocator, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines>( result,
+                                                                                          std::move( pipelines ) );
+      }
+
+      BasicPipelines(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
         VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
                                                                                                        pipelineCache,
         VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::RayTracingPipelineCreateInfoNV> const & createInfos,
-        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator        = nullptr,
+        Allocator const &                                                               handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkPipeline>                                                   pipelines( createInfos.size() );
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
         VULKAN_HPP_NAMESPACE::Result                                              result =
           static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateRayTracingPipelinesNV(
             static_cast<VkDevice>( *device ),
@@ -5533,8 +6888,8 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAllocationCallbacks *>(
               static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
             pipelines.data() ) );
-        if ( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
-             ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) )
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
         {
           this->reserve( createInfos.size() );
           for ( auto const & pipeline : pipelines )
@@ -5549,17 +6904,77 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkCreateRayTracingPipelinesNV" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateRayTracingPipelinesNV );
+        }
+      }
+
+      BasicPipelines(
+        VULKAN_HPP_NAMESPACE::Result &                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                       pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::RayTracingPipelineCreateInfoNV> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator        = nullptr,
+        Allocator const &                                                               handlesAllocator = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkPipeline>                                                 pipelines( createInfos.size() );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateRayTracingPipelinesNV(
+          static_cast<VkDevice>( *device ),
+          pipelineCache ? static_cast<VkPipelineCache>( **pipelineCache ) : 0,
+          createInfos.size(),
+          reinterpret_cast<const VkRayTracingPipelineCreateInfoNV *>( createInfos.data() ),
+          reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+          pipelines.data() ) );
+        if ( VULKAN_HPP_LIKELY( ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) ||
+                                ( result == VULKAN_HPP_NAMESPACE::Result::ePipelineCompileRequiredEXT ) ) )
+        {
+          this->reserve( createInfos.size() );
+          for ( auto const & pipeline : pipelines )
+          {
+            this->emplace_back( pipeline,
+                                static_cast<VkDevice>( *device ),
+                                reinterpret_cast<const VkAllocationCallbacks *>(
+                                  static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+                                result,
+                                dispatcher );
+          }
         }
       }
 
-      Pipelines()                    = delete;
-      Pipelines( Pipelines const & ) = delete;
-      Pipelines( Pipelines && rhs )  = default;
-      Pipelines & operator=( Pipelines const & ) = delete;
-      Pipelines & operator=( Pipelines && rhs ) = default;
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines> create(
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineCache> const &
+                                                                                                       pipelineCache,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::RayTracingPipelineCreateInfoNV> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator        = nullptr,
+        Allocator const &                                                               handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicPipelines pipelines( result, device, pipelineCache, createInfos, allocator, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicPipelines>( result,
+                                                                                          std::move( pipelines ) );
+      }
+
+      BasicPipelines()                                     = delete;
+      BasicPipelines( BasicPipelines const & )             = delete;
+      BasicPipelines( BasicPipelines && rhs )              = default;
+      BasicPipelines & operator=( BasicPipelines const & ) = delete;
+      BasicPipelines & operator=( BasicPipelines && rhs )  = default;
     };
 
+    using Pipelines = BasicPipelines<>;
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+    namespace pmr
+    {
+      using Pipelines =
+        BasicPipelines<std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Pipeline>>;
+    }
+#  endif
+
     class PipelineLayout
     {
     public:
@@ -5585,12 +7000,44 @@ namespace VULKAN_HPP_NAMESPACE
                                                    reinterpret_cast<const VkPipelineLayoutCreateInfo *>( &createInfo ),
                                                    m_allocator,
                                                    reinterpret_cast<VkPipelineLayout *>( &m_pipelineLayout ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreatePipelineLayout );
+        }
+      }
+
+      PipelineLayout(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::PipelineLayoutCreateInfo const &                          createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreatePipelineLayout( static_cast<VkDevice>( *device ),
+                                                   reinterpret_cast<const VkPipelineLayoutCreateInfo *>( &createInfo ),
+                                                   m_allocator,
+                                                   reinterpret_cast<VkPipelineLayout *>( &m_pipelineLayout ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreatePipelineLayout" );
+          m_pipelineLayout = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PipelineLayout>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::PipelineLayoutCreateInfo const &                          createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        PipelineLayout               pipelineLayout( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PipelineLayout>( result,
+                                                                                          std::move( pipelineLayout ) );
+      }
+
       PipelineLayout(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkPipelineLayout                                                                pipelineLayout,
@@ -5677,12 +7124,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkPrivateDataSlotCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkPrivateDataSlotEXT *>( &m_privateDataSlotEXT ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreatePrivateDataSlotEXT );
+        }
+      }
+
+      PrivateDataSlotEXT(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::PrivateDataSlotCreateInfoEXT const &                      createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreatePrivateDataSlotEXT(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkPrivateDataSlotCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkPrivateDataSlotEXT *>( &m_privateDataSlotEXT ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreatePrivateDataSlotEXT" );
+          m_privateDataSlotEXT = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PrivateDataSlotEXT>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::PrivateDataSlotCreateInfoEXT const &                      createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        PrivateDataSlotEXT           privateDataSlotEXT( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<PrivateDataSlotEXT>(
+          result, std::move( privateDataSlotEXT ) );
+      }
+
       PrivateDataSlotEXT(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkPrivateDataSlotEXT                                                            privateDataSlotEXT,
@@ -5769,12 +7248,42 @@ namespace VULKAN_HPP_NAMESPACE
                                               reinterpret_cast<const VkQueryPoolCreateInfo *>( &createInfo ),
                                               m_allocator,
                                               reinterpret_cast<VkQueryPool *>( &m_queryPool ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateQueryPool );
+        }
+      }
+
+      QueryPool( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                 VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                 VULKAN_HPP_NAMESPACE::QueryPoolCreateInfo const &                               createInfo,
+                 VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateQueryPool( static_cast<VkDevice>( *device ),
+                                              reinterpret_cast<const VkQueryPoolCreateInfo *>( &createInfo ),
+                                              m_allocator,
+                                              reinterpret_cast<VkQueryPool *>( &m_queryPool ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateQueryPool" );
+          m_queryPool = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<QueryPool>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::QueryPoolCreateInfo const &                               createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        QueryPool                    queryPool( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<QueryPool>( result, std::move( queryPool ) );
+      }
+
       QueryPool( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                  VkQueryPool                                                                     queryPool,
                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -5965,12 +7474,42 @@ namespace VULKAN_HPP_NAMESPACE
                                                reinterpret_cast<const VkRenderPassCreateInfo *>( &createInfo ),
                                                m_allocator,
                                                reinterpret_cast<VkRenderPass *>( &m_renderPass ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateRenderPass );
+        }
+      }
+
+      RenderPass( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                  VULKAN_HPP_NAMESPACE::RenderPassCreateInfo const &                              createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateRenderPass( static_cast<VkDevice>( *device ),
+                                               reinterpret_cast<const VkRenderPassCreateInfo *>( &createInfo ),
+                                               m_allocator,
+                                               reinterpret_cast<VkRenderPass *>( &m_renderPass ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateRenderPass" );
+          m_renderPass = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<RenderPass>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::RenderPassCreateInfo const &                              createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        RenderPass                   renderPass( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<RenderPass>( result, std::move( renderPass ) );
+      }
+
       RenderPass( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                   VULKAN_HPP_NAMESPACE::RenderPassCreateInfo2 const &                             createInfo,
                   VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -5984,12 +7523,42 @@ namespace VULKAN_HPP_NAMESPACE
                                                 reinterpret_cast<const VkRenderPassCreateInfo2 *>( &createInfo ),
                                                 m_allocator,
                                                 reinterpret_cast<VkRenderPass *>( &m_renderPass ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateRenderPass2 );
+        }
+      }
+
+      RenderPass( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                  VULKAN_HPP_NAMESPACE::RenderPassCreateInfo2 const &                             createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateRenderPass2( static_cast<VkDevice>( *device ),
+                                                reinterpret_cast<const VkRenderPassCreateInfo2 *>( &createInfo ),
+                                                m_allocator,
+                                                reinterpret_cast<VkRenderPass *>( &m_renderPass ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateRenderPass2" );
+          m_renderPass = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<RenderPass>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::RenderPassCreateInfo2 const &                             createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        RenderPass                   renderPass( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<RenderPass>( result, std::move( renderPass ) );
+      }
+
       RenderPass( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                   VkRenderPass                                                                    renderPass,
                   VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -6073,32 +7642,62 @@ namespace VULKAN_HPP_NAMESPACE
                                             reinterpret_cast<const VkSamplerCreateInfo *>( &createInfo ),
                                             m_allocator,
                                             reinterpret_cast<VkSampler *>( &m_sampler ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateSampler" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateSampler );
         }
       }
 
-      Sampler( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
-               VkSampler                                                                       sampler,
+      Sampler( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+               VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+               VULKAN_HPP_NAMESPACE::SamplerCreateInfo const &                                 createInfo,
                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
-        : m_sampler( sampler )
-        , m_device( *device )
+        : m_device( *device )
         , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
             static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
         , m_dispatcher( device.getDispatcher() )
-      {}
-
-      ~Sampler()
       {
-        if ( m_sampler )
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateSampler( static_cast<VkDevice>( *device ),
+                                            reinterpret_cast<const VkSamplerCreateInfo *>( &createInfo ),
+                                            m_allocator,
+                                            reinterpret_cast<VkSampler *>( &m_sampler ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          getDispatcher()->vkDestroySampler( m_device, static_cast<VkSampler>( m_sampler ), m_allocator );
+          m_sampler = nullptr;
         }
       }
 
-      Sampler()                  = delete;
-      Sampler( Sampler const & ) = delete;
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Sampler>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::SamplerCreateInfo const &                                 createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Sampler                      sampler( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Sampler>( result, std::move( sampler ) );
+      }
+
+      Sampler( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+               VkSampler                                                                       sampler,
+               VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_sampler( sampler )
+        , m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {}
+
+      ~Sampler()
+      {
+        if ( m_sampler )
+        {
+          getDispatcher()->vkDestroySampler( m_device, static_cast<VkSampler>( m_sampler ), m_allocator );
+        }
+      }
+
+      Sampler()                  = delete;
+      Sampler( Sampler const & ) = delete;
       Sampler( Sampler && rhs )
         : m_sampler( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::exchange( rhs.m_sampler, {} ) )
         , m_device( rhs.m_device )
@@ -6162,12 +7761,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkSamplerYcbcrConversionCreateInfo *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSamplerYcbcrConversion *>( &m_samplerYcbcrConversion ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateSamplerYcbcrConversion );
+        }
+      }
+
+      SamplerYcbcrConversion(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::SamplerYcbcrConversionCreateInfo const &                  createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateSamplerYcbcrConversion(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkSamplerYcbcrConversionCreateInfo *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSamplerYcbcrConversion *>( &m_samplerYcbcrConversion ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateSamplerYcbcrConversion" );
+          m_samplerYcbcrConversion = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SamplerYcbcrConversion>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::SamplerYcbcrConversionCreateInfo const &                  createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SamplerYcbcrConversion       samplerYcbcrConversion( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SamplerYcbcrConversion>(
+          result, std::move( samplerYcbcrConversion ) );
+      }
+
       SamplerYcbcrConversion(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkSamplerYcbcrConversion                                                        samplerYcbcrConversion,
@@ -6254,12 +7885,42 @@ namespace VULKAN_HPP_NAMESPACE
                                               reinterpret_cast<const VkSemaphoreCreateInfo *>( &createInfo ),
                                               m_allocator,
                                               reinterpret_cast<VkSemaphore *>( &m_semaphore ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateSemaphore" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateSemaphore );
         }
       }
 
+      Semaphore( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                 VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                 VULKAN_HPP_NAMESPACE::SemaphoreCreateInfo const &                               createInfo,
+                 VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateSemaphore( static_cast<VkDevice>( *device ),
+                                              reinterpret_cast<const VkSemaphoreCreateInfo *>( &createInfo ),
+                                              m_allocator,
+                                              reinterpret_cast<VkSemaphore *>( &m_semaphore ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_semaphore = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Semaphore>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::SemaphoreCreateInfo const &                               createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        Semaphore                    semaphore( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<Semaphore>( result, std::move( semaphore ) );
+      }
+
       Semaphore( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
                  VkSemaphore                                                                     semaphore,
                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -6344,12 +8005,44 @@ namespace VULKAN_HPP_NAMESPACE
                                                  reinterpret_cast<const VkShaderModuleCreateInfo *>( &createInfo ),
                                                  m_allocator,
                                                  reinterpret_cast<VkShaderModule *>( &m_shaderModule ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateShaderModule" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateShaderModule );
         }
       }
 
+      ShaderModule(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::ShaderModuleCreateInfo const &                            createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateShaderModule( static_cast<VkDevice>( *device ),
+                                                 reinterpret_cast<const VkShaderModuleCreateInfo *>( &createInfo ),
+                                                 m_allocator,
+                                                 reinterpret_cast<VkShaderModule *>( &m_shaderModule ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_shaderModule = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<ShaderModule>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::ShaderModuleCreateInfo const &                            createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        ShaderModule                 shaderModule( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<ShaderModule>( result,
+                                                                                        std::move( shaderModule ) );
+      }
+
       ShaderModule(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkShaderModule                                                                  shaderModule,
@@ -6436,11 +8129,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAndroidSurfaceCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateAndroidSurfaceKHR );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::AndroidSurfaceCreateInfoKHR const &                       createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateAndroidSurfaceKHR(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkAndroidSurfaceCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateAndroidSurfaceKHR" );
+          m_surfaceKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::AndroidSurfaceCreateInfoKHR const &                       createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_ANDROID_KHR*/
 
 #  if defined( VK_USE_PLATFORM_DIRECTFB_EXT )
@@ -6458,11 +8181,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDirectFBSurfaceCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDirectFBSurfaceEXT" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDirectFBSurfaceEXT );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::DirectFBSurfaceCreateInfoEXT const &                      createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDirectFBSurfaceEXT(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkDirectFBSurfaceCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::DirectFBSurfaceCreateInfoEXT const &                      createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_DIRECTFB_EXT*/
 
       SurfaceKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
@@ -6479,12 +8232,42 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkDisplaySurfaceCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateDisplayPlaneSurfaceKHR );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::DisplaySurfaceCreateInfoKHR const &                       createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateDisplayPlaneSurfaceKHR(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkDisplaySurfaceCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateDisplayPlaneSurfaceKHR" );
+          m_surfaceKHR = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::DisplaySurfaceCreateInfoKHR const &                       createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
+
       SurfaceKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
                   VULKAN_HPP_NAMESPACE::HeadlessSurfaceCreateInfoEXT const &                      createInfo,
                   VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
@@ -6499,12 +8282,42 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkHeadlessSurfaceCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateHeadlessSurfaceEXT" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateHeadlessSurfaceEXT );
         }
       }
 
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::HeadlessSurfaceCreateInfoEXT const &                      createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateHeadlessSurfaceEXT(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkHeadlessSurfaceCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::HeadlessSurfaceCreateInfoEXT const &                      createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
+
 #  if defined( VK_USE_PLATFORM_IOS_MVK )
       SurfaceKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
                   VULKAN_HPP_NAMESPACE::IOSSurfaceCreateInfoMVK const &                           createInfo,
@@ -6519,11 +8332,41 @@ namespace VULKAN_HPP_NAMESPACE
                                                   reinterpret_cast<const VkIOSSurfaceCreateInfoMVK *>( &createInfo ),
                                                   m_allocator,
                                                   reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateIOSSurfaceMVK" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateIOSSurfaceMVK );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::IOSSurfaceCreateInfoMVK const &                           createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateIOSSurfaceMVK( static_cast<VkInstance>( *instance ),
+                                                  reinterpret_cast<const VkIOSSurfaceCreateInfoMVK *>( &createInfo ),
+                                                  m_allocator,
+                                                  reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::IOSSurfaceCreateInfoMVK const &                           createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_IOS_MVK*/
 
 #  if defined( VK_USE_PLATFORM_FUCHSIA )
@@ -6541,11 +8384,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkImagePipeSurfaceCreateInfoFUCHSIA *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateImagePipeSurfaceFUCHSIA );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::ImagePipeSurfaceCreateInfoFUCHSIA const &                 createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateImagePipeSurfaceFUCHSIA(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkImagePipeSurfaceCreateInfoFUCHSIA *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateImagePipeSurfaceFUCHSIA" );
+          m_surfaceKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::ImagePipeSurfaceCreateInfoFUCHSIA const &                 createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_FUCHSIA*/
 
 #  if defined( VK_USE_PLATFORM_MACOS_MVK )
@@ -6563,11 +8436,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkMacOSSurfaceCreateInfoMVK *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateMacOSSurfaceMVK" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateMacOSSurfaceMVK );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::MacOSSurfaceCreateInfoMVK const &                         createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateMacOSSurfaceMVK(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkMacOSSurfaceCreateInfoMVK *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::MacOSSurfaceCreateInfoMVK const &                         createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_MACOS_MVK*/
 
 #  if defined( VK_USE_PLATFORM_METAL_EXT )
@@ -6585,11 +8488,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkMetalSurfaceCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateMetalSurfaceEXT );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::MetalSurfaceCreateInfoEXT const &                         createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateMetalSurfaceEXT(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkMetalSurfaceCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateMetalSurfaceEXT" );
+          m_surfaceKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::MetalSurfaceCreateInfoEXT const &                         createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_METAL_EXT*/
 
 #  if defined( VK_USE_PLATFORM_SCREEN_QNX )
@@ -6607,11 +8540,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkScreenSurfaceCreateInfoQNX *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateScreenSurfaceQNX" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateScreenSurfaceQNX );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::ScreenSurfaceCreateInfoQNX const &                        createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateScreenSurfaceQNX(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkScreenSurfaceCreateInfoQNX *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::ScreenSurfaceCreateInfoQNX const &                        createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_SCREEN_QNX*/
 
 #  if defined( VK_USE_PLATFORM_GGP )
@@ -6629,11 +8592,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkStreamDescriptorSurfaceCreateInfoGGP *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateStreamDescriptorSurfaceGGP" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateStreamDescriptorSurfaceGGP );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::StreamDescriptorSurfaceCreateInfoGGP const &              createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateStreamDescriptorSurfaceGGP(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkStreamDescriptorSurfaceCreateInfoGGP *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::StreamDescriptorSurfaceCreateInfoGGP const &              createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_GGP*/
 
 #  if defined( VK_USE_PLATFORM_VI_NN )
@@ -6650,11 +8643,41 @@ namespace VULKAN_HPP_NAMESPACE
                                                 reinterpret_cast<const VkViSurfaceCreateInfoNN *>( &createInfo ),
                                                 m_allocator,
                                                 reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateViSurfaceNN );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::ViSurfaceCreateInfoNN const &                             createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateViSurfaceNN( static_cast<VkInstance>( *instance ),
+                                                reinterpret_cast<const VkViSurfaceCreateInfoNN *>( &createInfo ),
+                                                m_allocator,
+                                                reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateViSurfaceNN" );
+          m_surfaceKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::ViSurfaceCreateInfoNN const &                             createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_VI_NN*/
 
 #  if defined( VK_USE_PLATFORM_WAYLAND_KHR )
@@ -6672,11 +8695,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkWaylandSurfaceCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateWaylandSurfaceKHR" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateWaylandSurfaceKHR );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::WaylandSurfaceCreateInfoKHR const &                       createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateWaylandSurfaceKHR(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkWaylandSurfaceCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::WaylandSurfaceCreateInfoKHR const &                       createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_WAYLAND_KHR*/
 
 #  if defined( VK_USE_PLATFORM_WIN32_KHR )
@@ -6694,11 +8747,41 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkWin32SurfaceCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateWin32SurfaceKHR );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::Win32SurfaceCreateInfoKHR const &                         createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateWin32SurfaceKHR(
+          static_cast<VkInstance>( *instance ),
+          reinterpret_cast<const VkWin32SurfaceCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateWin32SurfaceKHR" );
+          m_surfaceKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::Win32SurfaceCreateInfoKHR const &                         createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_WIN32_KHR*/
 
 #  if defined( VK_USE_PLATFORM_XCB_KHR )
@@ -6715,11 +8798,41 @@ namespace VULKAN_HPP_NAMESPACE
                                                   reinterpret_cast<const VkXcbSurfaceCreateInfoKHR *>( &createInfo ),
                                                   m_allocator,
                                                   reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateXcbSurfaceKHR" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateXcbSurfaceKHR );
         }
       }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::XcbSurfaceCreateInfoKHR const &                           createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateXcbSurfaceKHR( static_cast<VkInstance>( *instance ),
+                                                  reinterpret_cast<const VkXcbSurfaceCreateInfoKHR *>( &createInfo ),
+                                                  m_allocator,
+                                                  reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_surfaceKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::XcbSurfaceCreateInfoKHR const &                           createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_XCB_KHR*/
 
 #  if defined( VK_USE_PLATFORM_XLIB_KHR )
@@ -6736,11 +8849,41 @@ namespace VULKAN_HPP_NAMESPACE
                                                    reinterpret_cast<const VkXlibSurfaceCreateInfoKHR *>( &createInfo ),
                                                    m_allocator,
                                                    reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateXlibSurfaceKHR );
+        }
+      }
+
+      SurfaceKHR( VULKAN_HPP_NAMESPACE::Result &                                                  result,
+                  VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                  VULKAN_HPP_NAMESPACE::XlibSurfaceCreateInfoKHR const &                          createInfo,
+                  VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_instance( *instance )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( instance.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateXlibSurfaceKHR( static_cast<VkInstance>( *instance ),
+                                                   reinterpret_cast<const VkXlibSurfaceCreateInfoKHR *>( &createInfo ),
+                                                   m_allocator,
+                                                   reinterpret_cast<VkSurfaceKHR *>( &m_surfaceKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateXlibSurfaceKHR" );
+          m_surfaceKHR = nullptr;
         }
       }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
+                VULKAN_HPP_NAMESPACE::XlibSurfaceCreateInfoKHR const &                          createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SurfaceKHR                   surfaceKHR( result, instance, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SurfaceKHR>( result, std::move( surfaceKHR ) );
+      }
 #  endif /*VK_USE_PLATFORM_XLIB_KHR*/
 
       SurfaceKHR( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Instance const &               instance,
@@ -6825,12 +8968,44 @@ namespace VULKAN_HPP_NAMESPACE
                                                  reinterpret_cast<const VkSwapchainCreateInfoKHR *>( &createInfo ),
                                                  m_allocator,
                                                  reinterpret_cast<VkSwapchainKHR *>( &m_swapchainKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateSwapchainKHR" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateSwapchainKHR );
         }
       }
 
+      SwapchainKHR(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::SwapchainCreateInfoKHR const &                            createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
+          getDispatcher()->vkCreateSwapchainKHR( static_cast<VkDevice>( *device ),
+                                                 reinterpret_cast<const VkSwapchainCreateInfoKHR *>( &createInfo ),
+                                                 m_allocator,
+                                                 reinterpret_cast<VkSwapchainKHR *>( &m_swapchainKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          m_swapchainKHR = nullptr;
+        }
+      }
+
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SwapchainKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::SwapchainCreateInfoKHR const &                            createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        SwapchainKHR                 swapchainKHR( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<SwapchainKHR>( result,
+                                                                                        std::move( swapchainKHR ) );
+      }
+
       SwapchainKHR(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkSwapchainKHR                                                                  swapchainKHR,
@@ -6924,16 +9099,20 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * m_dispatcher;
     };
 
-    class SwapchainKHRs : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SwapchainKHR>
+    template <typename Allocator = std::allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SwapchainKHR>>
+    class BasicSwapchainKHRs
+      : public std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SwapchainKHR, Allocator>
     {
     public:
-      SwapchainKHRs(
+      BasicSwapchainKHRs(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                        device,
         VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::SwapchainCreateInfoKHR> const & createInfos,
-        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>        allocator = nullptr )
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>        allocator = nullptr,
+        Allocator const & handlesAllocator                                                               = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SwapchainKHR, Allocator>( handlesAllocator )
       {
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
-        std::vector<VkSwapchainKHR>                                               swapchains( createInfos.size() );
+        ScratchVector<VkSwapchainKHR>                                             swapchains( createInfos.size() );
         VULKAN_HPP_NAMESPACE::Result                                              result =
           static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateSharedSwapchainsKHR(
             static_cast<VkDevice>( *device ),
@@ -6942,7 +9121,7 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkAllocationCallbacks *>(
               static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
             swapchains.data() ) );
-        if ( result == VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
           this->reserve( createInfos.size() );
           for ( auto const & swapchainKHR : swapchains )
@@ -6956,17 +9135,70 @@ namespace VULKAN_HPP_NAMESPACE
         }
         else
         {
-          throwResultException( result, "vkCreateSharedSwapchainsKHR" );
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateSharedSwapchainsKHR );
+        }
+      }
+
+      BasicSwapchainKHRs(
+        VULKAN_HPP_NAMESPACE::Result &                                                         result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                        device,
+        VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::SwapchainCreateInfoKHR> const & createInfos,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks>        allocator = nullptr,
+        Allocator const & handlesAllocator                                                               = Allocator() )
+        : std::vector<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SwapchainKHR, Allocator>( handlesAllocator )
+      {
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DeviceDispatcher const * dispatcher = device.getDispatcher();
+        ScratchVector<VkSwapchainKHR>                                             swapchains( createInfos.size() );
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( dispatcher->vkCreateSharedSwapchainsKHR(
+          static_cast<VkDevice>( *device ),
+          createInfos.size(),
+          reinterpret_cast<const VkSwapchainCreateInfoKHR *>( createInfos.data() ),
+          reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+          swapchains.data() ) );
+        if ( VULKAN_HPP_LIKELY( result == VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          this->reserve( createInfos.size() );
+          for ( auto const & swapchainKHR : swapchains )
+          {
+            this->emplace_back( swapchainKHR,
+                                static_cast<VkDevice>( *device ),
+                                reinterpret_cast<const VkAllocationCallbacks *>(
+                                  static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ),
+                                dispatcher );
+          }
         }
       }
 
-      SwapchainKHRs()                        = delete;
-      SwapchainKHRs( SwapchainKHRs const & ) = delete;
-      SwapchainKHRs( SwapchainKHRs && rhs )  = default;
-      SwapchainKHRs & operator=( SwapchainKHRs const & ) = delete;
-      SwapchainKHRs & operator=( SwapchainKHRs && rhs ) = default;
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicSwapchainKHRs>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                        device,
+                VULKAN_HPP_NAMESPACE::ArrayProxy<VULKAN_HPP_NAMESPACE::SwapchainCreateInfoKHR> const & createInfos,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr,
+                Allocator const & handlesAllocator = Allocator() )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        BasicSwapchainKHRs           swapchainKHRs( result, device, createInfos, allocator, handlesAllocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<BasicSwapchainKHRs>(
+          result, std::move( swapchainKHRs ) );
+      }
+
+      BasicSwapchainKHRs()                                         = delete;
+      BasicSwapchainKHRs( BasicSwapchainKHRs const & )             = delete;
+      BasicSwapchainKHRs( BasicSwapchainKHRs && rhs )              = default;
+      BasicSwapchainKHRs & operator=( BasicSwapchainKHRs const & ) = delete;
+      BasicSwapchainKHRs & operator=( BasicSwapchainKHRs && rhs )  = default;
     };
 
+    using SwapchainKHRs = BasicSwapchainKHRs<>;
+
+#  if defined( VULKAN_HPP_RAII_HAS_PMR )
+    namespace pmr
+    {
+      using SwapchainKHRs = BasicSwapchainKHRs<
+        std::pmr::polymorphic_allocator<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SwapchainKHR>>;
+    }
+#  endif
+
     class ValidationCacheEXT
     {
     public:
@@ -6993,12 +9225,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkValidationCacheCreateInfoEXT *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkValidationCacheEXT *>( &m_validationCacheEXT ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateValidationCacheEXT );
+        }
+      }
+
+      ValidationCacheEXT(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::ValidationCacheCreateInfoEXT const &                      createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateValidationCacheEXT(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkValidationCacheCreateInfoEXT *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkValidationCacheEXT *>( &m_validationCacheEXT ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateValidationCacheEXT" );
+          m_validationCacheEXT = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<ValidationCacheEXT>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::ValidationCacheCreateInfoEXT const &                      createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        ValidationCacheEXT           validationCacheEXT( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<ValidationCacheEXT>(
+          result, std::move( validationCacheEXT ) );
+      }
+
       ValidationCacheEXT(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkValidationCacheEXT                                                            validationCacheEXT,
@@ -7092,12 +9356,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkVideoSessionCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkVideoSessionKHR *>( &m_videoSessionKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateVideoSessionKHR );
+        }
+      }
+
+      VideoSessionKHR(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::VideoSessionCreateInfoKHR const &                         createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateVideoSessionKHR(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkVideoSessionCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkVideoSessionKHR *>( &m_videoSessionKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateVideoSessionKHR" );
+          m_videoSessionKHR = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<VideoSessionKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::VideoSessionCreateInfoKHR const &                         createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        VideoSessionKHR              videoSessionKHR( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<VideoSessionKHR>(
+          result, std::move( videoSessionKHR ) );
+      }
+
       VideoSessionKHR(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkVideoSessionKHR                                                               videoSessionKHR,
@@ -7195,12 +9491,44 @@ namespace VULKAN_HPP_NAMESPACE
             reinterpret_cast<const VkVideoSessionParametersCreateInfoKHR *>( &createInfo ),
             m_allocator,
             reinterpret_cast<VkVideoSessionParametersKHR *>( &m_videoSessionParametersKHR ) ) );
-        if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
+        {
+          throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCreateVideoSessionParametersKHR );
+        }
+      }
+
+      VideoSessionParametersKHR(
+        VULKAN_HPP_NAMESPACE::Result &                                                  result,
+        VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+        VULKAN_HPP_NAMESPACE::VideoSessionParametersCreateInfoKHR const &               createInfo,
+        VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+        : m_device( *device )
+        , m_allocator( reinterpret_cast<const VkAllocationCallbacks *>(
+            static_cast<const VULKAN_HPP_NAMESPACE::AllocationCallbacks *>( allocator ) ) )
+        , m_dispatcher( device.getDispatcher() )
+      {
+        result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCreateVideoSessionParametersKHR(
+          static_cast<VkDevice>( *device ),
+          reinterpret_cast<const VkVideoSessionParametersCreateInfoKHR *>( &createInfo ),
+          m_allocator,
+          reinterpret_cast<VkVideoSessionParametersKHR *>( &m_videoSessionParametersKHR ) ) );
+        if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
         {
-          throwResultException( result, "vkCreateVideoSessionParametersKHR" );
+          m_videoSessionParametersKHR = nullptr;
         }
       }
 
+      static VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<VideoSessionParametersKHR>
+        create( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
+                VULKAN_HPP_NAMESPACE::VideoSessionParametersCreateInfoKHR const &               createInfo,
+                VULKAN_HPP_NAMESPACE::Optional<const VULKAN_HPP_NAMESPACE::AllocationCallbacks> allocator = nullptr )
+      {
+        VULKAN_HPP_NAMESPACE::Result result;
+        VideoSessionParametersKHR    videoSessionParametersKHR( result, device, createInfo, allocator );
+        return VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Expected<VideoSessionParametersKHR>(
+          result, std::move( videoSessionParametersKHR ) );
+      }
+
       VideoSessionParametersKHR(
         VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const &                 device,
         VkVideoSessionParametersKHR                                                     videoSessionParametersKHR,
@@ -7293,9 +9621,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Context::enumerateInstanceExtensionProperties" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumerateInstanceExtensionProperties );
       }
       return properties;
     }
@@ -7322,9 +9650,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Context::enumerateInstanceLayerProperties" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumerateInstanceLayerProperties );
       }
       return properties;
     }
@@ -7334,9 +9662,9 @@ namespace VULKAN_HPP_NAMESPACE
       uint32_t                     apiVersion;
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkEnumerateInstanceVersion( &apiVersion ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Context::enumerateInstanceVersion" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumerateInstanceVersion );
       }
       return apiVersion;
     }
@@ -7387,9 +9715,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         physicalDeviceGroupProperties.resize( physicalDeviceGroupCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Instance::enumeratePhysicalDeviceGroups" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumeratePhysicalDeviceGroups );
       }
       return physicalDeviceGroupProperties;
     }
@@ -7425,9 +9753,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkAcquireXlibDisplayEXT(
           static_cast<VkPhysicalDevice>( m_physicalDevice ), &dpy, static_cast<VkDisplayKHR>( display ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::acquireXlibDisplayEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquireXlibDisplayEXT );
       }
     }
 #  endif /*VK_USE_PLATFORM_XLIB_XRANDR_EXT*/
@@ -7460,10 +9788,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::enumerateDeviceExtensionProperties" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumerateDeviceExtensionProperties );
       }
       return properties;
     }
@@ -7492,9 +9819,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::enumerateDeviceLayerProperties" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumerateDeviceLayerProperties );
       }
       return properties;
     }
@@ -7536,10 +9863,9 @@ namespace VULKAN_HPP_NAMESPACE
         counters.resize( counterCount );
         counterDescriptions.resize( counterCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException(
-          result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::enumerateQueueFamilyPerformanceQueryCountersKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR );
       }
       return data;
     }
@@ -7557,9 +9883,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkDisplayPlaneInfo2KHR *>( &displayPlaneInfo ),
           reinterpret_cast<VkDisplayPlaneCapabilities2KHR *>( &capabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getDisplayPlaneCapabilities2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDisplayPlaneCapabilities2KHR );
       }
       return capabilities;
     }
@@ -7594,9 +9920,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         timeDomains.resize( timeDomainCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getCalibrateableTimeDomainsEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceCalibrateableTimeDomainsEXT );
       }
       return timeDomains;
     }
@@ -7631,10 +9957,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getCooperativeMatrixPropertiesNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceCooperativeMatrixPropertiesNV );
       }
       return properties;
     }
@@ -7684,9 +10009,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getDisplayPlaneProperties2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceDisplayPlaneProperties2KHR );
       }
       return properties;
     }
@@ -7721,9 +10046,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getDisplayPlanePropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceDisplayPlanePropertiesKHR );
       }
       return properties;
     }
@@ -7756,9 +10081,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getDisplayProperties2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceDisplayProperties2KHR );
       }
       return properties;
     }
@@ -7791,9 +10116,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getDisplayPropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceDisplayPropertiesKHR );
       }
       return properties;
     }
@@ -7846,10 +10171,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkImageCreateFlags>( flags ),
           static_cast<VkExternalMemoryHandleTypeFlagsNV>( externalHandleType ),
           reinterpret_cast<VkExternalImageFormatPropertiesNV *>( &externalImageFormatProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getExternalImageFormatPropertiesNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceExternalImageFormatPropertiesNV );
       }
       return externalImageFormatProperties;
     }
@@ -7962,9 +10286,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         fragmentShadingRates.resize( fragmentShadingRateCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getFragmentShadingRatesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceFragmentShadingRatesKHR );
       }
       return fragmentShadingRates;
     }
@@ -7986,9 +10310,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkImageUsageFlags>( usage ),
           static_cast<VkImageCreateFlags>( flags ),
           reinterpret_cast<VkImageFormatProperties *>( &imageFormatProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceImageFormatProperties );
       }
       return imageFormatProperties;
     }
@@ -8002,9 +10326,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkPhysicalDeviceImageFormatInfo2 *>( &imageFormatInfo ),
           reinterpret_cast<VkImageFormatProperties2 *>( &imageFormatProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties2" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceImageFormatProperties2 );
       }
       return imageFormatProperties;
     }
@@ -8021,9 +10345,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkPhysicalDeviceImageFormatInfo2 *>( &imageFormatInfo ),
           reinterpret_cast<VkImageFormatProperties2 *>( &imageFormatProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getImageFormatProperties2" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceImageFormatProperties2 );
       }
       return structureChain;
     }
@@ -8109,9 +10433,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         rects.resize( rectCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getPresentRectanglesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDevicePresentRectanglesKHR );
       }
       return rects;
     }
@@ -8197,8 +10521,8 @@ namespace VULKAN_HPP_NAMESPACE
       uint32_t queueFamilyPropertyCount;
       getDispatcher()->vkGetPhysicalDeviceQueueFamilyProperties2(
         static_cast<VkPhysicalDevice>( m_physicalDevice ), &queueFamilyPropertyCount, nullptr );
-      std::vector<StructureChain>                               returnVector( queueFamilyPropertyCount );
-      std::vector<VULKAN_HPP_NAMESPACE::QueueFamilyProperties2> queueFamilyProperties( queueFamilyPropertyCount );
+      std::vector<StructureChain>                                 returnVector( queueFamilyPropertyCount );
+      ScratchVector<VULKAN_HPP_NAMESPACE::QueueFamilyProperties2> queueFamilyProperties( queueFamilyPropertyCount );
       for ( uint32_t i = 0; i < queueFamilyPropertyCount; i++ )
       {
         queueFamilyProperties[i].pNext =
@@ -8313,10 +10637,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         combinations.resize( combinationCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException(
-          result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSupportedFramebufferMixedSamplesCombinationsNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV );
       }
       return combinations;
     }
@@ -8334,9 +10657,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           static_cast<VkSurfaceKHR>( surface ),
           reinterpret_cast<VkSurfaceCapabilities2EXT *>( &surfaceCapabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceCapabilities2EXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceCapabilities2EXT );
       }
       return surfaceCapabilities;
     }
@@ -8354,9 +10677,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkPhysicalDeviceSurfaceInfo2KHR *>( &surfaceInfo ),
           reinterpret_cast<VkSurfaceCapabilities2KHR *>( &surfaceCapabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceCapabilities2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceCapabilities2KHR );
       }
       return surfaceCapabilities;
     }
@@ -8373,9 +10696,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkPhysicalDeviceSurfaceInfo2KHR *>( &surfaceInfo ),
           reinterpret_cast<VkSurfaceCapabilities2KHR *>( &surfaceCapabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceCapabilities2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceCapabilities2KHR );
       }
       return structureChain;
     }
@@ -8393,9 +10716,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           static_cast<VkSurfaceKHR>( surface ),
           reinterpret_cast<VkSurfaceCapabilitiesKHR *>( &surfaceCapabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceCapabilitiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceCapabilitiesKHR );
       }
       return surfaceCapabilities;
     }
@@ -8432,9 +10755,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         surfaceFormats.resize( surfaceFormatCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceFormats2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceFormats2KHR );
       }
       return surfaceFormats;
     }
@@ -8470,9 +10793,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         surfaceFormats.resize( surfaceFormatCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceFormatsKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceFormatsKHR );
       }
       return surfaceFormats;
     }
@@ -8511,9 +10834,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         presentModes.resize( presentModeCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfacePresentModes2EXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfacePresentModes2EXT );
       }
       return presentModes;
     }
@@ -8552,9 +10875,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         presentModes.resize( presentModeCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfacePresentModesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfacePresentModesKHR );
       }
       return presentModes;
     }
@@ -8571,9 +10894,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                                queueFamilyIndex,
                                                                static_cast<VkSurfaceKHR>( surface ),
                                                                reinterpret_cast<VkBool32 *>( &supported ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getSurfaceSupportKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceSurfaceSupportKHR );
       }
       return supported;
     }
@@ -8606,9 +10929,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         toolProperties.resize( toolCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getToolPropertiesEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceToolPropertiesEXT );
       }
       return toolProperties;
     }
@@ -8627,9 +10950,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkVideoProfileKHR *>( &videoProfile ),
           reinterpret_cast<VkVideoCapabilitiesKHR *>( &capabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getVideoCapabilitiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceVideoCapabilitiesKHR );
       }
       return capabilities;
     }
@@ -8648,9 +10971,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkPhysicalDevice>( m_physicalDevice ),
           reinterpret_cast<const VkVideoProfileKHR *>( &videoProfile ),
           reinterpret_cast<VkVideoCapabilitiesKHR *>( &capabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getVideoCapabilitiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceVideoCapabilitiesKHR );
       }
       return structureChain;
     }
@@ -8692,9 +11015,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         videoFormatProperties.resize( videoFormatPropertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PhysicalDevice::getVideoFormatPropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPhysicalDeviceVideoFormatPropertiesKHR );
       }
       return videoFormatProperties;
     }
@@ -8766,12 +11089,12 @@ namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkAcquireNextImage2KHR( static_cast<VkDevice>( m_device ),
                                                  reinterpret_cast<const VkAcquireNextImageInfoKHR *>( &acquireInfo ),
                                                  &imageIndex ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eTimeout ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireNextImage2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquireNextImage2KHR );
       }
       return std::make_pair( result, imageIndex );
     }
@@ -8784,9 +11107,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkAcquireProfilingLockKHR(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkAcquireProfilingLockInfoKHR *>( &info ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::acquireProfilingLockKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquireProfilingLockKHR );
       }
     }
 
@@ -8802,9 +11125,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           bindInfos.size(),
           reinterpret_cast<const VkBindAccelerationStructureMemoryInfoNV *>( bindInfos.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::bindAccelerationStructureMemoryNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBindAccelerationStructureMemoryNV );
       }
     }
 
@@ -8815,9 +11138,9 @@ namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkBindBufferMemory2( static_cast<VkDevice>( m_device ),
                                               bindInfos.size(),
                                               reinterpret_cast<const VkBindBufferMemoryInfo *>( bindInfos.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::bindBufferMemory2" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBindBufferMemory2 );
       }
     }
 
@@ -8828,9 +11151,9 @@ namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkBindImageMemory2( static_cast<VkDevice>( m_device ),
                                              bindInfos.size(),
                                              reinterpret_cast<const VkBindImageMemoryInfo *>( bindInfos.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::bindImageMemory2" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBindImageMemory2 );
       }
     }
 
@@ -8843,11 +11166,16 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_ASSERT(
         getDispatcher()->vkBuildAccelerationStructuresKHR &&
         "Function <vkBuildAccelerationStructuresKHR> needs extension <VK_KHR_acceleration_structure> enabled!" );
+
+#  ifdef VULKAN_HPP_NO_EXCEPTIONS
+      VULKAN_HPP_ASSERT( infos.size() == pBuildRangeInfos.size() );
+#  else
       if ( infos.size() != pBuildRangeInfos.size() )
       {
         throw LogicError( VULKAN_HPP_NAMESPACE_STRING
                           "::Device::buildAccelerationStructuresKHR: infos.size() != pBuildRangeInfos.size()" );
       }
+#  endif /*VULKAN_HPP_NO_EXCEPTIONS*/
 
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkBuildAccelerationStructuresKHR(
@@ -8856,11 +11184,11 @@ namespace VULKAN_HPP_NAMESPACE
           infos.size(),
           reinterpret_cast<const VkAccelerationStructureBuildGeometryInfoKHR *>( infos.data() ),
           reinterpret_cast<const VkAccelerationStructureBuildRangeInfoKHR * const *>( pBuildRangeInfos.data() ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::buildAccelerationStructuresKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBuildAccelerationStructuresKHR );
       }
       return result;
     }
@@ -8878,11 +11206,11 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkDeferredOperationKHR>( deferredOperation ),
           reinterpret_cast<const VkCopyAccelerationStructureInfoKHR *>( &info ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyAccelerationStructureKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCopyAccelerationStructureKHR );
       }
       return result;
     }
@@ -8900,11 +11228,11 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkDeferredOperationKHR>( deferredOperation ),
           reinterpret_cast<const VkCopyAccelerationStructureToMemoryInfoKHR *>( &info ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyAccelerationStructureToMemoryKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCopyAccelerationStructureToMemoryKHR );
       }
       return result;
     }
@@ -8922,11 +11250,11 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkDeferredOperationKHR>( deferredOperation ),
           reinterpret_cast<const VkCopyMemoryToAccelerationStructureInfoKHR *>( &info ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eOperationDeferredKHR ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eOperationNotDeferredKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::copyMemoryToAccelerationStructureKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCopyMemoryToAccelerationStructureKHR );
       }
       return result;
     }
@@ -8939,9 +11267,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkDebugMarkerSetObjectNameEXT(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkDebugMarkerObjectNameInfoEXT *>( &nameInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::debugMarkerSetObjectNameEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eDebugMarkerSetObjectNameEXT );
       }
     }
 
@@ -8953,9 +11281,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkDebugMarkerSetObjectTagEXT(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkDebugMarkerObjectTagInfoEXT *>( &tagInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::debugMarkerSetObjectTagEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eDebugMarkerSetObjectTagEXT );
       }
     }
 
@@ -8963,9 +11291,9 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkDeviceWaitIdle( static_cast<VkDevice>( m_device ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitIdle" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eDeviceWaitIdle );
       }
     }
 
@@ -8980,9 +11308,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkDisplayKHR>( display ),
           reinterpret_cast<const VkDisplayPowerInfoEXT *>( &displayPowerInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::displayPowerControlEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eDisplayPowerControlEXT );
       }
     }
 
@@ -8994,9 +11322,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           memoryRanges.size(),
           reinterpret_cast<const VkMappedMemoryRange *>( memoryRanges.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::flushMappedMemoryRanges" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eFlushMappedMemoryRanges );
       }
     }
 
@@ -9083,10 +11411,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           &buffer,
           reinterpret_cast<VkAndroidHardwareBufferPropertiesANDROID *>( &properties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::Device::getAndroidHardwareBufferPropertiesANDROID" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetAndroidHardwareBufferPropertiesANDROID );
       }
       return properties;
     }
@@ -9105,10 +11432,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           &buffer,
           reinterpret_cast<VkAndroidHardwareBufferPropertiesANDROID *>( &properties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::Device::getAndroidHardwareBufferPropertiesANDROID" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetAndroidHardwareBufferPropertiesANDROID );
       }
       return structureChain;
     }
@@ -9172,9 +11498,9 @@ namespace VULKAN_HPP_NAMESPACE
           reinterpret_cast<const VkCalibratedTimestampInfoEXT *>( timestampInfos.data() ),
           timestamps.data(),
           &maxDeviation ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getCalibratedTimestampsEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetCalibratedTimestampsEXT );
       }
       return data;
     }
@@ -9248,9 +11574,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkGetDeviceGroupPresentCapabilitiesKHR(
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<VkDeviceGroupPresentCapabilitiesKHR *>( &deviceGroupPresentCapabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getGroupPresentCapabilitiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDeviceGroupPresentCapabilitiesKHR );
       }
       return deviceGroupPresentCapabilities;
     }
@@ -9269,9 +11595,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkPhysicalDeviceSurfaceInfo2KHR *>( &surfaceInfo ),
           reinterpret_cast<VkDeviceGroupPresentModeFlagsKHR *>( &modes ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getGroupSurfacePresentModes2EXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDeviceGroupSurfacePresentModes2EXT );
       }
       return modes;
     }
@@ -9290,9 +11616,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkSurfaceKHR>( surface ),
           reinterpret_cast<VkDeviceGroupPresentModeFlagsKHR *>( &modes ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getGroupSurfacePresentModesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDeviceGroupSurfacePresentModesKHR );
       }
       return modes;
     }
@@ -9318,9 +11644,9 @@ namespace VULKAN_HPP_NAMESPACE
       int                          fd;
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkGetFenceFdKHR(
         static_cast<VkDevice>( m_device ), reinterpret_cast<const VkFenceGetFdInfoKHR *>( &getFdInfo ), &fd ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFenceFdKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetFenceFdKHR );
       }
       return fd;
     }
@@ -9338,9 +11664,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkFenceGetWin32HandleInfoKHR *>( &getWin32HandleInfo ),
           &handle ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getFenceWin32HandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetFenceWin32HandleKHR );
       }
       return handle;
     }
@@ -9450,9 +11776,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkMemoryGetAndroidHardwareBufferInfoANDROID *>( &info ),
           &buffer ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryAndroidHardwareBufferANDROID" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryAndroidHardwareBufferANDROID );
       }
       return buffer;
     }
@@ -9467,9 +11793,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkGetMemoryFdKHR(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkMemoryGetFdInfoKHR *>( &getFdInfo ), &fd ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryFdKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryFdKHR );
       }
       return fd;
     }
@@ -9488,9 +11814,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkExternalMemoryHandleTypeFlagBits>( handleType ),
           fd,
           reinterpret_cast<VkMemoryFdPropertiesKHR *>( &memoryFdProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryFdPropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryFdPropertiesKHR );
       }
       return memoryFdProperties;
     }
@@ -9510,9 +11836,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkExternalMemoryHandleTypeFlagBits>( handleType ),
           pHostPointer,
           reinterpret_cast<VkMemoryHostPointerPropertiesEXT *>( &memoryHostPointerProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryHostPointerPropertiesEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryHostPointerPropertiesEXT );
       }
       return memoryHostPointerProperties;
     }
@@ -9531,9 +11857,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkMemoryGetWin32HandleInfoKHR *>( &getWin32HandleInfo ),
           &handle ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryWin32HandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryWin32HandleKHR );
       }
       return handle;
     }
@@ -9555,9 +11881,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkExternalMemoryHandleTypeFlagBits>( handleType ),
           handle,
           reinterpret_cast<VkMemoryWin32HandlePropertiesKHR *>( &memoryWin32HandleProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryWin32HandlePropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryWin32HandlePropertiesKHR );
       }
       return memoryWin32HandleProperties;
     }
@@ -9577,9 +11903,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkMemoryGetZirconHandleInfoFUCHSIA *>( &getZirconHandleInfo ),
           &zirconHandle ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryZirconHandleFUCHSIA" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryZirconHandleFUCHSIA );
       }
       return zirconHandle;
     }
@@ -9601,9 +11927,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkExternalMemoryHandleTypeFlagBits>( handleType ),
           zirconHandle,
           reinterpret_cast<VkMemoryZirconHandlePropertiesFUCHSIA *>( &memoryZirconHandleProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getMemoryZirconHandlePropertiesFUCHSIA" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryZirconHandlePropertiesFUCHSIA );
       }
       return memoryZirconHandleProperties;
     }
@@ -9621,9 +11947,9 @@ namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkGetPerformanceParameterINTEL( static_cast<VkDevice>( m_device ),
                                                          static_cast<VkPerformanceParameterTypeINTEL>( parameter ),
                                                          reinterpret_cast<VkPerformanceValueINTEL *>( &value ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPerformanceParameterINTEL" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPerformanceParameterINTEL );
       }
       return value;
     }
@@ -9664,10 +11990,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         internalRepresentations.resize( internalRepresentationCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::Device::getPipelineExecutableInternalRepresentationsKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPipelineExecutableInternalRepresentationsKHR );
       }
       return internalRepresentations;
     }
@@ -9704,9 +12029,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( executableCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPipelineExecutablePropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPipelineExecutablePropertiesKHR );
       }
       return properties;
     }
@@ -9743,9 +12068,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         statistics.resize( statisticCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getPipelineExecutableStatisticsKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPipelineExecutableStatisticsKHR );
       }
       return statistics;
     }
@@ -9777,9 +12102,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkGetSemaphoreFdKHR(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkSemaphoreGetFdInfoKHR *>( &getFdInfo ), &fd ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSemaphoreFdKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSemaphoreFdKHR );
       }
       return fd;
     }
@@ -9798,9 +12123,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkSemaphoreGetWin32HandleInfoKHR *>( &getWin32HandleInfo ),
           &handle ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSemaphoreWin32HandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSemaphoreWin32HandleKHR );
       }
       return handle;
     }
@@ -9820,9 +12145,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkSemaphoreGetZirconHandleInfoFUCHSIA *>( &getZirconHandleInfo ),
           &zirconHandle ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::getSemaphoreZirconHandleFUCHSIA" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSemaphoreZirconHandleFUCHSIA );
       }
       return zirconHandle;
     }
@@ -9836,9 +12161,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkImportFenceFdKHR(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkImportFenceFdInfoKHR *>( &importFenceFdInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::importFenceFdKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eImportFenceFdKHR );
       }
     }
 
@@ -9854,9 +12179,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkImportFenceWin32HandleKHR(
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkImportFenceWin32HandleInfoKHR *>( &importFenceWin32HandleInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::importFenceWin32HandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eImportFenceWin32HandleKHR );
       }
     }
 #  endif /*VK_USE_PLATFORM_WIN32_KHR*/
@@ -9870,9 +12195,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkImportSemaphoreFdKHR(
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkImportSemaphoreFdInfoKHR *>( &importSemaphoreFdInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::importSemaphoreFdKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eImportSemaphoreFdKHR );
       }
     }
 
@@ -9888,9 +12213,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkImportSemaphoreWin32HandleKHR(
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkImportSemaphoreWin32HandleInfoKHR *>( &importSemaphoreWin32HandleInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::importSemaphoreWin32HandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eImportSemaphoreWin32HandleKHR );
       }
     }
 #  endif /*VK_USE_PLATFORM_WIN32_KHR*/
@@ -9907,9 +12232,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkImportSemaphoreZirconHandleFUCHSIA(
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkImportSemaphoreZirconHandleInfoFUCHSIA *>( &importSemaphoreZirconHandleInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::importSemaphoreZirconHandleFUCHSIA" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eImportSemaphoreZirconHandleFUCHSIA );
       }
     }
 #  endif /*VK_USE_PLATFORM_FUCHSIA*/
@@ -9925,9 +12250,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkInitializePerformanceApiINTEL(
           static_cast<VkDevice>( m_device ),
           reinterpret_cast<const VkInitializePerformanceApiInfoINTEL *>( &initializeInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::initializePerformanceApiINTEL" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eInitializePerformanceApiINTEL );
       }
     }
 
@@ -9939,9 +12264,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           memoryRanges.size(),
           reinterpret_cast<const VkMappedMemoryRange *>( memoryRanges.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::invalidateMappedMemoryRanges" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eInvalidateMappedMemoryRanges );
       }
     }
 
@@ -9957,9 +12282,9 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkResetFences(
         static_cast<VkDevice>( m_device ), fences.size(), reinterpret_cast<const VkFence *>( fences.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::resetFences" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eResetFences );
       }
     }
 
@@ -9971,9 +12296,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkSetDebugUtilsObjectNameEXT(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkDebugUtilsObjectNameInfoEXT *>( &nameInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::setDebugUtilsObjectNameEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eSetDebugUtilsObjectNameEXT );
       }
     }
 
@@ -9985,9 +12310,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkSetDebugUtilsObjectTagEXT(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkDebugUtilsObjectTagInfoEXT *>( &tagInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::setDebugUtilsObjectTagEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eSetDebugUtilsObjectTagEXT );
       }
     }
 
@@ -10029,9 +12354,9 @@ namespace VULKAN_HPP_NAMESPACE
                                               objectHandle,
                                               static_cast<VkPrivateDataSlotEXT>( privateDataSlot ),
                                               data ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::setPrivateDataEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eSetPrivateDataEXT );
       }
     }
 
@@ -10040,9 +12365,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkSignalSemaphore(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkSemaphoreSignalInfo *>( &signalInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::signalSemaphore" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eSignalSemaphore );
       }
     }
 
@@ -10078,10 +12403,10 @@ namespace VULKAN_HPP_NAMESPACE
                                           reinterpret_cast<const VkFence *>( fences.data() ),
                                           static_cast<VkBool32>( waitAll ),
                                           timeout ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eTimeout ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eTimeout ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitForFences" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eWaitForFences );
       }
       return result;
     }
@@ -10092,10 +12417,10 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkWaitSemaphores(
           static_cast<VkDevice>( m_device ), reinterpret_cast<const VkSemaphoreWaitInfo *>( &waitInfo ), timeout ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eTimeout ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eTimeout ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::waitSemaphores" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eWaitSemaphores );
       }
       return result;
     }
@@ -10121,10 +12446,9 @@ namespace VULKAN_HPP_NAMESPACE
         data.size() * sizeof( T ),
         reinterpret_cast<void *>( data.data() ),
         stride ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result,
-                              VULKAN_HPP_NAMESPACE_STRING "::Device::writeAccelerationStructuresPropertiesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eWriteAccelerationStructuresPropertiesKHR );
       }
       return data;
     }
@@ -10144,9 +12468,9 @@ namespace VULKAN_HPP_NAMESPACE
         sizeof( T ),
         reinterpret_cast<void *>( &data ),
         stride ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Device::writeAccelerationStructuresPropertyKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eWriteAccelerationStructuresPropertiesKHR );
       }
       return data;
     }
@@ -10164,9 +12488,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ),
         data.size() * sizeof( T ),
         reinterpret_cast<void *>( data.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::AccelerationStructureNV::getHandle" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetAccelerationStructureHandleNV );
       }
       return data;
     }
@@ -10180,9 +12504,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VkAccelerationStructureNV>( m_accelerationStructureNV ),
         sizeof( T ),
         reinterpret_cast<void *>( &data ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::AccelerationStructureNV::getHandle" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetAccelerationStructureHandleNV );
       }
       return data;
     }
@@ -10195,9 +12519,9 @@ namespace VULKAN_HPP_NAMESPACE
                                              static_cast<VkBuffer>( m_buffer ),
                                              static_cast<VkDeviceMemory>( memory ),
                                              static_cast<VkDeviceSize>( memoryOffset ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Buffer::bindMemory" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBindBufferMemory );
       }
     }
 
@@ -10217,9 +12541,9 @@ namespace VULKAN_HPP_NAMESPACE
         getDispatcher()->vkResetCommandPool( static_cast<VkDevice>( m_device ),
                                              static_cast<VkCommandPool>( m_commandPool ),
                                              static_cast<VkCommandPoolResetFlags>( flags ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandPool::reset" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eResetCommandPool );
       }
     }
 
@@ -10236,9 +12560,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkBeginCommandBuffer( static_cast<VkCommandBuffer>( m_commandBuffer ),
                                                reinterpret_cast<const VkCommandBufferBeginInfo *>( &beginInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::begin" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBeginCommandBuffer );
       }
     }
 
@@ -11641,9 +13965,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCmdSetPerformanceMarkerINTEL(
           static_cast<VkCommandBuffer>( m_commandBuffer ),
           reinterpret_cast<const VkPerformanceMarkerInfoINTEL *>( &markerInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::setPerformanceMarkerINTEL" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCmdSetPerformanceMarkerINTEL );
       }
     }
 
@@ -11658,9 +13982,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCmdSetPerformanceOverrideINTEL(
           static_cast<VkCommandBuffer>( m_commandBuffer ),
           reinterpret_cast<const VkPerformanceOverrideInfoINTEL *>( &overrideInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::setPerformanceOverrideINTEL" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCmdSetPerformanceOverrideINTEL );
       }
     }
 
@@ -11675,9 +13999,9 @@ namespace VULKAN_HPP_NAMESPACE
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCmdSetPerformanceStreamMarkerINTEL(
           static_cast<VkCommandBuffer>( m_commandBuffer ),
           reinterpret_cast<const VkPerformanceStreamMarkerInfoINTEL *>( &markerInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::setPerformanceStreamMarkerINTEL" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCmdSetPerformanceStreamMarkerINTEL );
       }
     }
 
@@ -12107,9 +14431,9 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkEndCommandBuffer( static_cast<VkCommandBuffer>( m_commandBuffer ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::end" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eEndCommandBuffer );
       }
     }
 
@@ -12118,9 +14442,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkResetCommandBuffer(
           static_cast<VkCommandBuffer>( m_commandBuffer ), static_cast<VkCommandBufferResetFlags>( flags ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::CommandBuffer::reset" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eResetCommandBuffer );
       }
     }
 
@@ -12133,11 +14457,11 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkDeferredOperationJoinKHR(
           static_cast<VkDevice>( m_device ), static_cast<VkDeferredOperationKHR>( m_deferredOperationKHR ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eThreadDoneKHR ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eThreadIdleKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eThreadIdleKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DeferredOperationKHR::join" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eDeferredOperationJoinKHR );
       }
       return result;
     }
@@ -12205,9 +14529,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                    static_cast<VkDeviceMemory>( m_deviceMemory ),
                                                    static_cast<VkExternalMemoryHandleTypeFlagsNV>( handleType ),
                                                    &handle ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DeviceMemory::getMemoryWin32HandleNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetMemoryWin32HandleNV );
       }
       return handle;
     }
@@ -12226,9 +14550,9 @@ namespace VULKAN_HPP_NAMESPACE
                                       static_cast<VkDeviceSize>( size ),
                                       static_cast<VkMemoryMapFlags>( flags ),
                                       &pData ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DeviceMemory::mapMemory" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eMapMemory );
       }
       return pData;
     }
@@ -12248,9 +14572,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkAcquireWinrtDisplayNV(
           static_cast<VkPhysicalDevice>( m_physicalDevice ), static_cast<VkDisplayKHR>( m_displayKHR ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DisplayKHR::acquireWinrtNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquireWinrtDisplayNV );
       }
     }
 #  endif /*VK_USE_PLATFORM_WIN32_KHR*/
@@ -12287,9 +14611,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DisplayKHR::getModeProperties2" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDisplayModeProperties2KHR );
       }
       return properties;
     }
@@ -12325,9 +14649,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         properties.resize( propertyCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DisplayKHR::getModeProperties" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDisplayModePropertiesKHR );
       }
       return properties;
     }
@@ -12345,9 +14669,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDisplayModeKHR>( m_displayModeKHR ),
           planeIndex,
           reinterpret_cast<VkDisplayPlaneCapabilitiesKHR *>( &capabilities ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::DisplayModeKHR::getDisplayPlaneCapabilities" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetDisplayPlaneCapabilitiesKHR );
       }
       return capabilities;
     }
@@ -12356,10 +14680,10 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkGetEventStatus( static_cast<VkDevice>( m_device ), static_cast<VkEvent>( m_event ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eEventSet ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eEventReset ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eEventSet ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eEventReset ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Event::getStatus" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetEventStatus );
       }
       return result;
     }
@@ -12368,9 +14692,9 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkResetEvent( static_cast<VkDevice>( m_device ), static_cast<VkEvent>( m_event ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Event::reset" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eResetEvent );
       }
     }
 
@@ -12378,9 +14702,9 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkSetEvent( static_cast<VkDevice>( m_device ), static_cast<VkEvent>( m_event ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Event::set" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eSetEvent );
       }
     }
 
@@ -12388,10 +14712,10 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkGetFenceStatus( static_cast<VkDevice>( m_device ), static_cast<VkFence>( m_fence ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Fence::getStatus" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetFenceStatus );
       }
       return result;
     }
@@ -12404,9 +14728,9 @@ namespace VULKAN_HPP_NAMESPACE
                                             static_cast<VkImage>( m_image ),
                                             static_cast<VkDeviceMemory>( memory ),
                                             static_cast<VkDeviceSize>( memoryOffset ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Image::bindMemory" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBindImageMemory );
       }
     }
 
@@ -12423,9 +14747,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkImage>( m_image ),
           reinterpret_cast<VkImageDrmFormatModifierPropertiesEXT *>( &properties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Image::getDrmFormatModifierPropertiesEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetImageDrmFormatModifierPropertiesEXT );
       }
       return properties;
     }
@@ -12480,9 +14804,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkImageView>( m_imageView ),
           reinterpret_cast<VkImageViewAddressPropertiesNVX *>( &properties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::ImageView::getAddressNVX" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetImageViewAddressNVX );
       }
       return properties;
     }
@@ -12511,9 +14835,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         data.resize( dataSize );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PipelineCache::getData" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPipelineCacheData );
       }
       return data;
     }
@@ -12526,9 +14850,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                 static_cast<VkPipelineCache>( m_pipelineCache ),
                                                 srcCaches.size(),
                                                 reinterpret_cast<const VkPipelineCache *>( srcCaches.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::PipelineCache::merge" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eMergePipelineCaches );
       }
     }
 
@@ -12540,9 +14864,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkCompileDeferredNV(
           static_cast<VkDevice>( m_device ), static_cast<VkPipeline>( m_pipeline ), shader ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Pipeline::compileDeferredNV" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eCompileDeferredNV );
       }
     }
 
@@ -12563,10 +14887,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                                             groupCount,
                                                                             data.size() * sizeof( T ),
                                                                             reinterpret_cast<void *>( data.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException(
-          result, VULKAN_HPP_NAMESPACE_STRING "::Pipeline::getRayTracingCaptureReplayShaderGroupHandlesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetRayTracingCaptureReplayShaderGroupHandlesKHR );
       }
       return data;
     }
@@ -12583,10 +14906,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                                             groupCount,
                                                                             sizeof( T ),
                                                                             reinterpret_cast<void *>( &data ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException(
-          result, VULKAN_HPP_NAMESPACE_STRING "::Pipeline::getRayTracingCaptureReplayShaderGroupHandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetRayTracingCaptureReplayShaderGroupHandlesKHR );
       }
       return data;
     }
@@ -12608,9 +14930,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                                groupCount,
                                                                data.size() * sizeof( T ),
                                                                reinterpret_cast<void *>( data.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandlesKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetRayTracingShaderGroupHandlesKHR );
       }
       return data;
     }
@@ -12626,9 +14948,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                                groupCount,
                                                                sizeof( T ),
                                                                reinterpret_cast<void *>( &data ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Pipeline::getRayTracingShaderGroupHandleKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetRayTracingShaderGroupHandlesKHR );
       }
       return data;
     }
@@ -12684,9 +15006,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         info.resize( infoSize );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Pipeline::getShaderInfoAMD" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetShaderInfoAMD );
       }
       return info;
     }
@@ -12710,10 +15032,10 @@ namespace VULKAN_HPP_NAMESPACE
                                                                      reinterpret_cast<void *>( data.data() ),
                                                                      static_cast<VkDeviceSize>( stride ),
                                                                      static_cast<VkQueryResultFlags>( flags ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::QueryPool::getResults" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetQueryPoolResults );
       }
       return std::make_pair( result, data );
     }
@@ -12735,10 +15057,10 @@ namespace VULKAN_HPP_NAMESPACE
                                                                      reinterpret_cast<void *>( &data ),
                                                                      static_cast<VkDeviceSize>( stride ),
                                                                      static_cast<VkQueryResultFlags>( flags ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::QueryPool::getResult" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetQueryPoolResults );
       }
       return std::make_pair( result, data );
     }
@@ -12800,9 +15122,9 @@ namespace VULKAN_HPP_NAMESPACE
                                             bindInfo.size(),
                                             reinterpret_cast<const VkBindSparseInfo *>( bindInfo.data() ),
                                             static_cast<VkFence>( fence ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::bindSparse" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eQueueBindSparse );
       }
     }
 
@@ -12833,10 +15155,10 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkQueuePresentKHR(
           static_cast<VkQueue>( m_queue ), reinterpret_cast<const VkPresentInfoKHR *>( &presentInfo ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::presentKHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eQueuePresentKHR );
       }
       return result;
     }
@@ -12851,9 +15173,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkQueueSetPerformanceConfigurationINTEL(
           static_cast<VkQueue>( m_queue ), static_cast<VkPerformanceConfigurationINTEL>( configuration ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::setPerformanceConfigurationINTEL" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eQueueSetPerformanceConfigurationINTEL );
       }
     }
 
@@ -12865,9 +15187,9 @@ namespace VULKAN_HPP_NAMESPACE
                                         submits.size(),
                                         reinterpret_cast<const VkSubmitInfo *>( submits.data() ),
                                         static_cast<VkFence>( fence ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::submit" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eQueueSubmit );
       }
     }
 
@@ -12882,9 +15204,9 @@ namespace VULKAN_HPP_NAMESPACE
                                             submits.size(),
                                             reinterpret_cast<const VkSubmitInfo2KHR *>( submits.data() ),
                                             static_cast<VkFence>( fence ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::submit2KHR" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eQueueSubmit2KHR );
       }
     }
 
@@ -12892,9 +15214,9 @@ namespace VULKAN_HPP_NAMESPACE
     {
       VULKAN_HPP_NAMESPACE::Result result = static_cast<VULKAN_HPP_NAMESPACE::Result>(
         getDispatcher()->vkQueueWaitIdle( static_cast<VkQueue>( m_queue ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Queue::waitIdle" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eQueueWaitIdle );
       }
     }
 
@@ -12914,9 +15236,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkGetSemaphoreCounterValue(
           static_cast<VkDevice>( m_device ), static_cast<VkSemaphore>( m_semaphore ), &value ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::Semaphore::getCounterValue" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSemaphoreCounterValue );
       }
       return value;
     }
@@ -12931,9 +15253,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkAcquireFullScreenExclusiveModeEXT(
           static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::acquireFullScreenExclusiveModeEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquireFullScreenExclusiveModeEXT );
       }
     }
 #  endif /*VK_USE_PLATFORM_WIN32_KHR*/
@@ -12954,12 +15276,12 @@ namespace VULKAN_HPP_NAMESPACE
                                                 static_cast<VkSemaphore>( semaphore ),
                                                 static_cast<VkFence>( fence ),
                                                 &imageIndex ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eTimeout ) &&
            ( result != VULKAN_HPP_NAMESPACE::Result::eNotReady ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) )
+           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::acquireNextImage" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eAcquireNextImageKHR );
       }
       return std::make_pair( result, imageIndex );
     }
@@ -12997,9 +15319,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         presentationTimings.resize( presentationTimingCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::getPastPresentationTimingGOOGLE" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetPastPresentationTimingGOOGLE );
       }
       return presentationTimings;
     }
@@ -13017,9 +15339,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkSwapchainKHR>( m_swapchainKHR ),
           reinterpret_cast<VkRefreshCycleDurationGOOGLE *>( &displayTimingProperties ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::getRefreshCycleDurationGOOGLE" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetRefreshCycleDurationGOOGLE );
       }
       return displayTimingProperties;
     }
@@ -13036,9 +15358,9 @@ namespace VULKAN_HPP_NAMESPACE
                                                    static_cast<VkSwapchainKHR>( m_swapchainKHR ),
                                                    static_cast<VkSurfaceCounterFlagBitsEXT>( counter ),
                                                    &counterValue ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::getCounterEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSwapchainCounterEXT );
       }
       return counterValue;
     }
@@ -13073,9 +15395,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         swapchainImages.resize( swapchainImageCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::getImages" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSwapchainImagesKHR );
       }
       return swapchainImages;
     }
@@ -13089,10 +15411,10 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkGetSwapchainStatusKHR(
           static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ) ) );
-      if ( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
-           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) )
+      if ( VULKAN_HPP_UNLIKELY( ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) &&
+           ( result != VULKAN_HPP_NAMESPACE::Result::eSuboptimalKHR ) ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::getStatus" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetSwapchainStatusKHR );
       }
       return result;
     }
@@ -13107,9 +15429,9 @@ namespace VULKAN_HPP_NAMESPACE
       VULKAN_HPP_NAMESPACE::Result result =
         static_cast<VULKAN_HPP_NAMESPACE::Result>( getDispatcher()->vkReleaseFullScreenExclusiveModeEXT(
           static_cast<VkDevice>( m_device ), static_cast<VkSwapchainKHR>( m_swapchainKHR ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::SwapchainKHR::releaseFullScreenExclusiveModeEXT" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eReleaseFullScreenExclusiveModeEXT );
       }
     }
 #  endif /*VK_USE_PLATFORM_WIN32_KHR*/
@@ -13155,9 +15477,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         data.resize( dataSize );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::ValidationCacheEXT::getData" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetValidationCacheDataEXT );
       }
       return data;
     }
@@ -13174,9 +15496,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkValidationCacheEXT>( m_validationCacheEXT ),
           srcCaches.size(),
           reinterpret_cast<const VkValidationCacheEXT *>( srcCaches.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::ValidationCacheEXT::merge" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eMergeValidationCachesEXT );
       }
     }
 
@@ -13193,9 +15515,9 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkVideoSessionKHR>( m_videoSessionKHR ),
           videoSessionBindMemories.size(),
           reinterpret_cast<const VkVideoBindMemoryKHR *>( videoSessionBindMemories.data() ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::VideoSessionKHR::bindMemory" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eBindVideoSessionMemoryKHR );
       }
     }
 #  endif /*VK_ENABLE_BETA_EXTENSIONS*/
@@ -13234,9 +15556,9 @@ namespace VULKAN_HPP_NAMESPACE
       {
         videoSessionMemoryRequirements.resize( videoSessionMemoryRequirementsCount );
       }
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::VideoSessionKHR::getMemoryRequirements" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eGetVideoSessionMemoryRequirementsKHR );
       }
       return videoSessionMemoryRequirements;
     }
@@ -13254,13 +15576,389 @@ namespace VULKAN_HPP_NAMESPACE
           static_cast<VkDevice>( m_device ),
           static_cast<VkVideoSessionParametersKHR>( m_videoSessionParametersKHR ),
           reinterpret_cast<const VkVideoSessionParametersUpdateInfoKHR *>( &updateInfo ) ) );
-      if ( result != VULKAN_HPP_NAMESPACE::Result::eSuccess )
+      if ( VULKAN_HPP_UNLIKELY( result != VULKAN_HPP_NAMESPACE::Result::eSuccess ) )
       {
-        throwResultException( result, VULKAN_HPP_NAMESPACE_STRING "::VideoSessionParametersKHR::update" );
+        throwResultException( result, VULKAN_HPP_NAMESPACE::CommandId::eUpdateVideoSessionParametersKHR );
       }
     }
 #  endif /*VK_ENABLE_BETA_EXTENSIONS*/
 
+    // appends the deep key of a value to key, and returns false if the value can't be keyed, like a structure with a
+    // pNext chain; plain values like enums, flags, handles, and numbers are keyed by their bits, the structures
+    // reachable from the create info of an interned handle type have a specialization
+    template <typename T>
+    struct InterningKey
+    {
+      static bool append( std::vector<uint64_t> & key, T const & value )
+      {
+        static_assert( sizeof( T ) <= sizeof( uint64_t ), "a structure needs a specialization of InterningKey" );
+        uint64_t word = 0;
+        memcpy( &word, &value, sizeof( T ) );
+        key.push_back( word );
+        return true;
+      }
+    };
+
+    template <typename T>
+    bool appendInterningKey( std::vector<uint64_t> & key, T const & value )
+    {
+      return InterningKey<T>::append( key, value );
+    }
+
+    // an array is keyed by whether it's there and by its elements, not by its address
+    template <typename T>
+    bool appendInterningKey( std::vector<uint64_t> & key, T const * values, uint32_t count )
+    {
+      key.push_back( values ? 1 : 0 );
+      bool keyed = true;
+      for ( uint32_t i = 0; keyed && values && ( i < count ); i++ )
+      {
+        keyed = InterningKey<T>::append( key, values[i] );
+      }
+      return keyed;
+    }
+
+    // A get-or-create cache for the handles with an immutable create info: equal create infos give the same, shared
+    // handle, even if their arrays are at different addresses. A hit is lock-free, a miss creates the handle under a
+    // mutex. A create info with a pNext chain is not keyed, and always gives a new handle of its own. The pointers in a
+    // create info are followed as given, so the ones Vulkan would ignore must be null. As the hits don't lock, trim and
+    // clear must not run while any other thread is in get. The cache must not outlive its device, while the handles it
+    // handed out might outlive the cache.
+    template <typename HandleType, typename CreateInfoType>
+    class InterningCache
+    {
+    public:
+      struct Statistics
+      {
+        size_t size;      // number of handles currently cached
+        size_t hits;      // number of gets that found their handle
+        size_t misses;    // number of gets that created a cached handle
+        size_t uncached;  // number of gets that created a handle of its own, as its create info could not be keyed
+      };
+
+    public:
+      // the bucket index is taken from the lower bits of the hash, so bucketCount is a power of two
+      explicit InterningCache( VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const & device,
+                               size_t                                                          bucketCount = 64 )
+        : m_device( &device ), m_buckets( bucketCount ), m_size( 0 ), m_hits( 0 ), m_misses( 0 ), m_uncached( 0 )
+      {
+        VULKAN_HPP_ASSERT( ( 0 < bucketCount ) && ( ( bucketCount & ( bucketCount - 1 ) ) == 0 ) );
+        for ( auto & bucket : m_buckets )
+        {
+          bucket.store( nullptr, std::memory_order_relaxed );
+        }
+      }
+
+      InterningCache( InterningCache const & )             = delete;
+      InterningCache & operator=( InterningCache const & ) = delete;
+
+      ~InterningCache()
+      {
+        clear();
+      }
+
+      std::shared_ptr<HandleType const> get( CreateInfoType const & createInfo )
+      {
+        // the keys are built in a buffer per thread, such that a hit doesn't allocate
+        static thread_local std::vector<uint64_t> key;
+        key.clear();
+        if ( !appendInterningKey( key, createInfo ) )
+        {
+          m_uncached.fetch_add( 1, std::memory_order_relaxed );
+          return std::make_shared<HandleType>( *m_device, createInfo );
+        }
+
+        size_t                 hash = hashKey( key );
+        std::atomic<Entry *> & head = m_buckets[hash & ( m_buckets.size() - 1 )];
+        if ( Entry const * entry = find( head.load( std::memory_order_acquire ), hash, key ) )
+        {
+          m_hits.fetch_add( 1, std::memory_order_relaxed );
+          return entry->handle;
+        }
+
+        std::lock_guard<std::mutex> lock( m_mutex );
+        if ( Entry const * entry = find( head.load( std::memory_order_relaxed ), hash, key ) )
+        {
+          // another thread created it meanwhile
+          m_hits.fetch_add( 1, std::memory_order_relaxed );
+          return entry->handle;
+        }
+
+        // the entry is completely set up before it's published to the readers
+        std::unique_ptr<Entry> entry( new Entry );
+        entry->key    = key;
+        entry->hash   = hash;
+        entry->handle = std::make_shared<HandleType>( *m_device, createInfo );
+        entry->next.store( head.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+        head.store( entry.get(), std::memory_order_release );
+        m_size++;
+        m_misses.fetch_add( 1, std::memory_order_relaxed );
+        return entry.release()->handle;
+      }
+
+      // destroys the cached handles nobody else holds any more, and returns their number; no other thread may be in get
+      // meanwhile, as a lock-free hit could take a handle just found unused, or still stand on its entry
+      size_t trim()
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        size_t                      trimmed = 0;
+        for ( auto & bucket : m_buckets )
+        {
+          std::atomic<Entry *> * link = &bucket;
+          while ( Entry * entry = link->load( std::memory_order_relaxed ) )
+          {
+            if ( entry->handle.use_count() == 1 )
+            {
+              link->store( entry->next.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+              delete entry;
+              trimmed++;
+            }
+            else
+            {
+              link = &entry->next;
+            }
+          }
+        }
+        m_size -= trimmed;
+        return trimmed;
+      }
+
+      // releases all the cached handles; no other thread may use the cache meanwhile
+      void clear()
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        for ( auto & bucket : m_buckets )
+        {
+          Entry * entry = bucket.exchange( nullptr, std::memory_order_relaxed );
+          while ( entry )
+          {
+            Entry * next = entry->next.load( std::memory_order_relaxed );
+            delete entry;
+            entry = next;
+          }
+        }
+        m_size = 0;
+      }
+
+      Statistics getStatistics() const
+      {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        Statistics                  statistics;
+        statistics.size     = m_size;
+        statistics.hits     = m_hits.load( std::memory_order_relaxed );
+        statistics.misses   = m_misses.load( std::memory_order_relaxed );
+        statistics.uncached = m_uncached.load( std::memory_order_relaxed );
+        return statistics;
+      }
+
+    private:
+      struct Entry
+      {
+        std::vector<uint64_t>             key;
+        size_t                            hash;
+        std::shared_ptr<HandleType const> handle;
+        std::atomic<Entry *>              next;
+      };
+
+      static Entry const * find( Entry const * entry, size_t hash, std::vector<uint64_t> const & key )
+      {
+        while ( entry && ( ( entry->hash != hash ) || ( entry->key != key ) ) )
+        {
+          entry = entry->next.load( std::memory_order_acquire );
+        }
+        return entry;
+      }
+
+      static size_t hashKey( std::vector<uint64_t> const & key ) VULKAN_HPP_NOEXCEPT
+      {
+        // FNV-1a over the words of the key
+        uint64_t hash = 14695981039346656037ull;
+        for ( auto word : key )
+        {
+          hash = ( hash ^ word ) * 1099511628211ull;
+        }
+        return static_cast<size_t>( hash ^ ( hash >> 32 ) );
+      }
+
+    private:
+      VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Device const * m_device;
+      std::vector<std::atomic<Entry *>>                               m_buckets;
+      mutable std::mutex                                              m_mutex;  // guards all changes of the buckets
+      size_t                                                          m_size;
+      std::atomic<size_t>                                             m_hits;
+      std::atomic<size_t>                                             m_misses;
+      std::atomic<size_t>                                             m_uncached;
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::DescriptorSetLayoutBinding>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::DescriptorSetLayoutBinding const & value )
+      {
+        return appendInterningKey( key, value.binding ) && appendInterningKey( key, value.descriptorType ) &&
+               appendInterningKey( key, value.descriptorCount ) && appendInterningKey( key, value.stageFlags ) &&
+               appendInterningKey( key, value.pImmutableSamplers, value.descriptorCount );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::DescriptorSetLayoutCreateInfo>
+    {
+      static bool append( std::vector<uint64_t> &                                     key,
+                          VULKAN_HPP_NAMESPACE::DescriptorSetLayoutCreateInfo const & value )
+      {
+        return !value.pNext && appendInterningKey( key, value.flags ) &&
+               appendInterningKey( key, value.bindingCount ) &&
+               appendInterningKey( key, value.pBindings, value.bindingCount );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::PushConstantRange>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::PushConstantRange const & value )
+      {
+        return appendInterningKey( key, value.stageFlags ) && appendInterningKey( key, value.offset ) &&
+               appendInterningKey( key, value.size );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::PipelineLayoutCreateInfo>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::PipelineLayoutCreateInfo const & value )
+      {
+        return !value.pNext && appendInterningKey( key, value.flags ) &&
+               appendInterningKey( key, value.setLayoutCount ) &&
+               appendInterningKey( key, value.pSetLayouts, value.setLayoutCount ) &&
+               appendInterningKey( key, value.pushConstantRangeCount ) &&
+               appendInterningKey( key, value.pPushConstantRanges, value.pushConstantRangeCount );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::AttachmentDescription>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::AttachmentDescription const & value )
+      {
+        return appendInterningKey( key, value.flags ) && appendInterningKey( key, value.format ) &&
+               appendInterningKey( key, value.samples ) && appendInterningKey( key, value.loadOp ) &&
+               appendInterningKey( key, value.storeOp ) && appendInterningKey( key, value.stencilLoadOp ) &&
+               appendInterningKey( key, value.stencilStoreOp ) && appendInterningKey( key, value.initialLayout ) &&
+               appendInterningKey( key, value.finalLayout );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::AttachmentReference>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::AttachmentReference const & value )
+      {
+        return appendInterningKey( key, value.attachment ) && appendInterningKey( key, value.layout );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::SubpassDescription>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::SubpassDescription const & value )
+      {
+        return appendInterningKey( key, value.flags ) && appendInterningKey( key, value.pipelineBindPoint ) &&
+               appendInterningKey( key, value.inputAttachmentCount ) &&
+               appendInterningKey( key, value.pInputAttachments, value.inputAttachmentCount ) &&
+               appendInterningKey( key, value.colorAttachmentCount ) &&
+               appendInterningKey( key, value.pColorAttachments, value.colorAttachmentCount ) &&
+               appendInterningKey( key, value.pResolveAttachments, value.colorAttachmentCount ) &&
+               appendInterningKey( key, value.pDepthStencilAttachment, 1 ) &&
+               appendInterningKey( key, value.preserveAttachmentCount ) &&
+               appendInterningKey( key, value.pPreserveAttachments, value.preserveAttachmentCount );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::SubpassDependency>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::SubpassDependency const & value )
+      {
+        return appendInterningKey( key, value.srcSubpass ) && appendInterningKey( key, value.dstSubpass ) &&
+               appendInterningKey( key, value.srcStageMask ) && appendInterningKey( key, value.dstStageMask ) &&
+               appendInterningKey( key, value.srcAccessMask ) && appendInterningKey( key, value.dstAccessMask ) &&
+               appendInterningKey( key, value.dependencyFlags );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::RenderPassCreateInfo>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::RenderPassCreateInfo const & value )
+      {
+        return !value.pNext && appendInterningKey( key, value.flags ) &&
+               appendInterningKey( key, value.attachmentCount ) &&
+               appendInterningKey( key, value.pAttachments, value.attachmentCount ) &&
+               appendInterningKey( key, value.subpassCount ) &&
+               appendInterningKey( key, value.pSubpasses, value.subpassCount ) &&
+               appendInterningKey( key, value.dependencyCount ) &&
+               appendInterningKey( key, value.pDependencies, value.dependencyCount );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::SamplerCreateInfo>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::SamplerCreateInfo const & value )
+      {
+        return !value.pNext && appendInterningKey( key, value.flags ) && appendInterningKey( key, value.magFilter ) &&
+               appendInterningKey( key, value.minFilter ) && appendInterningKey( key, value.mipmapMode ) &&
+               appendInterningKey( key, value.addressModeU ) && appendInterningKey( key, value.addressModeV ) &&
+               appendInterningKey( key, value.addressModeW ) && appendInterningKey( key, value.mipLodBias ) &&
+               appendInterningKey( key, value.anisotropyEnable ) && appendInterningKey( key, value.maxAnisotropy ) &&
+               appendInterningKey( key, value.compareEnable ) && appendInterningKey( key, value.compareOp ) &&
+               appendInterningKey( key, value.minLod ) && appendInterningKey( key, value.maxLod ) &&
+               appendInterningKey( key, value.borderColor ) && appendInterningKey( key, value.unnormalizedCoordinates );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::ComponentMapping>
+    {
+      static bool append( std::vector<uint64_t> & key, VULKAN_HPP_NAMESPACE::ComponentMapping const & value )
+      {
+        return appendInterningKey( key, value.r ) && appendInterningKey( key, value.g ) &&
+               appendInterningKey( key, value.b ) && appendInterningKey( key, value.a );
+      }
+    };
+
+    template <>
+    struct InterningKey<VULKAN_HPP_NAMESPACE::SamplerYcbcrConversionCreateInfo>
+    {
+      static bool append( std::vector<uint64_t> &                                        key,
+                          VULKAN_HPP_NAMESPACE::SamplerYcbcrConversionCreateInfo const & value )
+      {
+        return !value.pNext && appendInterningKey( key, value.format ) && appendInterningKey( key, value.ycbcrModel ) &&
+               appendInterningKey( key, value.ycbcrRange ) && appendInterningKey( key, value.components ) &&
+               appendInterningKey( key, value.xChromaOffset ) && appendInterningKey( key, value.yChromaOffset ) &&
+               appendInterningKey( key, value.chromaFilter ) &&
+               appendInterningKey( key, value.forceExplicitReconstruction );
+      }
+    };
+
+    using DescriptorSetLayoutInterningCache =
+      InterningCache<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::DescriptorSetLayout,
+                     VULKAN_HPP_NAMESPACE::DescriptorSetLayoutCreateInfo>;
+
+    using PipelineLayoutInterningCache = InterningCache<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::PipelineLayout,
+                                                        VULKAN_HPP_NAMESPACE::PipelineLayoutCreateInfo>;
+
+    using RenderPassInterningCache = InterningCache<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::RenderPass,
+                                                    VULKAN_HPP_NAMESPACE::RenderPassCreateInfo>;
+
+    using SamplerInterningCache =
+      InterningCache<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::Sampler, VULKAN_HPP_NAMESPACE::SamplerCreateInfo>;
+
+    using SamplerYcbcrConversionInterningCache =
+      InterningCache<VULKAN_HPP_NAMESPACE::VULKAN_HPP_RAII_NAMESPACE::SamplerYcbcrConversion,
+                     VULKAN_HPP_NAMESPACE::SamplerYcbcrConversionCreateInfo>;
+
 #endif
   }  // namespace VULKAN_HPP_RAII_NAMESPACE
 }  // namespace VULKAN_HPP_NAMESPACE